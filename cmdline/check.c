@@ -27,6 +27,7 @@
 #include "handle.h"
 #include "raid/raid.h"
 #include "raid/combo.h"
+#include "raidmt.h"
 
 /****************************************************************************/
 /* check */
@@ -132,7 +133,7 @@ static int is_hash_matching(struct snapraid_state* state, int rehash, unsigned d
 
 	/* if we checked something, and no block failed the check */
 	/* recompute all the redundancy information */
-	raid_gen(diskmax, state->level, state->block_size, buffer);
+	raidmt_gen(diskmax, state->level, state->block_size, buffer);
 	return 1;
 }
 
@@ -142,12 +143,12 @@ static int is_hash_matching(struct snapraid_state* state, int rehash, unsigned d
 static int is_parity_matching(struct snapraid_state* state, unsigned diskmax, unsigned i, void** buffer, void** buffer_recov)
 {
 	/* recompute parity, note that we don't need parity over i */
-	raid_gen(diskmax, i + 1, state->block_size, buffer);
+	raidmt_gen(diskmax, i + 1, state->block_size, buffer);
 
 	/* if the recovered parity block matches */
 	if (memcmp(buffer[diskmax + i], buffer_recov[i], state->block_size) == 0) {
 		/* recompute all the redundancy information */
-		raid_gen(diskmax, state->level, state->block_size, buffer);
+		raidmt_gen(diskmax, state->level, state->block_size, buffer);
 		return 1;
 	}
 
@@ -171,7 +172,7 @@ static int repair_step(struct snapraid_state* state, int rehash, unsigned pos, u
 	if (failed_count == 0) {
 		/* LCOV_EXCL_START */
 		/* recompute only the parity */
-		raid_gen(diskmax, state->level, state->block_size, buffer);
+		raidmt_gen(diskmax, state->level, state->block_size, buffer);
 		return 0;
 		/* LCOV_EXCL_STOP */
 	}
@@ -217,7 +218,7 @@ static int repair_step(struct snapraid_state* state, int rehash, unsigned pos, u
 				memcpy(buffer[diskmax + ip[i]], buffer_recov[ip[i]], state->block_size);
 
 			/* recover using one less parity, the ip[r-1] one */
-			raid_data(r - 1, id, ip, diskmax, state->block_size, buffer);
+			raidmt_data(r - 1, id, ip, diskmax, state->block_size, buffer);
 
 			/* use the remaining ip[r-1] parity to check the result */
 			if (is_parity_matching(state, diskmax, ip[r - 1], buffer, buffer_recov))
@@ -257,7 +258,7 @@ static int repair_step(struct snapraid_state* state, int rehash, unsigned pos, u
 				memcpy(buffer[diskmax + ip[i]], buffer_recov[ip[i]], state->block_size);
 
 			/* recover */
-			raid_data(r, id, ip, diskmax, state->block_size, buffer);
+			raidmt_data(r, id, ip, diskmax, state->block_size, buffer);
 
 			/* use the hash to check the result */
 			if (is_hash_matching(state, rehash, diskmax, failed, failed_map, failed_count, buffer, buffer_zero))
@@ -298,7 +299,7 @@ static int repair(struct snapraid_state* state, int rehash, unsigned pos, unsign
 
 	/* if nothing failed, just recompute the parity */
 	if (failed_count == 0) {
-		raid_gen(diskmax, state->level, state->block_size, buffer);
+		raidmt_gen(diskmax, state->level, state->block_size, buffer);
 		return 0;
 	}
 
@@ -392,7 +393,7 @@ static int repair(struct snapraid_state* state, int rehash, unsigned pos, unsign
 		log_tag("recover_sync:%u:%u: Skipped for already recovered\n", pos, n);
 
 		/* recompute only the parity */
-		raid_gen(diskmax, state->level, state->block_size, buffer);
+		raidmt_gen(diskmax, state->level, state->block_size, buffer);
 		return 0;
 	}
 
@@ -847,6 +848,143 @@ static int block_is_enabled(struct snapraid_state* state, block_off_t i, struct
 	return 0;
 }
 
+/**
+ * Range of parity positions to process.
+ */
+struct check_range {
+	block_off_t begin; /**< First position. */
+	block_off_t end; /**< Position after the last one. */
+};
+
+static int check_range_compare(const void* void_a, const void* void_b)
+{
+	const struct check_range* a = void_a;
+	const struct check_range* b = void_b;
+
+	if (a->begin < b->begin)
+		return -1;
+	if (a->begin > b->begin)
+		return 1;
+	return 0;
+}
+
+/**
+ * Collect the sorted ranges of parity positions used by the files not excluded.
+ *
+ * If all the parity is excluded by the filters, only the blocks of the
+ * selected files have to be processed, and the ranges allow to skip
+ * all the other positions without visiting them.
+ *
+ * Note that the skipped positions don't need any post processing,
+ * as the files using them are excluded, and then never written.
+ * Excluded files are still opened and read at the visited positions,
+ * when their blocks are needed to reconstruct the selected ones,
+ * and if their last block falls in a skipped position, they are closed
+ * when the handle switches to another file, or at the end of the process.
+ *
+ * Return 0 if all the positions have to be visited.
+ */
+static struct check_range* check_range_collect(struct snapraid_state* state, struct snapraid_handle* handle, unsigned diskmax, block_off_t blockstart, block_off_t blockmax, tommy_size_t* range_max)
+{
+	struct check_range* range_map;
+	tommy_size_t count;
+	tommy_size_t i;
+	tommy_size_t k;
+	unsigned j;
+	unsigned l;
+
+	/* if a parity is not excluded, all the blocks are included */
+	for (l = 0; l < state->level; ++l) {
+		if (!state->parity[l].is_excluded_by_filter)
+			return 0;
+	}
+
+	/* count the extents */
+	count = 0;
+	for (j = 0; j < diskmax; ++j) {
+		if (!handle[j].disk)
+			continue;
+
+		fs_index_build(handle[j].disk);
+
+		count += handle[j].disk->fs_index->count;
+	}
+
+	range_map = malloc_nofail((count + 1) * sizeof(struct check_range));
+
+	/* insert the extents of the files not excluded */
+	count = 0;
+	for (j = 0; j < diskmax; ++j) {
+		const struct snapraid_extent_index* index;
+
+		if (!handle[j].disk)
+			continue;
+
+		index = handle[j].disk->fs_index;
+		for (i = 0; i < index->count; ++i) {
+			const struct snapraid_extent_entry* entry = &index->parity_vec[i];
+			block_off_t begin = entry->parity_pos;
+			block_off_t end = entry->parity_pos + entry->count;
+
+			if (file_flag_has(entry->file, FILE_IS_EXCLUDED))
+				continue;
+
+			if (begin < blockstart)
+				begin = blockstart;
+			if (end > blockmax)
+				end = blockmax;
+			if (begin >= end)
+				continue;
+
+			range_map[count].begin = begin;
+			range_map[count].end = end;
+			++count;
+		}
+	}
+
+	qsort(range_map, count, sizeof(struct check_range), check_range_compare);
+
+	/* merge the overlapping and adjacent ranges */
+	k = 0;
+	for (i = 0; i < count; ++i) {
+		if (k != 0 && range_map[i].begin <= range_map[k - 1].end) {
+			if (range_map[i].end > range_map[k - 1].end)
+				range_map[k - 1].end = range_map[i].end;
+		} else {
+			range_map[k++] = range_map[i];
+		}
+	}
+
+	*range_max = k;
+
+	return range_map;
+}
+
+/**
+ * Get the first position to process, starting from ::i.
+ *
+ * It returns a position not lower than ::i contained in the ranges,
+ * or ::blockmax if none.
+ */
+static block_off_t check_range_next(struct check_range* range_map, tommy_size_t range_max, tommy_size_t* range_pos, block_off_t i, block_off_t blockmax)
+{
+	/* without ranges, all the positions are processed */
+	if (!range_map)
+		return i;
+
+	/* skip the ranges already processed */
+	while (*range_pos < range_max && range_map[*range_pos].end <= i)
+		++*range_pos;
+
+	if (*range_pos == range_max)
+		return blockmax;
+
+	if (i < range_map[*range_pos].begin)
+		i = range_map[*range_pos].begin;
+
+	return i;
+}
+
 static int state_check_process(struct snapraid_state* state, int fix, struct snapraid_parity_handle** parity, block_off_t blockstart, block_off_t blockmax)
 {
 	struct snapraid_handle* handle;
@@ -865,12 +1003,19 @@ static int state_check_process(struct snapraid_state* state, int fix, struct sna
 	unsigned recovered_error;
 	struct failed_struct* failed;
 	unsigned* failed_map;
+	struct check_range* range_map;
+	tommy_size_t range_max;
+	tommy_size_t range_pos;
 	unsigned l;
 	char esc_buffer[ESC_MAX];
 	char esc_buffer_alt[ESC_MAX];
 
 	handle = handle_mapping(state, &diskmax);
 
+	/* if filtering, get the positions used by the selected files */
+	range_max = 0;
+	range_map = check_range_collect(state, handle, diskmax, blockstart, blockmax, &range_max);
+
 	/* we need 1 * data + 2 * parity + 1 * zero */
 	buffermax = diskmax + 2 * state->level + 1;
 
@@ -891,7 +1036,11 @@ static int state_check_process(struct snapraid_state* state, int fix, struct sna
 
 	/* first count the number of blocks to process */
 	countmax = 0;
+	range_pos = 0;
 	for (i = blockstart; i < blockmax; ++i) {
+		i = check_range_next(range_map, range_max, &range_pos, i, blockmax);
+		if (i == blockmax)
+			break;
 		if (!block_is_enabled(state, i, handle, diskmax))
 			continue;
 		++countmax;
@@ -900,6 +1049,7 @@ static int state_check_process(struct snapraid_state* state, int fix, struct sna
 	/* check all the blocks in files */
 	countsize = 0;
 	countpos = 0;
+	range_pos = 0;
 	state_progress_begin(state, blockstart, blockmax, countmax);
 	for (i = blockstart; i < blockmax; ++i) {
 		unsigned failed_count;
@@ -908,6 +1058,11 @@ static int state_check_process(struct snapraid_state* state, int fix, struct sna
 		snapraid_info info;
 		int rehash;
 
+		/* skip the positions not used by the selected files */
+		i = check_range_next(range_map, range_max, &range_pos, i, blockmax);
+		if (i == blockmax)
+			break;
+
 		if (!block_is_enabled(state, i, handle, diskmax)) {
 			/* post process the files */
 			ret = file_post(state, fix, i, handle, diskmax);
@@ -1906,6 +2061,7 @@ bail:
 
 	free(failed);
 	free(failed_map);
+	free(range_map);
 	free(handle);
 	free(buffer_alloc);
 	free(buffer);
@@ -59,7 +59,7 @@ static void dry_data_reader(struct snapraid_worker* worker, struct snapraid_task
 	}
 
 	/* get the block */
-	task->block = fs_par2block_find(disk, blockcur);
+	task->block = fs_par2block_find_cursor(disk, &worker->cursor, blockcur);
 
 	/* if the block is not used */
 	if (!block_has_file(task->block)) {
@@ -70,7 +70,7 @@ static void dry_data_reader(struct snapraid_worker* worker, struct snapraid_task
 	}
 
 	/* get the file of this block */
-	task->file = fs_par2file_get(disk, blockcur, &task->file_pos);
+	task->file = fs_par2file_get_cursor(disk, &worker->cursor, blockcur, &task->file_pos);
 
 	/* if the file is different than the current one, close it */
 	if (handle->file != 0 && handle->file != task->file) {
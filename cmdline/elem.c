@@ -20,6 +20,7 @@
 #include "elem.h"
 #include "support.h"
 #include "util.h"
+#include "hashstore.h"
 
 /****************************************************************************/
 /* snapraid */
@@ -358,15 +359,25 @@ int filter_content(tommy_list* contentlist, const char* path)
 		pathprint(tmp, sizeof(tmp), "%s.lock", content->content);
 		if (pathcmp(tmp, path) == 0)
 			return -1;
+
+		/* exclude also the change journal, and its position */
+		pathprint(tmp, sizeof(tmp), "%s.journal", content->content);
+		if (pathcmp(tmp, path) == 0)
+			return -1;
+		pathprint(tmp, sizeof(tmp), "%s.journal.pos", content->content);
+		if (pathcmp(tmp, path) == 0)
+			return -1;
+		pathprint(tmp, sizeof(tmp), "%s.journal.pos.tmp", content->content);
+		if (pathcmp(tmp, path) == 0)
+			return -1;
 	}
 
 	return 0;
 }
 
-struct snapraid_file* file_alloc(unsigned block_size, const char* sub, data_off_t size, uint64_t mtime_sec, int mtime_nsec, uint64_t inode, uint64_t physical)
+struct snapraid_file* file_alloc_blockvec(unsigned block_size, const char* sub, data_off_t size, uint64_t mtime_sec, int mtime_nsec, uint64_t inode, uint64_t physical, void* blockvec)
 {
 	struct snapraid_file* file;
-	block_off_t i;
 
 	file = malloc_nofail(sizeof(struct snapraid_file));
 	file->sub = strdup_nofail(sub);
@@ -377,6 +388,17 @@ struct snapraid_file* file_alloc(unsigned block_size, const char* sub, data_off_
 	file->inode = inode;
 	file->physical = physical;
 	file->flag = 0;
+	file->blockvec = blockvec;
+
+	return file;
+}
+
+struct snapraid_file* file_alloc(unsigned block_size, const char* sub, data_off_t size, uint64_t mtime_sec, int mtime_nsec, uint64_t inode, uint64_t physical)
+{
+	struct snapraid_file* file;
+	block_off_t i;
+
+	file = file_alloc_blockvec(block_size, sub, size, mtime_sec, mtime_nsec, inode, physical, 0);
 	file->blockvec = malloc_nofail(file->blockmax * block_sizeof());
 
 	for (i = 0; i < file->blockmax; ++i) {
@@ -418,7 +440,9 @@ void file_free(struct snapraid_file* file)
 {
 	free(file->sub);
 	file->sub = 0;
-	free(file->blockvec);
+	/* the blocks in the hash store are released all together */
+	if (!hashstore_owns(file->blockvec))
+		free(file->blockvec);
 	file->blockvec = 0;
 	free(file);
 }
@@ -645,6 +669,25 @@ void extent_free(struct snapraid_extent* extent)
 	free(extent);
 }
 
+static void extent_index_free(struct snapraid_extent_index* index)
+{
+	if (!index)
+		return;
+
+	free(index->parity_vec);
+	free(index->file_vec);
+	free(index);
+}
+
+static void free_index_free(struct snapraid_free_index* index)
+{
+	if (!index)
+		return;
+
+	free(index->vec);
+	free(index);
+}
+
 int extent_parity_compare(const void* void_a, const void* void_b)
 {
 	const struct snapraid_extent* arg_a = void_a;
@@ -757,9 +800,10 @@ struct snapraid_disk* disk_alloc(const char* name, const char* dir, uint64_t dev
 	disk->tick = 0;
 	disk->cached_blocks = 0;
 	disk->progress_file = 0;
+	disk->open_count = 0;
+	disk->open_cached = 0;
 	disk->total_blocks = 0;
 	disk->free_blocks = 0;
-	disk->first_free_block = 0;
 	disk->has_volatile_inodes = 0;
 	disk->has_volatile_hardlinks = 0;
 	disk->has_unreliable_physical = 0;
@@ -780,6 +824,8 @@ struct snapraid_disk* disk_alloc(const char* name, const char* dir, uint64_t dev
 	tommy_tree_init(&disk->fs_parity, extent_parity_compare);
 	tommy_tree_init(&disk->fs_file, extent_file_compare);
 	disk->fs_last = 0;
+	disk->fs_index = 0;
+	disk->fs_free = 0;
 
 	return disk;
 }
@@ -789,6 +835,8 @@ void disk_free(struct snapraid_disk* disk)
 	tommy_list_foreach(&disk->filelist, (tommy_foreach_func*)file_free);
 	tommy_list_foreach(&disk->deletedlist, (tommy_foreach_func*)file_free);
 	tommy_tree_foreach(&disk->fs_file, (tommy_foreach_func*)extent_free);
+	extent_index_free(disk->fs_index);
+	free_index_free(disk->fs_free);
 	tommy_hashdyn_done(&disk->inodeset);
 	tommy_hashdyn_done(&disk->pathset);
 	tommy_hashdyn_done(&disk->stampset);
@@ -1197,11 +1245,174 @@ static struct snapraid_extent* fs_file2extent_get_unlock(struct snapraid_disk* d
 	return extent;
 }
 
-struct snapraid_file* fs_par2file_find(struct snapraid_disk* disk, block_off_t parity_pos, block_off_t* file_pos)
+struct extent_index_fill {
+	struct snapraid_extent_entry* vec;
+	tommy_size_t count;
+};
+
+static void extent_index_fill_foreach_unlock(void* void_arg, void* void_obj)
+{
+	struct extent_index_fill* arg = void_arg;
+	const struct snapraid_extent* extent = void_obj;
+	struct snapraid_extent_entry* entry = &arg->vec[arg->count++];
+
+	entry->file = extent->file;
+	entry->parity_pos = extent->parity_pos;
+	entry->file_pos = extent->file_pos;
+	entry->count = extent->count;
+}
+
+void fs_index_build(struct snapraid_disk* disk)
+{
+	struct snapraid_extent_index* index;
+	struct extent_index_fill arg;
+
+	fs_lock(disk);
+
+	/* if already built, nothing changed */
+	if (disk->fs_index) {
+		fs_unlock(disk);
+		return;
+	}
+
+	index = malloc_nofail(sizeof(struct snapraid_extent_index));
+	index->count = tommy_tree_count(&disk->fs_parity);
+	index->parity_vec = 0;
+	index->file_vec = 0;
+
+	if (index->count != 0) {
+		index->parity_vec = malloc_nofail(index->count * sizeof(struct snapraid_extent_entry));
+		index->file_vec = malloc_nofail(index->count * sizeof(struct snapraid_extent_entry));
+
+		/* the trees are visited in order */
+		arg.vec = index->parity_vec;
+		arg.count = 0;
+		tommy_tree_foreach_arg(&disk->fs_parity, extent_index_fill_foreach_unlock, &arg);
+
+		arg.vec = index->file_vec;
+		arg.count = 0;
+		tommy_tree_foreach_arg(&disk->fs_file, extent_index_fill_foreach_unlock, &arg);
+	}
+
+	disk->fs_index = index;
+
+	fs_unlock(disk);
+}
+
+/**
+ * Discard the index, as the allocation is going to change.
+ */
+static inline void fs_index_discard_unlock(struct snapraid_disk* disk)
+{
+	extent_index_free(disk->fs_index);
+	disk->fs_index = 0;
+}
+
+/**
+ * Search the extent at the specified parity position in the index.
+ * If a cursor is specified, the search is optimized for sequential accesses.
+ * \return If not found return 0
+ */
+static const struct snapraid_extent_entry* fs_index_par2entry(const struct snapraid_extent_index* index, struct snapraid_extent_cursor* cursor, block_off_t parity_pos)
 {
+	const struct snapraid_extent_entry* vec = index->parity_vec;
+	tommy_size_t first;
+	tommy_size_t last;
+	int found = 0;
+
+	/* search the last extent starting at or before the position */
+	if (cursor && cursor->pos < index->count && vec[cursor->pos].parity_pos <= parity_pos) {
+		first = cursor->pos;
+
+		/* in sequential accesses we move at most to the next extent */
+		if (first + 1 < index->count && vec[first + 1].parity_pos <= parity_pos)
+			++first;
+
+		/* it's the one if the next extent starts after the position */
+		found = first + 1 == index->count || vec[first + 1].parity_pos > parity_pos;
+	}
+
+	if (!found) {
+		/* binary search of the first extent starting after the position */
+		first = 0;
+		last = index->count;
+		while (first < last) {
+			tommy_size_t mid = first + (last - first) / 2;
+			if (vec[mid].parity_pos <= parity_pos)
+				first = mid + 1;
+			else
+				last = mid;
+		}
+
+		/* no extent starts before */
+		if (first == 0)
+			return 0;
+
+		/* the extent is the previous one */
+		--first;
+	}
+
+	if (cursor)
+		cursor->pos = first;
+
+	if (parity_pos >= vec[first].parity_pos + vec[first].count)
+		return 0;
+
+	return &vec[first];
+}
+
+/**
+ * Search the extent at the specified file position in the index.
+ * \return If not found return 0
+ */
+static const struct snapraid_extent_entry* fs_index_file2entry(const struct snapraid_extent_index* index, struct snapraid_file* file, block_off_t file_pos)
+{
+	const struct snapraid_extent_entry* vec = index->file_vec;
+	tommy_size_t first;
+	tommy_size_t last;
+
+	/* binary search of the first extent starting after the position */
+	first = 0;
+	last = index->count;
+	while (first < last) {
+		tommy_size_t mid = first + (last - first) / 2;
+		if (vec[mid].file < file || (vec[mid].file == file && vec[mid].file_pos <= file_pos))
+			first = mid + 1;
+		else
+			last = mid;
+	}
+
+	/* no extent starts before */
+	if (first == 0)
+		return 0;
+
+	/* the extent is the previous one */
+	--first;
+
+	if (vec[first].file != file || file_pos >= vec[first].file_pos + vec[first].count)
+		return 0;
+
+	return &vec[first];
+}
+
+struct snapraid_file* fs_par2file_find_cursor(struct snapraid_disk* disk, struct snapraid_extent_cursor* cursor, block_off_t parity_pos, block_off_t* file_pos)
+{
+	const struct snapraid_extent_index* index = disk->fs_index;
 	struct snapraid_extent* extent;
 	struct snapraid_file* file;
 
+	/* if we have the index, search it without locking */
+	if (index) {
+		const struct snapraid_extent_entry* entry = fs_index_par2entry(index, cursor, parity_pos);
+		if (!entry)
+			return 0;
+
+		if (file_pos)
+			*file_pos = entry->file_pos + (parity_pos - entry->parity_pos);
+
+		return entry->file;
+	}
+
 	fs_lock(disk);
 
 	extent = fs_par2extent_get_unlock(disk, &disk->fs_last, parity_pos);
@@ -1220,11 +1431,26 @@ struct snapraid_file* fs_par2file_find(struct snapraid_disk* disk, block_off_t p
 	return file;
 }
 
+struct snapraid_file* fs_par2file_find(struct snapraid_disk* disk, block_off_t parity_pos, block_off_t* file_pos)
+{
+	return fs_par2file_find_cursor(disk, 0, parity_pos, file_pos);
+}
+
 block_off_t fs_file2par_find(struct snapraid_disk* disk, struct snapraid_file* file, block_off_t file_pos)
 {
+	const struct snapraid_extent_index* index = disk->fs_index;
 	struct snapraid_extent* extent;
 	block_off_t ret;
 
+	/* if we have the index, search it without locking */
+	if (index) {
+		const struct snapraid_extent_entry* entry = fs_index_file2entry(index, file, file_pos);
+		if (!entry)
+			return POS_NULL;
+
+		return entry->parity_pos + (file_pos - entry->file_pos);
+	}
+
 	fs_lock(disk);
 
 	extent = fs_file2extent_get_unlock(disk, &disk->fs_last, file, file_pos);
@@ -1239,6 +1465,260 @@ block_off_t fs_file2par_find(struct snapraid_disk* disk, struct snapraid_file* f
 	return ret;
 }
 
+/**
+ * Get the size class of a free extent.
+ */
+static unsigned free_class(block_off_t count)
+{
+	unsigned fl;
+
+	if (count < 16)
+		return count;
+
+	/* position of the most significant bit */
+	fl = 4;
+	while ((count >> fl) > 1)
+		++fl;
+
+	/* the 4 bits after the most significant one select the class */
+	return 16 + (fl - 4) * 16 + ((count >> (fl - 4)) & 15);
+}
+
+/**
+ * Check if all the extents with the same class have at least the specified size.
+ */
+static int free_class_is_min(block_off_t count)
+{
+	unsigned fl;
+
+	if (count < 16)
+		return 1;
+
+	fl = 4;
+	while ((count >> fl) > 1)
+		++fl;
+
+	return (count & ((1U << (fl - 4)) - 1)) == 0;
+}
+
+static void free_class_insert(struct snapraid_free_index* index, struct snapraid_free_extent* fe)
+{
+	unsigned c = free_class(fe->count);
+
+	fe->size_class = c;
+	tommy_list_insert_tail(&index->class_list[c], &fe->node, fe);
+	index->class_map[c / 64] |= (uint64_t)1 << (c % 64);
+}
+
+static void free_class_remove(struct snapraid_free_index* index, struct snapraid_free_extent* fe)
+{
+	unsigned c = fe->size_class;
+
+	tommy_list_remove_existing(&index->class_list[c], &fe->node);
+	if (tommy_list_empty(&index->class_list[c]))
+		index->class_map[c / 64] &= ~((uint64_t)1 << (c % 64));
+}
+
+/**
+ * Search the smallest free extent, with at least the specified size.
+ * The extents in the same size class are not sorted, and any of them is returned.
+ * \return If not found return 0
+ */
+static struct snapraid_free_extent* free_class_search(struct snapraid_free_index* index, block_off_t count)
+{
+	unsigned c = free_class(count);
+
+	/* the extents in the same class may be smaller */
+	if (!free_class_is_min(count))
+		++c;
+
+	while (c < FREE_CLASS_MAX) {
+		uint64_t map = index->class_map[c / 64] >> (c % 64);
+
+		if (map == 0) {
+			/* skip to the next word */
+			c = (c / 64 + 1) * 64;
+			continue;
+		}
+
+		while ((map & 1) == 0) {
+			map >>= 1;
+			++c;
+		}
+
+		return tommy_list_head(&index->class_list[c])->data;
+	}
+
+	return 0;
+}
+
+struct free_index_fill {
+	struct snapraid_free_index* index;
+	block_off_t pos; /**< First position not yet visited. */
+};
+
+static void free_index_fill_foreach_unlock(void* void_arg, void* void_obj)
+{
+	struct free_index_fill* arg = void_arg;
+	const struct snapraid_extent* extent = void_obj;
+	struct snapraid_free_index* index = arg->index;
+
+	/* blocks of deleted files are free */
+	if (file_flag_has(extent->file, FILE_IS_DELETED))
+		return;
+
+	if (extent->parity_pos > arg->pos) {
+		struct snapraid_free_extent* fe = &index->vec[index->count++];
+		fe->parity_pos = arg->pos;
+		fe->count = extent->parity_pos - arg->pos;
+	}
+
+	arg->pos = extent->parity_pos + extent->count;
+}
+
+/**
+ * Build the index of the free extents.
+ */
+static void fs_free_build_unlock(struct snapraid_disk* disk)
+{
+	struct snapraid_free_index* index;
+	struct free_index_fill arg;
+	tommy_size_t i;
+
+	index = malloc_nofail(sizeof(struct snapraid_free_index));
+	index->count = 0;
+	index->first = 0;
+	for (i = 0; i < FREE_CLASS_MAX; ++i)
+		tommy_list_init(&index->class_list[i]);
+	memset(index->class_map, 0, sizeof(index->class_map));
+
+	/* at most one free extent before each extent */
+	index->vec = malloc_nofail((tommy_tree_count(&disk->fs_parity) + 1) * sizeof(struct snapraid_free_extent));
+
+	/* the tree is visited in order */
+	arg.index = index;
+	arg.pos = 0;
+	tommy_tree_foreach_arg(&disk->fs_parity, free_index_fill_foreach_unlock, &arg);
+
+	index->tail = arg.pos;
+
+	for (i = 0; i < index->count; ++i)
+		free_class_insert(index, &index->vec[i]);
+
+	disk->fs_free = index;
+}
+
+static inline void fs_free_discard_unlock(struct snapraid_disk* disk)
+{
+	free_index_free(disk->fs_free);
+	disk->fs_free = 0;
+}
+
+void fs_free_discard(struct snapraid_disk* disk)
+{
+	fs_lock(disk);
+
+	fs_free_discard_unlock(disk);
+
+	fs_unlock(disk);
+}
+
+block_off_t fs_free_find(struct snapraid_disk* disk, block_off_t count, block_off_t* run)
+{
+	struct snapraid_free_index* index;
+	struct snapraid_free_extent* fe;
+	block_off_t parity_pos;
+
+	fs_lock(disk);
+
+	if (!disk->fs_free)
+		fs_free_build_unlock(disk);
+
+	index = disk->fs_free;
+
+	/* if possible keep all the blocks together */
+	fe = free_class_search(index, count);
+	if (fe) {
+		*run = count;
+		parity_pos = fe->parity_pos;
+		fs_unlock(disk);
+		return parity_pos;
+	}
+
+	/* otherwise fill the first free extent */
+	while (index->first < index->count && index->vec[index->first].count == 0)
+		++index->first;
+
+	if (index->first < index->count) {
+		fe = &index->vec[index->first];
+		*run = fe->count < count ? fe->count : count;
+		parity_pos = fe->parity_pos;
+		fs_unlock(disk);
+		return parity_pos;
+	}
+
+	/* and finally extend the parity */
+	*run = count;
+	parity_pos = index->tail;
+
+	fs_unlock(disk);
+
+	return parity_pos;
+}
+
+/**
+ * Remove the parity position from the free extents.
+ *
+ * If the position is not at the start of a free extent, the index is discarded.
+ */
+static void fs_free_take_unlock(struct snapraid_disk* disk, block_off_t parity_pos)
+{
+	struct snapraid_free_index* index = disk->fs_free;
+	struct snapraid_free_extent* fe;
+	tommy_size_t first;
+	tommy_size_t last;
+
+	if (!index)
+		return;
+
+	if (parity_pos >= index->tail) {
+		if (parity_pos == index->tail)
+			++index->tail;
+		else
+			fs_free_discard_unlock(disk);
+		return;
+	}
+
+	/* search the last extent starting before or at the position */
+	first = 0;
+	last = index->count;
+	while (first < last) {
+		tommy_size_t mid = first + (last - first) / 2;
+		if (index->vec[mid].parity_pos <= parity_pos)
+			first = mid + 1;
+		else
+			last = mid;
+	}
+
+	if (first == 0) {
+		fs_free_discard_unlock(disk);
+		return;
+	}
+
+	fe = &index->vec[first - 1];
+	if (fe->count == 0 || fe->parity_pos != parity_pos) {
+		fs_free_discard_unlock(disk);
+		return;
+	}
+
+	/* shrink the extent from the start */
+	free_class_remove(index, fe);
+	++fe->parity_pos;
+	--fe->count;
+	if (fe->count != 0)
+		free_class_insert(index, fe);
+}
+
 void fs_allocate(struct snapraid_disk* disk, block_off_t parity_pos, struct snapraid_file* file, block_off_t file_pos)
 {
 	struct snapraid_extent* extent;
@@ -1247,6 +1727,10 @@ void fs_allocate(struct snapraid_disk* disk, block_off_t parity_pos, struct snap
 
 	fs_lock(disk);
 
+	fs_index_discard_unlock(disk);
+
+	fs_free_take_unlock(disk, parity_pos);
+
 	if (file_pos > 0) {
 		/* search an existing extent for the previous file_pos */
 		extent = fs_file2extent_get_unlock(disk, &disk->fs_last, file, file_pos - 1);
@@ -1298,6 +1782,8 @@ void fs_deallocate(struct snapraid_disk* disk, block_off_t parity_pos)
 
 	fs_lock(disk);
 
+	fs_index_discard_unlock(disk);
+
 	extent = fs_par2extent_get_unlock(disk, &disk->fs_last, parity_pos);
 	if (!extent) {
 		/* LCOV_EXCL_START */
@@ -1306,6 +1792,10 @@ void fs_deallocate(struct snapraid_disk* disk, block_off_t parity_pos)
 		/* LCOV_EXCL_STOP */
 	}
 
+	/* blocks of deleted files are already free, otherwise a new free extent is created */
+	if (!file_flag_has(extent->file, FILE_IS_DELETED))
+		fs_free_discard_unlock(disk);
+
 	/* if it's the only block of the extent, delete it */
 	if (extent->count == 1) {
 		/* remove from the trees */
@@ -1379,18 +1869,23 @@ struct snapraid_block* fs_file2block_get(struct snapraid_file* file, block_off_t
 	return file_block(file, file_pos);
 }
 
-struct snapraid_block* fs_par2block_find(struct snapraid_disk* disk, block_off_t parity_pos)
+struct snapraid_block* fs_par2block_find_cursor(struct snapraid_disk* disk, struct snapraid_extent_cursor* cursor, block_off_t parity_pos)
 {
 	struct snapraid_file* file;
 	block_off_t file_pos;
 
-	file = fs_par2file_find(disk, parity_pos, &file_pos);
+	file = fs_par2file_find_cursor(disk, cursor, parity_pos, &file_pos);
 	if (file == 0)
 		return BLOCK_NULL;
 
 	return fs_file2block_get(file, file_pos);
 }
 
+struct snapraid_block* fs_par2block_find(struct snapraid_disk* disk, block_off_t parity_pos)
+{
+	return fs_par2block_find_cursor(disk, 0, parity_pos);
+}
+
 struct snapraid_map* map_alloc(const char* name, unsigned position, block_off_t total_blocks, block_off_t free_blocks, const char* uuid)
 {
 	struct snapraid_map* map;
@@ -323,6 +323,84 @@ struct snapraid_extent {
 	tommy_tree_node file_node; /**< Tree sorter by <file,file_pos>. */
 };
 
+/**
+ * Entry of the extent index.
+ *
+ * It's a plain copy of an extent, stored in a flat vector.
+ */
+struct snapraid_extent_entry {
+	struct snapraid_file* file; /**< File containing this extent. */
+	block_off_t parity_pos; /**< Parity position. */
+	block_off_t file_pos; /**< Position in the file. */
+	block_off_t count; /**< Number of sequential blocks in the file and parity. */
+};
+
+/**
+ * Index of the extents of a disk.
+ *
+ * It's a flat copy of the extent trees, built before starting the
+ * multithread processing. It's never modified, and it can be searched
+ * without locking. Any change in the allocation discards it, and the
+ * searches return to use the trees until it's built again.
+ */
+struct snapraid_extent_index {
+	tommy_size_t count; /**< Number of extents. */
+	struct snapraid_extent_entry* parity_vec; /**< Extents sorted by <parity_pos>. */
+	struct snapraid_extent_entry* file_vec; /**< Extents sorted by <file,file_pos>. */
+};
+
+/**
+ * Cursor for searching the extent index.
+ *
+ * It remembers the last extent found, to optimize sequential accesses.
+ * Every thread has to use its own cursor.
+ */
+struct snapraid_extent_cursor {
+	tommy_size_t pos; /**< Position in the parity vector of the last extent found. */
+};
+
+/**
+ * Free extent of the parity.
+ *
+ * It's a run of parity positions not used by any file,
+ * or used only by deleted files.
+ */
+struct snapraid_free_extent {
+	block_off_t parity_pos; /**< Parity position. */
+	block_off_t count; /**< Number of sequential free blocks. 0 if all allocated. */
+	unsigned size_class; /**< Size class of the extent. */
+	tommy_node node; /**< Node in the list of the size class. */
+};
+
+/**
+ * Number of size classes of the free extents.
+ *
+ * Sizes up to 31 have their own class. Bigger sizes are split in 16 classes
+ * for each power of two, like in the TLSF allocator.
+ */
+#define FREE_CLASS_MAX (16 + 28 * 16)
+
+/**
+ * Index of the free extents of a disk.
+ *
+ * It's built when starting to allocate new files, after all the
+ * deletions. Allocations only shrink the free extents, that are kept
+ * in a vector sorted by parity position. The extents are also in a
+ * list for each size class, with a bitmap of the classes not empty,
+ * to find in constant time an extent big enough for a file.
+ *
+ * Any change in the allocation not done from the start of a free
+ * extent discards it.
+ */
+struct snapraid_free_index {
+	tommy_size_t count; /**< Number of free extents. */
+	struct snapraid_free_extent* vec; /**< Free extents sorted by <parity_pos>. */
+	tommy_size_t first; /**< Position in the vector of the first extent not empty. */
+	block_off_t tail; /**< First parity position after the last one used. All the following ones are free. */
+	tommy_list class_list[FREE_CLASS_MAX]; /**< Extents not empty by size class. */
+	uint64_t class_map[(FREE_CLASS_MAX + 63) / 64]; /**< Bitmap of the size classes not empty. */
+};
+
 /**
  * Disk.
  */
@@ -340,13 +418,8 @@ struct snapraid_disk {
 	uint64_t progress_tick[PROGRESS_MAX]; /**< Last ticks of progress. */
 	unsigned cached_blocks; /**< Number of IO blocks cached. */
 	struct snapraid_file* progress_file; /**< File in progress. */
-
-	/**
-	 * First free searching block.
-	 * Note that it doesn't necessarily point at the first free block,
-	 * but it just tell you that no free block is present before this position.
-	 */
-	block_off_t first_free_block;
+	uint64_t open_count; /**< Number of files opened. */
+	uint64_t open_cached; /**< Number of files reused from the descriptor cache. */
 
 	int has_volatile_inodes; /**< If the underline file-system has not persistent inodes. */
 	int has_volatile_hardlinks; /**< If the underline file-system has not syncronized metadata for hardlink (NTFS). */
@@ -361,8 +434,11 @@ struct snapraid_disk {
 	/**
 	 * Mutex for protecting the filesystem structure.
 	 *
-	 * Specifically, this protects ::fs_parity, ::fs_file, and ::fs_last,
-	 * meaning that it protects only extents.
+	 * Specifically, this protects ::fs_parity, ::fs_file, ::fs_last,
+	 * ::fs_index and ::fs_free, meaning that it protects only extents.
+	 *
+	 * The ::fs_index is read without locking, and it's not allowed to
+	 * change the allocation while other threads are searching it.
 	 *
 	 * Files, links and dirs are not protected as they are not expected to
 	 * change during multithread processing.
@@ -383,6 +459,18 @@ struct snapraid_disk {
 	 */
 	struct snapraid_extent* fs_last;
 
+	/**
+	 * Flat index of the extents.
+	 * If 0, the searches use the trees.
+	 */
+	struct snapraid_extent_index* fs_index;
+
+	/**
+	 * Index of the free extents.
+	 * If 0, it's built at the first allocation search.
+	 */
+	struct snapraid_free_index* fs_free;
+
 	/**
 	 * List of all the snapraid_file for the disk.
 	 */
@@ -748,6 +836,14 @@ static inline void file_flag_clear(struct snapraid_file* file, unsigned mask)
  */
 struct snapraid_file* file_alloc(unsigned block_size, const char* sub, data_off_t size, uint64_t mtime_sec, int mtime_nsec, uint64_t inode, uint64_t physical);
 
+/**
+ * Allocate a file using the specified blocks.
+ *
+ * The blocks are not initialized, and they are not freed with the file
+ * if they are in the hash store.
+ */
+struct snapraid_file* file_alloc_blockvec(unsigned block_size, const char* sub, data_off_t size, uint64_t mtime_sec, int mtime_nsec, uint64_t inode, uint64_t physical, void* blockvec);
+
 /**
  * Duplicate a file.
  */
@@ -994,6 +1090,42 @@ int fs_is_empty(struct snapraid_disk* disk, block_off_t blockmax);
  */
 int fs_check(struct snapraid_disk* disk);
 
+/**
+ * Build the flat index of the extents.
+ *
+ * After this call, the par2file/file2par/par2block operations search
+ * the index without locking, until the next allocation change.
+ *
+ * Call it before starting threads that search the extents, and don't
+ * change the allocation until they are stopped.
+ */
+void fs_index_build(struct snapraid_disk* disk);
+
+/**
+ * Find the parity positions where to allocate the next blocks of a file.
+ *
+ * If a free extent can contain all the blocks, the smallest one is used,
+ * to keep the file contiguous without splitting bigger extents.
+ * Otherwise the free extents are filled in order, from the first one,
+ * and only at the end the parity is extended.
+ *
+ * The positions are then reserved by fs_allocate(), that has to be
+ * called for all of them, in order.
+ *
+ * \param count Number of blocks to allocate.
+ * \param run Where to return the number of free positions found. From 1 to count.
+ * \return The first parity position found.
+ */
+block_off_t fs_free_find(struct snapraid_disk* disk, block_off_t count, block_off_t* run);
+
+/**
+ * Discard the index of the free extents.
+ *
+ * Call it when files are deleted outside fs_deallocate(),
+ * or when the allocation of new files is completed.
+ */
+void fs_free_discard(struct snapraid_disk* disk);
+
 /**
  * Allocate a parity position for the specified file position.
  *
@@ -1025,6 +1157,12 @@ struct snapraid_block* fs_file2block_get(struct snapraid_file* file, block_off_t
  */
 struct snapraid_file* fs_par2file_find(struct snapraid_disk* disk, block_off_t parity_pos, block_off_t* file_pos);
 
+/**
+ * Get the file position from the parity position, using a cursor for sequential accesses.
+ * Return 0 if no file is using it.
+ */
+struct snapraid_file* fs_par2file_find_cursor(struct snapraid_disk* disk, struct snapraid_extent_cursor* cursor, block_off_t parity_pos, block_off_t* file_pos);
+
 /**
  * Get the file position from the parity position.
  */
@@ -1043,6 +1181,24 @@ static inline struct snapraid_file* fs_par2file_get(struct snapraid_disk* disk,
 	return ret;
 }
 
+/**
+ * Get the file position from the parity position, using a cursor for sequential accesses.
+ */
+static inline struct snapraid_file* fs_par2file_get_cursor(struct snapraid_disk* disk, struct snapraid_extent_cursor* cursor, block_off_t parity_pos, block_off_t* file_pos)
+{
+	struct snapraid_file* ret;
+
+	ret = fs_par2file_find_cursor(disk, cursor, parity_pos, file_pos);
+	if (ret == 0) {
+		/* LCOV_EXCL_START */
+		log_fatal("Internal inconsistency when deresolving parity to file at position '%u' in disk '%s'\n", parity_pos, disk->name);
+		os_abort();
+		/* LCOV_EXCL_STOP */
+	}
+
+	return ret;
+}
+
 /**
  * Get the parity position from the file position.
  * Return POS_NULL if no parity is allocated.
@@ -1073,6 +1229,12 @@ static inline block_off_t fs_file2par_get(struct snapraid_disk* disk, struct sna
  */
 struct snapraid_block* fs_par2block_find(struct snapraid_disk* disk, block_off_t parity_pos);
 
+/**
+ * Get the block from the parity position, using a cursor for sequential accesses.
+ * Return BLOCK_NULL==0 if the block is over the end of the disk or not used.
+ */
+struct snapraid_block* fs_par2block_find_cursor(struct snapraid_disk* disk, struct snapraid_extent_cursor* cursor, block_off_t parity_pos);
+
 /**
  * Get the block from the parity position.
  */
@@ -141,6 +141,135 @@ int handle_truncate(struct snapraid_handle* handle, struct snapraid_file* file)
 	return 0;
 }
 
+/**
+ * Reuse the descriptor of a file from the cache.
+ * Return -1 if not present, or if the file was changed.
+ */
+static int handle_cache_reuse(struct snapraid_handle* handle, struct snapraid_file* file)
+{
+	struct snapraid_handle_cache* entry;
+	struct stat st;
+	unsigned i;
+	int ret;
+
+	for (i = 0; i < HANDLE_CACHE_MAX; ++i) {
+		if (handle->cache_map[i].file == file)
+			break;
+	}
+	if (i == HANDLE_CACHE_MAX)
+		return -1;
+
+	entry = &handle->cache_map[i];
+
+	/* remove it from the cache */
+	entry->file = 0;
+
+	/* if the file was changed or deleted while in the cache, discard it */
+	ret = fstat(entry->f, &st);
+	if (ret != 0
+		|| st.st_nlink == 0
+		|| st.st_size != entry->st.st_size
+		|| st.st_mtime != entry->st.st_mtime
+		|| STAT_NSEC(&st) != STAT_NSEC(&entry->st)
+	) {
+		close(entry->f);
+		return -1;
+	}
+
+	handle->file = file;
+	handle->f = entry->f;
+	handle->st = st;
+	handle->advise = entry->advise;
+	handle->valid_size = entry->valid_size;
+
+	return 0;
+}
+
+/**
+ * Insert the current descriptor in the cache.
+ * If the cache is full, the least recently used one is closed.
+ */
+static int handle_cache_insert(struct snapraid_handle* handle)
+{
+	struct snapraid_handle_cache* entry;
+	unsigned i;
+	int ret;
+
+	/* search for a free entry, or for the oldest one */
+	entry = &handle->cache_map[0];
+	for (i = 0; i < HANDLE_CACHE_MAX; ++i) {
+		if (handle->cache_map[i].file == 0) {
+			entry = &handle->cache_map[i];
+			break;
+		}
+		if (handle->cache_map[i].tick < entry->tick)
+			entry = &handle->cache_map[i];
+	}
+
+	/* evict the oldest one */
+	if (entry->file != 0) {
+		ret = close(entry->f);
+		if (ret != 0) {
+			/* LCOV_EXCL_START */
+			log_fatal("Error closing file '%s'. %s.\n", entry->file->sub, strerror(errno));
+			entry->file = 0;
+			return -1;
+			/* LCOV_EXCL_STOP */
+		}
+	}
+
+	entry->file = handle->file;
+	entry->f = handle->f;
+	entry->st = handle->st;
+	entry->advise = handle->advise;
+	entry->valid_size = handle->valid_size;
+	entry->tick = ++handle->cache_tick;
+
+	return 0;
+}
+
+void handle_cache_init(struct snapraid_handle* handle)
+{
+	unsigned i;
+
+	handle->cache_map = malloc_nofail(HANDLE_CACHE_MAX * sizeof(struct snapraid_handle_cache));
+	handle->cache_tick = 0;
+
+	for (i = 0; i < HANDLE_CACHE_MAX; ++i)
+		handle->cache_map[i].file = 0;
+}
+
+int handle_cache_done(struct snapraid_handle* handle)
+{
+	unsigned i;
+	int ret;
+	int error;
+
+	if (!handle->cache_map)
+		return 0;
+
+	error = 0;
+	for (i = 0; i < HANDLE_CACHE_MAX; ++i) {
+		struct snapraid_handle_cache* entry = &handle->cache_map[i];
+
+		if (entry->file == 0)
+			continue;
+
+		ret = close(entry->f);
+		if (ret != 0) {
+			/* LCOV_EXCL_START */
+			log_fatal("Error closing file '%s'. %s.\n", entry->file->sub, strerror(errno));
+			error = -1;
+			/* LCOV_EXCL_STOP */
+		}
+	}
+
+	free(handle->cache_map);
+	handle->cache_map = 0;
+
+	return error;
+}
+
 int handle_open(struct snapraid_handle* handle, struct snapraid_file* file, int mode, fptr* out, fptr* out_missing)
 {
 	int ret;
@@ -154,12 +283,21 @@ int handle_open(struct snapraid_handle* handle, struct snapraid_file* file, int
 		return 0;
 	}
 
-	advise_init(&handle->advise, mode);
 	pathprint(handle->path, sizeof(handle->path), "%s%s", handle->disk->dir, file->sub);
 
 	/* for sure not created */
 	handle->created = 0;
 
+	/* if still open in the cache, reuse it */
+	if (handle->cache_map && handle_cache_reuse(handle, file) == 0) {
+		++handle->disk->open_cached;
+		return 0;
+	}
+
+	advise_init(&handle->advise, mode);
+
+	++handle->disk->open_count;
+
 	/* flags for opening */
 	/* O_BINARY: open as binary file (Windows only) */
 	/* O_NOFOLLOW: do not follow links to ensure to open the real file */
@@ -210,6 +348,18 @@ int handle_close(struct snapraid_handle* handle)
 {
 	int ret;
 
+	/* keep it open in the cache */
+	if (handle->cache_map && handle->f != -1 && handle->file != 0) {
+		ret = handle_cache_insert(handle);
+
+		/* reset the descriptor */
+		handle->file = 0;
+		handle->f = -1;
+		handle->valid_size = 0;
+
+		return ret;
+	}
+
 	/* close if open */
 	if (handle->f != -1) {
 		ret = close(handle->f);
@@ -259,6 +409,12 @@ int handle_read(struct snapraid_handle* handle, block_off_t file_pos, unsigned c
 
 	read_size = file_block_size(handle->file, file_pos, block_size);
 
+	if (handle->defer) {
+		/* only store the request, the read, the padding and the advise are done by the caller */
+		defer_set(handle->defer, 0, handle->f, &handle->advise, block_buffer, block_size, read_size, offset);
+		return read_size;
+	}
+
 	count = 0;
 	do {
 		/* read the full block to support O_DIRECT */
@@ -372,6 +528,9 @@ struct snapraid_handle* handle_mapping(struct snapraid_state* state, unsigned* h
 		handle[j].file = 0;
 		handle[j].f = -1;
 		handle[j].valid_size = 0;
+		handle[j].defer = 0;
+		handle[j].cache_map = 0;
+		handle[j].cache_tick = 0;
 	}
 
 	/* set the vector */
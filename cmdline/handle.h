@@ -24,6 +24,26 @@
 /****************************************************************************/
 /* handle */
 
+/**
+ * Max number of descriptors kept open in the cache of a handle.
+ *
+ * Every data reader has its cache, so the total of open files
+ * is this value multiplied by the number of disks.
+ */
+#define HANDLE_CACHE_MAX 8
+
+/**
+ * Descriptor kept open in the cache of a handle.
+ */
+struct snapraid_handle_cache {
+	struct snapraid_file* file; /**< File opened. 0 if the entry is free. */
+	int f; /**< Handle of the file. */
+	struct stat st; /**< Stat info of the opened file. */
+	struct advise_struct advise; /**< Advise information. */
+	data_off_t valid_size; /**< Size of the valid data. */
+	uint64_t tick; /**< Last use of the entry, to evict the least recently used. */
+};
+
 struct snapraid_handle {
 	char path[PATH_MAX]; /**< Path of the file. */
 	struct snapraid_disk* disk; /**< Disk of the file. */
@@ -33,6 +53,9 @@ struct snapraid_handle {
 	struct advise_struct advise; /**< Advise information. */
 	data_off_t valid_size; /**< Size of the valid data. */
 	int created; /**< If the file was created, otherwise it was already existing. */
+	struct defer_struct* defer; /**< If not 0, handle_read() only stores the request here. */
+	struct snapraid_handle_cache* cache_map; /**< If not 0, handle_close() keeps the descriptors open here. */
+	uint64_t cache_tick; /**< Counter of the uses of the cache. */
 };
 
 /**
@@ -58,12 +81,30 @@ int handle_open(struct snapraid_handle* handle, struct snapraid_file* file, int
 
 /**
  * Close a file.
+ * If the descriptor cache is enabled, the file is kept open in the cache.
  */
 int handle_close(struct snapraid_handle* handle);
 
+/**
+ * Enable the descriptor cache.
+ *
+ * The files closed are kept open, and reused by a following handle_open()
+ * of the same file, if its stat info is not changed in the meantime.
+ * It's intended only for read access.
+ */
+void handle_cache_init(struct snapraid_handle* handle);
+
+/**
+ * Disable the descriptor cache, closing all the files kept open.
+ * The current file, if any, is not closed.
+ */
+int handle_cache_done(struct snapraid_handle* handle);
+
 /**
  * Read a block from a file.
  * If the read block is shorter, it's padded with 0.
+ * If the handle has a defer struct, the read is only validated and stored in it,
+ * and the padding is left to the caller.
  */
 int handle_read(struct snapraid_handle* handle, block_off_t file_pos, unsigned char* block_buffer, unsigned block_size, fptr* out, fptr* out_missing);
 
@@ -0,0 +1,191 @@
+/*
+ * Copyright (C) 2016 Andrea Mazzoleni
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "portable.h"
+
+#include "support.h"
+#include "elem.h"
+#include "hashstore.h"
+
+/****************************************************************************/
+/* hashstore */
+
+static unsigned char* hashstore_map; /**< Mapping of the store. 0 if not initialized. */
+static size_t hashstore_size; /**< Size of the mapping. */
+static uint32_t hashstore_mapping_max; /**< Number of disk mappings. */
+static uint32_t* hashstore_next; /**< Next file to get for each disk mapping. */
+
+static uint32_t hashstore_le32(const unsigned char* ptr)
+{
+	return ptr[0] | (uint32_t)ptr[1] << 8 | (uint32_t)ptr[2] << 16 | (uint32_t)ptr[3] << 24;
+}
+
+static uint64_t hashstore_le64(const unsigned char* ptr)
+{
+	return hashstore_le32(ptr) | (uint64_t)hashstore_le32(ptr + 4) << 32;
+}
+
+#if HAVE_HASHSTORE
+int hashstore_init(const char* path, uint32_t crc, uint64_t size)
+{
+	struct stat st;
+	void* map;
+	unsigned char* header;
+	uint32_t mapping_max;
+	int f;
+
+	f = open(path, O_RDONLY | O_BINARY);
+	if (f == -1) {
+		if (errno != ENOENT)
+			log_fatal("WARNING! Error opening the hash store file '%s'. %s.\n", path, strerror(errno));
+		return -1;
+	}
+
+	if (fstat(f, &st) != 0) {
+		/* LCOV_EXCL_START */
+		log_fatal("WARNING! Error stating the hash store file '%s'. %s.\n", path, strerror(errno));
+		close(f);
+		return -1;
+		/* LCOV_EXCL_STOP */
+	}
+
+	if (st.st_size < HASHSTORE_HEADER_SIZE || (size_t)st.st_size != (uint64_t)st.st_size) {
+		/* LCOV_EXCL_START */
+		log_fatal("WARNING! Ignoring the invalid hash store file '%s'.\n", path);
+		close(f);
+		return -1;
+		/* LCOV_EXCL_STOP */
+	}
+
+	/* a private mapping allows to change the blocks without */
+	/* changing the file, and the kernel still drops the pages */
+	/* not changed instead of swapping them */
+	map = mmap(0, st.st_size, PROT_READ | PROT_WRITE, MAP_PRIVATE, f, 0);
+	if (map == MAP_FAILED) {
+		/* LCOV_EXCL_START */
+		log_fatal("WARNING! Error mapping the hash store file '%s'. %s.\n", path, strerror(errno));
+		close(f);
+		return -1;
+		/* LCOV_EXCL_STOP */
+	}
+
+	/* the mapping keeps the file alive */
+	close(f);
+
+	header = map;
+	mapping_max = hashstore_le32(header + 20);
+
+	if (memcmp(header, "SNAPHASH", 8) != 0
+		|| hashstore_le32(header + 8) != HASHSTORE_VERSION
+		|| hashstore_le32(header + 12) != block_sizeof()
+		|| mapping_max > (st.st_size - HASHSTORE_HEADER_SIZE) / HASHSTORE_ENTRY_SIZE
+	) {
+		/* LCOV_EXCL_START */
+		log_fatal("WARNING! Ignoring the invalid hash store file '%s'.\n", path);
+		munmap(map, st.st_size);
+		return -1;
+		/* LCOV_EXCL_STOP */
+	}
+
+	/* use it only if it was saved with the content file */
+	if (hashstore_le32(header + 16) != crc
+		|| hashstore_le64(header + 24) != size
+	) {
+		msg_verbose("Ignoring the hash store file '%s' not matching the content file.\n", path);
+		munmap(map, st.st_size);
+		return -1;
+	}
+
+	hashstore_map = map;
+	hashstore_size = st.st_size;
+	hashstore_mapping_max = mapping_max;
+	hashstore_next = calloc_nofail(mapping_max + 1, sizeof(uint32_t));
+
+	return 0;
+}
+
+void hashstore_done(void)
+{
+	if (!hashstore_map)
+		return;
+
+	munmap(hashstore_map, hashstore_size);
+	free(hashstore_next);
+
+	hashstore_map = 0;
+	hashstore_size = 0;
+	hashstore_mapping_max = 0;
+	hashstore_next = 0;
+}
+#else
+int hashstore_init(const char* path, uint32_t crc, uint64_t size)
+{
+	(void)path;
+	(void)crc;
+	(void)size;
+
+	return -1;
+}
+
+void hashstore_done(void)
+{
+}
+#endif
+
+void* hashstore_get(uint32_t mapping, block_off_t blockmax)
+{
+	const unsigned char* entry;
+	uint64_t index;
+	uint64_t offset;
+	uint32_t count;
+	uint32_t next;
+
+	if (!hashstore_map || mapping >= hashstore_mapping_max)
+		return 0;
+
+	entry = hashstore_map + HASHSTORE_HEADER_SIZE + mapping * (size_t)HASHSTORE_ENTRY_SIZE;
+	count = hashstore_le32(entry);
+	index = hashstore_le64(entry + 8);
+
+	/* advance even on failure, to stay in sync with the content file */
+	next = hashstore_next[mapping]++;
+	if (next >= count)
+		return 0;
+
+	if (index > hashstore_size || next >= (hashstore_size - index) / HASHSTORE_ENTRY_SIZE)
+		return 0;
+
+	entry = hashstore_map + index + next * (size_t)HASHSTORE_ENTRY_SIZE;
+	offset = hashstore_le64(entry + 8);
+
+	/* files without blocks don't use the store */
+	if (blockmax == 0 || hashstore_le32(entry) != blockmax)
+		return 0;
+
+	if (offset > hashstore_size || blockmax > (hashstore_size - offset) / block_sizeof())
+		return 0;
+
+	return hashstore_map + offset;
+}
+
+int hashstore_owns(const void* ptr)
+{
+	const unsigned char* p = ptr;
+
+	return hashstore_map != 0 && p >= hashstore_map && p < hashstore_map + hashstore_size;
+}
+
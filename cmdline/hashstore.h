@@ -0,0 +1,110 @@
+/*
+ * Copyright (C) 2016 Andrea Mazzoleni
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef __HASHSTORE_H
+#define __HASHSTORE_H
+
+/****************************************************************************/
+/* hashstore */
+
+/**
+ * External store for the block hashes.
+ *
+ * It's a file saved near the first content file, with a copy of the blocks
+ * of all the files. When loading a content file matching it, the store is
+ * memory mapped in private mode, and the files use the blocks in the mapping
+ * instead of reading them from the content file.
+ *
+ * The kernel reads the blocks on demand, and it's free to drop the pages
+ * not changed, instead of swapping them. The changed pages are copied in
+ * memory, and the store file is never modified.
+ *
+ * The format is:
+ *   "SNAPHASH"
+ *   le32 version
+ *   le32 size of a block in the store
+ *   le32 CRC of the matching content file
+ *   le32 number of disk mappings
+ *   le64 size of the matching content file
+ *   for each disk mapping:
+ *     le32 number of files
+ *     le32 0
+ *     le64 offset of the index of the files
+ *   for each disk mapping, in the same order of the files in the content file:
+ *     le32 number of blocks of the file
+ *     le32 0
+ *     le64 offset of the blocks of the file
+ *   all the blocks of the files of each disk, in parity position order
+ *
+ * There is only a single store for the whole process.
+ */
+
+#if HAVE_MMAP && HAVE_MUNMAP
+#define HAVE_HASHSTORE 1
+#endif
+
+/**
+ * Version of the store format.
+ */
+#define HASHSTORE_VERSION 1
+
+/**
+ * Size of the store header.
+ */
+#define HASHSTORE_HEADER_SIZE 32
+
+/**
+ * Size of the entries of the disk and file tables.
+ */
+#define HASHSTORE_ENTRY_SIZE 16
+
+/**
+ * Map the store in the specified file.
+ *
+ * The store is used only if it matches the content file with the specified
+ * CRC and size.
+ *
+ * \return 0 on success, or -1 if the store is missing or not matching.
+ */
+int hashstore_init(const char* path, uint32_t crc, uint64_t size);
+
+/**
+ * Unmap the store.
+ *
+ * All the blocks in the store becomes invalid.
+ */
+void hashstore_done(void);
+
+/**
+ * Get the blocks of the next file of a disk.
+ *
+ * It must be called for each file of the disk in the same order of the content
+ * file. It can be called concurrently for different disks.
+ *
+ * \param mapping Mapping index of the disk in the content file.
+ * \param blockmax Number of blocks of the file.
+ * \return The blocks of the file, or 0 if not available in the store.
+ */
+void* hashstore_get(uint32_t mapping, block_off_t blockmax);
+
+/**
+ * Check if the memory is in the store.
+ */
+int hashstore_owns(const void* ptr);
+
+#endif
+
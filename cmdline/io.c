@@ -38,6 +38,49 @@ static block_off_t io_position_next(struct snapraid_io* io)
 	return blockcur;
 }
 
+/**
+ * Set the deferred mode in the handle of the worker.
+ */
+static void io_defer(struct snapraid_worker* worker, struct defer_struct* defer)
+{
+	if (worker->handle)
+		worker->handle->defer = defer;
+	if (worker->parity_handle)
+		worker->parity_handle->defer = defer;
+}
+
+/**
+ * Enable the descriptor cache of the data readers.
+ *
+ * The files are kept open in the cache only while the workers are running.
+ */
+static void io_handle_cache_init(struct snapraid_io* io)
+{
+	unsigned i;
+
+	for (i = io->data_base; i < io->data_base + io->data_count; ++i) {
+		struct snapraid_handle* handle = io->reader_map[i].handle;
+
+		if (handle->disk)
+			handle_cache_init(handle);
+	}
+}
+
+/**
+ * Disable the descriptor cache of the data readers, closing the files kept open.
+ */
+static void io_handle_cache_done(struct snapraid_io* io)
+{
+	unsigned i;
+
+	for (i = io->data_base; i < io->data_base + io->data_count; ++i) {
+		struct snapraid_handle* handle = io->reader_map[i].handle;
+
+		/* errors are already reported, and we are only reading */
+		handle_cache_done(handle);
+	}
+}
+
 /**
  * Setup the next pending task for all readers.
  */
@@ -67,6 +110,9 @@ static void io_reader_sched(struct snapraid_io* io, int task_index, block_off_t
 		task->file_pos = 0;
 		task->read_size = 0;
 		task->is_timestamp_different = 0;
+		task->is_hashed = 0;
+		task->is_coalesced = 0;
+		task->is_done = task->state == TASK_STATE_EMPTY;
 	}
 }
 
@@ -92,6 +138,8 @@ static void io_writer_sched(struct snapraid_io* io, int task_index, block_off_t
 		task->file_pos = 0;
 		task->read_size = 0;
 		task->is_timestamp_different = 0;
+		task->is_hashed = 0;
+		task->is_coalesced = 0;
 	}
 }
 
@@ -117,6 +165,8 @@ static void io_writer_sched_empty(struct snapraid_io* io, int task_index, block_
 		task->file_pos = 0;
 		task->read_size = 0;
 		task->is_timestamp_different = 0;
+		task->is_hashed = 0;
+		task->is_coalesced = 0;
 	}
 }
 
@@ -251,11 +301,13 @@ static void io_start_mono(struct snapraid_io* io,
 	io->block_is_enabled = block_is_enabled;
 	io->block_arg = blockarg;
 	io->block_next = blockstart;
+
+	io_handle_cache_init(io);
 }
 
 static void io_stop_mono(struct snapraid_io* io)
 {
-	(void)io;
+	io_handle_cache_done(io);
 }
 
 /*****************************************************************************/
@@ -320,6 +372,173 @@ static struct snapraid_task* io_reader_step(struct snapraid_worker* worker)
 	}
 }
 
+/**
+ * Compare the physical order of two tasks.
+ */
+static int io_order_compare(uint64_t a_physical, uint64_t a_inode, block_off_t a_pos, uint64_t b_physical, uint64_t b_inode, block_off_t b_pos)
+{
+	if (a_physical < b_physical)
+		return -1;
+	if (a_physical > b_physical)
+		return 1;
+	if (a_inode < b_inode)
+		return -1;
+	if (a_inode > b_inode)
+		return 1;
+	if (a_pos < b_pos)
+		return -1;
+	if (a_pos > b_pos)
+		return 1;
+	return 0;
+}
+
+/**
+ * Setup the physical order of the next pending task for all readers.
+ *
+ * It's called before io_reader_sched() and outside the io mutex,
+ * because the workers don't access the tasks at this index.
+ */
+static void io_reader_order(struct snapraid_io* io, int task_index, block_off_t blockcur)
+{
+	unsigned i;
+
+	for (i = 0; i < io->reader_max; ++i) {
+		struct snapraid_worker* worker = &io->reader_map[i];
+		struct snapraid_task* task = &worker->task_map[task_index];
+		struct snapraid_disk* disk;
+		struct snapraid_file* file;
+		block_off_t file_pos;
+
+		/* by default use the parity order, used also for parity */
+		/* and for blocks without a file, that are the faster to process */
+		task->order_physical = 0;
+		task->order_inode = 0;
+		task->order_pos = blockcur;
+
+		if (!worker->handle || blockcur >= io->block_max)
+			continue;
+
+		disk = worker->handle->disk;
+		if (!disk)
+			continue;
+
+		file = fs_par2file_find(disk, blockcur, &file_pos);
+		if (!file)
+			continue;
+
+		/* the physical offset is read only at the first use of the file */
+		/* as it's not stored in the content file */
+		if (file->physical == FILEPHY_UNREAD_OFFSET) {
+			char path[PATH_MAX];
+
+			pathprint(path, sizeof(path), "%s%s", disk->dir, file->sub);
+
+			/* if it fails, like for a missing file, it's ordered by inode */
+			if (filephy(path, file->size, &file->physical) != 0)
+				file->physical = FILEPHY_UNREPORTED_OFFSET;
+		}
+
+		if (!disk->has_unreliable_physical)
+			task->order_physical = file->physical;
+		task->order_inode = file->inode;
+		task->order_pos = file_pos;
+	}
+}
+
+/**
+ * Get the next task to work on for a reader in physical order.
+ *
+ * The pending tasks are processed as an elevator sweep. The next task is
+ * the first one following the latest started in physical order, or if none,
+ * the first one in physical order.
+ *
+ * This is the synchronization point for workers with the io.
+ */
+static struct snapraid_task* io_reader_step_physical(struct snapraid_worker* worker)
+{
+	struct snapraid_io* io = worker->io;
+
+	/* the synchronization is protected by the io mutex */
+	thread_mutex_lock(&io->io_mutex);
+
+	/* if a task was completed */
+	if (worker->index != io->io_max) {
+		worker->task_map[worker->index].is_done = 1;
+
+		/* if the just completed task is the one the IO may be waiting for */
+		if (worker->index == io->reader_index) {
+			/* notify the IO that a new read is complete */
+			thread_cond_signal(&io->read_done);
+		}
+
+		worker->index = io->io_max;
+	}
+
+	while (1) {
+		unsigned first_index;
+		unsigned next_index;
+		unsigned i;
+
+		/* check if the worker has to exit */
+		/* even if there is work to do */
+		if (io->done) {
+			thread_mutex_unlock(&io->io_mutex);
+			return 0;
+		}
+
+		/* search in parity order, starting from the one the IO is waiting for */
+		first_index = io->io_max;
+		next_index = io->io_max;
+		for (i = 0; i < io->io_max; ++i) {
+			unsigned index = (io->reader_index + i) % io->io_max;
+			struct snapraid_task* task = &worker->task_map[index];
+
+			if (task->is_done)
+				continue;
+
+			/* the first in physical order */
+			if (first_index == io->io_max
+				|| io_order_compare(task->order_physical, task->order_inode, task->order_pos,
+				worker->task_map[first_index].order_physical, worker->task_map[first_index].order_inode, worker->task_map[first_index].order_pos) < 0)
+				first_index = index;
+
+			/* the first following the latest started */
+			if (io_order_compare(task->order_physical, task->order_inode, task->order_pos,
+				worker->order_physical, worker->order_inode, worker->order_pos) >= 0
+				&& (next_index == io->io_max
+				|| io_order_compare(task->order_physical, task->order_inode, task->order_pos,
+				worker->task_map[next_index].order_physical, worker->task_map[next_index].order_inode, worker->task_map[next_index].order_pos) < 0))
+				next_index = index;
+		}
+
+		/* restart the sweep if nothing follows */
+		if (next_index == io->io_max)
+			next_index = first_index;
+
+		/* if the queue of pending tasks is not empty */
+		if (next_index != io->io_max) {
+			struct snapraid_task* task;
+
+			/* get the new working task */
+			worker->index = next_index;
+			task = &worker->task_map[worker->index];
+
+			/* move the head */
+			worker->order_physical = task->order_physical;
+			worker->order_inode = task->order_inode;
+			worker->order_pos = task->order_pos;
+
+			thread_mutex_unlock(&io->io_mutex);
+
+			/* return the new task */
+			return task;
+		}
+
+		/* otherwise wait for a read_sched event */
+		thread_cond_wait(&io->read_sched, &io->io_mutex);
+	}
+}
+
 /**
  * Get the next task to work on for a writer.
  *
@@ -396,6 +615,10 @@ static block_off_t io_read_next_thread(struct snapraid_io* io, void*** buffer)
 	/* get the next parity position to process */
 	blockcur_schedule = io_position_next(io);
 
+	/* the tasks at this index are not used by the workers */
+	if (io->is_physical)
+		io_reader_order(io, io->reader_index, blockcur_schedule);
+
 	/* ensure that all data/parity was read */
 	assert(io->reader_list[0] == io->reader_max);
 
@@ -481,13 +704,24 @@ static void io_refresh_thread(struct snapraid_io* io)
 		unsigned begin, end, cached;
 		struct snapraid_worker* worker = &io->reader_map[i];
 
-		/* the first block read */
-		begin = io->reader_index + 1;
-		/* the block in reading */
-		end = worker->index;
-		if (begin > end)
-			end += io->io_max;
-		cached = end - begin;
+		if (io->is_physical) {
+			unsigned j;
+
+			/* the blocks read are not contiguous */
+			cached = 0;
+			for (j = 0; j < io->io_max; ++j) {
+				if (j != io->reader_index && worker->task_map[j].is_done && worker->task_map[j].state != TASK_STATE_EMPTY)
+					++cached;
+			}
+		} else {
+			/* the first block read */
+			begin = io->reader_index + 1;
+			/* the block in reading */
+			end = worker->index;
+			if (begin > end)
+				end += io->io_max;
+			cached = end - begin;
+		}
 
 		if (worker->parity_handle)
 			io->state->parity[worker->parity_handle->level].cached_blocks = cached;
@@ -559,7 +793,7 @@ static struct snapraid_task* io_task_read_thread(struct snapraid_io* io, unsigne
 				worker = &io->reader_map[i];
 
 				/* if the worker has finished this index */
-				if (busy_index != worker->index) {
+				if (io->is_physical ? worker->task_map[busy_index].is_done : busy_index != worker->index) {
 					struct snapraid_task* task;
 
 					task = &worker->task_map[io->reader_index];
@@ -678,12 +912,152 @@ static void io_parity_write_thread(struct snapraid_io* io, unsigned* pos, unsign
 	}
 }
 
+#if HAVE_PREADV
+/**
+ * Do the read of a run of coalesced tasks, and apply their advise.
+ *
+ * If the read or the advise fails, the worker function is called again
+ * without the deferred mode, to get the same error handling of the other modes.
+ */
+static void io_coalesce_flush(struct snapraid_worker* worker, struct snapraid_task** run_map, unsigned run_max)
+{
+	struct iovec iov[IO_COALESCE_MAX];
+	struct defer_struct* first;
+	ssize_t ret;
+	size_t done;
+	unsigned i;
+
+	if (run_max == 0)
+		return;
+
+	for (i = 0; i < run_max; ++i) {
+		iov[i].iov_base = run_map[i]->defer.buffer;
+		iov[i].iov_len = run_map[i]->defer.size;
+	}
+
+	first = &run_map[0]->defer;
+	ret = preadv(first->f, iov, run_max, first->offset);
+
+	/* on error, all the tasks are done again */
+	done = ret > 0 ? ret : 0;
+
+	for (i = 0; i < run_max; ++i) {
+		struct snapraid_task* task = run_map[i];
+		struct defer_struct* defer = &task->defer;
+		unsigned size;
+
+		/* the part of the I/O of this task */
+		size = done < defer->size ? done : defer->size;
+		done -= size;
+
+		if (size < defer->min_size) {
+			defer_clear(defer);
+			worker->func(worker, task);
+			continue;
+		}
+
+		if (defer_advise(defer) != 0) {
+			worker->func(worker, task);
+			continue;
+		}
+
+		/* pad with 0 */
+		if (defer->min_size < defer->size)
+			memset(defer->buffer + defer->min_size, 0, defer->size - defer->min_size);
+
+		/* hash the data now that it's read */
+		if (worker->handle)
+			io_data_hash(worker, task);
+	}
+}
+
+/**
+ * Run the reader function for a task, coalescing its read with the
+ * following pending tasks.
+ *
+ * The reader function is called in deferred mode to get the read requests,
+ * and the ones accessing contiguous data of the same file are done with a
+ * single preadv() into the buffers of the tasks.
+ * The following tasks completed are marked with ::is_coalesced.
+ *
+ * \param limit_index The index of the first task not pending.
+ */
+static void io_coalesce(struct snapraid_worker* worker, struct snapraid_task* task, unsigned limit_index)
+{
+	struct snapraid_io* io = worker->io;
+	struct snapraid_task* run_map[IO_COALESCE_MAX];
+	unsigned run_max;
+	unsigned index;
+
+	run_max = 0;
+	index = task - worker->task_map;
+	while (1) {
+		struct snapraid_task* next = &worker->task_map[index];
+		struct defer_struct* defer = &next->defer;
+
+		/* the following tasks must be pending and not at the end */
+		if (next != task) {
+			if (index == limit_index
+				|| next->state != TASK_STATE_READY
+				|| next->position >= io->block_max)
+				break;
+		}
+
+		defer_clear(defer);
+
+		io_defer(worker, defer);
+		worker->func(worker, next);
+		io_defer(worker, 0);
+
+		if (next != task)
+			next->is_coalesced = 1;
+
+		/* if no I/O was requested, the task is already completed */
+		if (defer->state == DEFER_NONE)
+			break;
+
+		/* if not contiguous, the task is done alone */
+		if (run_max != 0) {
+			struct defer_struct* last = &run_map[run_max - 1]->defer;
+
+			if (defer->f != last->f
+				|| defer->offset != last->offset + last->size) {
+				io_coalesce_flush(worker, run_map, run_max);
+				run_map[0] = next;
+				run_max = 1;
+				break;
+			}
+		}
+
+		run_map[run_max++] = next;
+		if (run_max == IO_COALESCE_MAX)
+			break;
+
+		index = (index + 1) % io->io_max;
+	}
+
+	io_coalesce_flush(worker, run_map, run_max);
+}
+#endif
+
 static void io_reader_worker(struct snapraid_worker* worker, struct snapraid_task* task)
 {
+	struct snapraid_io* io = worker->io;
+
 	/* if we reached the end */
-	if (task->position >= worker->io->block_max) {
+	if (task->position >= io->block_max) {
 		/* complete a dummy task */
 		task->state = TASK_STATE_EMPTY;
+#if HAVE_PREADV
+	} else if (io->is_coalesce) {
+		unsigned limit_index;
+
+		thread_mutex_lock(&io->io_mutex);
+		limit_index = io->reader_index;
+		thread_mutex_unlock(&io->io_mutex);
+
+		io_coalesce(worker, task, limit_index);
+#endif
 	} else {
 		worker->func(worker, task);
 	}
@@ -694,13 +1068,17 @@ static void* io_reader_thread(void* arg)
 	struct snapraid_worker* worker = arg;
 
 	/* force completion of the first task */
-	io_reader_worker(worker, &worker->task_map[0]);
+	if (!worker->io->is_physical)
+		io_reader_worker(worker, &worker->task_map[0]);
 
 	while (1) {
 		struct snapraid_task* task;
 
 		/* get the new task */
-		task = io_reader_step(worker);
+		if (worker->io->is_physical)
+			task = io_reader_step_physical(worker);
+		else
+			task = io_reader_step(worker);
 
 		/* if no task, it means to exit */
 		if (!task)
@@ -710,6 +1088,10 @@ static void* io_reader_thread(void* arg)
 		if (task->state == TASK_STATE_EMPTY)
 			continue;
 
+		/* already completed with a previous task */
+		if (task->is_coalesced)
+			continue;
+
 		assert(task->state == TASK_STATE_READY);
 
 		/* work on the assigned task */
@@ -777,6 +1159,9 @@ static void io_start_thread(struct snapraid_io* io,
 	for (i = 0; i < io->io_max - 1; ++i) {
 		block_off_t blockcur = io_position_next(io);
 
+		if (io->is_physical)
+			io_reader_order(io, i, blockcur);
+
 		io_reader_sched(io, i, blockcur);
 	}
 
@@ -785,11 +1170,24 @@ static void io_start_thread(struct snapraid_io* io,
 	for (i = 0; i <= io->writer_max; ++i)
 		io->writer_list[i] = i;
 
+	io_handle_cache_init(io);
+
 	/* start the reader threads */
 	for (i = 0; i < io->reader_max; ++i) {
 		struct snapraid_worker* worker = &io->reader_map[i];
 
-		worker->index = 0;
+		if (io->is_physical) {
+			/* the latest task is not yet scheduled */
+			worker->task_map[io->io_max - 1].is_done = 1;
+
+			/* no task in progress, and the head at the start */
+			worker->index = io->io_max;
+			worker->order_physical = 0;
+			worker->order_inode = 0;
+			worker->order_pos = 0;
+		} else {
+			worker->index = 0;
+		}
 
 		thread_create(&worker->thread, 0, io_reader_thread, worker);
 	}
@@ -836,6 +1234,445 @@ static void io_stop_thread(struct snapraid_io* io)
 		/* wait for thread termination */
 		thread_join(worker->thread, &retval);
 	}
+
+	io_handle_cache_done(io);
+}
+
+#endif
+
+/*****************************************************************************/
+/* io_uring */
+
+#if HAVE_IO_URING
+
+/**
+ * Submit all the queued requests.
+ */
+static void io_uring_submit(struct snapraid_io* io)
+{
+	if (uring_submit(&io->ring) != 0) {
+		/* LCOV_EXCL_START */
+		log_fatal("Failed to submit requests to io_uring. %s.\n", strerror(errno));
+		os_abort();
+		/* LCOV_EXCL_STOP */
+	}
+}
+
+/**
+ * Wait for the completion of one request of any task.
+ */
+static void io_uring_reap(struct snapraid_io* io)
+{
+	struct snapraid_task* task;
+	void* arg;
+	int result;
+
+	assert(io->ring.inflight != 0);
+
+	if (uring_wait(&io->ring, &arg, &result) != 0) {
+		/* LCOV_EXCL_START */
+		log_fatal("Failed to wait requests from io_uring. %s.\n", strerror(errno));
+		os_abort();
+		/* LCOV_EXCL_STOP */
+	}
+
+	task = arg;
+	task->defer.result = result;
+	task->defer.state = DEFER_COMPLETED;
+}
+
+/**
+ * Run the worker function for a task, queuing the resulting I/O in the ring.
+ *
+ * The worker function sees the I/O as already completed. If later
+ * it fails, the function is called again by io_uring_complete().
+ */
+static void io_uring_run(struct snapraid_worker* worker, struct snapraid_task* task)
+{
+	struct snapraid_io* io = worker->io;
+	struct defer_struct* defer = &task->defer;
+	int ret;
+
+	defer_clear(defer);
+
+	io_defer(worker, defer);
+	worker->func(worker, task);
+	io_defer(worker, 0);
+
+	/* if no I/O was requested, the task is already completed */
+	if (defer->state == DEFER_NONE)
+		return;
+
+	ret = uring_queue(&io->ring, defer->is_write, defer->f, defer->buffer, defer->size, defer->offset, task);
+	if (ret != 0) {
+		/* LCOV_EXCL_START */
+		/* if the ring is full, do the work synchronously */
+		defer_clear(defer);
+		worker->func(worker, task);
+		/* LCOV_EXCL_STOP */
+	}
+}
+
+/**
+ * Complete the task, waiting for its I/O, and applying its advise.
+ *
+ * If the I/O or the advise fails, the worker function is called again
+ * without the deferred mode, to get the same error handling of the other modes.
+ */
+static void io_uring_complete(struct snapraid_worker* worker, struct snapraid_task* task)
+{
+	struct defer_struct* defer = &task->defer;
+
+	while (defer->state == DEFER_QUEUED)
+		io_uring_reap(worker->io);
+
+	if (defer->state == DEFER_NONE)
+		return;
+
+	if (defer->result < 0 || (unsigned)defer->result < defer->min_size) {
+		defer_clear(defer);
+		worker->func(worker, task);
+		return;
+	}
+
+	if (defer_advise(defer) != 0) {
+		worker->func(worker, task);
+		return;
+	}
+
+	/* pad with 0 */
+	if (defer->min_size < defer->size)
+		memset(defer->buffer + defer->min_size, 0, defer->size - defer->min_size);
+}
+
+/**
+ * Complete a write task, and count its errors.
+ */
+static void io_uring_write_complete(struct snapraid_worker* worker, struct snapraid_task* task)
+{
+	struct snapraid_io* io = worker->io;
+	int error_index;
+
+	if (task->state == TASK_STATE_EMPTY)
+		return;
+
+	io_uring_complete(worker, task);
+
+	/* counts the number of errors in the global state */
+	error_index = task->state - IO_WRITER_ERROR_BASE;
+	if (error_index >= 0 && error_index < IO_WRITER_ERROR_MAX)
+		++io->writer_error[error_index];
+
+	/* don't count it again */
+	task->state = TASK_STATE_EMPTY;
+}
+
+/**
+ * Run all the reader tasks at the specified index, and submit their I/O.
+ */
+static void io_uring_read_sched(struct snapraid_io* io, unsigned task_index)
+{
+	unsigned i;
+
+	for (i = 0; i < io->reader_max; ++i) {
+		struct snapraid_worker* worker = &io->reader_map[i];
+		struct snapraid_task* task = &worker->task_map[task_index];
+
+		/* if we reached the end */
+		if (task->state == TASK_STATE_EMPTY) {
+			defer_clear(&task->defer);
+			continue;
+		}
+
+		io_uring_run(worker, task);
+	}
+
+	io_uring_submit(io);
+}
+
+static block_off_t io_read_next_uring(struct snapraid_io* io, void*** buffer)
+{
+	block_off_t blockcur_schedule;
+	unsigned i;
+
+	/* get the next parity position to process */
+	blockcur_schedule = io_position_next(io);
+
+	/* ensure that all data/parity was read */
+	assert(io->reader_list[0] == io->reader_max);
+
+	/* setup the list of workers to process */
+	for (i = 0; i <= io->reader_max; ++i)
+		io->reader_list[i] = i;
+
+	/* schedule the next read in the tasks just released by the caller */
+	io_reader_sched(io, io->reader_index, blockcur_schedule);
+	io_uring_read_sched(io, io->reader_index);
+
+	/* set the index for the tasks to return to the caller */
+	io->reader_index = (io->reader_index + 1) % io->io_max;
+
+	/* the parity buffers at this index may be still in writing */
+	for (i = 0; i < io->writer_max; ++i) {
+		struct snapraid_worker* worker = &io->writer_map[i];
+
+		io_uring_write_complete(worker, &worker->task_map[io->reader_index]);
+	}
+
+	/* set the buffer to use */
+	*buffer = io->buffer_map[io->reader_index];
+
+	/* get the position to operate at high level from one task */
+	return io->reader_map[0].task_map[io->reader_index].position;
+}
+
+static void io_write_preset_uring(struct snapraid_io* io, block_off_t blockcur, int skip)
+{
+	(void)io;
+	(void)blockcur;
+	(void)skip;
+}
+
+static void io_write_next_uring(struct snapraid_io* io, block_off_t blockcur, int skip, int* writer_error)
+{
+	unsigned i;
+
+	/* ensure that all parity was written */
+	assert(io->writer_list[0] == io->writer_max);
+
+	/* setup the list of workers to process */
+	for (i = 0; i <= io->writer_max; ++i)
+		io->writer_list[i] = i;
+
+	/* report errors */
+	for (i = 0; i < IO_WRITER_ERROR_MAX; ++i) {
+		writer_error[i] = io->writer_error[i];
+		io->writer_error[i] = 0;
+	}
+
+	/* the writes use the same index of the reads */
+	if (skip) {
+		/* skip the next write */
+		io_writer_sched_empty(io, io->reader_index, blockcur);
+	} else {
+		/* schedule the next write */
+		io_writer_sched(io, io->reader_index, blockcur);
+	}
+
+	for (i = 0; i < io->writer_max; ++i) {
+		struct snapraid_worker* worker = &io->writer_map[i];
+		struct snapraid_task* task = &worker->task_map[io->reader_index];
+
+		defer_clear(&task->defer);
+		if (task->state != TASK_STATE_EMPTY)
+			io_uring_run(worker, task);
+	}
+
+	io_uring_submit(io);
+}
+
+static void io_refresh_uring(struct snapraid_io* io)
+{
+	unsigned i;
+
+	/* for all workers, count the number of completed blocks */
+	/* for writers this is a kind of "opposite" of cached blocks */
+	for (i = 0; i < io->reader_max + io->writer_max; ++i) {
+		struct snapraid_worker* worker;
+		unsigned j, cached;
+
+		if (i < io->reader_max)
+			worker = &io->reader_map[i];
+		else
+			worker = &io->writer_map[i - io->reader_max];
+
+		cached = 0;
+		for (j = 1; j < io->io_max; ++j) {
+			unsigned index = (io->reader_index + j) % io->io_max;
+
+			if (worker->task_map[index].defer.state == DEFER_QUEUED)
+				break;
+
+			++cached;
+		}
+
+		if (worker->parity_handle)
+			io->state->parity[worker->parity_handle->level].cached_blocks = cached;
+		else
+			worker->handle->disk->cached_blocks = cached;
+	}
+}
+
+static struct snapraid_task* io_task_read_uring(struct snapraid_io* io, unsigned base, unsigned count, unsigned* pos, unsigned* waiting_map, unsigned* waiting_mac)
+{
+	unsigned waiting_cycle;
+
+	/* count the waiting cycle */
+	waiting_cycle = 0;
+
+	/* clear the waiting indexes */
+	*waiting_mac = 0;
+
+	while (1) {
+		unsigned char* let;
+
+		/* search for a worker that has already finished */
+		let = &io->reader_list[0];
+		while (1) {
+			unsigned i = *let;
+
+			/* if we are at the end */
+			if (i == io->reader_max)
+				break;
+
+			/* if it's in range */
+			if (base <= i && i < base + count) {
+				struct snapraid_worker* worker;
+				struct snapraid_task* task;
+
+				/* if it's the first cycle */
+				if (waiting_cycle == 0) {
+					/* store the waiting indexes */
+					waiting_map[(*waiting_mac)++] = i - base;
+				}
+
+				worker = &io->reader_map[i];
+				task = &worker->task_map[io->reader_index];
+
+				/* if the I/O of the task is finished */
+				if (task->defer.state != DEFER_QUEUED) {
+					/* mark the worker as processed */
+					/* setting the previous one to point at the next one */
+					*let = io->reader_list[i + 1];
+
+					/* check the result */
+					io_uring_complete(worker, task);
+
+					/* return the position */
+					*pos = i - base;
+
+					/* on the first cycle, no one is waiting */
+					if (waiting_cycle == 0)
+						*waiting_mac = 0;
+
+					return task;
+				}
+			}
+
+			/* next position to check */
+			let = &io->reader_list[i + 1];
+		}
+
+		/* if no read is finished, wait for one */
+		io_uring_reap(io);
+
+		/* count the cycles */
+		++waiting_cycle;
+	}
+}
+
+static struct snapraid_task* io_data_read_uring(struct snapraid_io* io, unsigned* pos, unsigned* waiting_map, unsigned* waiting_mac)
+{
+	return io_task_read_uring(io, io->data_base, io->data_count, pos, waiting_map, waiting_mac);
+}
+
+static struct snapraid_task* io_parity_read_uring(struct snapraid_io* io, unsigned* pos, unsigned* waiting_map, unsigned* waiting_mac)
+{
+	return io_task_read_uring(io, io->parity_base, io->parity_count, pos, waiting_map, waiting_mac);
+}
+
+static void io_parity_write_uring(struct snapraid_io* io, unsigned* pos, unsigned* waiting_map, unsigned* waiting_mac)
+{
+	unsigned i;
+
+	(void)waiting_map;
+
+	/* get the next worker, the write is scheduled by io_write_next() */
+	i = io->writer_list[0];
+
+	assert(i != io->writer_max);
+
+	/* mark the worker as processed */
+	io->writer_list[0] = io->writer_list[i + 1];
+
+	/* return the position */
+	*pos = i;
+
+	/* the buffers are already free, no one is waiting */
+	*waiting_mac = 0;
+}
+
+static void io_start_uring(struct snapraid_io* io,
+	block_off_t blockstart, block_off_t blockmax,
+	int (*block_is_enabled)(void* arg, block_off_t), void* blockarg)
+{
+	unsigned i, j;
+
+	io->block_start = blockstart;
+	io->block_max = blockmax;
+	io->block_is_enabled = block_is_enabled;
+	io->block_arg = blockarg;
+	io->block_next = blockstart;
+
+	io->done = 0;
+	io->reader_index = io->io_max - 1;
+	io->writer_index = 0;
+
+	/* clear writer errors */
+	for (i = 0; i < IO_WRITER_ERROR_MAX; ++i)
+		io->writer_error[i] = 0;
+
+	/* clear all the writer tasks */
+	for (i = 0; i < io->writer_max; ++i) {
+		struct snapraid_worker* worker = &io->writer_map[i];
+
+		for (j = 0; j < io->io_max; ++j) {
+			worker->task_map[j].state = TASK_STATE_EMPTY;
+			defer_clear(&worker->task_map[j].defer);
+		}
+	}
+
+	io_handle_cache_init(io);
+
+	/* setup the initial read pending tasks, except the latest one, */
+	/* the latest will be initialized at the fist io_read_next() call */
+	for (i = 0; i < io->io_max - 1; ++i) {
+		block_off_t blockcur = io_position_next(io);
+
+		io_reader_sched(io, i, blockcur);
+		io_uring_read_sched(io, i);
+	}
+
+	/* setup the lists of workers to process */
+	io->reader_list[0] = io->reader_max;
+	for (i = 0; i <= io->writer_max; ++i)
+		io->writer_list[i] = i;
+}
+
+static void io_stop_uring(struct snapraid_io* io)
+{
+	unsigned i, j;
+
+	/* complete all the writes */
+	for (i = 0; i < io->writer_max; ++i) {
+		struct snapraid_worker* worker = &io->writer_map[i];
+
+		for (j = 0; j < io->io_max; ++j)
+			io_uring_write_complete(worker, &worker->task_map[j]);
+	}
+
+	/* wait for all the reads, ignoring the ones not used */
+	while (io->ring.inflight != 0)
+		io_uring_reap(io);
+
+	for (i = 0; i < io->reader_max; ++i) {
+		struct snapraid_worker* worker = &io->reader_map[i];
+
+		for (j = 0; j < io->io_max; ++j)
+			defer_clear(&worker->task_map[j].defer);
+	}
+
+	io_handle_cache_done(io);
 }
 
 #endif
@@ -851,7 +1688,7 @@ void io_init(struct snapraid_io* io, struct snapraid_state* state,
 	void (*parity_writer)(struct snapraid_worker*, struct snapraid_task*),
 	struct snapraid_parity_handle* parity_handle_map, unsigned parity_handle_max)
 {
-	unsigned i;
+	unsigned i, j;
 	size_t allocated;
 
 	io->state = state;
@@ -875,6 +1712,28 @@ void io_init(struct snapraid_io* io, struct snapraid_state* state,
 	io->io_max = 1;
 #endif
 
+	io->is_uring = 0;
+	io->worker_hash = 0;
+	io->is_physical = 0;
+	io->is_coalesce = 0;
+
+#if HAVE_IO_URING
+	if (state->opt.io_uring != 0) {
+		/* one more task for the one used by the caller */
+		unsigned io_max = state->opt.io_uring + 1;
+
+		/* every worker has at most one request in flight for each task */
+		if (uring_init(&io->ring, io_max * (handle_max + parity_handle_max)) == 0) {
+			io->is_uring = 1;
+			io->io_max = io_max;
+		} else {
+			/* LCOV_EXCL_START */
+			msg_progress("Failed to setup io_uring. %s. Using the default IO mode.\n", strerror(errno));
+			/* LCOV_EXCL_STOP */
+		}
+	}
+#endif
+
 	assert(io->io_max == 1 || (io->io_max >= IO_MIN && io->io_max <= IO_MAX));
 
 	io->buffer_max = buffer_max;
@@ -913,6 +1772,10 @@ void io_init(struct snapraid_io* io, struct snapraid_state* state,
 		struct snapraid_worker* worker = &io->reader_map[i];
 
 		worker->io = io;
+		worker->cursor.pos = 0;
+
+		for (j = 0; j < IO_MAX; ++j)
+			defer_init(&worker->task_map[j].defer);
 
 		if (i < handle_max) {
 			/* it's a data read */
@@ -922,6 +1785,10 @@ void io_init(struct snapraid_io* io, struct snapraid_state* state,
 
 			/* data read is put in lower buffer index */
 			worker->buffer_skew = 0;
+
+			/* the extents are searched by the worker without locking */
+			if (handle_map[i].disk)
+				fs_index_build(handle_map[i].disk);
 		} else {
 			/* it's a parity read */
 			worker->handle = 0;
@@ -937,6 +1804,10 @@ void io_init(struct snapraid_io* io, struct snapraid_state* state,
 		struct snapraid_worker* worker = &io->writer_map[i];
 
 		worker->io = io;
+		worker->cursor.pos = 0;
+
+		for (j = 0; j < IO_MAX; ++j)
+			defer_init(&worker->task_map[j].defer);
 
 		/* it's a parity write */
 		worker->handle = 0;
@@ -947,6 +1818,21 @@ void io_init(struct snapraid_io* io, struct snapraid_state* state,
 		worker->buffer_skew = handle_max;
 	}
 
+#if HAVE_IO_URING
+	if (io->is_uring) {
+		io_read_next = io_read_next_uring;
+		io_write_preset = io_write_preset_uring;
+		io_write_next = io_write_next_uring;
+		io_refresh = io_refresh_uring;
+		io_data_read = io_data_read_uring;
+		io_parity_read = io_parity_read_uring;
+		io_parity_write = io_parity_write_uring;
+		io_start = io_start_uring;
+		io_stop = io_stop_uring;
+
+		msg_progress("Using io_uring with a queue depth of %u blocks.\n", io->io_max - 1);
+	} else
+#endif
 #if HAVE_PTHREAD
 	if (io->io_max > 1) {
 		io_read_next = io_read_next_thread;
@@ -959,6 +1845,19 @@ void io_init(struct snapraid_io* io, struct snapraid_state* state,
 		io_start = io_start_thread;
 		io_stop = io_stop_thread;
 
+		/* hash in the reader threads */
+		io->worker_hash = 1;
+
+		/* read in physical order, only if requested, as it disables the coalescing */
+		/* and the parity order already follows the disk order of not fragmented files */
+		/* in io_uring mode this is left to the kernel, as all the reads are in flight */
+		io->is_physical = state->opt.io_physical;
+
+#if HAVE_PREADV
+		/* coalesce the I/O, only if the tasks are processed in order */
+		io->is_coalesce = !io->is_physical;
+#endif
+
 		thread_mutex_init(&io->io_mutex, 0);
 		thread_cond_init(&io->read_done, 0);
 		thread_cond_init(&io->read_sched, 0);
@@ -979,6 +1878,27 @@ void io_init(struct snapraid_io* io, struct snapraid_state* state,
 	}
 }
 
+void io_data_hash(struct snapraid_worker* worker, struct snapraid_task* task)
+{
+	struct snapraid_io* io = worker->io;
+	struct snapraid_state* state = io->state;
+
+	if (!io->worker_hash)
+		return;
+
+	/* in deferred mode the data is not yet read, and it's hashed at the completion */
+	if (worker->handle->defer)
+		return;
+
+	memhash(state->hash, state->hashseed, task->hash, task->buffer, task->read_size);
+
+	/* if a rehash is in progress, the caller may need also the previous hash */
+	if (state->prevhash != HASH_UNDEFINED)
+		memhash(state->prevhash, state->prevhashseed, task->prevhash, task->buffer, task->read_size);
+
+	task->is_hashed = 1;
+}
+
 void io_done(struct snapraid_io* io)
 {
 	unsigned i;
@@ -993,8 +1913,11 @@ void io_done(struct snapraid_io* io)
 	free(io->writer_map);
 	free(io->writer_list);
 
+	if (io->is_uring)
+		uring_done(&io->ring);
+
 #if HAVE_PTHREAD
-	if (io->io_max > 1) {
+	if (io->io_max > 1 && !io->is_uring) {
 		thread_mutex_destroy(&io->io_mutex);
 		thread_cond_destroy(&io->read_done);
 		thread_cond_destroy(&io->read_sched);
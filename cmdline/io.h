@@ -22,6 +22,7 @@
 #include "support.h"
 #include "handle.h"
 #include "parity.h"
+#include "uring.h"
 
 /**
  * Number of read-ahead buffers.
@@ -42,6 +43,11 @@
 #define IO_MIN 3 /* required by writers, readers can work also with 2 */
 #define IO_MAX 128
 
+/**
+ * Max number of blocks coalesced in a single read.
+ */
+#define IO_COALESCE_MAX 16
+
 /**
  * State of the task.
  */
@@ -78,6 +84,44 @@ struct snapraid_task {
 	block_off_t file_pos;
 	int read_size; /**< Size of the data read. */
 	int is_timestamp_different; /**< Report if file has a changed timestamp. */
+
+	/**
+	 * Hash of the data read, computed by the worker with io_data_hash().
+	 *
+	 * Valid only if ::is_hashed is set.
+	 * The ::prevhash is computed only if a rehash is in progress.
+	 */
+	int is_hashed;
+	unsigned char hash[HASH_MAX];
+	unsigned char prevhash[HASH_MAX];
+
+	/**
+	 * If the task was already completed by the I/O coalesced
+	 * with a previous task.
+	 */
+	int is_coalesced;
+
+	/**
+	 * Physical order of the task.
+	 *
+	 * Used only in physical mode to sort the pending reads of a worker.
+	 * The order is the physical offset of the file, then its inode,
+	 * and then the block position inside the file.
+	 * The ::is_done flag reports if the read is completed,
+	 * and it's protected by the io mutex.
+	 */
+	int is_done;
+	uint64_t order_physical;
+	uint64_t order_inode;
+	block_off_t order_pos;
+
+	/**
+	 * Deferred I/O of the task.
+	 *
+	 * Used in io_uring mode to keep track of the request in flight,
+	 * and in coalesced mode to collect the requests to merge.
+	 */
+	struct defer_struct defer;
 };
 
 /**
@@ -114,13 +158,30 @@ struct snapraid_worker {
 	 * The task in progress by the worker thread.
 	 *
 	 * It's an index inside in the ::task_map vector.
+	 *
+	 * In physical mode it's ::io_max if no task is in progress.
 	 */
 	unsigned index;
 
+	/**
+	 * Physical order of the latest task started.
+	 *
+	 * Used only in physical mode to continue the sweep from
+	 * where the disk head is.
+	 */
+	uint64_t order_physical;
+	uint64_t order_inode;
+	block_off_t order_pos;
+
 	/**
 	 * Which buffer base index should be used for destination.
 	 */
 	unsigned buffer_skew;
+
+	/**
+	 * Cursor for searching the extents of the disk.
+	 */
+	struct snapraid_extent_cursor cursor;
 };
 
 /**
@@ -147,6 +208,51 @@ struct snapraid_io {
 	 */
 	unsigned io_max;
 
+	/**
+	 * If the io_uring mode is used.
+	 *
+	 * In this mode no thread is used. The worker functions are called
+	 * by the IO itself with the handles in deferred mode, and the
+	 * resulting requests are all submitted to a single ring.
+	 * The ::io_max tasks of every worker are the queue depth of the device.
+	 */
+	int is_uring;
+	struct snapraid_uring ring;
+
+	/**
+	 * If the data readers have to compute the hash of the data read.
+	 *
+	 * Enabled only if the workers are threads, to spread the hashing
+	 * over multiple cores instead of doing it in the main thread.
+	 */
+	int worker_hash;
+
+	/**
+	 * If the reads are done in physical order.
+	 *
+	 * Enabled only if requested, and if the workers are threads. Every
+	 * reader processes its pending tasks not in parity order, but sweeping
+	 * them in the physical order of the files on the disk.
+	 * The caller still gets the tasks in parity order.
+	 *
+	 * It applies only to the commands using the workers, like sync and scrub,
+	 * as check and fix read the blocks synchronously.
+	 */
+	int is_physical;
+
+	/**
+	 * If the reads of consecutive tasks are coalesced.
+	 *
+	 * Enabled only if the workers are threads, and not in physical order.
+	 * When a reader starts a task, it collects also the read requests of the
+	 * following pending tasks, and the ones accessing contiguous data of the
+	 * same file are done with a single preadv().
+	 *
+	 * Writers are not coalesced, because the parity handles are also used
+	 * directly by the main thread while the writers are running.
+	 */
+	int is_coalesce;
+
 #if HAVE_PTHREAD
 	/**
 	 * Mutex used to protect the synchronization
@@ -305,6 +411,14 @@ void io_init(struct snapraid_io* io, struct snapraid_state* state,
 	void (*parity_writer)(struct snapraid_worker*, struct snapraid_task*),
 	struct snapraid_parity_handle* parity_handle_map, unsigned parity_handle_max);
 
+/**
+ * Compute the hash of the data read by a task.
+ *
+ * It must be called by the data reader functions after a successful read.
+ * It does nothing if ::worker_hash is not set.
+ */
+void io_data_hash(struct snapraid_worker* worker, struct snapraid_task* task);
+
 /**
  * Deinitialize te InputOutput workers.
  */
@@ -0,0 +1,1305 @@
+/*
+ * Copyright (C) 2016 Andrea Mazzoleni
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "portable.h"
+
+#include "support.h"
+#include "elem.h"
+#include "state.h"
+#include "journal.h"
+
+/****************************************************************************/
+/* journal */
+
+/**
+ * Max length of a journal line.
+ *
+ * The path is escaped, and it may double its size.
+ */
+#define JOURNAL_LINE_MAX (4 * PATH_MAX)
+
+/**
+ * Extension of the barrier files, followed by the nonce.
+ *
+ * They are created near the journal by the scan, and the watcher
+ * replies with a "b" line with the same nonce.
+ */
+#define JOURNAL_BARRIER_EXT ".barrier."
+
+/**
+ * Time to wait for the watcher to reply to the barrier, in milliseconds.
+ */
+#define JOURNAL_BARRIER_TIMEOUT 5000
+
+/**
+ * Interval to check the reply of the watcher, in milliseconds.
+ */
+#define JOURNAL_BARRIER_SLEEP 10
+
+/**
+ * Escape a path to write it in a single line.
+ *
+ * The buffer must be at least two times the path length, plus one.
+ * Return the length of the escaped path.
+ */
+static size_t journal_esc(char* buffer, const char* str)
+{
+	char* p = buffer;
+
+	while (*str) {
+		char c = *str++;
+
+		switch (c) {
+		case '\\' :
+			*p++ = '\\';
+			*p++ = '\\';
+			break;
+		case '\n' :
+			*p++ = '\\';
+			*p++ = 'n';
+			break;
+		default :
+			*p++ = c;
+		}
+	}
+
+	*p = 0;
+
+	return p - buffer;
+}
+
+/**
+ * Unescape a path in place.
+ * Return -1 if the escape is invalid.
+ */
+static int journal_unesc(char* str)
+{
+	char* p = str;
+
+	while (*str) {
+		char c = *str++;
+
+		if (c == '\\') {
+			c = *str++;
+			switch (c) {
+			case '\\' :
+				break;
+			case 'n' :
+				c = '\n';
+				break;
+			default :
+				return -1;
+			}
+		}
+
+		*p++ = c;
+	}
+
+	*p = 0;
+
+	return 0;
+}
+
+/**
+ * CRC of the configuration that affects the scan.
+ *
+ * If the disks or the filters change, the files not changed may
+ * be now included or excluded, and a complete scan is required.
+ */
+static uint32_t journal_config_crc(struct snapraid_state* state)
+{
+	uint32_t crc = 0;
+	unsigned char buf[4];
+	tommy_node* i;
+
+	for (i = state->disklist; i != 0; i = i->next) {
+		struct snapraid_disk* disk = i->data;
+
+		crc = crc32c(crc, (const unsigned char*)disk->name, strlen(disk->name) + 1);
+		crc = crc32c(crc, (const unsigned char*)disk->dir, strlen(disk->dir) + 1);
+	}
+
+	for (i = state->filterlist; i != 0; i = i->next) {
+		struct snapraid_filter* filter = i->data;
+
+		crc = crc32c(crc, (const unsigned char*)filter->pattern, strlen(filter->pattern) + 1);
+
+		buf[0] = filter->is_disk;
+		buf[1] = filter->is_path;
+		buf[2] = filter->is_dir;
+		buf[3] = filter->direction > 0;
+		crc = crc32c(crc, buf, 4);
+	}
+
+	buf[0] = state->filter_hidden != 0;
+	crc = crc32c(crc, buf, 1);
+
+	return crc;
+}
+
+void journal_checkpoint_read(struct snapraid_state* state)
+{
+	char path[PATH_MAX];
+	FILE* f;
+	uint64_t id;
+	uint64_t pos;
+	uint32_t content_crc;
+	uint32_t config_crc;
+	int ret;
+
+	state->journal_id = 0;
+	state->journal_pos = 0;
+
+	if (state->journalfile[0] == 0)
+		return;
+
+	pathprint(path, sizeof(path), "%s.pos", state->journalfile);
+
+	f = fopen(path, "r");
+	if (!f) {
+		/* no checkpoint */
+		return;
+	}
+
+	ret = fscanf(f, "%" SCNx64 " %" SCNu64 " %" SCNx32 " %" SCNx32, &id, &pos, &content_crc, &config_crc);
+
+	fclose(f);
+
+	if (ret != 4) {
+		/* LCOV_EXCL_START */
+		log_fatal("WARNING! Ignoring the invalid journal position '%s'.\n", path);
+		return;
+		/* LCOV_EXCL_STOP */
+	}
+
+	/* the checkpoint is valid only for the content file that was written with it */
+	if (content_crc != state->content_crc)
+		return;
+
+	/* and only if the scan would include the same files */
+	if (config_crc != journal_config_crc(state))
+		return;
+
+	state->journal_id = id;
+	state->journal_pos = pos;
+}
+
+void journal_checkpoint_write(struct snapraid_state* state)
+{
+	char path[PATH_MAX];
+	char tmp[PATH_MAX];
+	FILE* f;
+
+	if (state->journalfile[0] == 0)
+		return;
+
+	pathprint(path, sizeof(path), "%s.pos", state->journalfile);
+
+	if (state->journal_id == 0) {
+		/* without a position, the next scan has to be complete */
+		if (remove(path) != 0 && errno != ENOENT) {
+			/* LCOV_EXCL_START */
+			log_fatal("WARNING! Error removing the journal position '%s'. %s.\n", path, strerror(errno));
+			/* LCOV_EXCL_STOP */
+		}
+		return;
+	}
+
+	pathprint(tmp, sizeof(tmp), "%s.tmp", path);
+
+	f = fopen(tmp, "w");
+	if (!f) {
+		/* LCOV_EXCL_START */
+		log_fatal("WARNING! Error creating the journal position '%s'. %s.\n", tmp, strerror(errno));
+		return;
+		/* LCOV_EXCL_STOP */
+	}
+
+	fprintf(f, "%" PRIx64 " %" PRIu64 " %08x %08x\n", state->journal_id, state->journal_pos, state->content_crc, journal_config_crc(state));
+
+	if (fclose(f) != 0) {
+		/* LCOV_EXCL_START */
+		log_fatal("WARNING! Error writing the journal position '%s'. %s.\n", tmp, strerror(errno));
+		remove(tmp);
+		return;
+		/* LCOV_EXCL_STOP */
+	}
+
+	/* if the rename fails, the old checkpoint doesn't match the new content file */
+	if (rename(tmp, path) != 0) {
+		/* LCOV_EXCL_START */
+		log_fatal("WARNING! Error renaming the journal position '%s'. %s.\n", tmp, strerror(errno));
+		remove(tmp);
+		/* LCOV_EXCL_STOP */
+	}
+}
+
+static int journal_dir_compare(const void* void_arg, const void* void_data)
+{
+	const char* arg = void_arg;
+	const struct snapraid_journal_dir* dir = void_data;
+
+	return strcmp(arg, dir->sub);
+}
+
+static inline tommy_uint32_t journal_dir_hash(const char* sub)
+{
+	return tommy_hash_u32(0, sub, strlen(sub));
+}
+
+static struct snapraid_journal_dir* journal_dir_search(struct snapraid_journal_disk* jdisk, const char* sub)
+{
+	return tommy_hashdyn_search(&jdisk->dirset, journal_dir_compare, sub, journal_dir_hash(sub));
+}
+
+static void journal_dir_set(struct snapraid_journal_disk* jdisk, const char* sub, unsigned flags)
+{
+	struct snapraid_journal_dir* dir;
+
+	dir = journal_dir_search(jdisk, sub);
+	if (!dir) {
+		dir = malloc_nofail(sizeof(struct snapraid_journal_dir));
+		dir->sub = strdup_nofail(sub);
+		dir->flags = 0;
+		tommy_hashdyn_insert(&jdisk->dirset, &dir->node, dir, journal_dir_hash(sub));
+	}
+
+	dir->flags |= flags;
+}
+
+static void journal_dir_free(struct snapraid_journal_dir* dir)
+{
+	free(dir->sub);
+	free(dir);
+}
+
+void journal_mark(struct snapraid_journal_disk* jdisk, const char* sub, unsigned flags)
+{
+	char parent[PATH_MAX];
+	size_t len;
+	size_t i;
+
+	journal_dir_set(jdisk, sub, flags);
+
+	if (flags & JOURNAL_TREE)
+		jdisk->has_tree = 1;
+
+	len = strlen(sub);
+	if (len == 0)
+		return;
+
+	/* the disk root is always a parent */
+	journal_dir_set(jdisk, "", JOURNAL_PATH);
+
+	/* all the parents, excluding the final slash */
+	for (i = 0; i + 1 < len; ++i) {
+		if (sub[i] == '/') {
+			memcpy(parent, sub, i + 1);
+			parent[i + 1] = 0;
+			journal_dir_set(jdisk, parent, JOURNAL_PATH);
+		}
+	}
+}
+
+struct snapraid_journal_disk* journal_disk(struct snapraid_journal* journal, const char* name)
+{
+	tommy_node* i;
+
+	for (i = journal->disklist; i != 0; i = i->next) {
+		struct snapraid_journal_disk* jdisk = i->data;
+
+		if (strcmp(jdisk->name, name) == 0)
+			return jdisk;
+	}
+
+	return 0;
+}
+
+static struct snapraid_journal_disk* journal_disk_get(struct snapraid_journal* journal, const char* name)
+{
+	struct snapraid_journal_disk* jdisk;
+
+	jdisk = journal_disk(journal, name);
+	if (jdisk)
+		return jdisk;
+
+	jdisk = malloc_nofail(sizeof(struct snapraid_journal_disk));
+	pathcpy(jdisk->name, sizeof(jdisk->name), name);
+	tommy_hashdyn_init(&jdisk->dirset);
+	jdisk->has_tree = 0;
+	tommy_list_insert_tail(&journal->disklist, &jdisk->node, jdisk);
+
+	return jdisk;
+}
+
+void journal_done(struct snapraid_journal* journal)
+{
+	tommy_node* i;
+
+	i = journal->disklist;
+	while (i) {
+		struct snapraid_journal_disk* jdisk = i->data;
+
+		i = i->next;
+
+		tommy_hashdyn_foreach(&jdisk->dirset, (tommy_foreach_func*)journal_dir_free);
+		tommy_hashdyn_done(&jdisk->dirset);
+		free(jdisk);
+	}
+
+	tommy_list_init(&journal->disklist);
+}
+
+unsigned journal_dir_flags(struct snapraid_journal_disk* jdisk, const char* sub)
+{
+	struct snapraid_journal_dir* dir;
+
+	if (!jdisk)
+		return 0;
+
+	dir = journal_dir_search(jdisk, sub);
+	if (!dir)
+		return 0;
+
+	return dir->flags;
+}
+
+int journal_dir_is_changed(struct snapraid_journal_disk* jdisk, const char* sub)
+{
+	char parent[PATH_MAX];
+	size_t len;
+	size_t i;
+
+	if (!jdisk)
+		return 0;
+
+	if (journal_dir_flags(jdisk, sub) & (JOURNAL_DIR | JOURNAL_TREE))
+		return 1;
+
+	if (!jdisk->has_tree)
+		return 0;
+
+	/* check the parents for a tree change */
+	len = strlen(sub);
+	for (i = 0; i < len; ++i) {
+		if (i == 0 || sub[i - 1] == '/') {
+			memcpy(parent, sub, i);
+			parent[i] = 0;
+			if (journal_dir_flags(jdisk, parent) & JOURNAL_TREE)
+				return 1;
+		}
+	}
+
+	return 0;
+}
+
+int journal_dir_is_read(struct snapraid_journal_disk* jdisk, const char* sub)
+{
+	if (journal_dir_flags(jdisk, sub) != 0)
+		return 1;
+
+	return journal_dir_is_changed(jdisk, sub);
+}
+
+/**
+ * Apply a change line of the journal.
+ * Return -1 if the line is invalid.
+ */
+static int journal_line(struct snapraid_state* state, struct snapraid_journal* journal, char* line)
+{
+	struct snapraid_journal_disk* jdisk;
+	tommy_node* i;
+	unsigned flags;
+	char* name;
+	char* sub;
+	char* space;
+
+	switch (line[0]) {
+	case 'd' :
+		flags = JOURNAL_DIR;
+		break;
+	case 't' :
+		flags = JOURNAL_TREE;
+		break;
+	default :
+		return -1;
+	}
+
+	if (line[1] != ' ')
+		return -1;
+
+	name = line + 2;
+	space = strchr(name, ' ');
+	if (!space)
+		return -1;
+	*space = 0;
+	sub = space + 1;
+
+	if (journal_unesc(sub) != 0)
+		return -1;
+
+	/* ignore disks not in the configuration */
+	for (i = state->disklist; i != 0; i = i->next) {
+		struct snapraid_disk* disk = i->data;
+		if (strcmp(disk->name, name) == 0)
+			break;
+	}
+	if (i == 0)
+		return 0;
+
+	jdisk = journal_disk_get(journal, name);
+
+	journal_mark(jdisk, sub, flags);
+
+	return 0;
+}
+
+#if HAVE_FLOCK
+/**
+ * Create the barrier file for the watcher.
+ *
+ * The watcher gets the event of the barrier after the events of all the
+ * changes done before, and it writes in the journal the "b" line with the
+ * same nonce after the lines of such changes.
+ *
+ * Return -1 if the barrier cannot be created.
+ */
+static int journal_barrier(struct snapraid_state* state, char* nonce, size_t nonce_size)
+{
+	char path[PATH_MAX];
+	uint64_t value;
+	int f;
+
+	if (randomize(&value, sizeof(value)) != 0)
+		return -1;
+
+	snprintf(nonce, nonce_size, "%016" PRIx64, value);
+
+	pathprint(path, sizeof(path), "%s%s", state->journalfile, JOURNAL_BARRIER_EXT);
+	pathcat(path, sizeof(path), nonce);
+
+	f = open(path, O_WRONLY | O_CREAT | O_EXCL | O_BINARY, 0600);
+	if (f == -1)
+		return -1;
+
+	close(f);
+
+	remove(path);
+
+	return 0;
+}
+#endif
+
+int journal_load(struct snapraid_state* state, struct snapraid_journal* journal)
+{
+	char line[JOURNAL_LINE_MAX];
+	char nonce[32];
+	uint64_t prev_id;
+	uint64_t prev_pos;
+	uint64_t id;
+	uint64_t pos;
+	int is_changed;
+	int is_lost;
+	int is_barrier;
+	unsigned wait;
+	FILE* f;
+
+	tommy_list_init(&journal->disklist);
+
+	nonce[0] = 0;
+	prev_id = state->journal_id;
+	prev_pos = state->journal_pos;
+
+	/* without a running watcher, the changes cannot be tracked */
+	state->journal_id = 0;
+	state->journal_pos = 0;
+
+	if (state->journalfile[0] == 0)
+		return -1;
+
+	f = fopen(state->journalfile, "r");
+	if (!f)
+		return -1;
+
+#if HAVE_FLOCK
+	/* the watcher keeps the journal locked while running */
+	/* if we can lock it, the changes after the watcher stopped are missing */
+	if (flock(fileno(f), LOCK_SH | LOCK_NB) == 0 || errno != EWOULDBLOCK) {
+		fclose(f);
+		return -1;
+	}
+#else
+	fclose(f);
+	return -1;
+#endif
+
+	/* the journal starts with the watcher ID */
+	/* if missing, the watcher is still starting */
+	if (fgets(line, sizeof(line), f) == 0
+		|| sscanf(line, "j %" SCNx64, &id) != 1
+		|| id == 0
+	) {
+		fclose(f);
+		return -1;
+	}
+
+	pos = ftell(f);
+
+	/* the changes are available only if the previous scan used the same watcher */
+	is_changed = prev_id == id && prev_pos >= pos;
+
+	if (is_changed)
+		pos = prev_pos;
+
+#if HAVE_FLOCK
+	/* the changes done until now may be still queued in the watcher */
+	/* without the barrier we cannot know when they are in the journal */
+	is_barrier = journal_barrier(state, nonce, sizeof(nonce)) == 0;
+	if (!is_barrier)
+		is_changed = 0;
+#else
+	is_barrier = 0;
+#endif
+
+	/* read all the complete lines, until the barrier, to get the position where the next scan starts */
+	is_lost = 0;
+	wait = 0;
+	while (1) {
+		size_t len;
+
+		if (fseek(f, pos, SEEK_SET) != 0) {
+			/* LCOV_EXCL_START */
+			fclose(f);
+			return -1;
+			/* LCOV_EXCL_STOP */
+		}
+
+		if (fgets(line, sizeof(line), f) != 0)
+			len = strlen(line);
+		else
+			len = 0;
+
+		/* at the end, or in a line not yet completely written by the watcher */
+		if (len == 0 || line[len - 1] != '\n') {
+			if (!is_barrier)
+				break;
+
+			/* if the watcher doesn't reply, the changes are unknown */
+			if (wait >= JOURNAL_BARRIER_TIMEOUT) {
+				is_changed = 0;
+				break;
+			}
+
+			usleep(JOURNAL_BARRIER_SLEEP * 1000);
+			wait += JOURNAL_BARRIER_SLEEP;
+			continue;
+		}
+
+		pos += len;
+
+		line[len - 1] = 0;
+
+		switch (line[0]) {
+		case 'b' :
+			/* all the changes before the barrier are in the journal */
+			if (line[1] == ' ' && strcmp(line + 2, nonce) == 0)
+				is_barrier = 0;
+			continue;
+		case 'o' :
+		case 's' :
+			/* some directories are not watched anymore */
+			is_lost = 1;
+			is_changed = 0;
+			continue;
+		case 'r' :
+			/* all the directories are watched again */
+			is_lost = 0;
+			continue;
+		}
+
+		if (!is_changed)
+			continue;
+
+		if (journal_line(state, journal, line) != 0)
+			is_changed = 0;
+	}
+
+	fclose(f);
+
+	/* the next scan starts from here */
+	/* but if the watcher is still recovering from lost events, the next scan has to be complete */
+	if (!is_lost) {
+		state->journal_id = id;
+		state->journal_pos = pos;
+	}
+
+	if (!is_changed) {
+		journal_done(journal);
+		return -1;
+	}
+
+	return 0;
+}
+
+/****************************************************************************/
+/* watch */
+
+#if HAVE_SYS_INOTIFY_H && HAVE_POLL_H && HAVE_FLOCK
+
+/**
+ * Events that change the scan.
+ */
+#define WATCH_MASK (IN_CREATE | IN_DELETE | IN_MODIFY | IN_ATTRIB | IN_CLOSE_WRITE | IN_MOVED_FROM | IN_MOVED_TO | IN_UNMOUNT | IN_ONLYDIR | IN_DONT_FOLLOW | IN_EXCL_UNLINK)
+
+/**
+ * Size of the buffer to write the journal.
+ */
+#define WATCH_BUFFER_MAX (64 * 1024)
+
+/**
+ * Directory watched.
+ */
+struct watch_dir {
+	int wd; /**< Watch descriptor. */
+	struct snapraid_disk* disk; /**< Disk of the directory. */
+	char* sub; /**< Path relative to the disk. It's empty or it terminates with /. */
+
+	/* nodes for data structures */
+	tommy_hashdyn_node node;
+};
+
+/**
+ * Line waiting to be written in the journal.
+ */
+struct watch_line {
+	tommy_node node;
+	tommy_hashdyn_node nodeset;
+	char line[]; /**< Line. It must be the last field. */
+};
+
+struct watch_context {
+	struct snapraid_state* state;
+	int f; /**< Handle of inotify. */
+	int journal; /**< Handle of the journal. */
+	tommy_hashdyn dirset; /**< Directories watched, by watch descriptor. */
+	tommy_list linelist; /**< Lines to write, in order. */
+	tommy_hashdyn lineset; /**< Lines to write, to remove duplicates. */
+	int barrier_wd; /**< Watch descriptor of the directory of the journal, where the barriers are created. */
+	char barrier_name[PATH_MAX]; /**< Name of the barrier files, without the nonce. */
+	int is_lost; /**< If some events were lost. */
+	unsigned count_dir; /**< Number of directories watched. */
+	char buffer[WATCH_BUFFER_MAX]; /**< Buffer to write the journal. */
+	char* event; /**< Buffer to read the events. Allocated to be aligned for struct inotify_event. */
+	size_t buffer_len; /**< Bytes used in the buffer. */
+};
+
+static int watch_dir_compare(const void* void_arg, const void* void_data)
+{
+	const int* arg = void_arg;
+	const struct watch_dir* dir = void_data;
+
+	return *arg != dir->wd;
+}
+
+static inline tommy_uint32_t watch_dir_hash(int wd)
+{
+	return tommy_inthash_u32(wd);
+}
+
+static void watch_dir_free(struct watch_dir* dir)
+{
+	free(dir->sub);
+	free(dir);
+}
+
+static int watch_line_compare(const void* void_arg, const void* void_data)
+{
+	const char* arg = void_arg;
+	const struct watch_line* line = void_data;
+
+	return strcmp(arg, line->line);
+}
+
+/**
+ * Write data in the journal.
+ */
+static void watch_write(struct watch_context* context, const char* data, size_t size)
+{
+	while (size > 0) {
+		ssize_t ret = write(context->journal, data, size);
+		if (ret < 0) {
+			/* LCOV_EXCL_START */
+			if (errno == EINTR)
+				continue;
+			log_fatal("Error writing the journal '%s'. %s.\n", context->state->journalfile, strerror(errno));
+			exit(EXIT_FAILURE);
+			/* LCOV_EXCL_STOP */
+		}
+		data += ret;
+		size -= ret;
+	}
+}
+
+static void watch_restore(struct watch_context* context);
+
+/**
+ * Write all the pending lines in the journal.
+ *
+ * Lines are written only whole in a single write to allow
+ * the scan to read the journal while the watcher is running.
+ */
+static void watch_flush(struct watch_context* context)
+{
+	tommy_node* i;
+
+	if (context->is_lost) {
+		tommy_list_foreach(&context->linelist, free);
+		tommy_list_init(&context->linelist);
+		tommy_hashdyn_done(&context->lineset);
+		tommy_hashdyn_init(&context->lineset);
+
+		/* the changes are now unknown */
+		watch_write(context, "o\n", 2);
+
+		context->is_lost = 0;
+
+		watch_restore(context);
+		return;
+	}
+
+	context->buffer_len = 0;
+
+	i = context->linelist;
+	while (i) {
+		struct watch_line* line = i->data;
+		size_t len = strlen(line->line);
+
+		i = i->next;
+
+		if (context->buffer_len + len > WATCH_BUFFER_MAX) {
+			watch_write(context, context->buffer, context->buffer_len);
+			context->buffer_len = 0;
+		}
+
+		memcpy(context->buffer + context->buffer_len, line->line, len);
+		context->buffer_len += len;
+
+		free(line);
+	}
+
+	if (context->buffer_len != 0)
+		watch_write(context, context->buffer, context->buffer_len);
+
+	tommy_list_init(&context->linelist);
+	tommy_hashdyn_done(&context->lineset);
+	tommy_hashdyn_init(&context->lineset);
+}
+
+/**
+ * Add a change in the journal.
+ */
+static void watch_mark(struct watch_context* context, char kind, struct snapraid_disk* disk, const char* sub)
+{
+	char esc[2 * PATH_MAX + 1];
+	char buffer[JOURNAL_LINE_MAX];
+	struct watch_line* line;
+	tommy_uint32_t hash;
+	size_t len;
+
+	journal_esc(esc, sub);
+
+	len = snprintf(buffer, sizeof(buffer), "%c %s %s\n", kind, disk->name, esc);
+	if (len >= sizeof(buffer)) {
+		/* LCOV_EXCL_START */
+		context->is_lost = 1;
+		return;
+		/* LCOV_EXCL_STOP */
+	}
+
+	hash = tommy_hash_u32(0, buffer, len);
+
+	/* if already present, nothing to do */
+	if (tommy_hashdyn_search(&context->lineset, watch_line_compare, buffer, hash) != 0)
+		return;
+
+	line = malloc_nofail(sizeof(struct watch_line) + len + 1);
+	memcpy(line->line, buffer, len + 1);
+
+	tommy_list_insert_tail(&context->linelist, &line->node, line);
+	tommy_hashdyn_insert(&context->lineset, &line->nodeset, line, hash);
+}
+
+/**
+ * Watch a directory and all its sub directories.
+ */
+static void watch_tree(struct watch_context* context, struct snapraid_disk* disk, const char* sub)
+{
+	struct snapraid_state* state = context->state;
+	char path[PATH_MAX];
+	struct watch_dir* dir;
+	DIR* d;
+	int wd;
+
+	pathprint(path, sizeof(path), "%s%s", disk->dir, sub);
+
+	wd = inotify_add_watch(context->f, path, WATCH_MASK);
+	if (wd < 0) {
+		/* if already removed, or replaced, there is nothing to watch */
+		if (errno == ENOENT || errno == ENOTDIR)
+			return;
+
+		/* LCOV_EXCL_START */
+		if (errno == ENOSPC)
+			log_fatal("WARNING! Too many directories to watch. Increase /proc/sys/fs/inotify/max_user_watches.\n");
+		else
+			log_fatal("WARNING! Error watching directory '%s'. %s.\n", path, strerror(errno));
+		context->is_lost = 1;
+		return;
+		/* LCOV_EXCL_STOP */
+	}
+
+	/* a moved directory keeps the same watch, update its path */
+	dir = tommy_hashdyn_search(&context->dirset, watch_dir_compare, &wd, watch_dir_hash(wd));
+	if (dir) {
+		free(dir->sub);
+		dir->sub = strdup_nofail(sub);
+		dir->disk = disk;
+	} else {
+		dir = malloc_nofail(sizeof(struct watch_dir));
+		dir->wd = wd;
+		dir->disk = disk;
+		dir->sub = strdup_nofail(sub);
+		tommy_hashdyn_insert(&context->dirset, &dir->node, dir, watch_dir_hash(wd));
+		++context->count_dir;
+	}
+
+	/* read the directory after watching it, to not miss new sub directories */
+	d = opendir(path);
+	if (!d) {
+		/* if already removed, it's reported by the parent */
+		if (errno == ENOENT || errno == ENOTDIR)
+			return;
+
+		/* LCOV_EXCL_START */
+		log_fatal("WARNING! Error opening directory '%s'. %s.\n", path, strerror(errno));
+		context->is_lost = 1;
+		return;
+		/* LCOV_EXCL_STOP */
+	}
+
+	while (1) {
+		char sub_next[PATH_MAX];
+		char path_next[PATH_MAX];
+		struct snapraid_filter* reason = 0;
+		struct dirent* dd;
+		const char* name;
+		struct stat st;
+
+		dd = readdir(d);
+		if (dd == 0)
+			break;
+
+		name = dd->d_name;
+		if (name[0] == '.' && (name[1] == 0 || (name[1] == '.' && name[2] == 0)))
+			continue;
+
+#if HAVE_STRUCT_DIRENT_D_TYPE
+		if (dd->d_type != DT_DIR && dd->d_type != DT_UNKNOWN)
+			continue;
+#endif
+
+		/* the excluded directories are never scanned */
+		if (filter_hidden(state->filter_hidden, dd) != 0)
+			continue;
+
+		pathprint(sub_next, sizeof(sub_next), "%s%s", sub, name);
+		if (filter_subdir(&state->filterlist, &reason, disk->name, sub_next) != 0)
+			continue;
+
+		pathprint(path_next, sizeof(path_next), "%s%s", disk->dir, sub_next);
+		if (lstat(path_next, &st) != 0 || !S_ISDIR(st.st_mode))
+			continue;
+
+		/* don't follow mount points, as the scan */
+		if ((uint64_t)st.st_dev != disk->device)
+			continue;
+
+		pathslash(sub_next, sizeof(sub_next));
+
+		watch_tree(context, disk, sub_next);
+	}
+
+	closedir(d);
+}
+
+/**
+ * Watch again all the directories after some events were lost.
+ *
+ * The lost events may include the creation of new directories, not yet
+ * watched, and the journal remains invalid until the "r" line.
+ * If some directory cannot be watched, the watcher stops, and all
+ * the following scans are complete.
+ */
+static void watch_restore(struct watch_context* context)
+{
+	struct snapraid_state* state = context->state;
+	tommy_node* i;
+
+	for (i = state->disklist; i != 0; i = i->next) {
+		struct snapraid_disk* disk = i->data;
+		struct stat st;
+
+		/* LCOV_EXCL_START */
+		if (lstat(disk->dir, &st) != 0 || (uint64_t)st.st_dev != disk->device) {
+			log_fatal("Disk '%s' is not mounted anymore. Stopping the watch.\n", disk->name);
+			exit(EXIT_FAILURE);
+		}
+		/* LCOV_EXCL_STOP */
+
+		watch_tree(context, disk, "");
+	}
+
+	if (context->is_lost) {
+		/* LCOV_EXCL_START */
+		log_fatal("Failed to watch again all the directories. Stopping the watch.\n");
+		exit(EXIT_FAILURE);
+		/* LCOV_EXCL_STOP */
+	}
+
+	/* the changes are tracked again */
+	watch_write(context, "r\n", 2);
+}
+
+/**
+ * Reply to a barrier created by the scan.
+ *
+ * All the changes done before the barrier are already in the pending lines.
+ */
+static void watch_barrier(struct watch_context* context, const char* nonce)
+{
+	char buffer[64];
+	size_t len;
+	size_t i;
+
+	len = strlen(nonce);
+	if (len == 0 || len > 16)
+		return;
+	for (i = 0; i < len; ++i) {
+		if (!isxdigit((unsigned char)nonce[i]))
+			return;
+	}
+
+	watch_flush(context);
+
+	len = snprintf(buffer, sizeof(buffer), "b %s\n", nonce);
+	watch_write(context, buffer, len);
+}
+
+/**
+ * Process the events read.
+ */
+static void watch_event(struct watch_context* context, const char* buffer, ssize_t size)
+{
+	struct snapraid_state* state = context->state;
+	const char* ptr = buffer;
+
+	while (ptr < buffer + size) {
+		const struct inotify_event* event = (const struct inotify_event*)ptr;
+		char path[PATH_MAX];
+		char sub[PATH_MAX];
+		struct watch_dir* dir;
+
+		ptr += sizeof(struct inotify_event) + event->len;
+
+		if (event->mask & IN_Q_OVERFLOW) {
+			/* LCOV_EXCL_START */
+			log_fatal("WARNING! Too many changes to watch. Increase /proc/sys/fs/inotify/max_queued_events.\n");
+			context->is_lost = 1;
+			continue;
+			/* LCOV_EXCL_STOP */
+		}
+
+		/* the barriers are not changes, even if the journal is in a data disk */
+		if (event->wd == context->barrier_wd && event->len != 0
+			&& strncmp(event->name, context->barrier_name, strlen(context->barrier_name)) == 0
+		) {
+			if (event->mask & IN_CLOSE_WRITE)
+				watch_barrier(context, event->name + strlen(context->barrier_name));
+			continue;
+		}
+
+		dir = tommy_hashdyn_search(&context->dirset, watch_dir_compare, &event->wd, watch_dir_hash(event->wd));
+		if (!dir)
+			continue;
+
+		/* the watch is removed, when the directory is deleted, or unmounted */
+		if (event->mask & IN_IGNORED) {
+			tommy_hashdyn_remove_existing(&context->dirset, &dir->node);
+			watch_dir_free(dir);
+			--context->count_dir;
+			continue;
+		}
+
+		/* LCOV_EXCL_START */
+		if (event->mask & IN_UNMOUNT) {
+			log_fatal("WARNING! Disk '%s' unmounted.\n", dir->disk->name);
+			context->is_lost = 1;
+			continue;
+		}
+		/* LCOV_EXCL_STOP */
+
+		/* events on the directory itself are reported also by the parent */
+		if (event->len == 0)
+			continue;
+
+		/* ignore the content files, and the journal itself */
+		pathprint(path, sizeof(path), "%s%s%s", dir->disk->dir, dir->sub, event->name);
+		if (filter_content(&state->contentlist, path) != 0)
+			continue;
+
+		/* the entries of the directory changed */
+		watch_mark(context, 'd', dir->disk, dir->sub);
+
+		if (event->mask & IN_ISDIR) {
+			if ((event->mask & (IN_CREATE | IN_MOVED_TO | IN_DELETE | IN_MOVED_FROM)) == 0)
+				continue;
+
+			pathprint(sub, sizeof(sub), "%s%s/", dir->sub, event->name);
+
+			/* new directories have to be watched, and moved ones get the new path */
+			if (event->mask & (IN_CREATE | IN_MOVED_TO))
+				watch_tree(context, dir->disk, sub);
+
+			/* the whole tree changed */
+			watch_mark(context, 't', dir->disk, sub);
+		}
+	}
+}
+
+/**
+ * Thread running the test command.
+ */
+static void* watch_run_thread(void* arg)
+{
+	const char* run = arg;
+	int ret;
+
+	ret = system(run);
+	if (ret != 0) {
+		/* LCOV_EXCL_START */
+		log_fatal("Error in running command '%s'.\n", run);
+		exit(EXIT_FAILURE);
+		/* LCOV_EXCL_STOP */
+	}
+
+	/* stop the watch */
+	global_interrupt = 1;
+
+	return 0;
+}
+
+void state_watch(struct snapraid_state* state, const char* run)
+{
+	struct watch_context* context;
+	char path[PATH_MAX];
+	char header[64];
+	char* slash;
+	uint64_t id;
+	tommy_node* i;
+	int len;
+#if HAVE_PTHREAD
+	pthread_t run_thread;
+#endif
+
+	if (state->journalfile[0] == 0) {
+		/* LCOV_EXCL_START */
+		log_fatal("No content file to place the journal.\n");
+		exit(EXIT_FAILURE);
+		/* LCOV_EXCL_STOP */
+	}
+
+	context = malloc_nofail(sizeof(struct watch_context));
+	context->state = state;
+	context->is_lost = 0;
+	context->count_dir = 0;
+	context->buffer_len = 0;
+	context->event = malloc_nofail(WATCH_BUFFER_MAX);
+	tommy_hashdyn_init(&context->dirset);
+	tommy_list_init(&context->linelist);
+	tommy_hashdyn_init(&context->lineset);
+
+	context->journal = open(state->journalfile, O_WRONLY | O_CREAT | O_APPEND | O_BINARY, 0600);
+	if (context->journal == -1) {
+		/* LCOV_EXCL_START */
+		log_fatal("Error creating the journal '%s'. %s.\n", state->journalfile, strerror(errno));
+		exit(EXIT_FAILURE);
+		/* LCOV_EXCL_STOP */
+	}
+
+	/* the lock tells to the scan that the watcher is running */
+	if (flock(context->journal, LOCK_EX | LOCK_NB) == -1) {
+		/* LCOV_EXCL_START */
+		if (errno == EWOULDBLOCK)
+			log_fatal("The journal '%s' is already used by another watcher!\n", state->journalfile);
+		else
+			log_fatal("Error locking the journal '%s'. %s.\n", state->journalfile, strerror(errno));
+		exit(EXIT_FAILURE);
+		/* LCOV_EXCL_STOP */
+	}
+
+	/* start a new journal, the scan notices the different ID */
+	if (ftruncate(context->journal, 0) != 0) {
+		/* LCOV_EXCL_START */
+		log_fatal("Error truncating the journal '%s'. %s.\n", state->journalfile, strerror(errno));
+		exit(EXIT_FAILURE);
+		/* LCOV_EXCL_STOP */
+	}
+
+	id = 0;
+	while (id == 0) {
+		if (randomize(&id, sizeof(id)) != 0) {
+			/* LCOV_EXCL_START */
+			log_fatal("Failed to get random values.\n");
+			exit(EXIT_FAILURE);
+			/* LCOV_EXCL_STOP */
+		}
+	}
+
+	context->f = inotify_init1(IN_CLOEXEC);
+	if (context->f == -1) {
+		/* LCOV_EXCL_START */
+		log_fatal("Error initializing inotify. %s.\n", strerror(errno));
+		exit(EXIT_FAILURE);
+		/* LCOV_EXCL_STOP */
+	}
+
+	msg_progress("Setting up the watch...\n");
+
+	for (i = state->disklist; i != 0; i = i->next) {
+		struct snapraid_disk* disk = i->data;
+
+		watch_tree(context, disk, "");
+	}
+
+	if (context->is_lost) {
+		/* LCOV_EXCL_START */
+		log_fatal("Failed to watch all the directories.\n");
+		exit(EXIT_FAILURE);
+		/* LCOV_EXCL_STOP */
+	}
+
+	/* watch the directory of the journal for the barriers */
+	/* if it's also a data directory, it's the same watch */
+	pathcpy(path, sizeof(path), state->journalfile);
+	slash = strrchr(path, '/');
+	if (slash) {
+		pathcpy(context->barrier_name, sizeof(context->barrier_name), slash + 1);
+		slash[1] = 0;
+	} else {
+		pathcpy(context->barrier_name, sizeof(context->barrier_name), path);
+		pathcpy(path, sizeof(path), ".");
+	}
+	pathcat(context->barrier_name, sizeof(context->barrier_name), JOURNAL_BARRIER_EXT);
+
+	context->barrier_wd = inotify_add_watch(context->f, path, WATCH_MASK);
+	if (context->barrier_wd < 0) {
+		/* LCOV_EXCL_START */
+		log_fatal("Error watching directory '%s'. %s.\n", path, strerror(errno));
+		exit(EXIT_FAILURE);
+		/* LCOV_EXCL_STOP */
+	}
+
+	/* the journal is valid only after all the directories are watched */
+	len = snprintf(header, sizeof(header), "j %016" PRIx64 "\n", id);
+	watch_write(context, header, len);
+
+	msg_progress("Watching %u directories in %u disks. Press Ctrl+C to stop.\n", context->count_dir, (unsigned)tommy_list_count(&state->disklist));
+
+	if (run != 0) {
+#if HAVE_PTHREAD
+		thread_create(&run_thread, 0, watch_run_thread, (void*)run);
+#else
+		watch_run_thread((void*)run);
+#endif
+	}
+
+	while (!global_interrupt) {
+		struct pollfd pfd;
+		ssize_t ret;
+
+		pfd.fd = context->f;
+		pfd.events = POLLIN;
+		pfd.revents = 0;
+
+		/* wake up periodically to check for the interruption */
+		if (poll(&pfd, 1, 100) <= 0)
+			continue;
+
+		ret = read(context->f, context->event, WATCH_BUFFER_MAX);
+		if (ret < 0) {
+			/* LCOV_EXCL_START */
+			if (errno == EINTR || errno == EAGAIN)
+				continue;
+			log_fatal("Error reading inotify events. %s.\n", strerror(errno));
+			exit(EXIT_FAILURE);
+			/* LCOV_EXCL_STOP */
+		}
+
+		watch_event(context, context->event, ret);
+
+		watch_flush(context);
+	}
+
+#if HAVE_PTHREAD
+	if (run != 0)
+		thread_join(run_thread, 0);
+#endif
+
+	/* the journal doesn't track anymore the changes */
+	watch_write(context, "s\n", 2);
+
+	close(context->f);
+
+	if (close(context->journal) != 0) {
+		/* LCOV_EXCL_START */
+		log_fatal("Error closing the journal '%s'. %s.\n", state->journalfile, strerror(errno));
+		exit(EXIT_FAILURE);
+		/* LCOV_EXCL_STOP */
+	}
+
+	tommy_hashdyn_foreach(&context->dirset, (tommy_foreach_func*)watch_dir_free);
+	tommy_hashdyn_done(&context->dirset);
+	tommy_hashdyn_done(&context->lineset);
+	free(context->event);
+	free(context);
+
+	msg_progress("Watch stopped.\n");
+}
+
+#else
+
+void state_watch(struct snapraid_state* state, const char* run)
+{
+	(void)state;
+	(void)run;
+
+	log_fatal("The 'watch' command is not supported in this platform.\n");
+	exit(EXIT_FAILURE);
+}
+
+#endif
+
@@ -0,0 +1,164 @@
+/*
+ * Copyright (C) 2016 Andrea Mazzoleni
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef __JOURNAL_H
+#define __JOURNAL_H
+
+#include "state.h"
+
+/****************************************************************************/
+/* journal */
+
+/**
+ * Change journal.
+ *
+ * The "watch" command monitors the data disks, and appends to the journal
+ * the directories where something changed. The journal is in the same
+ * directory of the first content file, with the ".journal" extension.
+ *
+ * Every time the content file is written, the position in the journal
+ * of the changes not yet scanned is saved in a ".journal.pos" file,
+ * together with the CRC of the content file.
+ *
+ * The next scan reads from the journal only the changes after that position,
+ * and it reads only the directories with changes, and their parents.
+ * If the watcher is not running, was restarted, or lost some events,
+ * the scan is complete as before.
+ *
+ * After lost events, the watcher watches again all the directories, and
+ * until it's done, the scans don't save any position, and they remain complete.
+ *
+ * Before reading the journal, the scan creates a barrier file near it,
+ * and waits for the watcher to reply, to be sure that all the changes done
+ * before are in the journal. Without a reply, the scan is complete.
+ *
+ * Journal lines are:
+ *   j ID - Start of the journal, with the random ID of the watcher.
+ *   d DISK SUB - Some entries of the directory changed.
+ *   t DISK SUB - The whole tree of the directory changed.
+ *   o - Some events were lost, and some directories may be not watched.
+ *   r - All the directories are watched again after lost events.
+ *   b NONCE - Reply to the barrier with the same nonce.
+ *   s - The watcher stopped.
+ */
+
+#define JOURNAL_DIR 1 /**< Some entries of the directory changed. */
+#define JOURNAL_TREE 2 /**< The whole tree of the directory changed. */
+#define JOURNAL_PATH 4 /**< Some sub directory changed. */
+
+/**
+ * Directory changed.
+ */
+struct snapraid_journal_dir {
+	char* sub; /**< Path relative to the disk. It's empty or it terminates with /. */
+	unsigned flags; /**< Changes. Combination of JOURNAL_* flags. */
+
+	/* nodes for data structures */
+	tommy_hashdyn_node node;
+};
+
+/**
+ * Changes of a disk.
+ */
+struct snapraid_journal_disk {
+	char name[PATH_MAX]; /**< Name of the disk. */
+	tommy_hashdyn dirset; /**< Directories changed. */
+	int has_tree; /**< If some directory has the JOURNAL_TREE flag. */
+
+	/* nodes for data structures */
+	tommy_node node;
+};
+
+/**
+ * Changes of all the disks.
+ */
+struct snapraid_journal {
+	tommy_list disklist; /**< Disks with changes. */
+};
+
+/**
+ * Read the checkpoint saved with the content file.
+ *
+ * It sets the position in the journal of the changes not yet scanned,
+ * if the checkpoint matches the content file read.
+ */
+void journal_checkpoint_read(struct snapraid_state* state);
+
+/**
+ * Write the checkpoint for the content file just written.
+ */
+void journal_checkpoint_write(struct snapraid_state* state);
+
+/**
+ * Load the changes not yet scanned from the journal.
+ *
+ * The journal position is moved at the end, to mark them as scanned.
+ *
+ * \return 0 if the changes are available, or -1 if a complete scan is required.
+ */
+int journal_load(struct snapraid_state* state, struct snapraid_journal* journal);
+
+/**
+ * Free the changes loaded.
+ */
+void journal_done(struct snapraid_journal* journal);
+
+/**
+ * Get the changes of a disk.
+ * Return 0 if the disk has no change.
+ */
+struct snapraid_journal_disk* journal_disk(struct snapraid_journal* journal, const char* name);
+
+/**
+ * Get the changes of a directory.
+ * \param sub Path of the directory, empty or terminating with /.
+ * \return Combination of JOURNAL_* flags.
+ */
+unsigned journal_dir_flags(struct snapraid_journal_disk* jdisk, const char* sub);
+
+/**
+ * Check if the entries of a directory may be changed.
+ *
+ * It's true if the directory, or one of its parents for a tree change, is in the journal.
+ * \param sub Path of the directory, empty or terminating with /.
+ */
+int journal_dir_is_changed(struct snapraid_journal_disk* jdisk, const char* sub);
+
+/**
+ * Check if a directory has to be read.
+ *
+ * It's true if its entries may be changed, or if some of its sub directories changed.
+ * \param sub Path of the directory, empty or terminating with /.
+ */
+int journal_dir_is_read(struct snapraid_journal_disk* jdisk, const char* sub);
+
+/**
+ * Mark a directory as changed, and all its parents as containing a change.
+ * \param sub Path of the directory, empty or terminating with /.
+ */
+void journal_mark(struct snapraid_journal_disk* jdisk, const char* sub, unsigned flags);
+
+/**
+ * Watch the data disks, and write the changes in the journal.
+ *
+ * It runs until interrupted.
+ * \param run Command to run while watching, stopping when it terminates. Used for testing.
+ */
+void state_watch(struct snapraid_state* state, const char* run);
+
+#endif
+
@@ -247,6 +247,45 @@ void test(void)
 			/* LCOV_EXCL_STOP */
 		}
 	}
+
+	for (i = 0; i < STREAM_MAX; ++i) {
+		snprintf(file, sizeof(file), "stream%u.bin", i);
+
+		s = sopen_read(file);
+		if (s == 0) {
+			/* LCOV_EXCL_START */
+			exit(EXIT_FAILURE);
+			/* LCOV_EXCL_STOP */
+		}
+
+		/* skip the chars, and read the first number */
+		if (sskip(s, 256) != 0 || stell(s) != 256) {
+			/* LCOV_EXCL_START */
+			exit(EXIT_FAILURE);
+			/* LCOV_EXCL_STOP */
+		}
+
+		if (sgetb32(s, &u32) != 0 || u32 != 0xFFFFFFFF) {
+			/* LCOV_EXCL_START */
+			exit(EXIT_FAILURE);
+			/* LCOV_EXCL_STOP */
+		}
+
+		/* seek back to each char */
+		for (j = 0; j < 256; j += 17) {
+			if (sseek(s, j) != 0 || stell(s) != (int64_t)j || sgetc(s) != (int)j || !spartial(s)) {
+				/* LCOV_EXCL_START */
+				exit(EXIT_FAILURE);
+				/* LCOV_EXCL_STOP */
+			}
+		}
+
+		if (sclose(s) != 0) {
+			/* LCOV_EXCL_START */
+			exit(EXIT_FAILURE);
+			/* LCOV_EXCL_STOP */
+		}
+	}
 }
 
 int main(void)
@@ -184,6 +184,7 @@ int parity_create(struct snapraid_parity_handle* handle, const struct snapraid_p
 
 	handle->level = level;
 	handle->split_mac = 0;
+	handle->defer = 0;
 
 	for (s = 0; s < parity->split_mac; ++s) {
 		struct snapraid_split_handle* split = &handle->split_map[s];
@@ -666,6 +667,7 @@ int parity_open(struct snapraid_parity_handle* handle, const struct snapraid_par
 
 	handle->level = level;
 	handle->split_mac = 0;
+	handle->defer = 0;
 
 	/* mask of bits used by the block size */
 	block_mask = ((data_off_t)block_size) - 1;
@@ -864,6 +866,12 @@ int parity_write(struct snapraid_parity_handle* handle, block_off_t pos, unsigne
 	if (split->valid_size < offset + block_size)
 		split->valid_size = offset + block_size;
 
+	if (handle->defer) {
+		/* only store the request, the write and the advise are done by the caller */
+		defer_set(handle->defer, 1, split->f, &split->advise, block_buffer, block_size, block_size, offset);
+		return 0;
+	}
+
 	write_ret = pwrite(split->f, block_buffer, block_size, offset);
 	if (write_ret != (ssize_t)block_size) { /* conversion is safe because block_size is always small */
 		/* LCOV_EXCL_START */
@@ -913,6 +921,12 @@ int parity_read(struct snapraid_parity_handle* handle, block_off_t pos, unsigned
 		/* LCOV_EXCL_STOP */
 	}
 
+	if (handle->defer) {
+		/* only store the request, the read and the advise are done by the caller */
+		defer_set(handle->defer, 0, split->f, &split->advise, block_buffer, block_size, block_size, offset);
+		return block_size;
+	}
+
 	count = 0;
 	do {
 		read_ret = pread(split->f, block_buffer + count, block_size - count, offset + count);
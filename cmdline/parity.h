@@ -57,6 +57,7 @@ struct snapraid_parity_handle {
 	struct snapraid_split_handle split_map[SPLIT_MAX];
 	unsigned split_mac; /**< Number of parity splits. */
 	unsigned level; /**< Level of the parity. */
+	struct defer_struct* defer; /**< If not 0, parity_read() and parity_write() only store the request here. */
 };
 
 /**
@@ -117,6 +117,14 @@
 #include <sys/file.h>
 #endif
 
+#if HAVE_SYS_INOTIFY_H
+#include <sys/inotify.h>
+#endif
+
+#if HAVE_POLL_H
+#include <poll.h>
+#endif
+
 #if HAVE_SYS_IOCTL_H
 #include <sys/ioctl.h>
 #endif
@@ -129,6 +137,25 @@
 #include <linux/fiemap.h>
 #endif
 
+#if HAVE_SYS_MMAN_H
+#include <sys/mman.h>
+#endif
+
+#if HAVE_SYS_UIO_H
+#include <sys/uio.h>
+#endif
+
+#if HAVE_LINUX_IO_URING_H && HAVE_SYS_MMAN_H && HAVE_SYS_SYSCALL_H
+#include <linux/io_uring.h>
+#include <sys/syscall.h>
+#if defined(__NR_io_uring_setup) && defined(__NR_io_uring_enter)
+#define HAVE_IO_URING 1
+#if HAVE_STATX && HAVE_DECL_IORING_OP_STATX
+#define HAVE_IO_URING_STATX 1
+#endif
+#endif
+#endif
+
 #if HAVE_BLKID_BLKID_H
 #include <blkid/blkid.h>
 #if HAVE_BLKID_DEVNO_TO_DEVNAME && HAVE_BLKID_GET_TAG_VALUE
@@ -0,0 +1,381 @@
+/*
+ * Copyright (C) 2016 Andrea Mazzoleni
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "portable.h"
+
+#include "support.h"
+#include "raid/raid.h"
+#include "raidmt.h"
+
+/****************************************************************************/
+/* raidmt */
+
+#define RAIDMT_GEN 0 /**< Run raid_gen(). */
+#define RAIDMT_REC 1 /**< Run raid_rec(). */
+#define RAIDMT_DATA 2 /**< Run raid_data(). */
+
+/**
+ * Computation to do in parallel.
+ */
+struct raidmt_job {
+	int op; /**< Operation. One of the RAIDMT_*. */
+	int nr;
+	int ir[RAID_PARITY_MAX]; /**< Indexes of failed blocks for raid_rec(), or data blocks for raid_data(). */
+	int ip[RAID_PARITY_MAX]; /**< Indexes of parity blocks for raid_data(). */
+	int nd;
+	int np;
+	size_t size;
+	void** v;
+	int nv; /**< Number of blocks in the ::v vector. */
+
+	size_t slice_size; /**< Size of each slice. Multiplier of 64. */
+	unsigned slice_max; /**< Number of slices. */
+	unsigned slice_next; /**< Next slice to compute. */
+	unsigned slice_pending; /**< Number of slices not yet completed. */
+};
+
+/**
+ * Number of threads configured, including the calling one.
+ */
+static unsigned raidmt_thread_max = 1;
+
+/**
+ * If the number of threads is limited by the parity level.
+ */
+static int raidmt_thread_auto;
+
+/**
+ * Minimum size of a slice.
+ */
+static size_t raidmt_slice_min = RAIDMT_SLICE_MIN;
+
+#if HAVE_PTHREAD
+/**
+ * Number of additional threads running.
+ */
+static unsigned raidmt_thread_mac;
+static pthread_t raidmt_thread_map[RAIDMT_THREAD_MAX];
+
+/**
+ * Mutex protecting the job, and conditions to signal a new job
+ * and the completion of a job.
+ */
+static pthread_mutex_t raidmt_mutex;
+static pthread_cond_t raidmt_job_cond;
+static pthread_cond_t raidmt_done_cond;
+static unsigned raidmt_generation; /**< Incremented for every new job. */
+static int raidmt_exit; /**< Exit condition for all threads. */
+static struct raidmt_job raidmt_job;
+#endif
+
+/**
+ * Compute a single slice of the job.
+ */
+static void raidmt_slice(struct raidmt_job* job, unsigned i)
+{
+	void* v[RAID_DATA_MAX + RAID_PARITY_MAX];
+	size_t offset;
+	size_t size;
+	int j;
+
+	offset = i * job->slice_size;
+	size = job->size - offset;
+	if (size > job->slice_size)
+		size = job->slice_size;
+
+	/* the RAID functions work byte by byte, so any slice is independent */
+	/* note that they may also swap pointers in the vector, so we need a copy */
+	for (j = 0; j < job->nv; ++j)
+		v[j] = (unsigned char*)job->v[j] + offset;
+
+	switch (job->op) {
+	case RAIDMT_GEN :
+		raid_gen(job->nd, job->np, size, v);
+		break;
+	case RAIDMT_REC :
+		raid_rec(job->nr, job->ir, job->nd, job->np, size, v);
+		break;
+	case RAIDMT_DATA :
+		raid_data(job->nr, job->ir, job->ip, job->nd, size, v);
+		break;
+	}
+}
+
+#if HAVE_PTHREAD
+/**
+ * Compute slices until the job is completed.
+ *
+ * It must be called with the mutex locked, and it returns with the mutex locked.
+ */
+static void raidmt_work(void)
+{
+	while (raidmt_job.slice_next < raidmt_job.slice_max) {
+		unsigned i = raidmt_job.slice_next++;
+
+		thread_mutex_unlock(&raidmt_mutex);
+
+		raidmt_slice(&raidmt_job, i);
+
+		thread_mutex_lock(&raidmt_mutex);
+
+		/* if it's the latest slice, notify the caller */
+		if (--raidmt_job.slice_pending == 0)
+			thread_cond_signal(&raidmt_done_cond);
+	}
+}
+
+static void* raidmt_thread(void* arg)
+{
+	unsigned generation = 0;
+
+	(void)arg;
+
+	thread_mutex_lock(&raidmt_mutex);
+
+	while (1) {
+		/* wait for a new job */
+		while (!raidmt_exit && generation == raidmt_generation)
+			thread_cond_wait(&raidmt_job_cond, &raidmt_mutex);
+
+		if (raidmt_exit)
+			break;
+
+		generation = raidmt_generation;
+
+		raidmt_work();
+	}
+
+	thread_mutex_unlock(&raidmt_mutex);
+
+	return 0;
+}
+
+/**
+ * Start the threads if not yet done, up to the specified number,
+ * including the calling one.
+ *
+ * A thread started after some jobs only sees the last one, already completed.
+ */
+static void raidmt_start(unsigned thread_max)
+{
+	if (raidmt_thread_mac == 0) {
+		thread_mutex_init(&raidmt_mutex, 0);
+		thread_cond_init(&raidmt_job_cond, 0);
+		thread_cond_init(&raidmt_done_cond, 0);
+		raidmt_generation = 0;
+		raidmt_exit = 0;
+	}
+
+	while (raidmt_thread_mac + 1 < thread_max) {
+		thread_create(&raidmt_thread_map[raidmt_thread_mac], 0, raidmt_thread, 0);
+		++raidmt_thread_mac;
+	}
+}
+#endif
+
+void raidmt_init(unsigned thread_max, size_t slice_min)
+{
+	if (slice_min == 0)
+		slice_min = RAIDMT_SLICE_MIN;
+
+	raidmt_slice_min = slice_min;
+
+	raidmt_thread_auto = 0;
+	if (thread_max == 0) {
+		thread_max = cpu_count();
+		raidmt_thread_auto = 1;
+	}
+
+	if (thread_max > RAIDMT_THREAD_MAX)
+		thread_max = RAIDMT_THREAD_MAX;
+
+#if HAVE_PTHREAD
+	raidmt_thread_max = thread_max;
+#else
+	/* without pthread there is only the calling thread */
+	raidmt_thread_max = 1;
+#endif
+}
+
+void raidmt_done(void)
+{
+#if HAVE_PTHREAD
+	unsigned i;
+
+	if (raidmt_thread_mac == 0)
+		return;
+
+	thread_mutex_lock(&raidmt_mutex);
+	raidmt_exit = 1;
+	thread_cond_broadcast_and_unlock(&raidmt_job_cond, &raidmt_mutex);
+
+	for (i = 0; i < raidmt_thread_mac; ++i) {
+		void* retval;
+
+		thread_join(raidmt_thread_map[i], &retval);
+	}
+
+	thread_cond_destroy(&raidmt_done_cond);
+	thread_cond_destroy(&raidmt_job_cond);
+	thread_mutex_destroy(&raidmt_mutex);
+
+	raidmt_thread_mac = 0;
+#endif
+}
+
+/**
+ * Number of threads to use for the specified parity level.
+ *
+ * By default the threads are limited to the parity level minus two.
+ * The cost of the computation grows with the number of parities,
+ * while the first two levels run almost at the memory speed, and
+ * more threads would only compete with the IO and hashing ones.
+ */
+static unsigned raidmt_thread_count(int np)
+{
+	unsigned thread_max = raidmt_thread_max;
+
+	if (raidmt_thread_auto && np - 2 < (int)thread_max)
+		thread_max = np > 2 ? np - 2 : 1;
+
+	return thread_max;
+}
+
+/**
+ * Run the job, in parallel if convenient.
+ */
+static void raidmt_run(struct raidmt_job* job, int np)
+{
+	unsigned thread_max;
+	size_t slice_size;
+
+	thread_max = raidmt_thread_count(np);
+
+	/* split the blocks in one slice for each thread */
+	slice_size = (job->size + thread_max - 1) / thread_max;
+
+	/* round up to a multiplier of 64, as required by the RAID functions */
+	slice_size = (slice_size + 63) & ~(size_t)63;
+
+	if (slice_size < raidmt_slice_min)
+		slice_size = raidmt_slice_min;
+
+	job->slice_size = slice_size;
+	job->slice_max = (job->size + slice_size - 1) / slice_size;
+	job->slice_next = 0;
+	job->slice_pending = job->slice_max;
+
+#if HAVE_PTHREAD
+	/* use threads only for high parity levels, and if there is more than one slice */
+	if (np >= RAIDMT_LEVEL_MIN && job->slice_max > 1) {
+		raidmt_start(thread_max);
+
+		thread_mutex_lock(&raidmt_mutex);
+
+		raidmt_job = *job;
+		++raidmt_generation;
+
+		/* wake up all the threads */
+		thread_cond_broadcast(&raidmt_job_cond);
+
+		/* take part at the computation */
+		raidmt_work();
+
+		/* wait for the slices computed by the other threads */
+		while (raidmt_job.slice_pending != 0)
+			thread_cond_wait(&raidmt_done_cond, &raidmt_mutex);
+
+		thread_mutex_unlock(&raidmt_mutex);
+		return;
+	}
+#else
+	(void)np;
+#endif
+
+	/* compute in the calling thread */
+	job->slice_size = job->size;
+	raidmt_slice(job, 0);
+}
+
+void raidmt_gen(int nd, int np, size_t size, void** v)
+{
+	struct raidmt_job job;
+
+	if (raidmt_thread_max <= 1) {
+		raid_gen(nd, np, size, v);
+		return;
+	}
+
+	job.op = RAIDMT_GEN;
+	job.nr = 0;
+	job.nd = nd;
+	job.np = np;
+	job.size = size;
+	job.v = v;
+	job.nv = nd + np;
+
+	raidmt_run(&job, np);
+}
+
+void raidmt_rec(int nr, int* ir, int nd, int np, size_t size, void** v)
+{
+	struct raidmt_job job;
+	int i;
+
+	if (raidmt_thread_max <= 1) {
+		raid_rec(nr, ir, nd, np, size, v);
+		return;
+	}
+
+	job.op = RAIDMT_REC;
+	job.nr = nr;
+	for (i = 0; i < nr; ++i)
+		job.ir[i] = ir[i];
+	job.nd = nd;
+	job.np = np;
+	job.size = size;
+	job.v = v;
+	job.nv = nd + np;
+
+	raidmt_run(&job, np);
+}
+
+void raidmt_data(int nr, int* id, int* ip, int nd, size_t size, void** v)
+{
+	struct raidmt_job job;
+	int i;
+
+	if (raidmt_thread_max <= 1 || nr == 0) {
+		raid_data(nr, id, ip, nd, size, v);
+		return;
+	}
+
+	job.op = RAIDMT_DATA;
+	job.nr = nr;
+	for (i = 0; i < nr; ++i) {
+		job.ir[i] = id[i];
+		job.ip[i] = ip[i];
+	}
+	job.nd = nd;
+	job.np = ip[nr - 1] + 1;
+	job.size = size;
+	job.v = v;
+	job.nv = nd + job.np;
+
+	raidmt_run(&job, job.np);
+}
+
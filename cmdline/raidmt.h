@@ -0,0 +1,77 @@
+/*
+ * Copyright (C) 2016 Andrea Mazzoleni
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef __RAIDMT_H
+#define __RAIDMT_H
+
+/****************************************************************************/
+/* raidmt */
+
+/**
+ * Minimum parity level to use multiple threads.
+ *
+ * With less parity levels the computation is limited by the memory
+ * bandwidth, and the threads don't give any advantage.
+ */
+#define RAIDMT_LEVEL_MIN 4
+
+/**
+ * Minimum size of a slice of the blocks computed by a single thread.
+ */
+#define RAIDMT_SLICE_MIN (16 * 1024)
+
+/**
+ * Maximum number of threads.
+ */
+#define RAIDMT_THREAD_MAX 64
+
+/**
+ * Set the number of threads to use for the RAID computation.
+ *
+ * The calling thread always takes part at the computation, so 1 means
+ * to not use any additional thread. 0 means to use one thread for
+ * each processor, but not more than the parity level minus two.
+ *
+ * The threads are started at the first computation that needs them.
+ *
+ * \param slice_min Minimum size of a slice. It must be a multiplier of 64.
+ * 0 for the default RAIDMT_SLICE_MIN.
+ */
+void raidmt_init(unsigned thread_max, size_t slice_min);
+
+/**
+ * Stop all the threads.
+ */
+void raidmt_done(void);
+
+/**
+ * Like raid_gen(), but splitting the blocks in slices computed in parallel.
+ */
+void raidmt_gen(int nd, int np, size_t size, void** v);
+
+/**
+ * Like raid_rec(), but splitting the blocks in slices computed in parallel.
+ */
+void raidmt_rec(int nr, int* ir, int nd, int np, size_t size, void** v);
+
+/**
+ * Like raid_data(), but splitting the blocks in slices computed in parallel.
+ */
+void raidmt_data(int nr, int* id, int* ip, int nd, size_t size, void** v);
+
+#endif
+
@@ -21,10 +21,46 @@
 #include "elem.h"
 #include "state.h"
 #include "parity.h"
+#include "uring.h"
+#include "journal.h"
 
 struct snapraid_scan {
 	struct snapraid_state* state; /**< State used. */
 	struct snapraid_disk* disk; /**< Disk used. */
+	int is_diff; /**< If it's a diff command, printing the differences. */
+
+	/**
+	 * If only the directories in the journal are read.
+	 *
+	 * All the other files are kept as they are.
+	 */
+	int is_journal;
+	struct snapraid_journal_disk* jdisk; /**< Changes of the disk. 0 if the disk has no change. */
+
+#if HAVE_PTHREAD
+	pthread_t thread; /**< Thread scanning the disk. */
+	pthread_t* loader_map; /**< Threads reading ahead the directories. */
+	unsigned loader_max; /**< Number of loader threads. */
+	pthread_mutex_t dir_mutex; /**< Mutex protecting the directory queue. */
+	pthread_cond_t dir_cond; /**< Condition signaled when the directory queue changes. */
+#endif
+
+	/**
+	 * Queue of directories to read.
+	 *
+	 * The first directory to process is at the head.
+	 */
+	tommy_list dir_queue;
+	unsigned dir_ahead; /**< Number of directories read ahead, and not yet processed. */
+	int dir_stop; /**< If the loader threads have to stop. */
+	struct snapraid_uring* ring; /**< Ring used by the disk thread to read the stat info. 0 if not used. */
+
+	/**
+	 * If the state is changed.
+	 *
+	 * Set by the scan thread, and moved to the state at the end.
+	 */
+	int need_write;
 
 	/**
 	 * Counters of changes.
@@ -41,10 +77,50 @@ struct snapraid_scan {
 	tommy_list link_insert_list; /**< Links to insert. */
 	tommy_list dir_insert_list; /**< Dirs to insert. */
 
+	/**
+	 * New files to report.
+	 *
+	 * The search of copies accesses all the disks, and it's done only
+	 * after the scan of all of them, together with the report.
+	 */
+	tommy_list file_report_list;
+
+	/* nodes for data structures */
+	tommy_node node;
+};
+
+/**
+ * New file found by the scan, waiting for the search of copies.
+ */
+struct snapraid_scan_report {
+	struct snapraid_file* file; /**< File found. */
+	int is_file_already_present; /**< If it replaces a file with the same name. */
+	data_off_t file_already_present_size; /**< Size of the replaced file. */
+	int64_t file_already_present_mtime_sec; /**< Time of the replaced file. */
+	int file_already_present_mtime_nsec; /**< Nanoseconds time of the replaced file. */
+
 	/* nodes for data structures */
 	tommy_node node;
 };
 
+/**
+ * Print a difference.
+ *
+ * The disks are scanned by multiple threads, and the output is locked.
+ */
+static void scan_print(const char* format, ...)
+{
+	va_list ap;
+
+	lock_msg();
+
+	va_start(ap, format);
+	vprintf(format, ap);
+	va_end(ap);
+
+	unlock_msg();
+}
+
 /**
  * Remove the specified link from the data set.
  */
@@ -116,13 +192,13 @@ static void scan_link(struct snapraid_scan* scan, int is_diff, const char* sub,
 			/* it's an update */
 
 			/* we have to save the linkto/type */
-			state->need_write = 1;
+			scan->need_write = 1;
 
 			++scan->count_change;
 
 			log_tag("scan:update:%s:%s\n", disk->name, esc_tag(slink->sub, esc_buffer));
 			if (is_diff) {
-				printf("update %s\n", fmt_term(disk, slink->sub, esc_buffer));
+				scan_print("update %s\n", fmt_term(disk, slink->sub, esc_buffer));
 			}
 
 			/* update it */
@@ -139,7 +215,7 @@ static void scan_link(struct snapraid_scan* scan, int is_diff, const char* sub,
 
 		log_tag("scan:add:%s:%s\n", disk->name, esc_tag(sub, esc_buffer));
 		if (is_diff) {
-			printf("add %s\n", fmt_term(disk, sub, esc_buffer));
+			scan_print("add %s\n", fmt_term(disk, sub, esc_buffer));
 		}
 
 		/* and continue to insert it */
@@ -164,20 +240,22 @@ static void scan_file_allocate(struct snapraid_scan* scan, struct snapraid_file*
 	struct snapraid_disk* disk = scan->disk;
 	block_off_t i;
 	block_off_t parity_pos;
+	block_off_t run;
 
 	/* state changed */
 	state->need_write = 1;
 
 	/* allocate the blocks of the file */
-	parity_pos = disk->first_free_block;
+	run = 0;
+	parity_pos = 0;
 	for (i = 0; i < file->blockmax; ++i) {
 		struct snapraid_block* block;
 		struct snapraid_block* over_block;
 		snapraid_info info;
 
-		/* increment the position until the first really free block */
-		while (block_has_file(fs_par2block_find(disk, parity_pos)))
-			++parity_pos;
+		/* get the next free positions, if the previous ones are all used */
+		if (run == 0)
+			parity_pos = fs_free_find(disk, file->blockmax - i, &run);
 
 		/* get block we are going to overwrite, if any */
 		over_block = fs_par2block_find(disk, parity_pos);
@@ -242,8 +320,9 @@ static void scan_file_allocate(struct snapraid_scan* scan, struct snapraid_file*
 		/* store in the disk map, after invalidating all the other blocks */
 		fs_allocate(disk, parity_pos, file, i);
 
-		/* set the new free position */
-		disk->first_free_block = parity_pos + 1;
+		/* next free position */
+		++parity_pos;
+		--run;
 	}
 
 	/* insert in the list of contained files */
@@ -267,18 +346,11 @@ static void scan_file_deallocate(struct snapraid_scan* scan, struct snapraid_fil
 	tommy_list_remove_existing(&disk->filelist, &file->nodelist);
 
 	/* state changed */
-	state->need_write = 1;
+	scan->need_write = 1;
 
-	/* here we are supposed to adjust the ::first_free_block position */
-	/* with the parity position we are deleting */
-	/* but we also know that we do only delayed insert, after all the deletion, */
-	/* so at this point ::first_free_block is always at 0, and we don't need to update it */
-	if (disk->first_free_block != 0) {
-		/* LCOV_EXCL_START */
-		log_fatal("Internal inconsistency for first free position at '%u' deallocating file '%s'\n", disk->first_free_block, file->sub);
-		os_abort();
-		/* LCOV_EXCL_STOP */
-	}
+	/* the parity positions we are deleting are not added to the free extents */
+	/* in the scan we do only delayed insert, after all the deletion, so the free extents */
+	/* are not yet built, and in the compaction they are reused only at the next run */
 
 	/* free all the blocks of the file */
 	for (i = 0; i < file->blockmax; ++i) {
@@ -555,6 +627,8 @@ static void scan_file_refresh(struct snapraid_scan* scan, const char* sub, struc
 
 /**
  * Insert the file in the data set.
+ *
+ * The file is inserted in the stamp set later, after the search of copies.
  */
 static void scan_file_insert(struct snapraid_scan* scan, struct snapraid_file* file)
 {
@@ -564,7 +638,6 @@ static void scan_file_insert(struct snapraid_scan* scan, struct snapraid_file* f
 	if (!file_flag_has(file, FILE_IS_WITHOUT_INODE))
 		tommy_hashdyn_insert(&disk->inodeset, &file->nodeset, file, file_inode_hash(file->inode));
 	tommy_hashdyn_insert(&disk->pathset, &file->pathset, file, file_path_hash(file->sub));
-	tommy_hashdyn_insert(&disk->stampset, &file->stampset, file, file_stamp_hash(file->size, file->mtime_sec, file->mtime_nsec));
 
 	/* delayed allocation of the parity */
 	scan_file_delayed_allocate(scan, file);
@@ -624,13 +697,12 @@ static void scan_file(struct snapraid_scan* scan, int is_diff, const char* sub,
 	struct snapraid_state* state = scan->state;
 	struct snapraid_disk* disk = scan->disk;
 	struct snapraid_file* file;
-	tommy_node* i;
+	struct snapraid_scan_report* report;
 	int is_original_file_size_different_than_zero;
 	int is_file_already_present;
 	data_off_t file_already_present_size;
 	int64_t file_already_present_mtime_sec;
 	int file_already_present_mtime_nsec;
-	int is_file_reported;
 	char esc_buffer[ESC_MAX];
 	char esc_buffer_alt[ESC_MAX];
 
@@ -706,7 +778,7 @@ static void scan_file(struct snapraid_scan* scan, int is_diff, const char* sub,
 				file->mtime_nsec = STAT_NSEC(st);
 
 				/* we have to save the new mtime */
-				state->need_write = 1;
+				scan->need_write = 1;
 			}
 
 			if (strcmp(file->sub, sub) != 0) {
@@ -715,7 +787,7 @@ static void scan_file(struct snapraid_scan* scan, int is_diff, const char* sub,
 
 				log_tag("scan:move:%s:%s:%s\n", disk->name, esc_tag(file->sub, esc_buffer), esc_tag(sub, esc_buffer_alt));
 				if (is_diff) {
-					printf("move %s -> %s\n", fmt_term(disk, file->sub, esc_buffer), fmt_term(disk, sub, esc_buffer_alt));
+					scan_print("move %s -> %s\n", fmt_term(disk, file->sub, esc_buffer), fmt_term(disk, sub, esc_buffer_alt));
 				}
 
 				/* remove from the name set */
@@ -728,7 +800,7 @@ static void scan_file(struct snapraid_scan* scan, int is_diff, const char* sub,
 				tommy_hashdyn_insert(&disk->pathset, &file->pathset, file, file_path_hash(file->sub));
 
 				/* we have to save the new name */
-				state->need_write = 1;
+				scan->need_write = 1;
 			} else {
 				/* otherwise it's equal */
 				++scan->count_equal;
@@ -805,7 +877,6 @@ static void scan_file(struct snapraid_scan* scan, int is_diff, const char* sub,
 	}
 
 	/* initialize for later overwrite */
-	is_file_reported = 0;
 	is_original_file_size_different_than_zero = 0;
 
 	/* then try finding it by name */
@@ -864,7 +935,7 @@ static void scan_file(struct snapraid_scan* scan, int is_diff, const char* sub,
 				file->mtime_nsec = STAT_NSEC(st);
 
 				/* we have to save the new mtime */
-				state->need_write = 1;
+				scan->need_write = 1;
 			}
 
 			/* if when processing the disk we used the past inodes values */
@@ -878,7 +949,7 @@ static void scan_file(struct snapraid_scan* scan, int is_diff, const char* sub,
 
 				log_tag("scan:restore:%s:%s\n", disk->name, esc_tag(sub, esc_buffer));
 				if (is_diff) {
-					printf("restore %s\n", fmt_term(disk, sub, esc_buffer));
+					scan_print("restore %s\n", fmt_term(disk, sub, esc_buffer));
 				}
 
 				/* remove from the inode set */
@@ -891,7 +962,7 @@ static void scan_file(struct snapraid_scan* scan, int is_diff, const char* sub,
 				tommy_hashdyn_insert(&disk->inodeset, &file->nodeset, file, file_inode_hash(file->inode));
 
 				/* we have to save the new inode */
-				state->need_write = 1;
+				scan->need_write = 1;
 			} else {
 				/* otherwise it's the case of not persistent inode, where doesn't */
 				/* matter if the inode is different or equal, because they have no */
@@ -963,6 +1034,38 @@ static void scan_file(struct snapraid_scan* scan, int is_diff, const char* sub,
 	/* mark it as present */
 	file_flag_set(file, FILE_IS_PRESENT);
 
+	/* postpone the search of copies and the report */
+	report = malloc_nofail(sizeof(struct snapraid_scan_report));
+	report->file = file;
+	report->is_file_already_present = is_file_already_present;
+	report->file_already_present_size = file_already_present_size;
+	report->file_already_present_mtime_sec = file_already_present_mtime_sec;
+	report->file_already_present_mtime_nsec = file_already_present_mtime_nsec;
+	tommy_list_insert_tail(&scan->file_report_list, &report->node, report);
+
+	/* insert the file in the delayed list */
+	scan_file_insert(scan, file);
+}
+
+/**
+ * Search the copies of a new file, and report it.
+ *
+ * This is done after the scan of all the disks, as it accesses all of them.
+ */
+static void scan_file_report(struct snapraid_scan* scan, struct snapraid_scan_report* report)
+{
+	struct snapraid_state* state = scan->state;
+	struct snapraid_disk* disk = scan->disk;
+	struct snapraid_file* file = report->file;
+	const char* sub = file->sub;
+	tommy_node* i;
+	int is_file_reported;
+	char esc_buffer[ESC_MAX];
+	char esc_buffer_alt[ESC_MAX];
+
+	/* initialize for later overwrite */
+	is_file_reported = 0;
+
 	/* if copy detection is enabled */
 	/* note that the copy detection is tried also for updated files */
 	/* this makes sense because it may happen to have two different copies */
@@ -984,7 +1087,7 @@ static void scan_file(struct snapraid_scan* scan, int is_diff, const char* sub,
 				other_file = tommy_hashdyn_search(&other_disk->stampset, file_pathstamp_compare, file, hash);
 
 			/* if found, and it's a fully hashed file */
-			if (other_file && file_is_full_hashed_and_stable(scan->state, other_disk, other_file)) {
+			if (other_file && file_is_full_hashed_and_stable(state, other_disk, other_file)) {
 				/* assume that the file is a copy, and reuse the hash */
 				file_copy(other_file, file);
 
@@ -992,8 +1095,8 @@ static void scan_file(struct snapraid_scan* scan, int is_diff, const char* sub,
 				++scan->count_copy;
 
 				log_tag("scan:copy:%s:%s:%s:%s\n", other_disk->name, esc_tag(other_file->sub, esc_buffer), disk->name, esc_tag(file->sub, esc_buffer_alt));
-				if (is_diff) {
-					printf("copy %s -> %s\n", fmt_term(other_disk, other_file->sub, esc_buffer), fmt_term(disk, file->sub, esc_buffer_alt));
+				if (scan->is_diff) {
+					scan_print("copy %s -> %s\n", fmt_term(other_disk, other_file->sub, esc_buffer), fmt_term(disk, file->sub, esc_buffer_alt));
 				}
 
 				/* mark it as reported */
@@ -1008,29 +1111,26 @@ static void scan_file(struct snapraid_scan* scan, int is_diff, const char* sub,
 	/* if not yet reported, do it now */
 	/* we postpone this to avoid to print two times the copied files */
 	if (!is_file_reported) {
-		if (is_file_already_present) {
+		if (report->is_file_already_present) {
 			++scan->count_change;
 
 			log_tag("scan:update:%s:%s: %" PRIu64 " %" PRIu64 ".%d -> %" PRIu64 " %" PRIu64 ".%d\n", disk->name, esc_tag(sub, esc_buffer),
-				file_already_present_size, file_already_present_mtime_sec, file_already_present_mtime_nsec,
+				report->file_already_present_size, report->file_already_present_mtime_sec, report->file_already_present_mtime_nsec,
 				file->size, file->mtime_sec, file->mtime_nsec
 			);
 
-			if (is_diff) {
-				printf("update %s\n", fmt_term(disk, sub, esc_buffer));
+			if (scan->is_diff) {
+				scan_print("update %s\n", fmt_term(disk, sub, esc_buffer));
 			}
 		} else {
 			++scan->count_insert;
 
 			log_tag("scan:add:%s:%s\n", disk->name, esc_tag(sub, esc_buffer));
-			if (is_diff) {
-				printf("add %s\n", fmt_term(disk, sub, esc_buffer));
+			if (scan->is_diff) {
+				scan_print("add %s\n", fmt_term(disk, sub, esc_buffer));
 			}
 		}
 	}
-
-	/* insert the file in the delayed list */
-	scan_file_insert(scan, file);
 }
 
 /**
@@ -1106,6 +1206,81 @@ static void scan_emptydir(struct snapraid_scan* scan, const char* sub)
 	tommy_list_insert_tail(&scan->dir_insert_list, &dir->nodelist, dir);
 }
 
+/**
+ * Directory to scan.
+ *
+ * The directories are read by the loader threads, and then processed
+ * by the disk thread, always in the same order of a sequential scan.
+ */
+struct snapraid_scan_dir {
+	char* dir; /**< Path of the directory. It always terminates with /. */
+	char* sub; /**< Path relative to the disk. It's empty or it terminates with /. */
+	int level; /**< Level of the directory. 0 for the disk mount point. */
+	int is_changed; /**< If the entries of the directory may be changed. Otherwise only the sub directories are read. */
+	int state; /**< State of the directory. One of the SCAN_DIR_* values. */
+	tommy_list list; /**< Sorted entries of the directory, when loaded. */
+
+	/* nodes for data structures */
+	tommy_node node;
+};
+
+#define SCAN_DIR_QUEUED 0 /**< Waiting in the queue. */
+#define SCAN_DIR_LOADING 1 /**< Being read by a thread. */
+#define SCAN_DIR_LOADED 2 /**< Ready to be processed. */
+
+/**
+ * Max number of directories read ahead by the loader threads.
+ *
+ * It limits the memory used when the processing is slower than the loading.
+ */
+#define SCAN_AHEAD_MAX 256
+
+static struct snapraid_scan_dir* scan_dir_alloc(const char* dir, const char* sub, int level, int is_changed)
+{
+	struct snapraid_scan_dir* sd;
+
+	sd = malloc_nofail(sizeof(struct snapraid_scan_dir));
+	sd->dir = strdup_nofail(dir);
+	sd->sub = strdup_nofail(sub);
+	sd->level = level;
+	sd->is_changed = is_changed;
+	sd->state = SCAN_DIR_QUEUED;
+	tommy_list_init(&sd->list);
+
+	return sd;
+}
+
+static void scan_dir_free(struct snapraid_scan_dir* sd)
+{
+	free(sd->dir);
+	free(sd->sub);
+	free(sd);
+}
+
+static inline void scan_lock(struct snapraid_scan* scan)
+{
+#if HAVE_PTHREAD
+	thread_mutex_lock(&scan->dir_mutex);
+#else
+	(void)scan;
+#endif
+}
+
+static inline void scan_unlock(struct snapraid_scan* scan)
+{
+#if HAVE_PTHREAD
+	thread_mutex_unlock(&scan->dir_mutex);
+#else
+	(void)scan;
+#endif
+}
+
+#define SCAN_ENTRY_SKIP 0 /**< Entry excluded or ignored. */
+#define SCAN_ENTRY_FILE 1 /**< Regular file, with the stat info in ::st. */
+#define SCAN_ENTRY_LINK 2 /**< Symbolic link, with the target in ::linkto. */
+#define SCAN_ENTRY_DIR 3 /**< Directory to recurse, in ::subdir. */
+#define SCAN_ENTRY_KEEP 4 /**< Entry not changed in the journal, kept as it's. */
+
 struct dirent_sorted {
 	/* node for data structures */
 	tommy_node node;
@@ -1119,6 +1294,11 @@ struct dirent_sorted {
 #if HAVE_STRUCT_DIRENT_D_STAT
 	struct stat d_stat; /**< Stat result. */
 #endif
+	int kind; /**< Kind of the entry. One of the SCAN_ENTRY_* values. */
+	int is_stat; /**< If ::st is already read. */
+	struct stat st; /**< Stat result. */
+	char* linkto; /**< Target of a link. */
+	struct snapraid_scan_dir* subdir; /**< Sub directory. */
 	char d_name[]; /**< Variable length name. It must be the last field. */
 };
 
@@ -1149,324 +1329,934 @@ static int dd_name_compare(const void* void_a, const void* void_b)
  * Return the stat info of a dir entry.
  */
 #if HAVE_STRUCT_DIRENT_D_STAT
-#define DSTAT(file, dd, buf) dstat(dd)
+#define DSTAT(file, dd) dstat(dd)
 struct stat* dstat(struct dirent_sorted* dd)
 {
 	return &dd->d_stat;
 }
 #else
-#define DSTAT(file, dd, buf) dstat(file, buf)
-struct stat* dstat(const char* file, struct stat* st)
+#define DSTAT(file, dd) dstat(file, dd)
+struct stat* dstat(const char* file, struct dirent_sorted* dd)
 {
-	if (lstat(file, st) != 0) {
+	/* if already read with the other entries of the directory */
+	if (dd->is_stat)
+		return &dd->st;
+
+	if (lstat_scan(file, &dd->st) != 0) {
 		/* LCOV_EXCL_START */
 		log_fatal("Error in stat file/directory '%s'. %s.\n", file, strerror(errno));
 		exit(EXIT_FAILURE);
 		/* LCOV_EXCL_STOP */
 	}
-	return st;
+
+	dd->is_stat = 1;
+
+	return &dd->st;
 }
 #endif
 
 /**
- * Process a directory.
- * Return != 0 if at least one file or link is processed.
+ * Get the info of a dir entry needed to process it.
  */
-static int scan_dir(struct snapraid_scan* scan, int level, int is_diff, const char* dir, const char* sub)
+static void scan_entry_load(struct snapraid_scan* scan, struct snapraid_scan_dir* sd, struct dirent_sorted* dd)
 {
 	struct snapraid_state* state = scan->state;
 	struct snapraid_disk* disk = scan->disk;
-	int processed = 0;
-	DIR* d;
-	tommy_list list;
-	tommy_node* node;
-
-	tommy_list_init(&list);
-
-	d = opendir(dir);
-	if (!d) {
-		/* LCOV_EXCL_START */
-		log_fatal("Error opening directory '%s'. %s.\n", dir, strerror(errno));
-		if (level == 0)
-			log_fatal("If this is the disk mount point, remember to create it manually\n");
-		else
-			log_fatal("If it's a permission problem, you can exclude it in the config file with:\n\texclude /%s\n", sub);
-		exit(EXIT_FAILURE);
-		/* LCOV_EXCL_STOP */
+	char path_next[PATH_MAX];
+	char sub_next[PATH_MAX];
+	char out[PATH_MAX];
+	struct snapraid_filter* reason = 0;
+	const char* name = dd->d_name;
+	struct stat* st;
+	int type;
+
+	pathprint(path_next, sizeof(path_next), "%s%s", sd->dir, name);
+	pathprint(sub_next, sizeof(sub_next), "%s%s", sd->sub, name);
+
+	dd->kind = SCAN_ENTRY_SKIP;
+	dd->linkto = 0;
+	dd->subdir = 0;
+
+	/* start with an unknown type */
+	type = -1;
+	st = 0;
+
+	/* if dirent has the type, use it */
+#if HAVE_STRUCT_DIRENT_D_TYPE
+	switch (dd->d_type) {
+	case DT_UNKNOWN : break;
+	case DT_REG : type = 0; break;
+	case DT_LNK : type = 1; break;
+	case DT_DIR : type = 2; break;
+	default : type = 3; break;
 	}
+#endif
 
-	/* read the full directory */
-	while (1) {
-		char path_next[PATH_MAX];
-		char sub_next[PATH_MAX];
-		struct dirent_sorted* entry;
-		const char* name;
-		struct dirent* dd;
-		size_t name_len;
-
-		/*
-		 * Clear errno to differentiate the end of the stream and an error condition
-		 *
-		 * From the Linux readdir() manpage:
-		 * "If the end of the directory stream is reached, NULL is returned and errno is not changed.
-		 * If an error occurs, NULL is returned and errno is set appropriately."
-		 */
-		errno = 0;
-		dd = readdir(d);
-		if (dd == 0 && errno != 0) {
-			/* LCOV_EXCL_START */
-			log_fatal("Error reading directory '%s'. %s.\n", dir, strerror(errno));
-			log_fatal("You can exclude it in the config file with:\n\texclude /%s\n", sub);
-			exit(EXIT_FAILURE);
-			/* LCOV_EXCL_STOP */
-		}
-		if (dd == 0) {
-			break; /* finished */
-		}
-
-		/* skip "." and ".." files */
-		name = dd->d_name;
-		if (name[0] == '.' && (name[1] == 0 || (name[1] == '.' && name[2] == 0)))
-			continue;
-
-		pathprint(path_next, sizeof(path_next), "%s%s", dir, name);
-		pathprint(sub_next, sizeof(sub_next), "%s%s", sub, name);
-
-		/* check for not supported file names */
-		if (name[0] == 0) {
-			/* LCOV_EXCL_START */
-			log_fatal("Unsupported name '%s' in file '%s'.\n", name, path_next);
-			exit(EXIT_FAILURE);
-			/* LCOV_EXCL_STOP */
-		}
-
-		/* exclude hidden files even before calling lstat() */
-		if (filter_hidden(state->filter_hidden, dd) != 0) {
-			msg_verbose("Excluding hidden '%s'\n", path_next);
-			continue;
-		}
-
-		/* exclude content files even before calling lstat() */
-		if (filter_content(&state->contentlist, path_next) != 0) {
-			msg_verbose("Excluding content '%s'\n", path_next);
-			continue;
-		}
-
-		name_len = strlen(dd->d_name);
-		entry = malloc_nofail(sizeof(struct dirent_sorted) + name_len + 1);
+	/* if type is still unknown */
+	if (type < 0) {
+		/* get the type from stat */
+		st = DSTAT(path_next, dd);
 
-		/* copy the dir entry */
-#if HAVE_STRUCT_DIRENT_D_INO
-		entry->d_ino = dd->d_ino;
-#endif
-#if HAVE_STRUCT_DIRENT_D_TYPE
-		entry->d_type = dd->d_type;
-#endif
 #if HAVE_STRUCT_DIRENT_D_STAT
-		/* convert dirent to lstat result */
-		dirent_lstat(dd, &entry->d_stat);
-
-		/* note that at this point the st_mode may be 0 */
+		/* if the st_mode field is missing, takes care to fill it using normal lstat() */
+		/* at now this can happen only in Windows (with HAVE_STRUCT_DIRENT_D_STAT defined), */
+		/* because we use a directory reading method that doesn't read info about ReparsePoint. */
+		/* Note that here we cannot call here lstat_sync(), because we don't know what kind */
+		/* of file is it, and lstat_sync() doesn't always work */
+		if (st->st_mode == 0) {
+			if (lstat(path_next, st) != 0) {
+				/* LCOV_EXCL_START */
+				log_fatal("Error in stat file/directory '%s'. %s.\n", path_next, strerror(errno));
+				exit(EXIT_FAILURE);
+				/* LCOV_EXCL_STOP */
+			}
+		}
 #endif
-		memcpy(entry->d_name, dd->d_name, name_len + 1);
-
-		/* insert in the list */
-		tommy_list_insert_tail(&list, &entry->node, entry);
-	}
 
-	if (closedir(d) != 0) {
-		/* LCOV_EXCL_START */
-		log_fatal("Error closing directory '%s'. %s.\n", dir, strerror(errno));
-		exit(EXIT_FAILURE);
-		/* LCOV_EXCL_STOP */
+		if (S_ISREG(st->st_mode))
+			type = 0;
+		else if (S_ISLNK(st->st_mode))
+			type = 1;
+		else if (S_ISDIR(st->st_mode))
+			type = 2;
+		else
+			type = 3;
 	}
 
-	if (state->opt.force_order == SORT_ALPHA) {
-		/* if requested sort alphabetically */
-		/* this is mainly done for testing to ensure to always */
-		/* process in the same way in different platforms */
-		tommy_list_sort(&list, dd_name_compare);
-	}
-#if HAVE_STRUCT_DIRENT_D_INO
-	else if (!disk->has_volatile_inodes) {
-		/* if inodes are persistent */
-		/* sort the list of dir entries by inodes */
-		tommy_list_sort(&list, dd_ino_compare);
+	/* if the directory is not changed, only the sub directories are read */
+	if (!sd->is_changed && type != 2) {
+		dd->kind = SCAN_ENTRY_KEEP;
+		return;
 	}
-	/* otherwise just keep the insertion order */
-#endif
-
-	/* process the sorted dir entries */
-	node = list;
-	while (node != 0) {
-		char path_next[PATH_MAX];
-		char sub_next[PATH_MAX];
-		char out[PATH_MAX];
-		struct snapraid_filter* reason = 0;
-		struct dirent_sorted* dd = node->data;
-		const char* name = dd->d_name;
-		struct stat* st;
-		int type;
-#if !HAVE_STRUCT_DIRENT_D_STAT
-		struct stat st_buf;
-#endif
-
-		pathprint(path_next, sizeof(path_next), "%s%s", dir, name);
-		pathprint(sub_next, sizeof(sub_next), "%s%s", sub, name);
 
-		/* start with an unknown type */
-		type = -1;
-		st = 0;
-
-		/* if dirent has the type, use it */
-#if HAVE_STRUCT_DIRENT_D_TYPE
-		switch (dd->d_type) {
-		case DT_UNKNOWN : break;
-		case DT_REG : type = 0; break;
-		case DT_LNK : type = 1; break;
-		case DT_DIR : type = 2; break;
-		default : type = 3; break;
-		}
-#endif
+	if (type == 0) { /* REG */
+		if (filter_path(&state->filterlist, &reason, disk->name, sub_next) == 0) {
 
-		/* if type is still unknown */
-		if (type < 0) {
-			/* get the type from stat */
-			st = DSTAT(path_next, dd, &st_buf);
+			/* late stat, if not yet called */
+			if (!st)
+				st = DSTAT(path_next, dd);
 
-#if HAVE_STRUCT_DIRENT_D_STAT
-			/* if the st_mode field is missing, takes care to fill it using normal lstat() */
-			/* at now this can happen only in Windows (with HAVE_STRUCT_DIRENT_D_STAT defined), */
-			/* because we use a directory reading method that doesn't read info about ReparsePoint. */
-			/* Note that here we cannot call here lstat_sync(), because we don't know what kind */
-			/* of file is it, and lstat_sync() doesn't always work */
-			if (st->st_mode == 0) {
-				if (lstat(path_next, st) != 0) {
+#if HAVE_LSTAT_SYNC
+			/* if the st_ino field is missing, takes care to fill it using the extended lstat() */
+			/* this can happen only in Windows */
+			if (st->st_ino == 0 || st->st_nlink == 0) {
+				if (lstat_sync(path_next, st, 0) != 0) {
 					/* LCOV_EXCL_START */
-					log_fatal("Error in stat file/directory '%s'. %s.\n", path_next, strerror(errno));
+					log_fatal("Error in stat file '%s'. %s.\n", path_next, strerror(errno));
 					exit(EXIT_FAILURE);
 					/* LCOV_EXCL_STOP */
 				}
 			}
 #endif
 
-			if (S_ISREG(st->st_mode))
-				type = 0;
-			else if (S_ISLNK(st->st_mode))
-				type = 1;
-			else if (S_ISDIR(st->st_mode))
-				type = 2;
-			else
-				type = 3;
+			/* keep the stat info for the processing */
+			if (st != &dd->st)
+				dd->st = *st;
+
+			dd->kind = SCAN_ENTRY_FILE;
+		} else {
+			msg_verbose("Excluding file '%s' for rule '%s'\n", path_next, filter_type(reason, out, sizeof(out)));
 		}
+	} else if (type == 1) { /* LNK */
+		if (filter_path(&state->filterlist, &reason, disk->name, sub_next) == 0) {
+			char subnew[PATH_MAX];
+			int ret;
 
-		if (type == 0) { /* REG */
-			if (filter_path(&state->filterlist, &reason, disk->name, sub_next) == 0) {
+			ret = readlink(path_next, subnew, sizeof(subnew));
+			if (ret >= PATH_MAX) {
+				/* LCOV_EXCL_START */
+				log_fatal("Error in readlink file '%s'. Symlink too long.\n", path_next);
+				exit(EXIT_FAILURE);
+				/* LCOV_EXCL_STOP */
+			}
+			if (ret < 0) {
+				/* LCOV_EXCL_START */
+				log_fatal("Error in readlink file '%s'. %s.\n", path_next, strerror(errno));
+				exit(EXIT_FAILURE);
+				/* LCOV_EXCL_STOP */
+			}
+			if (ret == 0)
+				log_fatal("WARNING! Empty symbolic link '%s'.\n", path_next);
 
-				/* late stat, if not yet called */
-				if (!st)
-					st = DSTAT(path_next, dd, &st_buf);
+			/* readlink doesn't put the final 0 */
+			subnew[ret] = 0;
 
-#if HAVE_LSTAT_SYNC
-				/* if the st_ino field is missing, takes care to fill it using the extended lstat() */
-				/* this can happen only in Windows */
-				if (st->st_ino == 0 || st->st_nlink == 0) {
-					if (lstat_sync(path_next, st, 0) != 0) {
-						/* LCOV_EXCL_START */
-						log_fatal("Error in stat file '%s'. %s.\n", path_next, strerror(errno));
-						exit(EXIT_FAILURE);
-						/* LCOV_EXCL_STOP */
-					}
-				}
+			dd->linkto = strdup_nofail(subnew);
+			dd->kind = SCAN_ENTRY_LINK;
+		} else {
+			msg_verbose("Excluding link '%s' for rule '%s'\n", path_next, filter_type(reason, out, sizeof(out)));
+		}
+	} else if (type == 2) { /* DIR */
+		if (filter_subdir(&state->filterlist, &reason, disk->name, sub_next) == 0) {
+#ifndef _WIN32
+			/* late stat, if not yet called */
+			if (!st)
+				st = DSTAT(path_next, dd);
+
+			/* in Unix don't follow mount points in different devices */
+			/* in Windows we are already skipping them reporting them as special files */
+			if ((uint64_t)st->st_dev != disk->device) {
+				log_fatal("WARNING! Ignoring mount point '%s' because it appears to be in a different device\n", path_next);
+			} else
 #endif
+			{
+				char sub_dir[PATH_MAX];
 
-				scan_file(scan, is_diff, sub_next, st, FILEPHY_UNREAD_OFFSET);
-				processed = 1;
-			} else {
-				msg_verbose("Excluding file '%s' for rule '%s'\n", path_next, filter_type(reason, out, sizeof(out)));
-			}
-		} else if (type == 1) { /* LNK */
-			if (filter_path(&state->filterlist, &reason, disk->name, sub_next) == 0) {
-				char subnew[PATH_MAX];
-				int ret;
+				/* recurse */
+				pathslash(path_next, sizeof(path_next));
+				pathcpy(sub_dir, sizeof(sub_dir), sub_next);
+				pathslash(sub_dir, sizeof(sub_dir));
 
-				ret = readlink(path_next, subnew, sizeof(subnew));
-				if (ret >= PATH_MAX) {
-					/* LCOV_EXCL_START */
-					log_fatal("Error in readlink file '%s'. Symlink too long.\n", path_next);
-					exit(EXIT_FAILURE);
-					/* LCOV_EXCL_STOP */
-				}
-				if (ret < 0) {
-					/* LCOV_EXCL_START */
-					log_fatal("Error in readlink file '%s'. %s.\n", path_next, strerror(errno));
-					exit(EXIT_FAILURE);
-					/* LCOV_EXCL_STOP */
+				if (scan->is_journal && !journal_dir_is_read(scan->jdisk, sub_dir)) {
+					/* nothing changed inside */
+					dd->kind = SCAN_ENTRY_KEEP;
+				} else {
+					dd->subdir = scan_dir_alloc(path_next, sub_dir, sd->level + 1, !scan->is_journal || journal_dir_is_changed(scan->jdisk, sub_dir));
+					dd->kind = SCAN_ENTRY_DIR;
 				}
-				if (ret == 0)
-					log_fatal("WARNING! Empty symbolic link '%s'.\n", path_next);
+			}
+		} else {
+			msg_verbose("Excluding directory '%s' for rule '%s'\n", path_next, filter_type(reason, out, sizeof(out)));
+		}
+	} else {
+		if (filter_path(&state->filterlist, &reason, disk->name, sub_next) == 0) {
+			/* late stat, if not yet called */
+			if (!st)
+				st = DSTAT(path_next, dd);
+
+			log_fatal("WARNING! Ignoring special '%s' file '%s'\n", stat_desc(st), path_next);
+		} else {
+			msg_verbose("Excluding special file '%s' for rule '%s'\n", path_next, filter_type(reason, out, sizeof(out)));
+		}
+	}
+}
+
+#if HAVE_IO_URING_STATX
+/**
+ * Max number of stat requests submitted together.
+ */
+#define SCAN_URING_MAX 64
+
+/**
+ * Stat request of a dir entry.
+ */
+struct scan_statx {
+	struct statx stx; /**< Result. */
+	struct dirent_sorted* dd; /**< Entry to fill. */
+};
+
+/**
+ * Check if the stat info of a dir entry is going to be used.
+ *
+ * It's used for the files and directories not excluded,
+ * and for the entries of unknown type.
+ */
+static int scan_entry_need_stat(struct snapraid_scan* scan, struct snapraid_scan_dir* sd, struct dirent_sorted* dd)
+{
+#if HAVE_STRUCT_DIRENT_D_TYPE
+	struct snapraid_state* state = scan->state;
+	struct snapraid_disk* disk = scan->disk;
+	struct snapraid_filter* reason = 0;
+	char sub_next[PATH_MAX];
+
+	pathprint(sub_next, sizeof(sub_next), "%s%s", sd->sub, dd->d_name);
+
+	switch (dd->d_type) {
+	case DT_UNKNOWN : return 1;
+	case DT_REG : return sd->is_changed && filter_path(&state->filterlist, &reason, disk->name, sub_next) == 0;
+	case DT_DIR : return filter_subdir(&state->filterlist, &reason, disk->name, sub_next) == 0;
+	}
+
+	/* links don't use it, and special files are too rare to matter */
+	return 0;
+#else
+	(void)scan;
+	(void)sd;
+	(void)dd;
+	return 1;
+#endif
+}
+
+/**
+ * Read the stat info of all the entries of a directory.
+ *
+ * The statx requests are submitted to io_uring in batches, instead
+ * of calling lstat() for one entry at time.
+ * Entries with an error are left to lstat(), that reports it.
+ */
+static void scan_dir_stat(struct snapraid_scan* scan, struct snapraid_uring* ring, struct snapraid_scan_dir* sd, DIR* d, tommy_list* list)
+{
+	struct scan_statx* req_map;
+	tommy_node* node;
+	int f;
+
+	f = dirfd(d);
+	if (f == -1) {
+		/* LCOV_EXCL_START */
+		return;
+		/* LCOV_EXCL_STOP */
+	}
+
+	req_map = malloc_nofail(SCAN_URING_MAX * sizeof(struct scan_statx));
+
+	node = tommy_list_head(list);
+	while (node) {
+		unsigned count;
+		unsigned i;
+
+		/* queue a batch of requests */
+		count = 0;
+		while (node && count < SCAN_URING_MAX) {
+			struct dirent_sorted* dd = node->data;
+			struct scan_statx* req = &req_map[count];
+
+			node = node->next;
+
+			if (!scan_entry_need_stat(scan, sd, dd))
+				continue;
+
+			if (uring_queue_statx(ring, f, dd->d_name, &req->stx, req) != 0) {
+				/* LCOV_EXCL_START */
+				log_fatal("Failed to queue requests to io_uring.\n");
+				os_abort();
+				/* LCOV_EXCL_STOP */
+			}
+
+			req->dd = dd;
+			++count;
+		}
+
+		if (count == 0)
+			break;
+
+		if (uring_submit(ring) != 0) {
+			/* LCOV_EXCL_START */
+			log_fatal("Failed to submit requests to io_uring. %s.\n", strerror(errno));
+			exit(EXIT_FAILURE);
+			/* LCOV_EXCL_STOP */
+		}
+
+		/* wait for all of them */
+		for (i = 0; i < count; ++i) {
+			struct scan_statx* req;
+			void* arg;
+			int result;
+
+			if (uring_wait(ring, &arg, &result) != 0) {
+				/* LCOV_EXCL_START */
+				log_fatal("Failed to wait requests from io_uring. %s.\n", strerror(errno));
+				exit(EXIT_FAILURE);
+				/* LCOV_EXCL_STOP */
+			}
+
+			req = arg;
+
+			/* on error, including kernels without statx support in io_uring, */
+			/* the entry is left to lstat() */
+			if (result == 0) {
+				statx_to_stat(&req->stx, &req->dd->st);
+				req->dd->is_stat = 1;
+			}
+		}
+	}
+
+	free(req_map);
+}
+#endif
+
+/**
+ * Setup the ring to read the stat info of the directories.
+ *
+ * It's experimental, and enabled only with --test-scan-uring.
+ * The statx() call of the normal path already requests only the used
+ * fields, and the ring gains only when the stat info isn't cached,
+ * while the kernels before 5.6 without IORING_OP_STATX pay an extra
+ * failed request for every entry.
+ *
+ * Return 0 if io_uring is not used.
+ */
+static struct snapraid_uring* scan_ring_init(struct snapraid_scan* scan, struct snapraid_uring* ring)
+{
+#if HAVE_IO_URING_STATX && !HAVE_STRUCT_DIRENT_D_STAT
+	if (scan->state->opt.scan_uring) {
+		if (uring_init(ring, SCAN_URING_MAX) == 0)
+			return ring;
+
+		/* LCOV_EXCL_START */
+		msg_verbose("Failed to setup io_uring for disk '%s'. %s. Using lstat().\n", scan->disk->name, strerror(errno));
+		/* LCOV_EXCL_STOP */
+	}
+#else
+	(void)scan;
+	(void)ring;
+#endif
+	return 0;
+}
+
+static void scan_ring_done(struct snapraid_uring* ring)
+{
+	if (ring)
+		uring_done(ring);
+}
+
+/**
+ * Read a directory, and get the info of all its entries.
+ *
+ * It doesn't change the state, and it can run concurrently with
+ * other directories of the same disk.
+ */
+static void scan_dir_load(struct snapraid_scan* scan, struct snapraid_uring* ring, struct snapraid_scan_dir* sd)
+{
+	struct snapraid_state* state = scan->state;
+	struct snapraid_disk* disk = scan->disk;
+	const char* dir = sd->dir;
+	const char* sub = sd->sub;
+	int level = sd->level;
+	DIR* d;
+	tommy_list list;
+	tommy_node* node;
+
+	tommy_list_init(&list);
+
+	d = opendir(dir);
+	if (!d) {
+		/* LCOV_EXCL_START */
+		log_fatal("Error opening directory '%s'. %s.\n", dir, strerror(errno));
+		if (level == 0)
+			log_fatal("If this is the disk mount point, remember to create it manually\n");
+		else
+			log_fatal("If it's a permission problem, you can exclude it in the config file with:\n\texclude /%s\n", sub);
+		exit(EXIT_FAILURE);
+		/* LCOV_EXCL_STOP */
+	}
+
+	/* read the full directory */
+	while (1) {
+		char path_next[PATH_MAX];
+		char sub_next[PATH_MAX];
+		struct dirent_sorted* entry;
+		const char* name;
+		struct dirent* dd;
+		size_t name_len;
+
+		/*
+		 * Clear errno to differentiate the end of the stream and an error condition
+		 *
+		 * From the Linux readdir() manpage:
+		 * "If the end of the directory stream is reached, NULL is returned and errno is not changed.
+		 * If an error occurs, NULL is returned and errno is set appropriately."
+		 */
+		errno = 0;
+		dd = readdir(d);
+		if (dd == 0 && errno != 0) {
+			/* LCOV_EXCL_START */
+			log_fatal("Error reading directory '%s'. %s.\n", dir, strerror(errno));
+			log_fatal("You can exclude it in the config file with:\n\texclude /%s\n", sub);
+			exit(EXIT_FAILURE);
+			/* LCOV_EXCL_STOP */
+		}
+		if (dd == 0) {
+			break; /* finished */
+		}
+
+		/* skip "." and ".." files */
+		name = dd->d_name;
+		if (name[0] == '.' && (name[1] == 0 || (name[1] == '.' && name[2] == 0)))
+			continue;
+
+		pathprint(path_next, sizeof(path_next), "%s%s", dir, name);
+		pathprint(sub_next, sizeof(sub_next), "%s%s", sub, name);
+
+		/* check for not supported file names */
+		if (name[0] == 0) {
+			/* LCOV_EXCL_START */
+			log_fatal("Unsupported name '%s' in file '%s'.\n", name, path_next);
+			exit(EXIT_FAILURE);
+			/* LCOV_EXCL_STOP */
+		}
+
+		/* exclude hidden files even before calling lstat() */
+		if (filter_hidden(state->filter_hidden, dd) != 0) {
+			msg_verbose("Excluding hidden '%s'\n", path_next);
+			continue;
+		}
+
+		/* exclude content files even before calling lstat() */
+		if (filter_content(&state->contentlist, path_next) != 0) {
+			msg_verbose("Excluding content '%s'\n", path_next);
+			continue;
+		}
+
+		name_len = strlen(dd->d_name);
+		entry = malloc_nofail(sizeof(struct dirent_sorted) + name_len + 1);
+
+		/* copy the dir entry */
+#if HAVE_STRUCT_DIRENT_D_INO
+		entry->d_ino = dd->d_ino;
+#endif
+#if HAVE_STRUCT_DIRENT_D_TYPE
+		entry->d_type = dd->d_type;
+#endif
+		entry->is_stat = 0;
+#if HAVE_STRUCT_DIRENT_D_STAT
+		/* convert dirent to lstat result */
+		dirent_lstat(dd, &entry->d_stat);
+
+		/* note that at this point the st_mode may be 0 */
+#endif
+		memcpy(entry->d_name, dd->d_name, name_len + 1);
+
+		/* insert in the list */
+		tommy_list_insert_tail(&list, &entry->node, entry);
+	}
+
+	if (state->opt.force_order == SORT_ALPHA) {
+		/* if requested sort alphabetically */
+		/* this is mainly done for testing to ensure to always */
+		/* process in the same way in different platforms */
+		tommy_list_sort(&list, dd_name_compare);
+	}
+#if HAVE_STRUCT_DIRENT_D_INO
+	else if (!disk->has_volatile_inodes) {
+		/* if inodes are persistent */
+		/* sort the list of dir entries by inodes */
+		tommy_list_sort(&list, dd_ino_compare);
+	}
+	/* otherwise just keep the insertion order */
+#endif
+
+#if HAVE_IO_URING_STATX
+	/* read the stat info all together, in the sorted order */
+	if (ring)
+		scan_dir_stat(scan, ring, sd, d, &list);
+#else
+	(void)ring;
+#endif
+
+	if (closedir(d) != 0) {
+		/* LCOV_EXCL_START */
+		log_fatal("Error closing directory '%s'. %s.\n", dir, strerror(errno));
+		exit(EXIT_FAILURE);
+		/* LCOV_EXCL_STOP */
+	}
+
+	/* get the info of the sorted dir entries */
+	for (node = list; node != 0; node = node->next)
+		scan_entry_load(scan, sd, node->data);
+
+	sd->list = list;
+}
+
+/**
+ * Mark the directory as loaded, and queue its sub directories.
+ *
+ * Call it with the lock held.
+ */
+static void scan_dir_loaded_unlock(struct snapraid_scan* scan, struct snapraid_scan_dir* sd)
+{
+	tommy_node* node;
+
+	/* insert the sub directories at the head of the queue in reverse order, */
+	/* to have the first one to process at the head */
+	node = tommy_list_tail(&sd->list);
+	while (node) {
+		struct dirent_sorted* dd = node->data;
+
+		if (dd->kind == SCAN_ENTRY_DIR)
+			tommy_list_insert_head(&scan->dir_queue, &dd->subdir->node, dd->subdir);
+
+		/* the head has the prev pointer to the tail, and we stop there */
+		node = node != sd->list ? node->prev : 0;
+	}
+
+	sd->state = SCAN_DIR_LOADED;
+}
+
+/**
+ * Wait until the directory is loaded.
+ *
+ * If no loader thread has started to read it, it's taken back from
+ * the queue, and read directly.
+ */
+static void scan_dir_wait(struct snapraid_scan* scan, struct snapraid_scan_dir* sd)
+{
+	scan_lock(scan);
+
+	if (sd->state == SCAN_DIR_QUEUED) {
+		tommy_list_remove_existing(&scan->dir_queue, &sd->node);
+		sd->state = SCAN_DIR_LOADING;
+
+		scan_unlock(scan);
+
+		scan_dir_load(scan, scan->ring, sd);
+
+		scan_lock(scan);
+
+		scan_dir_loaded_unlock(scan, sd);
+
+#if HAVE_PTHREAD
+		/* new sub directories are available to the loaders */
+		thread_cond_broadcast(&scan->dir_cond);
+#endif
+
+		scan_unlock(scan);
+		return;
+	}
+
+#if HAVE_PTHREAD
+	while (sd->state != SCAN_DIR_LOADED)
+		thread_cond_wait(&scan->dir_cond, &scan->dir_mutex);
+
+	/* the directory read ahead is now consumed */
+	--scan->dir_ahead;
+
+	/* the loaders may wait for the read ahead limit */
+	thread_cond_broadcast(&scan->dir_cond);
+#endif
+
+	scan_unlock(scan);
+}
+
+#if HAVE_PTHREAD
+/**
+ * Thread reading ahead the directories in the queue.
+ */
+static void* scan_loader_thread(void* arg)
+{
+	struct snapraid_scan* scan = arg;
+	struct snapraid_uring ring_buf;
+	struct snapraid_uring* ring;
+
+	ring = scan_ring_init(scan, &ring_buf);
+
+	thread_mutex_lock(&scan->dir_mutex);
+
+	while (1) {
+		struct snapraid_scan_dir* sd;
+
+		while (!scan->dir_stop && (tommy_list_empty(&scan->dir_queue) || scan->dir_ahead >= SCAN_AHEAD_MAX))
+			thread_cond_wait(&scan->dir_cond, &scan->dir_mutex);
+
+		if (scan->dir_stop)
+			break;
+
+		/* take the directory that will be processed first */
+		sd = tommy_list_head(&scan->dir_queue)->data;
+		tommy_list_remove_existing(&scan->dir_queue, &sd->node);
+		sd->state = SCAN_DIR_LOADING;
+
+		thread_mutex_unlock(&scan->dir_mutex);
+
+		scan_dir_load(scan, ring, sd);
+
+		thread_mutex_lock(&scan->dir_mutex);
+
+		scan_dir_loaded_unlock(scan, sd);
+
+		++scan->dir_ahead;
+
+		thread_cond_broadcast(&scan->dir_cond);
+	}
+
+	thread_mutex_unlock(&scan->dir_mutex);
+
+	scan_ring_done(ring);
+
+	return 0;
+}
+#endif
+
+/**
+ * Process a directory.
+ * Return != 0 if at least one file or link is processed.
+ *
+ * The directory is freed.
+ */
+static int scan_dir(struct snapraid_scan* scan, struct snapraid_scan_dir* sd)
+{
+	int processed = 0;
+	tommy_node* node;
 
-				/* readlink doesn't put the final 0 */
-				subnew[ret] = 0;
+	scan_dir_wait(scan, sd);
 
-				/* process as a symbolic link */
-				scan_link(scan, is_diff, sub_next, subnew, FILE_IS_SYMLINK);
-				processed = 1;
-			} else {
-				msg_verbose("Excluding link '%s' for rule '%s'\n", path_next, filter_type(reason, out, sizeof(out)));
-			}
-		} else if (type == 2) { /* DIR */
-			if (filter_subdir(&state->filterlist, &reason, disk->name, sub_next) == 0) {
-#ifndef _WIN32
-				/* late stat, if not yet called */
-				if (!st)
-					st = DSTAT(path_next, dd, &st_buf);
-
-				/* in Unix don't follow mount points in different devices */
-				/* in Windows we are already skipping them reporting them as special files */
-				if ((uint64_t)st->st_dev != disk->device) {
-					log_fatal("WARNING! Ignoring mount point '%s' because it appears to be in a different device\n", path_next);
-				} else
-#endif
-				{
-					char sub_dir[PATH_MAX];
-
-					/* recurse */
-					pathslash(path_next, sizeof(path_next));
-					pathcpy(sub_dir, sizeof(sub_dir), sub_next);
-					pathslash(sub_dir, sizeof(sub_dir));
-					if (scan_dir(scan, level + 1, is_diff, path_next, sub_dir) == 0) {
-						/* scan the directory as empty dir */
-						scan_emptydir(scan, sub_next);
-					}
-					/* or we processed something internally, or we have added the empty dir */
-					processed = 1;
-				}
-			} else {
-				msg_verbose("Excluding directory '%s' for rule '%s'\n", path_next, filter_type(reason, out, sizeof(out)));
-			}
-		} else {
-			if (filter_path(&state->filterlist, &reason, disk->name, sub_next) == 0) {
-				/* late stat, if not yet called */
-				if (!st)
-					st = DSTAT(path_next, dd, &st_buf);
+	/* process the sorted dir entries */
+	node = sd->list;
+	while (node != 0) {
+		char sub_next[PATH_MAX];
+		struct dirent_sorted* dd = node->data;
 
-				log_fatal("WARNING! Ignoring special '%s' file '%s'\n", stat_desc(st), path_next);
-			} else {
-				msg_verbose("Excluding special file '%s' for rule '%s'\n", path_next, filter_type(reason, out, sizeof(out)));
+		pathprint(sub_next, sizeof(sub_next), "%s%s", sd->sub, dd->d_name);
+
+		switch (dd->kind) {
+		case SCAN_ENTRY_FILE :
+			scan_file(scan, scan->is_diff, sub_next, &dd->st, FILEPHY_UNREAD_OFFSET);
+			processed = 1;
+			break;
+		case SCAN_ENTRY_LINK :
+			/* process as a symbolic link */
+			scan_link(scan, scan->is_diff, sub_next, dd->linkto, FILE_IS_SYMLINK);
+			processed = 1;
+			break;
+		case SCAN_ENTRY_DIR :
+			if (scan_dir(scan, dd->subdir) == 0) {
+				/* scan the directory as empty dir */
+				scan_emptydir(scan, sub_next);
 			}
+			/* or we processed something internally, or we have added the empty dir */
+			processed = 1;
+			break;
+		case SCAN_ENTRY_KEEP :
+			/* already kept before reading */
+			processed = 1;
+			break;
 		}
 
 		/* next entry */
 		node = node->next;
 
 		/* free the present one */
+		free(dd->linkto);
 		free(dd);
 	}
 
+	scan_dir_free(sd);
+
 	return processed;
 }
 
+/**
+ * Get the directory containing a path.
+ *
+ * The result is empty, or it terminates with /.
+ */
+static void scan_parent(char* parent, size_t size, const char* sub)
+{
+	const char* slash = strrchr(sub, '/');
+	size_t len = slash ? (size_t)(slash - sub) + 1 : 0;
+
+	if (len >= size) {
+		/* LCOV_EXCL_START */
+		log_fatal("Path too long '%s'\n", sub);
+		os_abort();
+		/* LCOV_EXCL_STOP */
+	}
+
+	memcpy(parent, sub, len);
+	parent[len] = 0;
+}
+
+/**
+ * Keep all the files, links and dirs in directories not changed in the journal.
+ *
+ * It's done before reading the directories, to have the kept files
+ * already present when searching for moved files and hardlinks.
+ */
+static void scan_journal_keep(struct snapraid_scan* scan)
+{
+	struct snapraid_state* state = scan->state;
+	struct snapraid_disk* disk = scan->disk;
+	char parent[PATH_MAX];
+	char sub[PATH_MAX];
+	char esc_buffer[ESC_MAX];
+	tommy_node* node;
+	int is_marked;
+
+	/* a hardlink and its file have to be both read or both kept */
+	/* to update them together, as in a complete scan */
+	do {
+		is_marked = 0;
+
+		if (!scan->jdisk)
+			break;
+
+		for (node = disk->linklist; node != 0; node = node->next) {
+			struct snapraid_link* slink = node->data;
+			char parent_to[PATH_MAX];
+			int is_changed;
+			int is_changed_to;
+
+			if (link_flag_get(slink, FILE_IS_LINK_MASK) != FILE_IS_HARDLINK)
+				continue;
+
+			scan_parent(parent, sizeof(parent), slink->sub);
+			scan_parent(parent_to, sizeof(parent_to), slink->linkto);
+
+			is_changed = journal_dir_is_changed(scan->jdisk, parent);
+			is_changed_to = journal_dir_is_changed(scan->jdisk, parent_to);
+
+			if (is_changed != is_changed_to) {
+				journal_mark(scan->jdisk, parent, JOURNAL_DIR);
+				journal_mark(scan->jdisk, parent_to, JOURNAL_DIR);
+				is_marked = 1;
+			}
+		}
+	} while (is_marked);
+
+	node = disk->filelist;
+	while (node) {
+		struct snapraid_file* file = node->data;
+
+		/* next node, as the file may be reinserted */
+		node = node->next;
+
+		scan_parent(parent, sizeof(parent), file->sub);
+		if (journal_dir_is_changed(scan->jdisk, parent))
+			continue;
+
+		file_flag_set(file, FILE_IS_PRESENT);
+
+		++scan->count_equal;
+
+		if (state->opt.gui) {
+			log_tag("scan:equal:%s:%s\n", disk->name, esc_tag(file->sub, esc_buffer));
+		}
+
+		scan_file_keep(scan, file);
+	}
+
+	for (node = disk->linklist; node != 0; node = node->next) {
+		struct snapraid_link* slink = node->data;
+
+		scan_parent(parent, sizeof(parent), slink->sub);
+		if (journal_dir_is_changed(scan->jdisk, parent))
+			continue;
+
+		link_flag_set(slink, FILE_IS_PRESENT);
+
+		++scan->count_equal;
+
+		if (state->opt.gui) {
+			log_tag("scan:equal:%s:%s\n", disk->name, esc_tag(slink->sub, esc_buffer));
+		}
+	}
+
+	for (node = disk->dirlist; node != 0; node = node->next) {
+		struct snapraid_dir* dir = node->data;
+
+		/* an empty dir is kept if it's not read */
+		pathcpy(sub, sizeof(sub), dir->sub);
+		pathslash(sub, sizeof(sub));
+		if (journal_dir_is_read(scan->jdisk, sub))
+			continue;
+
+		dir_flag_set(dir, FILE_IS_PRESENT);
+	}
+}
+
+/**
+ * Scan a disk, finding new and deleted files.
+ *
+ * It accesses only the specified disk, and it can run concurrently with other disks.
+ */
+static void scan_disk(struct snapraid_scan* scan)
+{
+	struct snapraid_disk* disk = scan->disk;
+	struct snapraid_scan_dir* root;
+	struct snapraid_uring ring_buf;
+	tommy_node* node;
+	int ret;
+	int has_persistent_inodes;
+	int has_syncronized_hardlinks;
+#if HAVE_PTHREAD
+	unsigned i;
+#endif
+
+	/* check if the disk supports persistent inodes */
+	ret = fsinfo(disk->dir, &has_persistent_inodes, &has_syncronized_hardlinks, 0, 0);
+	if (ret < 0) {
+		/* LCOV_EXCL_START */
+		log_fatal("Error accessing disk '%s' to get file-system info. %s.\n", disk->dir, strerror(errno));
+		exit(EXIT_FAILURE);
+		/* LCOV_EXCL_STOP */
+	}
+	if (!has_persistent_inodes) {
+		disk->has_volatile_inodes = 1;
+	}
+	if (!has_syncronized_hardlinks) {
+		disk->has_volatile_hardlinks = 1;
+	}
+
+	/* the journal cannot be used if the inodes of the kept files may be changed */
+	/* an unsupported UUID is instead fine, as an unmount is reported in the journal */
+	if (disk->has_volatile_inodes || disk->has_different_uuid)
+		scan->is_journal = 0;
+
+	/* keep the files not changed, with their inodes */
+	if (scan->is_journal)
+		scan_journal_keep(scan);
+
+	/* if inodes or UUID are not persistent/changed/unsupported */
+	if (disk->has_volatile_inodes || disk->has_different_uuid || disk->has_unsupported_uuid) {
+		/* remove all the inodes from the inode collection */
+		/* if they are not persistent, all of them could be changed now */
+		/* and we don't want to find false matching ones */
+		/* see scan_file() for more details */
+		node = disk->filelist;
+		while (node) {
+			struct snapraid_file* file = node->data;
+
+			node = node->next;
+
+			/* the files kept from the journal are not changed */
+			if (file_flag_has(file, FILE_IS_PRESENT))
+				continue;
+
+			/* remove from the inode set */
+			tommy_hashdyn_remove_existing(&disk->inodeset, &file->nodeset);
+
+			/* clear the inode */
+			file->inode = 0;
+
+			/* mark as missing inode */
+			file_flag_set(file, FILE_IS_WITHOUT_INODE);
+		}
+	}
+
+	/* if nothing changed, there is nothing to read */
+	if (scan->is_journal && !scan->jdisk)
+		return;
+
+	scan->ring = scan_ring_init(scan, &ring_buf);
+
+	/* the disk mount point is the first directory to read */
+	root = scan_dir_alloc(disk->dir, "", 0, !scan->is_journal || journal_dir_is_changed(scan->jdisk, ""));
+	tommy_list_insert_tail(&scan->dir_queue, &root->node, root);
+
+#if HAVE_PTHREAD
+	/* the disk thread is also reading the directories */
+	scan->loader_max = scan->state->scan_thread - 1;
+	scan->loader_map = malloc_nofail(scan->loader_max * sizeof(pthread_t) + 1);
+	for (i = 0; i < scan->loader_max; ++i)
+		thread_create(&scan->loader_map[i], 0, scan_loader_thread, scan);
+#endif
+
+	scan_dir(scan, root);
+
+#if HAVE_PTHREAD
+	thread_mutex_lock(&scan->dir_mutex);
+	scan->dir_stop = 1;
+	thread_cond_broadcast(&scan->dir_cond);
+	thread_mutex_unlock(&scan->dir_mutex);
+
+	for (i = 0; i < scan->loader_max; ++i)
+		thread_join(scan->loader_map[i], 0);
+
+	free(scan->loader_map);
+#endif
+
+	scan_ring_done(scan->ring);
+	scan->ring = 0;
+}
+
+#if HAVE_PTHREAD
+static void* scan_disk_thread(void* arg)
+{
+	scan_disk(arg);
+
+	return 0;
+}
+#endif
+
 static int state_diffscan(struct snapraid_state* state, int is_diff)
 {
 	tommy_node* i;
@@ -1475,26 +2265,34 @@ static int state_diffscan(struct snapraid_state* state, int is_diff)
 	int done;
 	fptr* msg;
 	struct snapraid_scan total;
+	struct snapraid_journal journal;
+	int is_journal;
 	int no_difference;
 	char esc_buffer[ESC_MAX];
 
 	tommy_list_init(&scanlist);
 
+	/* get the changes from the watcher, if running */
+	is_journal = journal_load(state, &journal) == 0;
+	if (is_journal)
+		msg_verbose("Reading only the directories changed in the journal\n");
+
 	if (is_diff)
 		msg_progress("Comparing...\n");
 
 	/* first scan all the directory and find new and deleted files */
+	/* every disk is scanned by a different thread */
 	for (i = state->disklist; i != 0; i = i->next) {
 		struct snapraid_disk* disk = i->data;
 		struct snapraid_scan* scan;
-		tommy_node* node;
-		int ret;
-		int has_persistent_inodes;
-		int has_syncronized_hardlinks;
 
 		scan = malloc_nofail(sizeof(struct snapraid_scan));
 		scan->state = state;
 		scan->disk = disk;
+		scan->is_diff = is_diff;
+		scan->is_journal = is_journal;
+		scan->jdisk = is_journal ? journal_disk(&journal, disk->name) : 0;
+		scan->need_write = 0;
 		scan->count_equal = 0;
 		scan->count_move = 0;
 		scan->count_copy = 0;
@@ -1505,51 +2303,72 @@ static int state_diffscan(struct snapraid_state* state, int is_diff)
 		tommy_list_init(&scan->file_insert_list);
 		tommy_list_init(&scan->link_insert_list);
 		tommy_list_init(&scan->dir_insert_list);
+		tommy_list_init(&scan->file_report_list);
+		tommy_list_init(&scan->dir_queue);
+		scan->dir_ahead = 0;
+		scan->dir_stop = 0;
+		scan->ring = 0;
+#if HAVE_PTHREAD
+		thread_mutex_init(&scan->dir_mutex, 0);
+		thread_cond_init(&scan->dir_cond, 0);
+#endif
 
 		tommy_list_insert_tail(&scanlist, &scan->node, scan);
 
 		if (!is_diff)
 			msg_progress("Scanning disk %s...\n", disk->name);
 
-		/* check if the disk supports persistent inodes */
-		ret = fsinfo(disk->dir, &has_persistent_inodes, &has_syncronized_hardlinks, 0, 0);
-		if (ret < 0) {
-			/* LCOV_EXCL_START */
-			log_fatal("Error accessing disk '%s' to get file-system info. %s.\n", disk->dir, strerror(errno));
-			exit(EXIT_FAILURE);
-			/* LCOV_EXCL_STOP */
-		}
-		if (!has_persistent_inodes) {
-			disk->has_volatile_inodes = 1;
-		}
-		if (!has_syncronized_hardlinks) {
-			disk->has_volatile_hardlinks = 1;
-		}
+#if HAVE_PTHREAD
+		thread_create(&scan->thread, 0, scan_disk_thread, scan);
+#else
+		scan_disk(scan);
+#endif
+	}
 
-		/* if inodes or UUID are not persistent/changed/unsupported */
-		if (disk->has_volatile_inodes || disk->has_different_uuid || disk->has_unsupported_uuid) {
-			/* remove all the inodes from the inode collection */
-			/* if they are not persistent, all of them could be changed now */
-			/* and we don't want to find false matching ones */
-			/* see scan_file() for more details */
-			node = disk->filelist;
-			while (node) {
-				struct snapraid_file* file = node->data;
+#if HAVE_PTHREAD
+	for (i = scanlist; i != 0; i = i->next) {
+		struct snapraid_scan* scan = i->data;
 
-				node = node->next;
+		thread_join(scan->thread, 0);
+	}
+#endif
 
-				/* remove from the inode set */
-				tommy_hashdyn_remove_existing(&disk->inodeset, &file->nodeset);
+	if (is_journal)
+		journal_done(&journal);
 
-				/* clear the inode */
-				file->inode = 0;
+	/* now search the copies of the new files, and report them */
+	/* this has to be done before removing any file, to detect */
+	/* also files moved from one disk to another */
+	for (i = scanlist; i != 0; i = i->next) {
+		struct snapraid_scan* scan = i->data;
+		struct snapraid_disk* disk = scan->disk;
+		tommy_node* node;
+		tommy_node* report_node;
+
+		/* the new files to report are in the same order of the insert list */
+		node = scan->file_insert_list;
+		report_node = scan->file_report_list;
+		while (node) {
+			struct snapraid_file* file = node->data;
 
-				/* mark as missing inode */
-				file_flag_set(file, FILE_IS_WITHOUT_INODE);
+			/* next node */
+			node = node->next;
+
+			if (report_node != 0) {
+				struct snapraid_scan_report* report = report_node->data;
+
+				if (report->file == file) {
+					report_node = report_node->next;
+
+					scan_file_report(scan, report);
+				}
 			}
+
+			/* insert in the stamp set only now, to not find itself as a copy */
+			tommy_hashdyn_insert(&disk->stampset, &file->stampset, file, file_stamp_hash(file->size, file->mtime_sec, file->mtime_nsec));
 		}
 
-		scan_dir(scan, 0, is_diff, disk->dir, "");
+		tommy_list_foreach(&scan->file_report_list, (tommy_foreach_func*)free);
 	}
 
 	/* we split the search in two phases because to detect files */
@@ -1580,7 +2399,7 @@ static int state_diffscan(struct snapraid_state* state, int is_diff)
 
 				log_tag("scan:remove:%s:%s\n", disk->name, esc_tag(file->sub, esc_buffer));
 				if (is_diff) {
-					printf("remove %s\n", fmt_term(disk, file->sub, esc_buffer));
+					scan_print("remove %s\n", fmt_term(disk, file->sub, esc_buffer));
 				}
 
 				scan_file_remove(scan, file);
@@ -1601,7 +2420,7 @@ static int state_diffscan(struct snapraid_state* state, int is_diff)
 
 				log_tag("scan:remove:%s:%s\n", disk->name, esc_tag(slink->sub, esc_buffer));
 				if (is_diff) {
-					printf("remove %s\n", fmt_term(disk, slink->sub, esc_buffer));
+					scan_print("remove %s\n", fmt_term(disk, slink->sub, esc_buffer));
 				}
 
 				scan_link_remove(scan, slink);
@@ -1676,6 +2495,9 @@ static int state_diffscan(struct snapraid_state* state, int is_diff)
 			scan_file_allocate(scan, file);
 		}
 
+		/* the free extents are not needed anymore */
+		fs_free_discard(disk);
+
 		/* mark the disk without reliable physical offset if it has duplicates */
 		/* here it should never happen because we already sorted out hardlinks */
 		if (state->opt.force_order == SORT_PHYSICAL && phy_dup > 0) {
@@ -1846,6 +2668,8 @@ static int state_diffscan(struct snapraid_state* state, int is_diff)
 
 	for (i = scanlist; i != 0; i = i->next) {
 		struct snapraid_scan* scan = i->data;
+		if (scan->need_write)
+			state->need_write = 1;
 		total.count_equal += scan->count_equal;
 		total.count_move += scan->count_move;
 		total.count_copy += scan->count_copy;
@@ -1889,6 +2713,11 @@ static int state_diffscan(struct snapraid_state* state, int is_diff)
 		}
 	}
 
+	/* if the content file still matches the disks, the changes in the journal */
+	/* are scanned, even if the content file is not written */
+	if (no_difference && !state->need_write)
+		journal_checkpoint_write(state);
+
 	if (no_difference) {
 		log_tag("summary:exit:equal\n");
 	} else {
@@ -1896,7 +2725,17 @@ static int state_diffscan(struct snapraid_state* state, int is_diff)
 	}
 	log_flush();
 
-	tommy_list_foreach(&scanlist, (tommy_foreach_func*)free);
+	for (i = scanlist; i != 0; ) {
+		struct snapraid_scan* scan = i->data;
+
+		i = i->next;
+
+#if HAVE_PTHREAD
+		thread_mutex_destroy(&scan->dir_mutex);
+		thread_cond_destroy(&scan->dir_cond);
+#endif
+		free(scan);
+	}
 
 	/* check the file-system on all disks */
 	state_fscheck(state, "after scan");
@@ -1924,3 +2763,199 @@ void state_scan(struct snapraid_state* state)
 	(void)state_diffscan(state, 0); /* ignore return value */
 }
 
+
+/**
+ * File candidate to be relocated by the compaction.
+ */
+struct snapraid_compact {
+	struct snapraid_file* file; /**< File to relocate. */
+	block_off_t parity_last; /**< Last parity position used by the file. */
+	int is_fragmented; /**< If the file is not contiguous in the parity. */
+
+	/* nodes for data structures */
+	tommy_node node;
+};
+
+static int compact_parity_compare(const void* void_a, const void* void_b)
+{
+	const struct snapraid_compact* arg_a = void_a;
+	const struct snapraid_compact* arg_b = void_b;
+
+	/* the files at the end of the parity first */
+	if (arg_a->parity_last > arg_b->parity_last)
+		return -1;
+	if (arg_a->parity_last < arg_b->parity_last)
+		return 1;
+	return 0;
+}
+
+/**
+ * Move a file in a different position of the parity.
+ *
+ * The old blocks become DELETED, keeping their hash as past hash,
+ * and the new ones are REP with the same hash, as the data is unchanged.
+ * The next sync updates the parity in both the positions.
+ */
+static void scan_file_relocate(struct snapraid_scan* scan, struct snapraid_file* file)
+{
+	struct snapraid_disk* disk = scan->disk;
+	struct snapraid_file* copy;
+	block_off_t i;
+
+	copy = file_dup(file);
+
+	/* the data is the same, only the parity has to be updated */
+	for (i = 0; i < copy->blockmax; ++i)
+		block_state_set(fs_file2block_get(copy, i), BLOCK_STATE_REP);
+
+	/* remove the file, leaving its blocks in the parity */
+	scan_file_remove(scan, file);
+
+	/* insert the copy in the containers */
+	if (!file_flag_has(copy, FILE_IS_WITHOUT_INODE))
+		tommy_hashdyn_insert(&disk->inodeset, &copy->nodeset, copy, file_inode_hash(copy->inode));
+	tommy_hashdyn_insert(&disk->pathset, &copy->pathset, copy, file_path_hash(copy->sub));
+	tommy_hashdyn_insert(&disk->stampset, &copy->stampset, copy, file_stamp_hash(copy->size, copy->mtime_sec, copy->mtime_nsec));
+
+	/* and allocate it in the parity */
+	scan_file_allocate(scan, copy);
+}
+
+/**
+ * Compact the parity of a disk.
+ *
+ * Starting from the files at the end of the parity, a file is moved
+ * if a single free extent can contain it, and if it then ends
+ * before than now. This fills the holes and makes the file contiguous.
+ * Fragmented files are also moved in any free extent inside the parity.
+ *
+ * The parity positions freed are reused only at the next run.
+ */
+static void scan_compact(struct snapraid_scan* scan, block_off_t blockcount, unsigned* count_file, block_off_t* count_block)
+{
+	struct snapraid_disk* disk = scan->disk;
+	tommy_list list;
+	tommy_node* node;
+	char esc_buffer[ESC_MAX];
+
+	tommy_list_init(&list);
+
+	/* collect all the files already synced */
+	for (node = disk->filelist; node != 0; node = node->next) {
+		struct snapraid_file* file = node->data;
+		struct snapraid_compact* compact;
+		block_off_t parity_last;
+		block_off_t parity_prev;
+		int is_fragmented;
+		block_off_t j;
+
+		if (file->blockmax == 0)
+			continue;
+
+		/* files with pending changes are placed by the next sync */
+		parity_last = 0;
+		parity_prev = POS_NULL;
+		is_fragmented = 0;
+		for (j = 0; j < file->blockmax; ++j) {
+			block_off_t parity_pos;
+
+			if (block_state_get(fs_file2block_get(file, j)) != BLOCK_STATE_BLK)
+				break;
+
+			parity_pos = fs_file2par_get(disk, file, j);
+			if (parity_pos > parity_last)
+				parity_last = parity_pos;
+			if (j != 0 && parity_pos != parity_prev + 1)
+				is_fragmented = 1;
+			parity_prev = parity_pos;
+		}
+		if (j != file->blockmax)
+			continue;
+
+		compact = malloc_nofail(sizeof(struct snapraid_compact));
+		compact->file = file;
+		compact->parity_last = parity_last;
+		compact->is_fragmented = is_fragmented;
+		tommy_list_insert_tail(&list, &compact->node, compact);
+	}
+
+	tommy_list_sort(&list, compact_parity_compare);
+
+	for (node = list; node != 0; node = node->next) {
+		struct snapraid_compact* compact = node->data;
+		struct snapraid_file* file = compact->file;
+		block_off_t parity_pos;
+		block_off_t run;
+
+		/* stop when the limit is reached, but try with smaller files */
+		if (blockcount != 0 && *count_block + file->blockmax > blockcount)
+			continue;
+
+		/* a full run is found only in a free extent or at the end of the parity */
+		parity_pos = fs_free_find(disk, file->blockmax, &run);
+		if (run != file->blockmax)
+			continue;
+
+		/* move it only if it ends before, or if it gets contiguous without growing the parity */
+		if (parity_pos + file->blockmax - 1 >= compact->parity_last
+			&& (!compact->is_fragmented || parity_pos + file->blockmax > fs_size(disk)))
+			continue;
+
+		log_tag("compact:%s:%s:%u:%u\n", disk->name, esc_tag(file->sub, esc_buffer), compact->parity_last, parity_pos + file->blockmax - 1);
+
+		++*count_file;
+		*count_block += file->blockmax;
+
+		scan_file_relocate(scan, file);
+	}
+
+	tommy_list_foreach(&list, (tommy_foreach_func*)free);
+
+	/* the positions freed are not in the free extents, and they are discarded */
+	fs_free_discard(disk);
+}
+
+void state_compact(struct snapraid_state* state, block_off_t blockcount)
+{
+	tommy_node* i;
+	unsigned count_file;
+	block_off_t count_block;
+
+	/* the parity of the relocated blocks has to be computed with the hash of the data */
+	if (state->prevhash != HASH_UNDEFINED) {
+		/* LCOV_EXCL_START */
+		log_fatal("You cannot compact with a rehash in progress.\n");
+		log_fatal("Complete it first with 'snapraid scrub'.\n");
+		exit(EXIT_FAILURE);
+		/* LCOV_EXCL_STOP */
+	}
+
+	msg_progress("Compacting...\n");
+
+	count_file = 0;
+	count_block = 0;
+	for (i = state->disklist; i != 0; i = i->next) {
+		struct snapraid_disk* disk = i->data;
+		struct snapraid_scan scan;
+
+		/* only the fields used to change the parity allocation */
+		scan.state = state;
+		scan.disk = disk;
+		scan.need_write = 0;
+
+		scan_compact(&scan, blockcount, &count_file, &count_block);
+
+		if (scan.need_write)
+			state->need_write = 1;
+	}
+
+	msg_verbose("%8u relocated files\n", count_file);
+	msg_verbose("%8u relocated blocks\n", count_block);
+
+	log_tag("summary:compact_file:%u\n", count_file);
+	log_tag("summary:compact_block:%u\n", count_block);
+	log_flush();
+
+	/* check the file-system on all disks */
+	state_fscheck(state, "after compact");
+}
@@ -24,6 +24,7 @@
 #include "handle.h"
 #include "io.h"
 #include "raid/raid.h"
+#include "raidmt.h"
 
 /****************************************************************************/
 /* scrub */
@@ -122,7 +123,7 @@ static void scrub_data_reader(struct snapraid_worker* worker, struct snapraid_ta
 	}
 
 	/* get the block */
-	task->block = fs_par2block_find(disk, blockcur);
+	task->block = fs_par2block_find_cursor(disk, &worker->cursor, blockcur);
 
 	/* if the block is not used */
 	if (!block_has_file(task->block)) {
@@ -133,7 +134,7 @@ static void scrub_data_reader(struct snapraid_worker* worker, struct snapraid_ta
 	}
 
 	/* get the file of this block */
-	task->file = fs_par2file_get(disk, blockcur, &task->file_pos);
+	task->file = fs_par2file_get_cursor(disk, &worker->cursor, blockcur, &task->file_pos);
 
 	/* if the file is different than the current one, close it */
 	if (handle->file != 0 && handle->file != task->file) {
@@ -213,6 +214,9 @@ static void scrub_data_reader(struct snapraid_worker* worker, struct snapraid_ta
 	/* store the path of the opened file */
 	pathcpy(task->path, sizeof(task->path), handle->path);
 
+	/* hash the data in the worker thread, if enabled */
+	io_data_hash(worker, task);
+
 	task->state = TASK_STATE_DONE;
 }
 
@@ -456,15 +460,24 @@ static int state_scrub_process(struct snapraid_state* state, struct snapraid_par
 
 			countsize += read_size;
 
-			/* now compute the hash */
+			/* now compute the hash, if not already done by the worker */
 			if (rehash) {
-				memhash(state->prevhash, state->prevhashseed, hash, buffer[diskcur], read_size);
+				if (task->is_hashed)
+					memcpy(hash, task->prevhash, HASH_MAX);
+				else
+					memhash(state->prevhash, state->prevhashseed, hash, buffer[diskcur], read_size);
 
 				/* compute the new hash, and store it */
 				rehandle[diskcur].block = block;
-				memhash(state->hash, state->hashseed, rehandle[diskcur].hash, buffer[diskcur], read_size);
+				if (task->is_hashed)
+					memcpy(rehandle[diskcur].hash, task->hash, HASH_MAX);
+				else
+					memhash(state->hash, state->hashseed, rehandle[diskcur].hash, buffer[diskcur], read_size);
 			} else {
-				memhash(state->hash, state->hashseed, hash, buffer[diskcur], read_size);
+				if (task->is_hashed)
+					memcpy(hash, task->hash, HASH_MAX);
+				else
+					memhash(state->hash, state->hashseed, hash, buffer[diskcur], read_size);
 			}
 
 			/* until now is hash */
@@ -561,7 +574,7 @@ static int state_scrub_process(struct snapraid_state* state, struct snapraid_par
 		if (!error_on_this_block && !silent_error_on_this_block && !io_error_on_this_block) {
 
 			/* compute the parity */
-			raid_gen(diskmax, state->level, state->block_size, buffer);
+			raidmt_gen(diskmax, state->level, state->block_size, buffer);
 
 			/* compare the parity */
 			for (l = 0; l < state->level; ++l) {
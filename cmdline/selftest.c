@@ -286,6 +286,7 @@ static struct crc_test_vector TEST_CRC32C[] = {
 static void test_crc32c(void)
 {
 	unsigned i;
+	int j;
 
 	for (i = 0; TEST_CRC32C[i].data; ++i) {
 		uint32_t digest;
@@ -300,6 +301,20 @@ static void test_crc32c(void)
 			exit(EXIT_FAILURE);
 			/* LCOV_EXCL_STOP */
 		}
+
+		/* combine the crc of the data split in two parts */
+		for (j = 0; j <= TEST_CRC32C[i].len; ++j) {
+			const unsigned char* data = (const unsigned char*)TEST_CRC32C[i].data;
+			uint32_t digest_a = crc32c(0, data, j);
+			uint32_t digest_b = crc32c(0, data + j, TEST_CRC32C[i].len - j);
+
+			if (crc32c_combine(digest_a, digest_b, TEST_CRC32C[i].len - j) != TEST_CRC32C[i].digest) {
+				/* LCOV_EXCL_START */
+				log_fatal("Failed CRC32C combine test\n");
+				exit(EXIT_FAILURE);
+				/* LCOV_EXCL_STOP */
+			}
+		}
 	}
 }
 
@@ -636,5 +651,17 @@ void selftest(void)
 		exit(EXIT_FAILURE);
 		/* LCOV_EXCL_STOP */
 	}
+	if (raid_test_add(RAID_MODE_VANDERMONDE, 32, 256) != 0) {
+		/* LCOV_EXCL_START */
+		log_fatal("Failed ADD Vandermonde test\n");
+		exit(EXIT_FAILURE);
+		/* LCOV_EXCL_STOP */
+	}
+	if (raid_test_add(RAID_MODE_CAUCHY, 32, 256) != 0) {
+		/* LCOV_EXCL_START */
+		log_fatal("Failed ADD Cauchy test\n");
+		exit(EXIT_FAILURE);
+		/* LCOV_EXCL_STOP */
+	}
 }
 
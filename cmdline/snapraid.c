@@ -23,8 +23,10 @@
 #include "import.h"
 #include "search.h"
 #include "state.h"
+#include "journal.h"
 #include "io.h"
 #include "raid/raid.h"
+#include "raidmt.h"
 
 /****************************************************************************/
 /* main */
@@ -38,21 +40,23 @@ void usage(void)
 {
 	version();
 
-	printf("Usage: " PACKAGE " status|diff|sync|scrub|list|dup|up|down|smart|pool|check|fix [options]\n");
+	printf("Usage: " PACKAGE " status|diff|sync|scrub|compact|list|dup|up|down|smart|pool|watch|check|fix [options]\n");
 	printf("\n");
 	printf("Commands:\n");
-	printf("  status Print the status of the array\n");
-	printf("  diff   Show the changes that needs to be synchronized\n");
-	printf("  sync   Synchronize the state of the array\n");
-	printf("  scrub  Scrub the array\n");
-	printf("  list   List the array content\n");
-	printf("  dup    Find duplicate files\n");
-	printf("  up     Spin-up the array\n");
-	printf("  down   Spin-down the array\n");
-	printf("  smart  SMART attributes of the array\n");
-	printf("  pool   Create or update the virtual view of the array\n");
-	printf("  check  Check the array\n");
-	printf("  fix    Fix the array\n");
+	printf("  status  Print the status of the array\n");
+	printf("  diff    Show the changes that needs to be synchronized\n");
+	printf("  sync    Synchronize the state of the array\n");
+	printf("  scrub   Scrub the array\n");
+	printf("  compact Compact the parity moving the files in the free space\n");
+	printf("  list    List the array content\n");
+	printf("  dup     Find duplicate files\n");
+	printf("  up      Spin-up the array\n");
+	printf("  down    Spin-down the array\n");
+	printf("  smart   SMART attributes of the array\n");
+	printf("  pool    Create or update the virtual view of the array\n");
+	printf("  watch   Watch the changes to speed up the next diff and sync\n");
+	printf("  check   Check the array\n");
+	printf("  fix     Fix the array\n");
 	printf("\n");
 	printf("Options:\n");
 	printf("  " SWITCH_GETOPT_LONG("-c, --conf FILE       ", "-c") "  Configuration file\n");
@@ -66,6 +70,7 @@ void usage(void)
 	printf("  " SWITCH_GETOPT_LONG("-l, --log FILE        ", "-l") "  Log file. Default none\n");
 	printf("  " SWITCH_GETOPT_LONG("-a, --audit-only      ", "-a") "  Check only file data and not parity\n");
 	printf("  " SWITCH_GETOPT_LONG("-h, --pre-hash        ", "-h") "  Pre-hash all the new data\n");
+	printf("  " SWITCH_GETOPT_LONG("-u, --delta-update    ", "-u") "  Update the parity incrementally for new data\n");
 	printf("  " SWITCH_GETOPT_LONG("-Z, --force-zero      ", "-Z") "  Force syncing of files that get zero size\n");
 	printf("  " SWITCH_GETOPT_LONG("-E, --force-empty     ", "-E") "  Force syncing of disks that get empty\n");
 	printf("  " SWITCH_GETOPT_LONG("-U, --force-uuid      ", "-U") "  Force commands on disks with uuid changed\n");
@@ -300,6 +305,10 @@ void config(char* conf, size_t conf_size, const char* argv0)
 #define OPT_TEST_SKIP_CONTENT_WRITE 302
 #define OPT_TEST_SKIP_SPACE_HOLDER 303
 #define OPT_TEST_FORMAT 304
+#define OPT_TEST_IO_URING 305
+#define OPT_TEST_RAID_THREAD 306
+#define OPT_TEST_SCAN_URING 307
+#define OPT_TEST_IO_PHYSICAL 308
 
 #if HAVE_GETOPT_LONG
 struct option long_options[] = {
@@ -325,6 +334,7 @@ struct option long_options[] = {
 	{ "force-realloc", 0, 0, 'R' },
 	{ "audit-only", 0, 0, 'a' },
 	{ "pre-hash", 0, 0, 'h' },
+	{ "delta-update", 0, 0, 'u' },
 	{ "speed-test", 0, 0, 'T' }, /* undocumented speed test command */
 	{ "gen-conf", 1, 0, 'C' },
 	{ "verbose", 0, 0, 'v' },
@@ -428,6 +438,18 @@ struct option long_options[] = {
 	/* Number of IO buffers */
 	{ "test-io-cache", 1, 0, OPT_TEST_IO_CACHE },
 
+	/* Use io_uring with the specified queue depth */
+	{ "test-io-uring", 1, 0, OPT_TEST_IO_URING },
+
+	/* Number of threads for the RAID computation */
+	{ "test-raid-thread", 1, 0, OPT_TEST_RAID_THREAD },
+
+	/* Use io_uring to read the stat info in the scan (experimental) */
+	{ "test-scan-uring", 0, 0, OPT_TEST_SCAN_URING },
+
+	/* Read the blocks in physical order */
+	{ "test-io-physical", 0, 0, OPT_TEST_IO_PHYSICAL },
+
 	/* Print IO stats */
 	{ "test-io-stats", 0, 0, OPT_TEST_IO_STATS },
 
@@ -471,7 +493,7 @@ struct option long_options[] = {
 };
 #endif
 
-#define OPTIONS "c:f:d:mep:o:S:B:L:i:l:ZEUDNFRahTC:vqHVG"
+#define OPTIONS "c:f:d:mep:o:S:B:L:i:l:ZEUDNFRahuTC:vqHVG"
 
 volatile int global_interrupt = 0;
 
@@ -523,6 +545,8 @@ void signal_init(void)
 #define OPERATION_SPINDOWN 15
 #define OPERATION_DEVICES 16
 #define OPERATION_SMART 17
+#define OPERATION_WATCH 18
+#define OPERATION_COMPACT 19
 
 int main(int argc, char* argv[])
 {
@@ -730,6 +754,9 @@ int main(int argc, char* argv[])
 		case 'h' :
 			opt.prehash = 1;
 			break;
+		case 'u' :
+			opt.delta_update = 1;
+			break;
 		case 'v' :
 			++msg_level;
 			break;
@@ -858,6 +885,30 @@ int main(int argc, char* argv[])
 				/* LCOV_EXCL_STOP */
 			}
 			break;
+		case OPT_TEST_IO_URING :
+			opt.io_uring = atoi(optarg);
+			if (opt.io_uring < IO_MIN - 1 || opt.io_uring > IO_MAX - 1) {
+				/* LCOV_EXCL_START */
+				log_fatal("The IO queue depth should be between %u and %u.\n", IO_MIN - 1, IO_MAX - 1);
+				exit(EXIT_FAILURE);
+				/* LCOV_EXCL_STOP */
+			}
+			break;
+		case OPT_TEST_RAID_THREAD :
+			opt.raid_thread = atoi(optarg);
+			if (opt.raid_thread < 1 || opt.raid_thread > RAIDMT_THREAD_MAX) {
+				/* LCOV_EXCL_START */
+				log_fatal("The number of RAID threads should be between 1 and %u.\n", RAIDMT_THREAD_MAX);
+				exit(EXIT_FAILURE);
+				/* LCOV_EXCL_STOP */
+			}
+			break;
+		case OPT_TEST_SCAN_URING :
+			opt.scan_uring = 1;
+			break;
+		case OPT_TEST_IO_PHYSICAL :
+			opt.io_physical = 1;
+			break;
 		case OPT_TEST_IO_STATS :
 			opt.force_stats = 1;
 			break;
@@ -920,6 +971,10 @@ int main(int argc, char* argv[])
 
 	os_init(opt.force_scan_winfind);
 	raid_init();
+
+	/* when testing, split also small blocks to exercise the threads */
+	raidmt_init(opt.raid_thread, opt.raid_thread != 0 ? 64 : 0);
+
 	crc32c_init();
 
 	if (speedtest != 0) {
@@ -978,6 +1033,10 @@ int main(int argc, char* argv[])
 		operation = OPERATION_DEVICES;
 	} else if (strcmp(argv[optind], "smart") == 0) {
 		operation = OPERATION_SMART;
+	} else if (strcmp(argv[optind], "watch") == 0) {
+		operation = OPERATION_WATCH;
+	} else if (strcmp(argv[optind], "compact") == 0) {
+		operation = OPERATION_COMPACT;
 	} else {
 		/* LCOV_EXCL_START */
 		log_fatal("Unknown command '%s'\n", argv[optind]);
@@ -1040,6 +1099,13 @@ int main(int argc, char* argv[])
 			/* LCOV_EXCL_STOP */
 		}
 
+		if (opt.delta_update) {
+			/* LCOV_EXCL_START */
+			log_fatal("You cannot use -u, --delta-update with the '%s' command\n", command);
+			exit(EXIT_FAILURE);
+			/* LCOV_EXCL_STOP */
+		}
+
 		if (opt.force_full) {
 			/* LCOV_EXCL_START */
 			log_fatal("You cannot use -F, --force-full with the '%s' command\n", command);
@@ -1083,6 +1149,21 @@ int main(int argc, char* argv[])
 		/* LCOV_EXCL_STOP */
 	}
 
+	/* the pre-hash loses the information that the new blocks were empty */
+	if (opt.delta_update && opt.prehash) {
+		/* LCOV_EXCL_START */
+		log_fatal("You cannot use the -u, --delta-update and -h, --pre-hash options at the same time\n");
+		exit(EXIT_FAILURE);
+		/* LCOV_EXCL_STOP */
+	}
+
+	if (opt.delta_update && (opt.force_full || opt.force_realloc)) {
+		/* LCOV_EXCL_START */
+		log_fatal("You cannot use the -u, --delta-update option with -F, --force-full or -R, --force-realloc\n");
+		exit(EXIT_FAILURE);
+		/* LCOV_EXCL_STOP */
+	}
+
 	switch (operation) {
 	case OPERATION_CHECK :
 	case OPERATION_FIX :
@@ -1163,6 +1244,7 @@ int main(int argc, char* argv[])
 	case OPERATION_READ :
 	case OPERATION_REHASH :
 	case OPERATION_TOUCH :
+	case OPERATION_WATCH :
 	case OPERATION_SPINUP : /* we want to do it in different threads to avoid blocking */
 		/* avoid to check and access parity disks if not needed */
 		opt.skip_parity_access = 1;
@@ -1187,6 +1269,7 @@ int main(int argc, char* argv[])
 	case OPERATION_SPINDOWN :
 	case OPERATION_DEVICES :
 	case OPERATION_SMART :
+	case OPERATION_WATCH :
 		opt.skip_self = 1;
 		break;
 	}
@@ -1194,6 +1277,7 @@ int main(int argc, char* argv[])
 	switch (operation) {
 #if HAVE_DIRECT_IO
 	case OPERATION_SYNC :
+	case OPERATION_COMPACT :
 	case OPERATION_SCRUB :
 	case OPERATION_DRY :
 		break;
@@ -1208,6 +1292,7 @@ int main(int argc, char* argv[])
 	switch (operation) {
 	case OPERATION_DEVICES :
 	case OPERATION_SMART :
+	case OPERATION_WATCH :
 		/* we may need to use these commands during operations */
 		opt.skip_lock = 1;
 		break;
@@ -1350,6 +1435,42 @@ int main(int argc, char* argv[])
 			log_fatal("WARNING! Skipped state write for --test-kill-after-sync option.\n");
 		}
 
+		/* abort if required */
+		if (ret != 0) {
+			/* LCOV_EXCL_START */
+			exit(EXIT_FAILURE);
+			/* LCOV_EXCL_STOP */
+		}
+	} else if (operation == OPERATION_COMPACT) {
+		/* like in sync, as the parity is updated after the compaction */
+		state.clear_past_hash = 1;
+
+		state_read(&state);
+
+		state_scan(&state);
+
+		/* relocate the files, and the sync updates the parity */
+		state_compact(&state, blockcount);
+
+		/* refresh the size info before the content write */
+		state_refresh(&state);
+
+		memory();
+
+		/* intercept signals while operating */
+		signal_init();
+
+		/* waits some time like in sync, to detect concurrent modifications */
+		if (!opt.skip_self)
+			sleep(2);
+
+		/* sync all the parity, as the number of blocks is already limited */
+		ret = state_sync(&state, 0, 0);
+
+		/* save the new state if required */
+		if (state.need_write || state.opt.force_content_write)
+			state_write(&state);
+
 		/* abort if required */
 		if (ret != 0) {
 			/* LCOV_EXCL_START */
@@ -1432,6 +1553,11 @@ int main(int argc, char* argv[])
 		state_device(&state, DEVICE_LIST, 0);
 	} else if (operation == OPERATION_SMART) {
 		state_device(&state, DEVICE_SMART, 0);
+	} else if (operation == OPERATION_WATCH) {
+		/* intercept signals to stop the watch */
+		signal_init();
+
+		state_watch(&state, run);
 	} else if (operation == OPERATION_STATUS) {
 		state_read(&state);
 
@@ -1507,6 +1633,7 @@ int main(int argc, char* argv[])
 	tommy_list_foreach(&filterlist_file, (tommy_foreach_func*)filter_free);
 	tommy_list_foreach(&filterlist_disk, (tommy_foreach_func*)filter_free);
 
+	raidmt_done();
 	os_done();
 	lock_done();
 
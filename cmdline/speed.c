@@ -35,6 +35,11 @@
  */
 #define TEST_COUNT (8)
 
+/*
+ * Maximum number of data blocks to test with tiling.
+ */
+#define TEST_TILE_DISK_MAX (128)
+
 /**
  * Differential us of two timeval.
  */
@@ -81,7 +86,7 @@ void speed(int period)
 	struct timeval stop;
 	int64_t ds;
 	int64_t dt;
-	int i, j;
+	int i, j, nr;
 	unsigned char digest[HASH_MAX];
 	unsigned char seed[HASH_MAX];
 	int id[RAID_PARITY_MAX];
@@ -93,6 +98,11 @@ void speed(int period)
 	int nv;
 	void *v_alloc;
 	void **v;
+	void *tv_alloc;
+	void **tv;
+	size_t tile_cache;
+	int tile_prefetch;
+	size_t stream_size;
 
 	nv = nd + RAID_PARITY_MAX + 1;
 
@@ -130,11 +140,13 @@ void speed(int period)
 
 		raid_cpu_info(vendor, &family, &model);
 
-		printf("CPU %s, family %u, model %u, flags%s%s%s%s%s%s\n", vendor, family, model,
+		printf("CPU %s, family %u, model %u, flags%s%s%s%s%s%s%s%s\n", vendor, family, model,
 			raid_cpu_has_sse2() ? " sse2" : "",
 			raid_cpu_has_ssse3() ? " ssse3" : "",
 			raid_cpu_has_crc32() ? " crc32" : "",
 			raid_cpu_has_avx2() ? " avx2" : "",
+			raid_cpu_has_avx512bw() ? " avx512bw" : "",
+			raid_cpu_has_gfni() ? " gfni" : "",
 			raid_cpu_has_slowmult() ? " slowmult" : "",
 			raid_cpu_has_slowextendedreg() ? " slowext" : ""
 		);
@@ -278,6 +290,11 @@ void speed(int period)
 #ifdef CONFIG_X86_64
 	printf("%8s", "avx2e");
 #endif
+	printf("%8s", "avx512");
+#ifdef CONFIG_X86_64
+	printf("%8s", "avx512e");
+#endif
+	printf("%8s", "gfni");
 #endif
 	printf("\n");
 
@@ -331,6 +348,19 @@ void speed(int period)
 		fflush(stdout);
 	}
 #endif
+#ifdef CONFIG_X86_64
+	printf("%8s", "");
+#endif
+#ifdef CONFIG_AVX512BW
+	if (raid_cpu_has_avx512bw()) {
+		SPEED_START {
+			raid_gen1_avx512bw(nd, size, v);
+		} SPEED_STOP
+
+		printf("%8" PRIu64, ds / dt);
+		fflush(stdout);
+	}
+#endif
 #endif
 	printf("\n");
 
@@ -390,6 +420,19 @@ void speed(int period)
 		fflush(stdout);
 	}
 #endif
+#ifdef CONFIG_X86_64
+	printf("%8s", "");
+#endif
+#ifdef CONFIG_AVX512BW
+	if (raid_cpu_has_avx512bw()) {
+		SPEED_START {
+			raid_gen2_avx512bw(nd, size, v);
+		} SPEED_STOP
+
+		printf("%8" PRIu64, ds / dt);
+		fflush(stdout);
+	}
+#endif
 #endif
 	printf("\n");
 
@@ -515,6 +558,32 @@ void speed(int period)
 		fflush(stdout);
 	}
 #endif
+#endif
+
+	printf("%8s", "");
+
+#ifdef CONFIG_X86_64
+#ifdef CONFIG_AVX512BW
+	if (raid_cpu_has_avx512bw()) {
+		SPEED_START {
+			raid_gen3_avx512bwext(nd, size, v);
+		} SPEED_STOP
+
+		printf("%8" PRIu64, ds / dt);
+		fflush(stdout);
+	}
+#endif
+#endif
+
+#ifdef CONFIG_GFNI
+	if (raid_cpu_has_gfni()) {
+		SPEED_START {
+			raid_gen3_gfni(nd, size, v);
+		} SPEED_STOP
+
+		printf("%8" PRIu64, ds / dt);
+		fflush(stdout);
+	}
 #endif
 #endif
 	printf("\n");
@@ -580,6 +649,32 @@ void speed(int period)
 		fflush(stdout);
 	}
 #endif
+#endif
+
+	printf("%8s", "");
+
+#ifdef CONFIG_X86_64
+#ifdef CONFIG_AVX512BW
+	if (raid_cpu_has_avx512bw()) {
+		SPEED_START {
+			raid_gen4_avx512bwext(nd, size, v);
+		} SPEED_STOP
+
+		printf("%8" PRIu64, ds / dt);
+		fflush(stdout);
+	}
+#endif
+#endif
+
+#ifdef CONFIG_GFNI
+	if (raid_cpu_has_gfni()) {
+		SPEED_START {
+			raid_gen4_gfni(nd, size, v);
+		} SPEED_STOP
+
+		printf("%8" PRIu64, ds / dt);
+		fflush(stdout);
+	}
 #endif
 #endif
 	printf("\n");
@@ -645,6 +740,32 @@ void speed(int period)
 		fflush(stdout);
 	}
 #endif
+#endif
+
+	printf("%8s", "");
+
+#ifdef CONFIG_X86_64
+#ifdef CONFIG_AVX512BW
+	if (raid_cpu_has_avx512bw()) {
+		SPEED_START {
+			raid_gen5_avx512bwext(nd, size, v);
+		} SPEED_STOP
+
+		printf("%8" PRIu64, ds / dt);
+		fflush(stdout);
+	}
+#endif
+#endif
+
+#ifdef CONFIG_GFNI
+	if (raid_cpu_has_gfni()) {
+		SPEED_START {
+			raid_gen5_gfni(nd, size, v);
+		} SPEED_STOP
+
+		printf("%8" PRIu64, ds / dt);
+		fflush(stdout);
+	}
 #endif
 #endif
 	printf("\n");
@@ -711,209 +832,517 @@ void speed(int period)
 	}
 #endif
 #endif
-#endif
-	printf("\n");
-	printf("\n");
 
-	/* recover table */
-	printf("RAID functions used for recovering with 'fix':\n");
 	printf("%8s", "");
-	printf("%8s", "best");
-	printf("%8s", "int8");
-#ifdef CONFIG_X86
-	printf("%8s", "ssse3");
-	printf("%8s", "avx2");
-#endif
-	printf("\n");
-
-	printf("%8s", "rec1");
-	printf("%8s", raid_rec1_tag());
-	fflush(stdout);
-
-	SPEED_START {
-		for (j = 0; j < nd; ++j)
-			/* +1 to avoid GEN1 optimized case */
-			raid_rec1_int8(1, id, ip + 1, nd, size, v);
-	} SPEED_STOP
-
-	printf("%8" PRIu64, ds / dt);
-	fflush(stdout);
 
-#ifdef CONFIG_X86
-#ifdef CONFIG_SSSE3
-	if (raid_cpu_has_ssse3()) {
+#ifdef CONFIG_X86_64
+#ifdef CONFIG_AVX512BW
+	if (raid_cpu_has_avx512bw()) {
 		SPEED_START {
-			for (j = 0; j < nd; ++j)
-				/* +1 to avoid GEN1 optimized case */
-				raid_rec1_ssse3(1, id, ip + 1, nd, size, v);
+			raid_gen6_avx512bwext(nd, size, v);
 		} SPEED_STOP
 
 		printf("%8" PRIu64, ds / dt);
+		fflush(stdout);
 	}
 #endif
-#ifdef CONFIG_AVX2
-	if (raid_cpu_has_avx2()) {
+#endif
+
+#ifdef CONFIG_GFNI
+	if (raid_cpu_has_gfni()) {
 		SPEED_START {
-			for (j = 0; j < nd; ++j)
-				/* +1 to avoid GEN1 optimized case */
-				raid_rec1_avx2(1, id, ip + 1, nd, size, v);
+			raid_gen6_gfni(nd, size, v);
 		} SPEED_STOP
 
 		printf("%8" PRIu64, ds / dt);
+		fflush(stdout);
 	}
 #endif
 #endif
 	printf("\n");
 
-	printf("%8s", "rec2");
-	printf("%8s", raid_rec2_tag());
+	/* GEN7 */
+	printf("%8s", "gen7");
+	printf("%8s", raid_gen7_tag());
 	fflush(stdout);
 
 	SPEED_START {
-		for (j = 0; j < nd; ++j)
-			/* +1 to avoid GEN2 optimized case */
-			raid_rec2_int8(2, id, ip + 1, nd, size, v);
+		raid_gen7_int8(nd, size, v);
 	} SPEED_STOP
 
 	printf("%8" PRIu64, ds / dt);
 	fflush(stdout);
 
+	printf("%8s", "");
+	printf("%8s", "");
+
+#ifdef CONFIG_X86
+#ifdef CONFIG_SSE2
+	if (raid_cpu_has_sse2()) {
+		printf("%8s", "");
+
+#ifdef CONFIG_X86_64
+		printf("%8s", "");
+#endif
+	}
+#endif
+#endif
+
 #ifdef CONFIG_X86
 #ifdef CONFIG_SSSE3
 	if (raid_cpu_has_ssse3()) {
+		printf("%8s", "");
+
+#ifdef CONFIG_X86_64
 		SPEED_START {
-			for (j = 0; j < nd; ++j)
-				/* +1 to avoid GEN2 optimized case */
-				raid_rec2_ssse3(2, id, ip + 1, nd, size, v);
+			raid_gen7_ssse3ext(nd, size, v);
 		} SPEED_STOP
 
 		printf("%8" PRIu64, ds / dt);
+		fflush(stdout);
+#endif
 	}
 #endif
+
+	printf("%8s", "");
+
+#ifdef CONFIG_X86_64
 #ifdef CONFIG_AVX2
 	if (raid_cpu_has_avx2()) {
 		SPEED_START {
-			for (j = 0; j < nd; ++j)
-				/* +1 to avoid GEN1 optimized case */
-				raid_rec2_avx2(2, id, ip + 1, nd, size, v);
+			raid_gen7_avx2ext(nd, size, v);
 		} SPEED_STOP
 
 		printf("%8" PRIu64, ds / dt);
+		fflush(stdout);
 	}
 #endif
 #endif
-	printf("\n");
-
-	printf("%8s", "rec3");
-	printf("%8s", raid_recX_tag());
-	fflush(stdout);
-
-	SPEED_START {
-		for (j = 0; j < nd; ++j)
-			raid_recX_int8(3, id, ip, nd, size, v);
-	} SPEED_STOP
 
-	printf("%8" PRIu64, ds / dt);
-	fflush(stdout);
+	printf("%8s", "");
 
-#ifdef CONFIG_X86
-#ifdef CONFIG_SSSE3
-	if (raid_cpu_has_ssse3()) {
+#ifdef CONFIG_X86_64
+#ifdef CONFIG_AVX512BW
+	if (raid_cpu_has_avx512bw()) {
 		SPEED_START {
-			for (j = 0; j < nd; ++j)
-				raid_recX_ssse3(3, id, ip, nd, size, v);
+			raid_gen7_avx512bwext(nd, size, v);
 		} SPEED_STOP
 
 		printf("%8" PRIu64, ds / dt);
+		fflush(stdout);
 	}
 #endif
-#ifdef CONFIG_AVX2
-	if (raid_cpu_has_avx2()) {
+#endif
+
+#ifdef CONFIG_X86_64
+#ifdef CONFIG_GFNI
+	if (raid_cpu_has_gfni()) {
 		SPEED_START {
-			for (j = 0; j < nd; ++j)
-				raid_recX_avx2(3, id, ip, nd, size, v);
+			raid_gen7_gfniext(nd, size, v);
 		} SPEED_STOP
 
 		printf("%8" PRIu64, ds / dt);
+		fflush(stdout);
 	}
 #endif
+#endif
 #endif
 	printf("\n");
 
-	printf("%8s", "rec4");
-	printf("%8s", raid_recX_tag());
+	/* GEN8 */
+	printf("%8s", "gen8");
+	printf("%8s", raid_gen8_tag());
 	fflush(stdout);
 
 	SPEED_START {
-		for (j = 0; j < nd; ++j)
-			raid_recX_int8(4, id, ip, nd, size, v);
+		raid_gen8_int8(nd, size, v);
 	} SPEED_STOP
 
 	printf("%8" PRIu64, ds / dt);
 	fflush(stdout);
 
+	printf("%8s", "");
+	printf("%8s", "");
+
+#ifdef CONFIG_X86
+#ifdef CONFIG_SSE2
+	if (raid_cpu_has_sse2()) {
+		printf("%8s", "");
+
+#ifdef CONFIG_X86_64
+		printf("%8s", "");
+#endif
+	}
+#endif
+#endif
+
 #ifdef CONFIG_X86
 #ifdef CONFIG_SSSE3
 	if (raid_cpu_has_ssse3()) {
+		printf("%8s", "");
+
+#ifdef CONFIG_X86_64
 		SPEED_START {
-			for (j = 0; j < nd; ++j)
-				raid_recX_ssse3(4, id, ip, nd, size, v);
+			raid_gen8_ssse3ext(nd, size, v);
 		} SPEED_STOP
 
 		printf("%8" PRIu64, ds / dt);
+		fflush(stdout);
+#endif
 	}
 #endif
+
+	printf("%8s", "");
+
+#ifdef CONFIG_X86_64
 #ifdef CONFIG_AVX2
 	if (raid_cpu_has_avx2()) {
 		SPEED_START {
-			for (j = 0; j < nd; ++j)
-				raid_recX_avx2(4, id, ip, nd, size, v);
+			raid_gen8_avx2ext(nd, size, v);
 		} SPEED_STOP
 
 		printf("%8" PRIu64, ds / dt);
+		fflush(stdout);
 	}
 #endif
 #endif
-	printf("\n");
-
-	printf("%8s", "rec5");
-	printf("%8s", raid_recX_tag());
-	fflush(stdout);
-
-	SPEED_START {
-		for (j = 0; j < nd; ++j)
-			raid_recX_int8(5, id, ip, nd, size, v);
-	} SPEED_STOP
 
-	printf("%8" PRIu64, ds / dt);
-	fflush(stdout);
+	printf("%8s", "");
 
-#ifdef CONFIG_X86
-#ifdef CONFIG_SSSE3
-	if (raid_cpu_has_ssse3()) {
+#ifdef CONFIG_X86_64
+#ifdef CONFIG_AVX512BW
+	if (raid_cpu_has_avx512bw()) {
 		SPEED_START {
-			for (j = 0; j < nd; ++j)
-				raid_recX_ssse3(5, id, ip, nd, size, v);
+			raid_gen8_avx512bwext(nd, size, v);
 		} SPEED_STOP
 
 		printf("%8" PRIu64, ds / dt);
+		fflush(stdout);
 	}
 #endif
-#ifdef CONFIG_AVX2
-	if (raid_cpu_has_avx2()) {
+#endif
+
+#ifdef CONFIG_X86_64
+#ifdef CONFIG_GFNI
+	if (raid_cpu_has_gfni()) {
 		SPEED_START {
-			for (j = 0; j < nd; ++j)
-				raid_recX_avx2(5, id, ip, nd, size, v);
+			raid_gen8_gfniext(nd, size, v);
 		} SPEED_STOP
 
 		printf("%8" PRIu64, ds / dt);
+		fflush(stdout);
 	}
 #endif
 #endif
+#endif
+	printf("\n");
 	printf("\n");
 
-	printf("%8s", "rec6");
-	printf("%8s", raid_recX_tag());
+	/* recover table */
+	printf("RAID functions used for recovering with 'fix':\n");
+	printf("%8s", "");
+	printf("%8s", "best");
+	printf("%8s", "int8");
+#ifdef CONFIG_X86
+	printf("%8s", "ssse3");
+	printf("%8s", "avx2");
+	printf("%8s", "avx512");
+	printf("%8s", "gfni");
+#endif
+	printf("\n");
+
+	printf("%8s", "rec1");
+	printf("%8s", raid_rec1_tag());
+	fflush(stdout);
+
+	SPEED_START {
+		for (j = 0; j < nd; ++j)
+			/* +1 to avoid GEN1 optimized case */
+			raid_rec1_int8(1, id, ip + 1, nd, size, v);
+	} SPEED_STOP
+
+	printf("%8" PRIu64, ds / dt);
+	fflush(stdout);
+
+#ifdef CONFIG_X86
+#ifdef CONFIG_SSSE3
+	if (raid_cpu_has_ssse3()) {
+		SPEED_START {
+			for (j = 0; j < nd; ++j)
+				/* +1 to avoid GEN1 optimized case */
+				raid_rec1_ssse3(1, id, ip + 1, nd, size, v);
+		} SPEED_STOP
+
+		printf("%8" PRIu64, ds / dt);
+	}
+#endif
+#ifdef CONFIG_AVX2
+	if (raid_cpu_has_avx2()) {
+		SPEED_START {
+			for (j = 0; j < nd; ++j)
+				/* +1 to avoid GEN1 optimized case */
+				raid_rec1_avx2(1, id, ip + 1, nd, size, v);
+		} SPEED_STOP
+
+		printf("%8" PRIu64, ds / dt);
+	}
+#endif
+#ifdef CONFIG_AVX512BW
+	if (raid_cpu_has_avx512bw()) {
+		SPEED_START {
+			for (j = 0; j < nd; ++j)
+				/* +1 to avoid GEN1 optimized case */
+				raid_rec1_avx512bw(1, id, ip + 1, nd, size, v);
+		} SPEED_STOP
+
+		printf("%8" PRIu64, ds / dt);
+	}
+#endif
+#ifdef CONFIG_GFNI
+	if (raid_cpu_has_gfni()) {
+		SPEED_START {
+			for (j = 0; j < nd; ++j)
+				/* +1 to avoid GEN1 optimized case */
+				raid_rec1_gfni(1, id, ip + 1, nd, size, v);
+		} SPEED_STOP
+
+		printf("%8" PRIu64, ds / dt);
+	}
+#endif
+#endif
+	printf("\n");
+
+	printf("%8s", "rec2");
+	printf("%8s", raid_rec2_tag());
+	fflush(stdout);
+
+	SPEED_START {
+		for (j = 0; j < nd; ++j)
+			/* +1 to avoid GEN2 optimized case */
+			raid_rec2_int8(2, id, ip + 1, nd, size, v);
+	} SPEED_STOP
+
+	printf("%8" PRIu64, ds / dt);
+	fflush(stdout);
+
+#ifdef CONFIG_X86
+#ifdef CONFIG_SSSE3
+	if (raid_cpu_has_ssse3()) {
+		SPEED_START {
+			for (j = 0; j < nd; ++j)
+				/* +1 to avoid GEN2 optimized case */
+				raid_rec2_ssse3(2, id, ip + 1, nd, size, v);
+		} SPEED_STOP
+
+		printf("%8" PRIu64, ds / dt);
+	}
+#endif
+#ifdef CONFIG_AVX2
+	if (raid_cpu_has_avx2()) {
+		SPEED_START {
+			for (j = 0; j < nd; ++j)
+				/* +1 to avoid GEN1 optimized case */
+				raid_rec2_avx2(2, id, ip + 1, nd, size, v);
+		} SPEED_STOP
+
+		printf("%8" PRIu64, ds / dt);
+	}
+#endif
+#ifdef CONFIG_AVX512BW
+	if (raid_cpu_has_avx512bw()) {
+		SPEED_START {
+			for (j = 0; j < nd; ++j)
+				/* +1 to avoid GEN2 optimized case */
+				raid_recX_avx512bw(2, id, ip + 1, nd, size, v);
+		} SPEED_STOP
+
+		printf("%8" PRIu64, ds / dt);
+	}
+#endif
+#ifdef CONFIG_GFNI
+	if (raid_cpu_has_gfni()) {
+		SPEED_START {
+			for (j = 0; j < nd; ++j)
+				/* +1 to avoid GEN2 optimized case */
+				raid_recX_gfni(2, id, ip + 1, nd, size, v);
+		} SPEED_STOP
+
+		printf("%8" PRIu64, ds / dt);
+	}
+#endif
+#endif
+	printf("\n");
+
+	printf("%8s", "rec3");
+	printf("%8s", raid_recX_tag());
+	fflush(stdout);
+
+	SPEED_START {
+		for (j = 0; j < nd; ++j)
+			raid_recX_int8(3, id, ip, nd, size, v);
+	} SPEED_STOP
+
+	printf("%8" PRIu64, ds / dt);
+	fflush(stdout);
+
+#ifdef CONFIG_X86
+#ifdef CONFIG_SSSE3
+	if (raid_cpu_has_ssse3()) {
+		SPEED_START {
+			for (j = 0; j < nd; ++j)
+				raid_recX_ssse3(3, id, ip, nd, size, v);
+		} SPEED_STOP
+
+		printf("%8" PRIu64, ds / dt);
+	}
+#endif
+#ifdef CONFIG_AVX2
+	if (raid_cpu_has_avx2()) {
+		SPEED_START {
+			for (j = 0; j < nd; ++j)
+				raid_recX_avx2(3, id, ip, nd, size, v);
+		} SPEED_STOP
+
+		printf("%8" PRIu64, ds / dt);
+	}
+#endif
+#ifdef CONFIG_AVX512BW
+	if (raid_cpu_has_avx512bw()) {
+		SPEED_START {
+			for (j = 0; j < nd; ++j)
+				raid_recX_avx512bw(3, id, ip, nd, size, v);
+		} SPEED_STOP
+
+		printf("%8" PRIu64, ds / dt);
+	}
+#endif
+#ifdef CONFIG_GFNI
+	if (raid_cpu_has_gfni()) {
+		SPEED_START {
+			for (j = 0; j < nd; ++j)
+				raid_recX_gfni(3, id, ip, nd, size, v);
+		} SPEED_STOP
+
+		printf("%8" PRIu64, ds / dt);
+	}
+#endif
+#endif
+	printf("\n");
+
+	printf("%8s", "rec4");
+	printf("%8s", raid_recX_tag());
+	fflush(stdout);
+
+	SPEED_START {
+		for (j = 0; j < nd; ++j)
+			raid_recX_int8(4, id, ip, nd, size, v);
+	} SPEED_STOP
+
+	printf("%8" PRIu64, ds / dt);
+	fflush(stdout);
+
+#ifdef CONFIG_X86
+#ifdef CONFIG_SSSE3
+	if (raid_cpu_has_ssse3()) {
+		SPEED_START {
+			for (j = 0; j < nd; ++j)
+				raid_recX_ssse3(4, id, ip, nd, size, v);
+		} SPEED_STOP
+
+		printf("%8" PRIu64, ds / dt);
+	}
+#endif
+#ifdef CONFIG_AVX2
+	if (raid_cpu_has_avx2()) {
+		SPEED_START {
+			for (j = 0; j < nd; ++j)
+				raid_recX_avx2(4, id, ip, nd, size, v);
+		} SPEED_STOP
+
+		printf("%8" PRIu64, ds / dt);
+	}
+#endif
+#ifdef CONFIG_AVX512BW
+	if (raid_cpu_has_avx512bw()) {
+		SPEED_START {
+			for (j = 0; j < nd; ++j)
+				raid_recX_avx512bw(4, id, ip, nd, size, v);
+		} SPEED_STOP
+
+		printf("%8" PRIu64, ds / dt);
+	}
+#endif
+#ifdef CONFIG_GFNI
+	if (raid_cpu_has_gfni()) {
+		SPEED_START {
+			for (j = 0; j < nd; ++j)
+				raid_recX_gfni(4, id, ip, nd, size, v);
+		} SPEED_STOP
+
+		printf("%8" PRIu64, ds / dt);
+	}
+#endif
+#endif
+	printf("\n");
+
+	printf("%8s", "rec5");
+	printf("%8s", raid_recX_tag());
+	fflush(stdout);
+
+	SPEED_START {
+		for (j = 0; j < nd; ++j)
+			raid_recX_int8(5, id, ip, nd, size, v);
+	} SPEED_STOP
+
+	printf("%8" PRIu64, ds / dt);
+	fflush(stdout);
+
+#ifdef CONFIG_X86
+#ifdef CONFIG_SSSE3
+	if (raid_cpu_has_ssse3()) {
+		SPEED_START {
+			for (j = 0; j < nd; ++j)
+				raid_recX_ssse3(5, id, ip, nd, size, v);
+		} SPEED_STOP
+
+		printf("%8" PRIu64, ds / dt);
+	}
+#endif
+#ifdef CONFIG_AVX2
+	if (raid_cpu_has_avx2()) {
+		SPEED_START {
+			for (j = 0; j < nd; ++j)
+				raid_recX_avx2(5, id, ip, nd, size, v);
+		} SPEED_STOP
+
+		printf("%8" PRIu64, ds / dt);
+	}
+#endif
+#ifdef CONFIG_AVX512BW
+	if (raid_cpu_has_avx512bw()) {
+		SPEED_START {
+			for (j = 0; j < nd; ++j)
+				raid_recX_avx512bw(5, id, ip, nd, size, v);
+		} SPEED_STOP
+
+		printf("%8" PRIu64, ds / dt);
+	}
+#endif
+#ifdef CONFIG_GFNI
+	if (raid_cpu_has_gfni()) {
+		SPEED_START {
+			for (j = 0; j < nd; ++j)
+				raid_recX_gfni(5, id, ip, nd, size, v);
+		} SPEED_STOP
+
+		printf("%8" PRIu64, ds / dt);
+	}
+#endif
+#endif
+	printf("\n");
+
+	printf("%8s", "rec6");
+	printf("%8s", raid_recX_tag());
 	fflush(stdout);
 
 	SPEED_START {
@@ -945,10 +1374,336 @@ void speed(int period)
 		printf("%8" PRIu64, ds / dt);
 	}
 #endif
+#ifdef CONFIG_AVX512BW
+	if (raid_cpu_has_avx512bw()) {
+		SPEED_START {
+			for (j = 0; j < nd; ++j)
+				raid_recX_avx512bw(6, id, ip, nd, size, v);
+		} SPEED_STOP
+
+		printf("%8" PRIu64, ds / dt);
+	}
+#endif
+#ifdef CONFIG_GFNI
+	if (raid_cpu_has_gfni()) {
+		SPEED_START {
+			for (j = 0; j < nd; ++j)
+				raid_recX_gfni(6, id, ip, nd, size, v);
+		} SPEED_STOP
+
+		printf("%8" PRIu64, ds / dt);
+	}
+#endif
 #endif
 	printf("\n");
+
+	printf("%8s", "rec7");
+	printf("%8s", raid_recX_tag());
+	fflush(stdout);
+
+	SPEED_START {
+		for (j = 0; j < nd; ++j)
+			raid_recX_int8(7, id, ip, nd, size, v);
+	} SPEED_STOP
+
+	printf("%8" PRIu64, ds / dt);
+	fflush(stdout);
+
+#ifdef CONFIG_X86
+#ifdef CONFIG_SSSE3
+	if (raid_cpu_has_ssse3()) {
+		SPEED_START {
+			for (j = 0; j < nd; ++j)
+				raid_recX_ssse3(7, id, ip, nd, size, v);
+		} SPEED_STOP
+
+		printf("%8" PRIu64, ds / dt);
+	}
+#endif
+#ifdef CONFIG_AVX2
+	if (raid_cpu_has_avx2()) {
+		SPEED_START {
+			for (j = 0; j < nd; ++j)
+				raid_recX_avx2(7, id, ip, nd, size, v);
+		} SPEED_STOP
+
+		printf("%8" PRIu64, ds / dt);
+	}
+#endif
+#ifdef CONFIG_AVX512BW
+	if (raid_cpu_has_avx512bw()) {
+		SPEED_START {
+			for (j = 0; j < nd; ++j)
+				raid_recX_avx512bw(7, id, ip, nd, size, v);
+		} SPEED_STOP
+
+		printf("%8" PRIu64, ds / dt);
+	}
+#endif
+#ifdef CONFIG_GFNI
+	if (raid_cpu_has_gfni()) {
+		SPEED_START {
+			for (j = 0; j < nd; ++j)
+				raid_recX_gfni(7, id, ip, nd, size, v);
+		} SPEED_STOP
+
+		printf("%8" PRIu64, ds / dt);
+	}
+#endif
+#endif
 	printf("\n");
 
+	printf("%8s", "rec8");
+	printf("%8s", raid_recX_tag());
+	fflush(stdout);
+
+	SPEED_START {
+		for (j = 0; j < nd; ++j)
+			raid_recX_int8(8, id, ip, nd, size, v);
+	} SPEED_STOP
+
+	printf("%8" PRIu64, ds / dt);
+	fflush(stdout);
+
+#ifdef CONFIG_X86
+#ifdef CONFIG_SSSE3
+	if (raid_cpu_has_ssse3()) {
+		SPEED_START {
+			for (j = 0; j < nd; ++j)
+				raid_recX_ssse3(8, id, ip, nd, size, v);
+		} SPEED_STOP
+
+		printf("%8" PRIu64, ds / dt);
+	}
+#endif
+#ifdef CONFIG_AVX2
+	if (raid_cpu_has_avx2()) {
+		SPEED_START {
+			for (j = 0; j < nd; ++j)
+				raid_recX_avx2(8, id, ip, nd, size, v);
+		} SPEED_STOP
+
+		printf("%8" PRIu64, ds / dt);
+	}
+#endif
+#ifdef CONFIG_AVX512BW
+	if (raid_cpu_has_avx512bw()) {
+		SPEED_START {
+			for (j = 0; j < nd; ++j)
+				raid_recX_avx512bw(8, id, ip, nd, size, v);
+		} SPEED_STOP
+
+		printf("%8" PRIu64, ds / dt);
+	}
+#endif
+#ifdef CONFIG_GFNI
+	if (raid_cpu_has_gfni()) {
+		SPEED_START {
+			for (j = 0; j < nd; ++j)
+				raid_recX_gfni(8, id, ip, nd, size, v);
+		} SPEED_STOP
+
+		printf("%8" PRIu64, ds / dt);
+	}
+#endif
+#endif
+	printf("\n");
+	printf("\n");
+
+	/* add table */
+	printf("RAID functions used for updating the parity of changed blocks with 'sync':\n");
+	printf("%8s", "");
+	printf("%8s", "best");
+	printf("%8s", "int8");
+#ifdef CONFIG_X86
+	printf("%8s", "ssse3");
+	printf("%8s", "avx2");
+	printf("%8s", "gfni");
+#endif
+	printf("\n");
+
+	/* the last data block is added to all the parities */
+	printf("%8s", "add");
+	printf("%8s", raid_add_tag());
+	fflush(stdout);
+
+	SPEED_START {
+		for (j = 0; j < nd; ++j)
+			raid_add_int8(nd - 1, RAID_PARITY_MAX, size, v + nd - 1);
+	} SPEED_STOP
+
+	printf("%8" PRIu64, ds / dt);
+	fflush(stdout);
+
+#ifdef CONFIG_X86
+#ifdef CONFIG_SSSE3
+	if (raid_cpu_has_ssse3()) {
+		SPEED_START {
+			for (j = 0; j < nd; ++j)
+				raid_add_ssse3(nd - 1, RAID_PARITY_MAX, size, v + nd - 1);
+		} SPEED_STOP
+
+		printf("%8" PRIu64, ds / dt);
+	}
+#endif
+#ifdef CONFIG_AVX2
+	if (raid_cpu_has_avx2()) {
+		SPEED_START {
+			for (j = 0; j < nd; ++j)
+				raid_add_avx2(nd - 1, RAID_PARITY_MAX, size, v + nd - 1);
+		} SPEED_STOP
+
+		printf("%8" PRIu64, ds / dt);
+	}
+#endif
+#ifdef CONFIG_GFNI
+	if (raid_cpu_has_gfni()) {
+		SPEED_START {
+			for (j = 0; j < nd; ++j)
+				raid_add_gfni(nd - 1, RAID_PARITY_MAX, size, v + nd - 1);
+		} SPEED_STOP
+
+		printf("%8" PRIu64, ds / dt);
+	}
+#endif
+#endif
+	printf("\n");
+	printf("\n");
+
+	printf("RAID matrix setup for every recovering with 'fix' in nanoseconds:\n");
+	printf("%8s", "");
+	printf("%8s", "invert");
+	printf("%8s", "cached");
+	printf("\n");
+
+	for (nr = 3; nr <= RAID_PARITY_MAX; ++nr) {
+		uint8_t V[RAID_PARITY_MAX * RAID_PARITY_MAX];
+
+		printf("%7s%d", "rec", nr);
+		fflush(stdout);
+
+		SPEED_START {
+			for (j = 0; j < nd; ++j) {
+				raid_rec_invert(nr, id, ip, V);
+				side_effect += V[0];
+			}
+		} SPEED_STOP
+
+		printf("%8" PRIu64, dt * 1000 / ((int64_t)count * nd));
+		fflush(stdout);
+
+		SPEED_START {
+			for (j = 0; j < nd; ++j)
+				side_effect += raid_rec_matrix(nr, id, ip)[0];
+		} SPEED_STOP
+
+		printf("%8" PRIu64, dt * 1000 / ((int64_t)count * nd));
+		printf("\n");
+	}
+	printf("\n");
+
+	/* tiling matrix */
+	tile_cache = raid_tile_cache;
+	tile_prefetch = raid_tile_prefetch;
+
+	nv = TEST_TILE_DISK_MAX + 6 + 1;
+	tv = malloc_nofail_vector_align(TEST_TILE_DISK_MAX, nv, TEST_SIZE, &tv_alloc);
+
+	for (i = 0; i < nv; ++i)
+		memset(tv[i], i, TEST_SIZE);
+
+	printf("RAID gen6 split in tiles of %u KiB of cache, for number of disks and block size:\n", (unsigned)(tile_cache / KIBI));
+	printf("%8s", "");
+	for (size = TEST_SIZE / 4; size <= TEST_SIZE; size *= 4) {
+		for (j = 0; j < 3; ++j)
+			printf("%10uk", size / KIBI);
+	}
+	printf("\n");
+	printf("%8s", "");
+	for (size = TEST_SIZE / 4; size <= TEST_SIZE; size *= 4) {
+		printf("%11s", "none");
+		printf("%11s", "tile");
+		printf("%11s", "pref");
+	}
+	printf("\n");
+
+	for (nd = 8; nd <= TEST_TILE_DISK_MAX; nd *= 2) {
+		printf("%5s%3d", "disk", nd);
+		fflush(stdout);
+
+		for (size = TEST_SIZE / 4; size <= TEST_SIZE; size *= 4) {
+			raid_tile(0, 0);
+
+			SPEED_START {
+				raid_gen(nd, 6, size, tv);
+			} SPEED_STOP
+
+			printf("%11" PRIu64, ds / dt);
+			fflush(stdout);
+
+			raid_tile(tile_cache, 0);
+
+			SPEED_START {
+				raid_gen(nd, 6, size, tv);
+			} SPEED_STOP
+
+			printf("%11" PRIu64, ds / dt);
+			fflush(stdout);
+
+			raid_tile(tile_cache, 1);
+
+			SPEED_START {
+				raid_gen(nd, 6, size, tv);
+			} SPEED_STOP
+
+			printf("%11" PRIu64, ds / dt);
+			fflush(stdout);
+		}
+		printf("\n");
+	}
+	printf("\n");
+
+	raid_tile(tile_cache, tile_prefetch);
+
+	/* store matrix */
+	stream_size = raid_stream_size;
+
+	printf("RAID gen6 with non-temporal and temporal stores, switching at %u KiB, for block size:\n", (unsigned)(stream_size / KIBI));
+	printf("%8s", "");
+	printf("%11s", "nt");
+	printf("%11s", "temporal");
+	printf("\n");
+
+	nd = 8;
+	for (size = TEST_SIZE / 64; size <= TEST_SIZE; size *= 4) {
+		printf("%7uk", size / KIBI);
+		fflush(stdout);
+
+		raid_stream_size = 0;
+
+		SPEED_START {
+			raid_gen(nd, 6, size, tv);
+		} SPEED_STOP
+
+		printf("%11" PRIu64, ds / dt);
+		fflush(stdout);
+
+		raid_stream_size = (size_t)-1;
+
+		SPEED_START {
+			raid_gen(nd, 6, size, tv);
+		} SPEED_STOP
+
+		printf("%11" PRIu64, ds / dt);
+		printf("\n");
+	}
+	printf("\n");
+
+	raid_stream_size = stream_size;
+
+	free(tv_alloc);
+	free(tv);
+
 	printf("If the 'best' expectations are wrong, please report it in the SnapRAID forum\n\n");
 
 	free(v_alloc);
@@ -26,29 +26,33 @@
 #include "stream.h"
 #include "handle.h"
 #include "io.h"
+#include "hashstore.h"
+#include "journal.h"
 #include "raid/raid.h"
 #include "raid/cpu.h"
 
 /**
  * Configure the multithread support.
  *
- * Multi thread for write could be either faster or slower, depending
- * on the specific conditions. With multithreads it's likely faster
- * writing to disk, but you'll need to access multiple times the same data,
- * being potentially slower.
- *
- * For upcoming SnapRAID version it's planned to add a mutex protection
- * at the file-system structure, slowing down multiple data access,
- * so we disable it.
+ * Writing is done serializing the state only once in a single stream,
+ * that is then written concurrently in all the content files.
+ * See sopen_multi_write().
  *
  * Multi thread for verify is instead always generally faster,
  * so we enable it if possible.
  */
 #if HAVE_PTHREAD
-/* #define HAVE_MT_WRITE 1 */
 #define HAVE_MT_VERIFY 1
 #endif
 
+/**
+ * Multi thread for read of content files with the index of the disk
+ * sections. Each disk is read by a different thread.
+ */
+#if HAVE_PTHREAD
+#define HAVE_MT_READ 1
+#endif
+
 const char* lev_name(unsigned l)
 {
 	switch (l) {
@@ -58,6 +62,8 @@ const char* lev_name(unsigned l)
 	case 3 : return "4-Parity";
 	case 4 : return "5-Parity";
 	case 5 : return "6-Parity";
+	case 6 : return "7-Parity";
+	case 7 : return "8-Parity";
 	}
 
 	return 0;
@@ -72,6 +78,8 @@ const char* lev_config_name(unsigned l)
 	case 3 : return "4-parity";
 	case 4 : return "5-parity";
 	case 5 : return "6-parity";
+	case 6 : return "7-parity";
+	case 7 : return "8-parity";
 	}
 
 	return 0;
@@ -109,6 +117,16 @@ static int lev_config_scan(const char* s, unsigned* level, unsigned* mode)
 		return 0;
 	}
 
+	if (strcmp(s, "7-parity") == 0) {
+		*level = 6;
+		return 0;
+	}
+
+	if (strcmp(s, "8-parity") == 0) {
+		*level = 7;
+		return 0;
+	}
+
 	if (strcmp(s, "z-parity") == 0) {
 		*level = 2;
 		if (mode)
@@ -131,6 +149,8 @@ const char* lev_raid_name(unsigned mode, unsigned n)
 	case 4 : return "par4";
 	case 5 : return "par5";
 	case 6 : return "par6";
+	case 7 : return "par7";
+	case 8 : return "par8";
 	}
 
 	return 0;
@@ -143,6 +163,13 @@ void state_init(struct snapraid_state* state)
 	memset(&state->opt, 0, sizeof(state->opt));
 	state->filter_hidden = 0;
 	state->autosave = 0;
+	state->hashstore = 0;
+	state->bgsave = 0;
+	state->scan_thread = 1;
+	state->write_background = 0;
+	state->write_snapshot = 0;
+	state->write_progress = 0;
+	state->write_context = 0;
 	state->need_write = 0;
 	state->checked_read = 0;
 	state->block_size = 256 * KIBI; /* default 256 KiB */
@@ -174,6 +201,10 @@ void state_init(struct snapraid_state* state)
 	state->pool[0] = 0;
 	state->pool_device = 0;
 	state->lockfile[0] = 0;
+	state->journalfile[0] = 0;
+	state->journal_id = 0;
+	state->journal_pos = 0;
+	state->content_crc = 0;
 	state->level = 1; /* default is the lowest protection */
 	state->clear_past_hash = 0;
 	state->no_conf = 0;
@@ -201,6 +232,9 @@ void state_done(struct snapraid_state* state)
 	tommy_hashdyn_done(&state->previmportset);
 	tommy_hashdyn_done(&state->searchset);
 	tommy_arrayblkof_done(&state->infoarr);
+
+	/* after freeing all the files, as they may point inside it */
+	hashstore_done();
 }
 
 /**
@@ -881,6 +915,8 @@ void state_config(struct snapraid_state* state, const char* path, const char* co
 			if (state->lockfile[0] == 0 && dev != 0) {
 				pathcpy(state->lockfile, sizeof(state->lockfile), buffer);
 				pathcat(state->lockfile, sizeof(state->lockfile), ".lock");
+				pathcpy(state->journalfile, sizeof(state->journalfile), buffer);
+				pathcat(state->journalfile, sizeof(state->journalfile), ".journal");
 			}
 
 			content = content_alloc(buffer, dev);
@@ -1069,6 +1105,10 @@ void state_config(struct snapraid_state* state, const char* path, const char* co
 			}
 		} else if (strcmp(tag, "nohidden") == 0) {
 			state->filter_hidden = 1;
+		} else if (strcmp(tag, "hashstore") == 0) {
+			state->hashstore = 1;
+		} else if (strcmp(tag, "bgsave") == 0) {
+			state->bgsave = 1;
 		} else if (strcmp(tag, "exclude") == 0) {
 			struct snapraid_filter* filter;
 
@@ -1152,6 +1192,33 @@ void state_config(struct snapraid_state* state, const char* path, const char* co
 
 			/* convert to GB */
 			state->autosave *= GIGA;
+		} else if (strcmp(tag, "scanthreads") == 0) {
+			char* e;
+
+			ret = sgetlasttok(f, buffer, sizeof(buffer));
+			if (ret < 0) {
+				/* LCOV_EXCL_START */
+				log_fatal("Invalid 'scanthreads' specification in '%s' at line %u\n", path, line);
+				exit(EXIT_FAILURE);
+				/* LCOV_EXCL_STOP */
+			}
+
+			if (!*buffer) {
+				/* LCOV_EXCL_START */
+				log_fatal("Empty 'scanthreads' specification in '%s' at line %u\n", path, line);
+				exit(EXIT_FAILURE);
+				/* LCOV_EXCL_STOP */
+			}
+
+			state->scan_thread = strtoul(buffer, &e, 0);
+
+			if (!e || *e || state->scan_thread < 1 || state->scan_thread > 64) {
+				/* LCOV_EXCL_START */
+				log_fatal("Invalid 'scanthreads' specification in '%s' at line %u\n", path, line);
+				log_fatal("It must be a number of threads between 1 and 64.\n");
+				exit(EXIT_FAILURE);
+				/* LCOV_EXCL_STOP */
+			}
 		} else if (tag[0] == 0) {
 			/* allow empty lines */
 		} else if (tag[0] == '#') {
@@ -1507,13 +1574,25 @@ static void state_map(struct snapraid_state* state)
 		/* LCOV_EXCL_STOP */
 	}
 
+	/* with more than six parities, each one reduces the number of data disks */
+	if (diskcount + state->level > RAID_DISK_MAX) {
+		/* LCOV_EXCL_START */
+		log_fatal("Too many data disks for %u parities. No more than %u.\n", state->level, RAID_DISK_MAX - state->level);
+		exit(EXIT_FAILURE);
+		/* LCOV_EXCL_STOP */
+	}
+
 	/* now count the real number of data disks, excluding holes left after removing some */
 	diskcount = tommy_list_count(&state->maplist);
 
 	/* recommend number of parities */
 	if (!state->opt.no_warnings) {
 		/* intentionally use log_fatal() instead of log_error() to give more visibility at the warning */
-		if (diskcount >= 36 && state->level < 6) {
+		if (diskcount >= 50 && state->level < 8) {
+			log_fatal("WARNING! With %u disks it's recommended to use eight parity levels.\n", diskcount);
+		} else if (diskcount >= 43 && state->level < 7) {
+			log_fatal("WARNING! With %u disks it's recommended to use seven parity levels.\n", diskcount);
+		} else if (diskcount >= 36 && state->level < 6) {
 			log_fatal("WARNING! With %u disks it's recommended to use six parity levels.\n", diskcount);
 		} else if (diskcount >= 29 && state->level < 5) {
 			log_fatal("WARNING! With %u disks it's recommended to use five parity levels.\n", diskcount);
@@ -1623,6 +1702,256 @@ static void state_content_check(struct snapraid_state* state, const char* path)
 	}
 }
 
+#if HAVE_HASHSTORE
+/**
+ * Map the hash store, if it matches the content file to read.
+ *
+ * The CRC is always stored in the last 4 bytes of the content file,
+ * so we can check it before reading the content file.
+ */
+static void state_read_hashstore(struct snapraid_state* state, const char* path, STREAM* f, uint64_t size)
+{
+	char store_path[PATH_MAX];
+	struct snapraid_content* content;
+	unsigned char buf[4];
+	uint32_t crc;
+
+	if (size < 4 || pread(shandle(f), buf, 4, size - 4) != 4) {
+		/* LCOV_EXCL_START */
+		log_fatal("WARNING! Error reading the CRC of the content file '%s'. Not using the hash store.\n", path);
+		return;
+		/* LCOV_EXCL_STOP */
+	}
+
+	crc = buf[0] | (uint32_t)buf[1] << 8 | (uint32_t)buf[2] << 16 | (uint32_t)buf[3] << 24;
+
+	/* the store is placed near the first content file */
+	content = tommy_list_head(&state->contentlist)->data;
+	pathprint(store_path, sizeof(store_path), "%s.hash", content->content);
+
+	if (hashstore_init(store_path, crc, size) == 0)
+		msg_progress("Mapping hashes from %s...\n", store_path);
+}
+
+/**
+ * File to save in the hash store.
+ */
+struct state_hashstore_entry {
+	block_off_t pos; /**< First parity position of the file. */
+	uint64_t offset; /**< Offset of the blocks in the store. */
+	struct snapraid_file* file;
+};
+
+static int state_hashstore_compare(const void* void_a, const void* void_b)
+{
+	const struct state_hashstore_entry* a = *(const struct state_hashstore_entry* const*)void_a;
+	const struct state_hashstore_entry* b = *(const struct state_hashstore_entry* const*)void_b;
+
+	if (a->pos < b->pos)
+		return -1;
+	if (a->pos > b->pos)
+		return 1;
+	return 0;
+}
+
+/**
+ * Save the hash store for the content file just written.
+ *
+ * The files of each disk are placed in the order of their parity position,
+ * so the store is accessed sequentially when processing the parity.
+ *
+ * Any error is not fatal, as without a matching store the hashes are
+ * read from the content file.
+ */
+static void state_write_hashstore(struct snapraid_state* state, uint32_t crc)
+{
+	char path[PATH_MAX];
+	char tmp[PATH_MAX];
+	struct snapraid_content* content;
+	struct stat st;
+	struct snapraid_disk** disk_map;
+	struct state_hashstore_entry** entry_map;
+	struct state_hashstore_entry*** sort_map;
+	unsigned* count_map;
+	unsigned mapping_max;
+	unsigned m;
+	tommy_node* i;
+	uint64_t offset;
+	STREAM* f;
+
+	content = tommy_list_head(&state->contentlist)->data;
+	pathprint(path, sizeof(path), "%s.hash", content->content);
+	pathprint(tmp, sizeof(tmp), "%s.hash.tmp", content->content);
+
+	if (stat(content->content, &st) != 0) {
+		/* LCOV_EXCL_START */
+		log_fatal("WARNING! Error stating the content file '%s'. %s.\n", content->content, strerror(errno));
+		return;
+		/* LCOV_EXCL_STOP */
+	}
+
+	msg_progress("Saving hashes to %s...\n", path);
+
+	/* disks in mapping order */
+	mapping_max = 0;
+	for (i = state->disklist; i != 0; i = i->next) {
+		struct snapraid_disk* disk = i->data;
+		if (disk->mapping_idx >= 0 && (unsigned)disk->mapping_idx + 1 > mapping_max)
+			mapping_max = disk->mapping_idx + 1;
+	}
+
+	disk_map = calloc_nofail(mapping_max + 1, sizeof(struct snapraid_disk*));
+	entry_map = calloc_nofail(mapping_max + 1, sizeof(struct state_hashstore_entry*));
+	sort_map = calloc_nofail(mapping_max + 1, sizeof(struct state_hashstore_entry**));
+	count_map = calloc_nofail(mapping_max + 1, sizeof(unsigned));
+	for (i = state->disklist; i != 0; i = i->next) {
+		struct snapraid_disk* disk = i->data;
+		if (disk->mapping_idx >= 0)
+			disk_map[disk->mapping_idx] = disk;
+	}
+
+	/* the index of the files follows the disk table */
+	offset = HASHSTORE_HEADER_SIZE + mapping_max * (uint64_t)HASHSTORE_ENTRY_SIZE;
+	for (m = 0; m < mapping_max; ++m) {
+		struct snapraid_disk* disk = disk_map[m];
+		if (disk)
+			count_map[m] = tommy_list_count(&disk->filelist);
+		offset += count_map[m] * (uint64_t)HASHSTORE_ENTRY_SIZE;
+	}
+
+	/* the blocks follow the index, in parity position order */
+	for (m = 0; m < mapping_max; ++m) {
+		struct state_hashstore_entry* entry;
+		struct state_hashstore_entry** sort;
+		unsigned n;
+
+		if (count_map[m] == 0)
+			continue;
+
+		entry = malloc_nofail(count_map[m] * sizeof(struct state_hashstore_entry));
+		sort = malloc_nofail(count_map[m] * sizeof(struct state_hashstore_entry*));
+
+		n = 0;
+		for (i = disk_map[m]->filelist; i != 0; i = i->next) {
+			struct snapraid_file* file = i->data;
+
+			entry[n].file = file;
+			entry[n].pos = file->blockmax != 0 ? fs_file2par_get(disk_map[m], file, 0) : 0;
+			sort[n] = &entry[n];
+			++n;
+		}
+
+		qsort(sort, n, sizeof(struct state_hashstore_entry*), state_hashstore_compare);
+
+		for (n = 0; n < count_map[m]; ++n) {
+			sort[n]->offset = offset;
+			offset += sort[n]->file->blockmax * (uint64_t)block_sizeof();
+		}
+
+		entry_map[m] = entry;
+		sort_map[m] = sort;
+	}
+
+	/* ensure to delete a previous stale file */
+	remove(tmp);
+
+	f = sopen_write(tmp);
+	if (!f) {
+		/* LCOV_EXCL_START */
+		log_fatal("WARNING! Error creating the hash store file '%s'. %s.\n", tmp, strerror(errno));
+		goto bail;
+		/* LCOV_EXCL_STOP */
+	}
+
+	swrite("SNAPHASH", 8, f);
+	sputble32(HASHSTORE_VERSION, f);
+	sputble32(block_sizeof(), f);
+	sputble32(crc, f);
+	sputble32(mapping_max, f);
+	sputble32(st.st_size & 0xFFFFFFFF, f);
+	sputble32((uint64_t)st.st_size >> 32, f);
+
+	offset = HASHSTORE_HEADER_SIZE + mapping_max * (uint64_t)HASHSTORE_ENTRY_SIZE;
+	for (m = 0; m < mapping_max; ++m) {
+		sputble32(count_map[m], f);
+		sputble32(0, f);
+		sputble32(offset & 0xFFFFFFFF, f);
+		sputble32(offset >> 32, f);
+		offset += count_map[m] * (uint64_t)HASHSTORE_ENTRY_SIZE;
+	}
+
+	for (m = 0; m < mapping_max; ++m) {
+		unsigned n;
+
+		for (n = 0; n < count_map[m]; ++n) {
+			struct state_hashstore_entry* entry = &entry_map[m][n];
+
+			sputble32(entry->file->blockmax, f);
+			sputble32(0, f);
+			sputble32(entry->offset & 0xFFFFFFFF, f);
+			sputble32(entry->offset >> 32, f);
+		}
+	}
+
+	for (m = 0; m < mapping_max; ++m) {
+		unsigned n;
+
+		for (n = 0; n < count_map[m]; ++n) {
+			struct snapraid_file* file = sort_map[m][n]->file;
+
+			swrite(file->blockvec, file->blockmax * block_sizeof(), f);
+		}
+	}
+
+	if (serror(f) || sflush(f) != 0) {
+		/* LCOV_EXCL_START */
+		log_fatal("WARNING! Error writing the hash store file '%s'. %s.\n", tmp, strerror(errno));
+		sclose(f);
+		remove(tmp);
+		goto bail;
+		/* LCOV_EXCL_STOP */
+	}
+
+#if HAVE_FSYNC
+	if (ssync(f) != 0) {
+		/* LCOV_EXCL_START */
+		log_fatal("WARNING! Error writing the hash store file '%s' in sync(). %s.\n", tmp, strerror(errno));
+		sclose(f);
+		remove(tmp);
+		goto bail;
+		/* LCOV_EXCL_STOP */
+	}
+#endif
+
+	if (sclose(f) != 0) {
+		/* LCOV_EXCL_START */
+		log_fatal("WARNING! Error closing the hash store file '%s'. %s.\n", tmp, strerror(errno));
+		remove(tmp);
+		goto bail;
+		/* LCOV_EXCL_STOP */
+	}
+
+	/* a store already mapped keeps using the old file */
+	if (rename(tmp, path) != 0) {
+		/* LCOV_EXCL_START */
+		log_fatal("WARNING! Error renaming the hash store file '%s' to '%s'. %s.\n", tmp, path, strerror(errno));
+		remove(tmp);
+		goto bail;
+		/* LCOV_EXCL_STOP */
+	}
+
+bail:
+	for (m = 0; m < mapping_max; ++m) {
+		free(entry_map[m]);
+		free(sort_map[m]);
+	}
+	free(disk_map);
+	free(entry_map);
+	free(sort_map);
+	free(count_map);
+}
+#endif
+
 /**
  * Check if the position is REQUIRED, or we can completely clear it from the state.
  *
@@ -1701,6 +2030,51 @@ static int fs_is_block_deleted(struct snapraid_disk* disk, block_off_t pos)
 	return block_state_get(block) == BLOCK_STATE_DELETED;
 }
 
+/**
+ * Check the CRC of the whole content file.
+ *
+ * It's used when the CRC of a stream doesn't cover the whole file.
+ */
+static void state_read_crc(const char* path)
+{
+	unsigned char buf[4];
+	uint32_t crc_stored;
+	uint32_t crc_computed;
+	STREAM* f;
+
+	f = sopen_read(path);
+	if (!f) {
+		/* LCOV_EXCL_START */
+		log_fatal("Error opening the content file '%s'. %s.\n", path, strerror(errno));
+		exit(EXIT_FAILURE);
+		/* LCOV_EXCL_STOP */
+	}
+
+	if (sdeplete(f, buf) != 0) {
+		/* LCOV_EXCL_START */
+		log_fatal("Error flushing the content file '%s' at offset %" PRIi64 "\n", path, stell(f));
+		exit(EXIT_FAILURE);
+		/* LCOV_EXCL_STOP */
+	}
+
+	/* get the stored crc from the last four bytes */
+	crc_stored = buf[0] | (uint32_t)buf[1] << 8 | (uint32_t)buf[2] << 16 | (uint32_t)buf[3] << 24;
+
+	/* get the computed crc */
+	crc_computed = scrc(f);
+
+	/* adjust the stored crc to include itself */
+	crc_stored = crc32c(crc_stored, buf, 4);
+
+	if (crc_computed != crc_stored) {
+		log_fatal("Mismatching CRC in '%s'\n", path);
+		log_fatal("This content file is damaged! Use an alternate copy.\n");
+		exit(EXIT_FAILURE);
+	}
+
+	sclose(f);
+}
+
 /**
  * Flush the file checking the final CRC.
  * We exploit the fact that the CRC is always stored in the last 4 bytes.
@@ -1728,6 +2102,13 @@ static void decoding_error(const char* path, STREAM* f)
 
 	log_fatal("Decoding error in '%s' at offset %" PRIi64 "\n", path, stell(f));
 
+	/* a partial stream doesn't cover the whole file, so read it again */
+	if (spartial(f)) {
+		state_read_crc(path);
+		log_fatal("The file CRC is correct!\n");
+		return;
+	}
+
 	if (sdeplete(f, buf) != 0) {
 		/* LCOV_EXCL_START */
 		log_fatal("Error flushing the content file '%s' at offset %" PRIi64 "\n", path, stell(f));
@@ -1753,120 +2134,161 @@ static void decoding_error(const char* path, STREAM* f)
 	}
 }
 
-static void state_read_content(struct snapraid_state* state, const char* path, STREAM* f)
-{
+/**
+ * Section of the content file with the data of a single disk.
+ */
+struct state_section {
+	uint32_t mapping; /**< Mapping index of the disk. */
+	uint64_t offset; /**< Offset of the section in the content file. */
+	uint64_t size; /**< Size of the section. */
+};
+
+/**
+ * Context for reading the data of the disks from the content file.
+ */
+struct state_read_disk_context {
+	struct snapraid_state* state;
+	const char* path;
 	block_off_t blockmax;
+	tommy_array* disk_mapping;
+	uint32_t mapping_max;
+	int mapping_section; /**< Only mapping allowed in the section. -1 for any. */
+	/* output */
 	unsigned count_file;
 	unsigned count_hardlink;
 	unsigned count_symlink;
 	unsigned count_dir;
-	int crc_checked;
-	char buffer[PATH_MAX];
-	int ret;
-	tommy_array disk_mapping;
-	uint32_t mapping_max;
+};
 
-	blockmax = 0;
-	count_file = 0;
-	count_hardlink = 0;
-	count_symlink = 0;
-	count_dir = 0;
-	crc_checked = 0;
-	mapping_max = 0;
-	tommy_array_init(&disk_mapping);
+/**
+ * Read a record with the data of a disk.
+ *
+ * The records 'f', 'a', 's', 'r' and 'h' change only the specified disk,
+ * and they can be read concurrently for different disks.
+ */
+static void state_read_disk(struct state_read_disk_context* context, STREAM* f, int c)
+{
+	struct snapraid_state* state = context->state;
+	const char* path = context->path;
+	block_off_t blockmax = context->blockmax;
+	int ret;
 
-	ret = sread(f, buffer, 12);
-	if (ret < 0) {
-		/* LCOV_EXCL_START */
-		decoding_error(path, f);
-		log_fatal("Invalid header!\n");
-		os_abort();
-		/* LCOV_EXCL_STOP */
-	}
+	if (c == 'f') {
+		/* file */
+		char sub[PATH_MAX];
+		uint64_t v_size;
+		uint64_t v_mtime_sec;
+		uint32_t v_mtime_nsec;
+		uint64_t v_inode;
+		uint32_t v_idx;
+		struct snapraid_file* file;
+		void* blockvec;
+		struct snapraid_disk* disk;
+		uint32_t mapping;
 
-	/*
-	 * File format versions:
-	 *  - SNAPCNT1/SnapRAID 4.0 First version.
-	 *  - SNAPCNT2/SnapRAID 7.0 Adds entries 'M' and 'P', to add free_blocks support.
-	 *    The previous 'm' entry is now deprecated, but supported for importing.
-	 *    Similarly for text file, we add 'mapping' and 'parity' deprecating 'map'.
-	 *  - SNAPCNT3/SnapRAID 11.0 Adds entry 'y' for hash size.
-	 *  - SNAPCNT3/SnapRAID 11.0 Adds entry 'Q' for multi parity file.
-	 *    The previous 'P' entry is now deprecated, but supported for importing.
-	 */
-	if (memcmp(buffer, "SNAPCNT1\n\3\0\0", 12) != 0
-		&& memcmp(buffer, "SNAPCNT2\n\3\0\0", 12) != 0
-		&& memcmp(buffer, "SNAPCNT3\n\3\0\0", 12) != 0
-	) {
-		/* LCOV_EXCL_START */
-		if (memcmp(buffer, "SNAPCNT", 7) != 0) {
+		ret = sgetb32(f, &mapping);
+		if (ret < 0 || mapping >= context->mapping_max || (context->mapping_section >= 0 && mapping != (uint32_t)context->mapping_section)) {
+			/* LCOV_EXCL_START */
 			decoding_error(path, f);
-			log_fatal("Invalid header!\n");
+			log_fatal("Internal inconsistency in mapping index!\n");
 			os_abort();
-		} else {
-			log_fatal("The content file '%s' was generated with a newer version of SnapRAID!\n", path);
-			exit(EXIT_FAILURE);
+			/* LCOV_EXCL_STOP */
 		}
-		/* LCOV_EXCL_STOP */
-	}
+		disk = tommy_array_get(context->disk_mapping, mapping);
 
-	while (1) {
-		int c;
+		ret = sgetb64(f, &v_size);
+		if (ret < 0) {
+			/* LCOV_EXCL_START */
+			decoding_error(path, f);
+			os_abort();
+			/* LCOV_EXCL_STOP */
+		}
 
-		/* read the command */
-		c = sgetc(f);
-		if (c == EOF) {
-			break;
+		if (state->block_size == 0) {
+			/* LCOV_EXCL_START */
+			decoding_error(path, f);
+			log_fatal("Internal incosistency due zero blocksize!\n");
+			exit(EXIT_FAILURE);
+			/* LCOV_EXCL_STOP */
 		}
 
-		if (c == 'f') {
-			/* file */
-			char sub[PATH_MAX];
-			uint64_t v_size;
-			uint64_t v_mtime_sec;
-			uint32_t v_mtime_nsec;
-			uint64_t v_inode;
-			uint32_t v_idx;
-			struct snapraid_file* file;
-			struct snapraid_disk* disk;
-			uint32_t mapping;
+		/* check for impossible file size to avoid to crash for a too big allocation */
+		if (v_size / state->block_size > blockmax) {
+			/* LCOV_EXCL_START */
+			decoding_error(path, f);
+			log_fatal("Internal inconsistency in file size too big!\n");
+			os_abort();
+			/* LCOV_EXCL_STOP */
+		}
 
-			ret = sgetb32(f, &mapping);
-			if (ret < 0 || mapping >= mapping_max) {
-				/* LCOV_EXCL_START */
-				decoding_error(path, f);
-				log_fatal("Internal inconsistency in mapping index!\n");
-				os_abort();
-				/* LCOV_EXCL_STOP */
-			}
-			disk = tommy_array_get(&disk_mapping, mapping);
+		ret = sgetb64(f, &v_mtime_sec);
+		if (ret < 0) {
+			/* LCOV_EXCL_START */
+			decoding_error(path, f);
+			os_abort();
+			/* LCOV_EXCL_STOP */
+		}
 
-			ret = sgetb64(f, &v_size);
-			if (ret < 0) {
-				/* LCOV_EXCL_START */
-				decoding_error(path, f);
-				os_abort();
-				/* LCOV_EXCL_STOP */
-			}
+		ret = sgetb32(f, &v_mtime_nsec);
+		if (ret < 0) {
+			/* LCOV_EXCL_START */
+			decoding_error(path, f);
+			os_abort();
+			/* LCOV_EXCL_STOP */
+		}
 
-			if (state->block_size == 0) {
-				/* LCOV_EXCL_START */
-				decoding_error(path, f);
-				log_fatal("Internal incosistency due zero blocksize!\n");
-				exit(EXIT_FAILURE);
-				/* LCOV_EXCL_STOP */
-			}
+		/* STAT_NSEC_INVALID is encoded as 0 */
+		if (v_mtime_nsec == 0)
+			v_mtime_nsec = STAT_NSEC_INVALID;
+		else
+			--v_mtime_nsec;
 
-			/* check for impossible file size to avoid to crash for a too big allocation */
-			if (v_size / state->block_size > blockmax) {
-				/* LCOV_EXCL_START */
-				decoding_error(path, f);
-				log_fatal("Internal inconsistency in file size too big!\n");
-				os_abort();
-				/* LCOV_EXCL_STOP */
-			}
+		ret = sgetb64(f, &v_inode);
+		if (ret < 0) {
+			/* LCOV_EXCL_START */
+			decoding_error(path, f);
+			os_abort();
+			/* LCOV_EXCL_STOP */
+		}
+
+		ret = sgetbs(f, sub, sizeof(sub));
+		if (ret < 0) {
+			/* LCOV_EXCL_START */
+			decoding_error(path, f);
+			os_abort();
+			/* LCOV_EXCL_STOP */
+		}
+		if (!*sub) {
+			/* LCOV_EXCL_START */
+			decoding_error(path, f);
+			log_fatal("Internal inconsistency for null file!\n");
+			os_abort();
+			/* LCOV_EXCL_STOP */
+		}
+
+		/* allocate the file, using the blocks in the hash store if available */
+		blockvec = hashstore_get(mapping, (v_size + state->block_size - 1) / state->block_size);
+		if (blockvec)
+			file = file_alloc_blockvec(state->block_size, sub, v_size, v_mtime_sec, v_mtime_nsec, v_inode, 0, blockvec);
+		else
+			file = file_alloc(state->block_size, sub, v_size, v_mtime_sec, v_mtime_nsec, v_inode, 0);
+
+		/* insert the file in the file containers */
+		tommy_hashdyn_insert(&disk->inodeset, &file->nodeset, file, file_inode_hash(file->inode));
+		tommy_hashdyn_insert(&disk->pathset, &file->pathset, file, file_path_hash(file->sub));
+		tommy_hashdyn_insert(&disk->stampset, &file->stampset, file, file_stamp_hash(file->size, file->mtime_sec, file->mtime_nsec));
+		tommy_list_insert_tail(&disk->filelist, &file->nodelist, file);
+
+		/* read all the blocks */
+		v_idx = 0;
+		while (v_idx < file->blockmax) {
+			block_off_t v_pos;
+			uint32_t v_count;
+
+			/* get the "subcommand */
+			c = sgetc(f);
 
-			ret = sgetb64(f, &v_mtime_sec);
+			ret = sgetb32(f, &v_pos);
 			if (ret < 0) {
 				/* LCOV_EXCL_START */
 				decoding_error(path, f);
@@ -1874,7 +2296,7 @@ static void state_read_content(struct snapraid_state* state, const char* path, S
 				/* LCOV_EXCL_STOP */
 			}
 
-			ret = sgetb32(f, &v_mtime_nsec);
+			ret = sgetb32(f, &v_count);
 			if (ret < 0) {
 				/* LCOV_EXCL_START */
 				decoding_error(path, f);
@@ -1882,89 +2304,45 @@ static void state_read_content(struct snapraid_state* state, const char* path, S
 				/* LCOV_EXCL_STOP */
 			}
 
-			/* STAT_NSEC_INVALID is encoded as 0 */
-			if (v_mtime_nsec == 0)
-				v_mtime_nsec = STAT_NSEC_INVALID;
-			else
-				--v_mtime_nsec;
-
-			ret = sgetb64(f, &v_inode);
-			if (ret < 0) {
+			if (v_idx + v_count > file->blockmax) {
 				/* LCOV_EXCL_START */
 				decoding_error(path, f);
+				log_fatal("Internal inconsistency in block number!\n");
 				os_abort();
 				/* LCOV_EXCL_STOP */
 			}
 
-			ret = sgetbs(f, sub, sizeof(sub));
-			if (ret < 0) {
+			if (v_pos + v_count > blockmax) {
 				/* LCOV_EXCL_START */
 				decoding_error(path, f);
+				log_fatal("Internal inconsistency in block size %u/%u!\n", blockmax, v_pos + v_count);
 				os_abort();
-				/* LCOV_EXCL_STOP */
-			}
-			if (!*sub) {
 				/* LCOV_EXCL_START */
-				decoding_error(path, f);
-				log_fatal("Internal inconsistency for null file!\n");
-				os_abort();
-				/* LCOV_EXCL_STOP */
 			}
 
-			/* allocate the file */
-			file = file_alloc(state->block_size, sub, v_size, v_mtime_sec, v_mtime_nsec, v_inode, 0);
-
-			/* insert the file in the file containers */
-			tommy_hashdyn_insert(&disk->inodeset, &file->nodeset, file, file_inode_hash(file->inode));
-			tommy_hashdyn_insert(&disk->pathset, &file->pathset, file, file_path_hash(file->sub));
-			tommy_hashdyn_insert(&disk->stampset, &file->stampset, file, file_stamp_hash(file->size, file->mtime_sec, file->mtime_nsec));
-			tommy_list_insert_tail(&disk->filelist, &file->nodelist, file);
-
-			/* read all the blocks */
-			v_idx = 0;
-			while (v_idx < file->blockmax) {
-				block_off_t v_pos;
-				uint32_t v_count;
-
-				/* get the "subcommand */
-				c = sgetc(f);
-
-				ret = sgetb32(f, &v_pos);
-				if (ret < 0) {
-					/* LCOV_EXCL_START */
-					decoding_error(path, f);
-					os_abort();
-					/* LCOV_EXCL_STOP */
-				}
-
-				ret = sgetb32(f, &v_count);
-				if (ret < 0) {
-					/* LCOV_EXCL_START */
-					decoding_error(path, f);
-					os_abort();
-					/* LCOV_EXCL_STOP */
-				}
-
-				if (v_idx + v_count > file->blockmax) {
-					/* LCOV_EXCL_START */
-					decoding_error(path, f);
-					log_fatal("Internal inconsistency in block number!\n");
-					os_abort();
-					/* LCOV_EXCL_STOP */
-				}
+			/* fill the blocks in the run */
+			while (v_count) {
+				struct snapraid_block* block = fs_file2block_get(file, v_idx);
 
-				if (v_pos + v_count > blockmax) {
-					/* LCOV_EXCL_START */
-					decoding_error(path, f);
-					log_fatal("Internal inconsistency in block size %u/%u!\n", blockmax, v_pos + v_count);
-					os_abort();
-					/* LCOV_EXCL_START */
-				}
-
-				/* fill the blocks in the run */
-				while (v_count) {
-					struct snapraid_block* block = fs_file2block_get(file, v_idx);
+				if (blockvec) {
+					/* the state and the hash are already in the hash store */
+					/* and we skip them without touching the store */
+					if (c != 'b' && c != 'g' && c != 'p') {
+						/* LCOV_EXCL_START */
+						decoding_error(path, f);
+						log_fatal("Invalid block type!\n");
+						os_abort();
+						/* LCOV_EXCL_STOP */
+					}
 
+					ret = sskip(f, BLOCK_HASH_SIZE);
+					if (ret < 0) {
+						/* LCOV_EXCL_START */
+						decoding_error(path, f);
+						os_abort();
+						/* LCOV_EXCL_STOP */
+					}
+				} else {
 					switch (c) {
 					case 'b' :
 						block_state_set(block, BLOCK_STATE_BLK);
@@ -2000,52 +2378,642 @@ static void state_read_content(struct snapraid_state* state, const char* path, S
 						/* set the ZERO hash for deprecated NEW blocks */
 						hash_zero_set(block->hash);
 					}
+				}
+
+				/* if the block contains a hash of past data */
+				/* and we are clearing such indeterminate hashes */
+				if (state->clear_past_hash
+					&& block_has_past_hash(block)
+				) {
+					/* set the hash value to INVALID */
+					hash_invalid_set(block->hash);
+				}
+
+				/* if we are disabling the copy optimization */
+				/* we want also to clear any already previously stored information */
+				/* in other sync commands */
+				/* note that this is required only in sync, and we detect */
+				/* this using the clear_past_hash flag */
+				if (state->clear_past_hash
+					&& state->opt.force_nocopy
+					&& block_state_get(block) == BLOCK_STATE_REP
+				) {
+					/* set the hash value to INVALID */
+					hash_invalid_set(block->hash);
+					/* convert from REP to CHG block */
+					block_state_set(block, BLOCK_STATE_CHG);
+				}
+
+				/* if we want a full reallocation, marks block as invalid parity */
+				/* note that we do this after the force_nocopy option */
+				/* to avoid to mixup the two things */
+				if (state->opt.force_realloc
+					&& block_state_get(block) == BLOCK_STATE_BLK) {
+					/* convert from BLK to REP */
+					block_state_set(block, BLOCK_STATE_REP);
+				}
+
+				/* set the parity association */
+				fs_allocate(disk, v_pos, file, v_idx);
+
+				/* go to the next block */
+				++v_idx;
+				++v_pos;
+				--v_count;
+			}
+		}
+
+		/* stat */
+		++context->count_file;
+	} else if (c == 'h') {
+		/* hole */
+		uint32_t v_pos;
+		struct snapraid_disk* disk;
+		uint32_t mapping;
 
-					/* if the block contains a hash of past data */
-					/* and we are clearing such indeterminate hashes */
-					if (state->clear_past_hash
-						&& block_has_past_hash(block)
-					) {
+		ret = sgetb32(f, &mapping);
+		if (ret < 0 || mapping >= context->mapping_max || (context->mapping_section >= 0 && mapping != (uint32_t)context->mapping_section)) {
+			/* LCOV_EXCL_START */
+			decoding_error(path, f);
+			log_fatal("Internal inconsistency in mapping index!\n");
+			os_abort();
+			/* LCOV_EXCL_STOP */
+		}
+		disk = tommy_array_get(context->disk_mapping, mapping);
+
+		v_pos = 0;
+		while (v_pos < blockmax) {
+			uint32_t v_idx;
+			uint32_t v_count;
+			struct snapraid_file* deleted;
+
+			ret = sgetb32(f, &v_count);
+			if (ret < 0) {
+				/* LCOV_EXCL_START */
+				decoding_error(path, f);
+				os_abort();
+				/* LCOV_EXCL_STOP */
+			}
+
+			if (v_pos + v_count > blockmax) {
+				/* LCOV_EXCL_START */
+				decoding_error(path, f);
+				log_fatal("Internal inconsistency in hole size %u/%u!\n", blockmax, v_pos + v_count);
+				os_abort();
+				/* LCOV_EXCL_STOP */
+			}
+
+			/* get the sub-command */
+			c = sgetc(f);
+
+			switch (c) {
+			case 'o' :
+				/* if it's a run of deleted blocks */
+
+				/* allocate a fake deleted file */
+				deleted = file_alloc(state->block_size, "<deleted>", v_count * (data_off_t)state->block_size, 0, 0, 0, 0);
+
+				/* mark the file as deleted */
+				file_flag_set(deleted, FILE_IS_DELETED);
+
+				/* insert it in the list of deleted files */
+				tommy_list_insert_tail(&disk->deletedlist, &deleted->nodelist, deleted);
+
+				/* process all blocks */
+				v_idx = 0;
+				while (v_count) {
+					struct snapraid_block* block = fs_file2block_get(deleted, v_idx);
+
+					/* set the block as deleted */
+					block_state_set(block, BLOCK_STATE_DELETED);
+
+					/* read the hash */
+					ret = sread(f, block->hash, BLOCK_HASH_SIZE);
+					if (ret < 0) {
+						/* LCOV_EXCL_START */
+						decoding_error(path, f);
+						os_abort();
+						/* LCOV_EXCL_STOP */
+					}
+
+					/* if we are clearing indeterminate hashes */
+					if (state->clear_past_hash) {
 						/* set the hash value to INVALID */
 						hash_invalid_set(block->hash);
 					}
 
-					/* if we are disabling the copy optimization */
-					/* we want also to clear any already previously stored information */
-					/* in other sync commands */
-					/* note that this is required only in sync, and we detect */
-					/* this using the clear_past_hash flag */
-					if (state->clear_past_hash
-						&& state->opt.force_nocopy
-						&& block_state_get(block) == BLOCK_STATE_REP
-					) {
-						/* set the hash value to INVALID */
-						hash_invalid_set(block->hash);
-						/* convert from REP to CHG block */
-						block_state_set(block, BLOCK_STATE_CHG);
-					}
+					/* insert the block in the block array */
+					fs_allocate(disk, v_pos, deleted, v_idx);
+
+					/* go to next block */
+					++v_pos;
+					++v_idx;
+					--v_count;
+				}
+				break;
+			case 'O' :
+				/* go to the next run */
+				v_pos += v_count;
+				break;
+			default :
+				/* LCOV_EXCL_START */
+				decoding_error(path, f);
+				log_fatal("Invalid hole type!\n");
+				os_abort();
+				/* LCOV_EXCL_STOP */
+			}
+		}
+	} else if (c == 's') {
+		/* symlink */
+		char sub[PATH_MAX];
+		char linkto[PATH_MAX];
+		struct snapraid_link* slink;
+		struct snapraid_disk* disk;
+		uint32_t mapping;
+
+		ret = sgetb32(f, &mapping);
+		if (ret < 0 || mapping >= context->mapping_max || (context->mapping_section >= 0 && mapping != (uint32_t)context->mapping_section)) {
+			/* LCOV_EXCL_START */
+			decoding_error(path, f);
+			log_fatal("Internal inconsistency in mapping index!\n");
+			os_abort();
+			/* LCOV_EXCL_STOP */
+		}
+		disk = tommy_array_get(context->disk_mapping, mapping);
+
+		ret = sgetbs(f, sub, sizeof(sub));
+		if (ret < 0) {
+			/* LCOV_EXCL_START */
+			decoding_error(path, f);
+			os_abort();
+			/* LCOV_EXCL_STOP */
+		}
+
+		if (!*sub) {
+			/* LCOV_EXCL_START */
+			decoding_error(path, f);
+			log_fatal("Internal inconsistency for null symlink!\n");
+			os_abort();
+			/* LCOV_EXCL_STOP */
+		}
+
+		ret = sgetbs(f, linkto, sizeof(linkto));
+		if (ret < 0) {
+			/* LCOV_EXCL_START */
+			decoding_error(path, f);
+			os_abort();
+			/* LCOV_EXCL_STOP */
+		}
+
+		/* allocate the link as symbolic link */
+		slink = link_alloc(sub, linkto, FILE_IS_SYMLINK);
+
+		/* insert the link in the link containers */
+		tommy_hashdyn_insert(&disk->linkset, &slink->nodeset, slink, link_name_hash(slink->sub));
+		tommy_list_insert_tail(&disk->linklist, &slink->nodelist, slink);
+
+		/* stat */
+		++context->count_symlink;
+	} else if (c == 'a') {
+		/* hardlink */
+		char sub[PATH_MAX];
+		char linkto[PATH_MAX];
+		struct snapraid_link* slink;
+		struct snapraid_disk* disk;
+		uint32_t mapping;
+
+		ret = sgetb32(f, &mapping);
+		if (ret < 0 || mapping >= context->mapping_max || (context->mapping_section >= 0 && mapping != (uint32_t)context->mapping_section)) {
+			/* LCOV_EXCL_START */
+			decoding_error(path, f);
+			log_fatal("Internal inconsistency in mapping index!\n");
+			os_abort();
+			/* LCOV_EXCL_STOP */
+		}
+		disk = tommy_array_get(context->disk_mapping, mapping);
+
+		ret = sgetbs(f, sub, sizeof(sub));
+		if (ret < 0) {
+			/* LCOV_EXCL_START */
+			decoding_error(path, f);
+			os_abort();
+			/* LCOV_EXCL_STOP */
+		}
+
+		if (!*sub) {
+			/* LCOV_EXCL_START */
+			decoding_error(path, f);
+			log_fatal("Internal inconsistency for null hardlink!\n");
+			os_abort();
+			/* LCOV_EXCL_STOP */
+		}
+
+		ret = sgetbs(f, linkto, sizeof(linkto));
+		if (ret < 0) {
+			/* LCOV_EXCL_START */
+			decoding_error(path, f);
+			os_abort();
+			/* LCOV_EXCL_STOP */
+		}
+
+		if (!*linkto) {
+			/* LCOV_EXCL_START */
+			decoding_error(path, f);
+			log_fatal("Internal inconsistency for empty hardlink '%s'!\n", sub);
+			os_abort();
+			/* LCOV_EXCL_STOP */
+		}
+
+		/* allocate the link as hard link */
+		slink = link_alloc(sub, linkto, FILE_IS_HARDLINK);
+
+		/* insert the link in the link containers */
+		tommy_hashdyn_insert(&disk->linkset, &slink->nodeset, slink, link_name_hash(slink->sub));
+		tommy_list_insert_tail(&disk->linklist, &slink->nodelist, slink);
+
+		/* stat */
+		++context->count_hardlink;
+	} else if (c == 'r') {
+		/* dir */
+		char sub[PATH_MAX];
+		struct snapraid_dir* dir;
+		struct snapraid_disk* disk;
+		uint32_t mapping;
+
+		ret = sgetb32(f, &mapping);
+		if (ret < 0 || mapping >= context->mapping_max || (context->mapping_section >= 0 && mapping != (uint32_t)context->mapping_section)) {
+			/* LCOV_EXCL_START */
+			decoding_error(path, f);
+			log_fatal("Internal inconsistency in mapping index!\n");
+			os_abort();
+			/* LCOV_EXCL_STOP */
+		}
+		disk = tommy_array_get(context->disk_mapping, mapping);
+
+		ret = sgetbs(f, sub, sizeof(sub));
+		if (ret < 0) {
+			/* LCOV_EXCL_START */
+			decoding_error(path, f);
+			os_abort();
+			/* LCOV_EXCL_STOP */
+		}
+
+		if (!*sub) {
+			/* LCOV_EXCL_START */
+			decoding_error(path, f);
+			log_fatal("Internal inconsistency for null dir!\n");
+			os_abort();
+			/* LCOV_EXCL_STOP */
+		}
+
+		/* allocate the dir */
+		dir = dir_alloc(sub);
+
+		/* insert the dir in the dir containers */
+		tommy_hashdyn_insert(&disk->dirset, &dir->nodeset, dir, dir_name_hash(dir->sub));
+		tommy_list_insert_tail(&disk->dirlist, &dir->nodelist, dir);
+
+		/* stat */
+		++context->count_dir;
+	} else {
+		/* LCOV_EXCL_START */
+		decoding_error(path, f);
+		log_fatal("Invalid command '%c'!\n", (char)c);
+		os_abort();
+		/* LCOV_EXCL_STOP */
+	}
+}
+
+#if HAVE_MT_READ
+/**
+ * Read the index of the disk sections, stored at the end of the content file.
+ *
+ * The index is only a hint to read the disks concurrently, as the whole
+ * file is anyway read and checked with its CRC.
+ *
+ * \return The number of sections, or 0 if the index cannot be used.
+ */
+static unsigned state_read_index(const char* path, struct state_section** out_map)
+{
+	STREAM* f;
+	struct stat st;
+	struct state_section* section_map;
+	uint32_t section_max;
+	uint32_t offset_lo;
+	uint32_t offset_hi;
+	uint64_t offset;
+	uint64_t next;
+	unsigned s, t;
+
+	section_map = 0;
+
+	f = sopen_read(path);
+	if (!f) {
+		/* LCOV_EXCL_START */
+		return 0;
+		/* LCOV_EXCL_STOP */
+	}
+
+	/* the file ends with the offset of the index, the 'N' command and the CRC */
+	if (fstat(shandle(f), &st) != 0 || st.st_size < 12 + 13)
+		goto bail;
+	if (sseek(f, st.st_size - 13) != 0)
+		goto bail;
+	if (sgetble32(f, &offset_lo) != 0 || sgetble32(f, &offset_hi) != 0 || sgetc(f) != 'N')
+		goto bail;
+
+	offset = offset_lo | (uint64_t)offset_hi << 32;
+	if (offset < 12 || offset >= (uint64_t)st.st_size - 13)
+		goto bail;
+
+	if (sseek(f, offset) != 0 || sgetc(f) != 'X')
+		goto bail;
+	if (sgetb32(f, &section_max) != 0 || section_max == 0 || section_max > offset)
+		goto bail;
+
+	section_map = malloc_nofail(section_max * sizeof(struct state_section));
+
+	/* the sections must be ordered and not overlapping */
+	next = 12;
+	for (s = 0; s < section_max; ++s) {
+		if (sgetb32(f, &section_map[s].mapping) != 0
+			|| sgetb64(f, &section_map[s].offset) != 0
+			|| sgetb64(f, &section_map[s].size) != 0)
+			goto bail;
+		if (section_map[s].offset < next || section_map[s].size > offset - section_map[s].offset)
+			goto bail;
+		next = section_map[s].offset + section_map[s].size;
+
+		/* each disk must be only in one section, as it's read by a single thread */
+		for (t = 0; t < s; ++t)
+			if (section_map[t].mapping == section_map[s].mapping)
+				goto bail;
+	}
+
+	sclose(f);
+
+	*out_map = section_map;
+	return section_max;
+
+bail:
+	sclose(f);
+	free(section_map);
+	return 0;
+}
+
+struct state_read_thread_context {
+	struct state_read_disk_context disk;
+	struct state_section* section;
+	pthread_t thread;
+	uint32_t crc; /**< CRC of the section. */
+};
+
+static void* state_read_thread(void* arg)
+{
+	struct state_read_thread_context* context = arg;
+	const char* path = context->disk.path;
+	uint64_t end = context->section->offset + context->section->size;
+	STREAM* f;
+
+	f = sopen_read(path);
+	if (!f) {
+		/* LCOV_EXCL_START */
+		log_fatal("Error opening the content file '%s'. %s.\n", path, strerror(errno));
+		exit(EXIT_FAILURE);
+		/* LCOV_EXCL_STOP */
+	}
+
+	if (sseek(f, context->section->offset) != 0) {
+		/* LCOV_EXCL_START */
+		log_fatal("Error seeking the content file '%s'. %s.\n", path, strerror(errno));
+		exit(EXIT_FAILURE);
+		/* LCOV_EXCL_STOP */
+	}
+
+	while ((uint64_t)stell(f) < end) {
+		int c = sgetc(f);
+
+		if (c != 'f' && c != 'a' && c != 's' && c != 'r' && c != 'h') {
+			/* LCOV_EXCL_START */
+			decoding_error(path, f);
+			log_fatal("Invalid command '%c' in the disk section!\n", (char)c);
+			os_abort();
+			/* LCOV_EXCL_STOP */
+		}
+
+		state_read_disk(&context->disk, f, c);
+	}
+
+	if ((uint64_t)stell(f) != end) {
+		/* LCOV_EXCL_START */
+		decoding_error(path, f);
+		log_fatal("Internal inconsistency in the disk section size!\n");
+		os_abort();
+		/* LCOV_EXCL_STOP */
+	}
+
+	/* the stream starts at the section, so it's the CRC of the section */
+	context->crc = scrc(f);
+
+	sclose(f);
+
+	return 0;
+}
+
+/**
+ * Read the disk sections with a thread for each one.
+ *
+ * Each thread computes the CRC of its section, and they are combined
+ * with the CRC of the main stream, that then seeks after the sections.
+ * The main stream becomes partial, and its CRC restarts from there.
+ *
+ * \return The CRC of the file up to the end of the sections.
+ */
+static uint32_t state_read_sections(struct state_read_disk_context* disk_context, STREAM* f, struct state_section* section_map, unsigned section_max)
+{
+	struct state_read_thread_context* thread_map;
+	const char* path = disk_context->path;
+	uint32_t crc;
+	uint64_t end;
+	unsigned s;
+
+	thread_map = malloc_nofail(section_max * sizeof(struct state_read_thread_context));
+
+	for (s = 0; s < section_max; ++s) {
+		struct state_read_thread_context* context = &thread_map[s];
+
+		if (section_map[s].mapping >= disk_context->mapping_max) {
+			/* LCOV_EXCL_START */
+			decoding_error(path, f);
+			log_fatal("Internal inconsistency in mapping index!\n");
+			os_abort();
+			/* LCOV_EXCL_STOP */
+		}
+
+		context->disk = *disk_context;
+		context->disk.mapping_section = section_map[s].mapping;
+		context->disk.count_file = 0;
+		context->disk.count_hardlink = 0;
+		context->disk.count_symlink = 0;
+		context->disk.count_dir = 0;
+		context->section = &section_map[s];
+
+		thread_create(&context->thread, 0, state_read_thread, context);
+	}
+
+	/* the sections must be contiguous, as their CRCs are combined */
+	end = stell(f);
+	for (s = 0; s < section_max; ++s) {
+		if (end != section_map[s].offset) {
+			/* LCOV_EXCL_START */
+			decoding_error(path, f);
+			log_fatal("Internal inconsistency in the disk sections!\n");
+			os_abort();
+			/* LCOV_EXCL_STOP */
+		}
+		end += section_map[s].size;
+	}
+
+	/* CRC of the main stream before the sections */
+	crc = scrc(f);
+
+	for (s = 0; s < section_max; ++s) {
+		struct state_read_thread_context* context = &thread_map[s];
+
+		thread_join(context->thread, 0);
+
+		crc = crc32c_combine(crc, context->crc, section_map[s].size);
+
+		disk_context->count_file += context->disk.count_file;
+		disk_context->count_hardlink += context->disk.count_hardlink;
+		disk_context->count_symlink += context->disk.count_symlink;
+		disk_context->count_dir += context->disk.count_dir;
+	}
+
+	free(thread_map);
+
+	if (sseek(f, end) != 0) {
+		/* LCOV_EXCL_START */
+		log_fatal("Error seeking the content file '%s'. %s.\n", path, strerror(errno));
+		exit(EXIT_FAILURE);
+		/* LCOV_EXCL_STOP */
+	}
+
+	return crc;
+}
+#endif
+
+static void state_read_content(struct snapraid_state* state, const char* path, STREAM* f)
+{
+	block_off_t blockmax;
+	unsigned count_file;
+	unsigned count_hardlink;
+	unsigned count_symlink;
+	unsigned count_dir;
+	int crc_checked;
+	char buffer[PATH_MAX];
+	int ret;
+	tommy_array disk_mapping;
+	uint32_t mapping_max;
+	struct state_read_disk_context disk_context;
+	struct state_section* section_map;
+	unsigned section_max;
+	uint32_t crc_sections;
+	int64_t offset_sections;
+
+	blockmax = 0;
+	count_file = 0;
+	count_hardlink = 0;
+	count_symlink = 0;
+	count_dir = 0;
+	crc_checked = 0;
+	mapping_max = 0;
+	tommy_array_init(&disk_mapping);
+	section_map = 0;
+	section_max = 0;
+	crc_sections = 0;
+	offset_sections = 0;
+
+	disk_context.state = state;
+	disk_context.path = path;
+	disk_context.blockmax = 0;
+	disk_context.disk_mapping = &disk_mapping;
+	disk_context.mapping_max = 0;
+	disk_context.mapping_section = -1;
+	disk_context.count_file = 0;
+	disk_context.count_hardlink = 0;
+	disk_context.count_symlink = 0;
+	disk_context.count_dir = 0;
+
+	ret = sread(f, buffer, 12);
+	if (ret < 0) {
+		/* LCOV_EXCL_START */
+		decoding_error(path, f);
+		log_fatal("Invalid header!\n");
+		os_abort();
+		/* LCOV_EXCL_STOP */
+	}
+
+	/*
+	 * File format versions:
+	 *  - SNAPCNT1/SnapRAID 4.0 First version.
+	 *  - SNAPCNT2/SnapRAID 7.0 Adds entries 'M' and 'P', to add free_blocks support.
+	 *    The previous 'm' entry is now deprecated, but supported for importing.
+	 *    Similarly for text file, we add 'mapping' and 'parity' deprecating 'map'.
+	 *  - SNAPCNT3/SnapRAID 11.0 Adds entry 'y' for hash size.
+	 *  - SNAPCNT3/SnapRAID 11.0 Adds entry 'Q' for multi parity file.
+	 *    The previous 'P' entry is now deprecated, but supported for importing.
+	 *  - SNAPCNT4/SnapRAID 11.4 Adds entry 'X' with the index of the disk sections,
+	 *    followed by its offset at a fixed position from the end of the file.
+	 */
+	if (memcmp(buffer, "SNAPCNT1\n\3\0\0", 12) != 0
+		&& memcmp(buffer, "SNAPCNT2\n\3\0\0", 12) != 0
+		&& memcmp(buffer, "SNAPCNT3\n\3\0\0", 12) != 0
+		&& memcmp(buffer, "SNAPCNT4\n\3\0\0", 12) != 0
+	) {
+		/* LCOV_EXCL_START */
+		if (memcmp(buffer, "SNAPCNT", 7) != 0) {
+			decoding_error(path, f);
+			log_fatal("Invalid header!\n");
+			os_abort();
+		} else {
+			log_fatal("The content file '%s' was generated with a newer version of SnapRAID!\n", path);
+			exit(EXIT_FAILURE);
+		}
+		/* LCOV_EXCL_STOP */
+	}
+
+#if HAVE_MT_READ
+	/* get the index of the disk sections to read them concurrently */
+	if (memcmp(buffer, "SNAPCNT4\n\3\0\0", 12) == 0)
+		section_max = state_read_index(path, &section_map);
+#endif
 
-					/* if we want a full reallocation, marks block as invalid parity */
-					/* note that we do this after the force_nocopy option */
-					/* to avoid to mixup the two things */
-					if (state->opt.force_realloc
-						&& block_state_get(block) == BLOCK_STATE_BLK) {
-						/* convert from BLK to REP */
-						block_state_set(block, BLOCK_STATE_REP);
-					}
+	while (1) {
+		int c;
 
-					/* set the parity association */
-					fs_allocate(disk, v_pos, file, v_idx);
+#if HAVE_MT_READ
+		/* read all the disk sections when reaching the first one */
+		if (section_max != 0 && (uint64_t)stell(f) == section_map[0].offset) {
+			disk_context.blockmax = blockmax;
+			disk_context.mapping_max = mapping_max;
+			crc_sections = state_read_sections(&disk_context, f, section_map, section_max);
+			offset_sections = stell(f);
+			section_max = 0;
+		}
+#endif
 
-					/* go to the next block */
-					++v_idx;
-					++v_pos;
-					--v_count;
-				}
-			}
+		/* read the command */
+		c = sgetc(f);
+		if (c == EOF) {
+			break;
+		}
 
-			/* stat */
-			++count_file;
+		if (c == 'f' || c == 'a' || c == 's' || c == 'r' || c == 'h') {
+			/* data of a disk */
+			disk_context.blockmax = blockmax;
+			disk_context.mapping_max = mapping_max;
+			state_read_disk(&disk_context, f, c);
 		} else if (c == 'i') {
 			/* "inf" command */
 			snapraid_info info;
@@ -2145,256 +3113,6 @@ static void state_read_content(struct snapraid_state* state, const char* path, S
 					--v_count;
 				}
 			}
-		} else if (c == 'h') {
-			/* hole */
-			uint32_t v_pos;
-			struct snapraid_disk* disk;
-			uint32_t mapping;
-
-			ret = sgetb32(f, &mapping);
-			if (ret < 0 || mapping >= mapping_max) {
-				/* LCOV_EXCL_START */
-				decoding_error(path, f);
-				log_fatal("Internal inconsistency in mapping index!\n");
-				os_abort();
-				/* LCOV_EXCL_STOP */
-			}
-			disk = tommy_array_get(&disk_mapping, mapping);
-
-			v_pos = 0;
-			while (v_pos < blockmax) {
-				uint32_t v_idx;
-				uint32_t v_count;
-				struct snapraid_file* deleted;
-
-				ret = sgetb32(f, &v_count);
-				if (ret < 0) {
-					/* LCOV_EXCL_START */
-					decoding_error(path, f);
-					os_abort();
-					/* LCOV_EXCL_STOP */
-				}
-
-				if (v_pos + v_count > blockmax) {
-					/* LCOV_EXCL_START */
-					decoding_error(path, f);
-					log_fatal("Internal inconsistency in hole size %u/%u!\n", blockmax, v_pos + v_count);
-					os_abort();
-					/* LCOV_EXCL_STOP */
-				}
-
-				/* get the sub-command */
-				c = sgetc(f);
-
-				switch (c) {
-				case 'o' :
-					/* if it's a run of deleted blocks */
-
-					/* allocate a fake deleted file */
-					deleted = file_alloc(state->block_size, "<deleted>", v_count * (data_off_t)state->block_size, 0, 0, 0, 0);
-
-					/* mark the file as deleted */
-					file_flag_set(deleted, FILE_IS_DELETED);
-
-					/* insert it in the list of deleted files */
-					tommy_list_insert_tail(&disk->deletedlist, &deleted->nodelist, deleted);
-
-					/* process all blocks */
-					v_idx = 0;
-					while (v_count) {
-						struct snapraid_block* block = fs_file2block_get(deleted, v_idx);
-
-						/* set the block as deleted */
-						block_state_set(block, BLOCK_STATE_DELETED);
-
-						/* read the hash */
-						ret = sread(f, block->hash, BLOCK_HASH_SIZE);
-						if (ret < 0) {
-							/* LCOV_EXCL_START */
-							decoding_error(path, f);
-							os_abort();
-							/* LCOV_EXCL_STOP */
-						}
-
-						/* if we are clearing indeterminate hashes */
-						if (state->clear_past_hash) {
-							/* set the hash value to INVALID */
-							hash_invalid_set(block->hash);
-						}
-
-						/* insert the block in the block array */
-						fs_allocate(disk, v_pos, deleted, v_idx);
-
-						/* go to next block */
-						++v_pos;
-						++v_idx;
-						--v_count;
-					}
-					break;
-				case 'O' :
-					/* go to the next run */
-					v_pos += v_count;
-					break;
-				default :
-					/* LCOV_EXCL_START */
-					decoding_error(path, f);
-					log_fatal("Invalid hole type!\n");
-					os_abort();
-					/* LCOV_EXCL_STOP */
-				}
-			}
-		} else if (c == 's') {
-			/* symlink */
-			char sub[PATH_MAX];
-			char linkto[PATH_MAX];
-			struct snapraid_link* slink;
-			struct snapraid_disk* disk;
-			uint32_t mapping;
-
-			ret = sgetb32(f, &mapping);
-			if (ret < 0 || mapping >= mapping_max) {
-				/* LCOV_EXCL_START */
-				decoding_error(path, f);
-				log_fatal("Internal inconsistency in mapping index!\n");
-				os_abort();
-				/* LCOV_EXCL_STOP */
-			}
-			disk = tommy_array_get(&disk_mapping, mapping);
-
-			ret = sgetbs(f, sub, sizeof(sub));
-			if (ret < 0) {
-				/* LCOV_EXCL_START */
-				decoding_error(path, f);
-				os_abort();
-				/* LCOV_EXCL_STOP */
-			}
-
-			if (!*sub) {
-				/* LCOV_EXCL_START */
-				decoding_error(path, f);
-				log_fatal("Internal inconsistency for null symlink!\n");
-				os_abort();
-				/* LCOV_EXCL_STOP */
-			}
-
-			ret = sgetbs(f, linkto, sizeof(linkto));
-			if (ret < 0) {
-				/* LCOV_EXCL_START */
-				decoding_error(path, f);
-				os_abort();
-				/* LCOV_EXCL_STOP */
-			}
-
-			/* allocate the link as symbolic link */
-			slink = link_alloc(sub, linkto, FILE_IS_SYMLINK);
-
-			/* insert the link in the link containers */
-			tommy_hashdyn_insert(&disk->linkset, &slink->nodeset, slink, link_name_hash(slink->sub));
-			tommy_list_insert_tail(&disk->linklist, &slink->nodelist, slink);
-
-			/* stat */
-			++count_symlink;
-		} else if (c == 'a') {
-			/* hardlink */
-			char sub[PATH_MAX];
-			char linkto[PATH_MAX];
-			struct snapraid_link* slink;
-			struct snapraid_disk* disk;
-			uint32_t mapping;
-
-			ret = sgetb32(f, &mapping);
-			if (ret < 0 || mapping >= mapping_max) {
-				/* LCOV_EXCL_START */
-				decoding_error(path, f);
-				log_fatal("Internal inconsistency in mapping index!\n");
-				os_abort();
-				/* LCOV_EXCL_STOP */
-			}
-			disk = tommy_array_get(&disk_mapping, mapping);
-
-			ret = sgetbs(f, sub, sizeof(sub));
-			if (ret < 0) {
-				/* LCOV_EXCL_START */
-				decoding_error(path, f);
-				os_abort();
-				/* LCOV_EXCL_STOP */
-			}
-
-			if (!*sub) {
-				/* LCOV_EXCL_START */
-				decoding_error(path, f);
-				log_fatal("Internal inconsistency for null hardlink!\n");
-				os_abort();
-				/* LCOV_EXCL_STOP */
-			}
-
-			ret = sgetbs(f, linkto, sizeof(linkto));
-			if (ret < 0) {
-				/* LCOV_EXCL_START */
-				decoding_error(path, f);
-				os_abort();
-				/* LCOV_EXCL_STOP */
-			}
-
-			if (!*linkto) {
-				/* LCOV_EXCL_START */
-				decoding_error(path, f);
-				log_fatal("Internal inconsistency for empty hardlink '%s'!\n", sub);
-				os_abort();
-				/* LCOV_EXCL_STOP */
-			}
-
-			/* allocate the link as hard link */
-			slink = link_alloc(sub, linkto, FILE_IS_HARDLINK);
-
-			/* insert the link in the link containers */
-			tommy_hashdyn_insert(&disk->linkset, &slink->nodeset, slink, link_name_hash(slink->sub));
-			tommy_list_insert_tail(&disk->linklist, &slink->nodelist, slink);
-
-			/* stat */
-			++count_hardlink;
-		} else if (c == 'r') {
-			/* dir */
-			char sub[PATH_MAX];
-			struct snapraid_dir* dir;
-			struct snapraid_disk* disk;
-			uint32_t mapping;
-
-			ret = sgetb32(f, &mapping);
-			if (ret < 0 || mapping >= mapping_max) {
-				/* LCOV_EXCL_START */
-				decoding_error(path, f);
-				log_fatal("Internal inconsistency in mapping index!\n");
-				os_abort();
-				/* LCOV_EXCL_STOP */
-			}
-			disk = tommy_array_get(&disk_mapping, mapping);
-
-			ret = sgetbs(f, sub, sizeof(sub));
-			if (ret < 0) {
-				/* LCOV_EXCL_START */
-				decoding_error(path, f);
-				os_abort();
-				/* LCOV_EXCL_STOP */
-			}
-
-			if (!*sub) {
-				/* LCOV_EXCL_START */
-				decoding_error(path, f);
-				log_fatal("Internal inconsistency for null dir!\n");
-				os_abort();
-				/* LCOV_EXCL_STOP */
-			}
-
-			/* allocate the dir */
-			dir = dir_alloc(sub);
-
-			/* insert the dir in the dir containers */
-			tommy_hashdyn_insert(&disk->dirset, &dir->nodeset, dir, dir_name_hash(dir->sub));
-			tommy_list_insert_tail(&disk->dirlist, &dir->nodelist, dir);
-
-			/* stat */
-			++count_dir;
 		} else if (c == 'c') {
 			/* get the subcommand */
 			c = sgetc(f);
@@ -2803,6 +3521,49 @@ static void state_read_content(struct snapraid_state* state, const char* path, S
 					}
 				}
 			}
+		} else if (c == 'X') {
+			/* index of the disk sections, already used before */
+			uint32_t v_count;
+			uint32_t v_mapping;
+			uint64_t v_offset;
+			uint64_t v_size;
+			uint32_t v_index_lo;
+			uint32_t v_index_hi;
+
+			ret = sgetb32(f, &v_count);
+			if (ret < 0) {
+				/* LCOV_EXCL_START */
+				decoding_error(path, f);
+				os_abort();
+				/* LCOV_EXCL_STOP */
+			}
+
+			while (v_count) {
+				ret = sgetb32(f, &v_mapping);
+				if (ret == 0)
+					ret = sgetb64(f, &v_offset);
+				if (ret == 0)
+					ret = sgetb64(f, &v_size);
+				if (ret < 0) {
+					/* LCOV_EXCL_START */
+					decoding_error(path, f);
+					os_abort();
+					/* LCOV_EXCL_STOP */
+				}
+
+				--v_count;
+			}
+
+			/* offset of the index */
+			ret = sgetble32(f, &v_index_lo);
+			if (ret == 0)
+				ret = sgetble32(f, &v_index_hi);
+			if (ret < 0) {
+				/* LCOV_EXCL_START */
+				decoding_error(path, f);
+				os_abort();
+				/* LCOV_EXCL_STOP */
+			}
 		} else if (c == 'N') {
 			uint32_t crc_stored;
 			uint32_t crc_computed;
@@ -2810,6 +3571,10 @@ static void state_read_content(struct snapraid_state* state, const char* path, S
 			/* get the crc before reading it from the file */
 			crc_computed = scrc(f);
 
+			/* after the disk sections, the stream has only the crc from there */
+			if (spartial(f))
+				crc_computed = crc32c_combine(crc_sections, crc_computed, stell(f) - offset_sections);
+
 			ret = sgetble32(f, &crc_stored);
 			if (ret < 0) {
 				/* LCOV_EXCL_START */
@@ -2829,6 +3594,9 @@ static void state_read_content(struct snapraid_state* state, const char* path, S
 				/* LCOV_EXCL_STOP */
 			}
 
+			/* identify the content file in the journal checkpoint */
+			state->content_crc = crc_stored;
+
 			crc_checked = 1;
 		} else {
 			/* LCOV_EXCL_START */
@@ -2840,6 +3608,13 @@ static void state_read_content(struct snapraid_state* state, const char* path, S
 	}
 
 	tommy_array_done(&disk_mapping);
+	free(section_map);
+
+	/* stat */
+	count_file += disk_context.count_file;
+	count_hardlink += disk_context.count_hardlink;
+	count_symlink += disk_context.count_symlink;
+	count_dir += disk_context.count_dir;
 
 	if (serror(f)) {
 		/* LCOV_EXCL_START */
@@ -2880,15 +3655,16 @@ static void state_read_content(struct snapraid_state* state, const char* path, S
 
 struct state_write_thread_context {
 	struct snapraid_state* state;
-#if HAVE_MT_WRITE
-	pthread_t thread;
-#endif
 	/* input */
 	block_off_t blockmax;
 	time_t info_oldest;
 	time_t info_now;
 	int info_has_rehash;
 	STREAM* f;
+	/* buffer */
+	unsigned char* blockvec; /**< Copy of the blocks of a file, used in background write. */
+	size_t blockvec_size;
+	struct state_section* section_map; /**< Sections of the disks. */
 	/* output */
 	uint32_t crc;
 	unsigned count_file;
@@ -2897,6 +3673,102 @@ struct state_write_thread_context {
 	unsigned count_dir;
 };
 
+/**
+ * Get the first position not yet touched by the sync.
+ *
+ * All the reads of the state done before are completed before reading
+ * the progress, and the sync sets the progress before changing the state.
+ * This ensures that a position read before and found lower than the
+ * progress is read with the value it had at the start of the write.
+ */
+static inline block_off_t state_write_progress_get(struct snapraid_state* state)
+{
+#if HAVE_PTHREAD
+	__atomic_thread_fence(__ATOMIC_SEQ_CST);
+	return __atomic_load_n(&state->write_progress, __ATOMIC_SEQ_CST);
+#else
+	return state->write_progress;
+#endif
+}
+
+/**
+ * Check if the position may have been changed by the sync after the start of the write.
+ */
+static inline int state_write_is_changing(struct snapraid_state* state, block_off_t pos)
+{
+	if (!state->write_background)
+		return 0;
+
+	return pos >= state->write_snapshot && pos < state_write_progress_get(state);
+}
+
+/**
+ * Get a block from a vector of blocks.
+ */
+static inline struct snapraid_block* state_write_block(unsigned char* blockvec, block_off_t idx)
+{
+	return (struct snapraid_block*)(blockvec + idx * block_sizeof());
+}
+
+/**
+ * Get the blocks of a file to write.
+ *
+ * In a background write, the blocks are first copied, and then the ones
+ * changed by the sync are saved as changed with an invalid hash, as their
+ * parity may be neither the old nor the new one.
+ */
+static unsigned char* state_write_blockvec(struct state_write_thread_context* context, struct snapraid_disk* disk, struct snapraid_file* file)
+{
+	struct snapraid_state* state = context->state;
+	block_off_t progress;
+	block_off_t idx;
+	size_t size;
+
+	if (!state->write_background)
+		return (unsigned char*)file->blockvec;
+
+	size = file->blockmax * block_sizeof();
+	if (size > context->blockvec_size) {
+		free(context->blockvec);
+		context->blockvec = malloc_nofail(size);
+		context->blockvec_size = size;
+	}
+
+	memcpy(context->blockvec, file->blockvec, size);
+
+	progress = state_write_progress_get(state);
+
+	for (idx = 0; idx < file->blockmax; ++idx) {
+		block_off_t pos = fs_file2par_get(disk, file, idx);
+
+		if (pos >= state->write_snapshot && pos < progress) {
+			struct snapraid_block* block = state_write_block(context->blockvec, idx);
+
+			block_state_set(block, BLOCK_STATE_CHG);
+			hash_invalid_set(block->hash);
+		}
+	}
+
+	return context->blockvec;
+}
+
+/**
+ * Get the info of a position to write.
+ *
+ * In a background write, the info changed by the sync is marked as bad,
+ * to have the position checked, as its parity may be neither the old
+ * nor the new one.
+ */
+static snapraid_info state_write_info_get(struct snapraid_state* state, block_off_t pos)
+{
+	snapraid_info info = info_get(&state->infoarr, pos);
+
+	if (info != 0 && state_write_is_changing(state, pos))
+		info = info_set_bad(info);
+
+	return info;
+}
+
 static void* state_write_thread(void* arg)
 {
 	struct state_write_thread_context* context = arg;
@@ -2911,6 +3783,8 @@ static void* state_write_thread(void* arg)
 	unsigned count_hardlink;
 	unsigned count_symlink;
 	unsigned count_dir;
+	unsigned count_section;
+	int64_t offset;
 	tommy_node* i;
 	block_off_t idx;
 	block_off_t begin;
@@ -2921,6 +3795,7 @@ static void* state_write_thread(void* arg)
 	count_hardlink = 0;
 	count_symlink = 0;
 	count_dir = 0;
+	count_section = 0;
 
 	/* check what version to use */
 	version = 2;
@@ -2931,8 +3806,23 @@ static void* state_write_thread(void* arg)
 	if (BLOCK_HASH_SIZE != 16)
 		version = 3;
 
+	/* with more than one disk, add the index of the disk sections */
+	/* to allow to read them concurrently */
+	for (i = state->disklist; i != 0; i = i->next) {
+		struct snapraid_disk* disk = i->data;
+		if (disk->mapping_idx >= 0)
+			++count_section;
+	}
+	if (count_section > 1) {
+		version = 4;
+		context->section_map = malloc_nofail(count_section * sizeof(struct state_section));
+	}
+	count_section = 0;
+
 	/* write header */
-	if (version == 3)
+	if (version == 4)
+		swrite("SNAPCNT4\n\3\0\0", 12, f);
+	else if (version == 3)
 		swrite("SNAPCNT3\n\3\0\0", 12, f);
 	else
 		swrite("SNAPCNT2\n\3\0\0", 12, f);
@@ -2944,7 +3834,7 @@ static void* state_write_thread(void* arg)
 	sputb32(blockmax, f);
 
 	/* hash size */
-	if (version == 3) {
+	if (version >= 3) {
 		sputc('y', f);
 		sputb32(BLOCK_HASH_SIZE, f);
 	}
@@ -3037,7 +3927,7 @@ static void* state_write_thread(void* arg)
 
 	/* for each parity */
 	for (l = 0; l < state->level; ++l) {
-		if (version == 3) {
+		if (version >= 3) {
 			sputc('Q', f);
 			sputb32(l, f);
 			sputb32(state->parity[l].total_blocks, f);
@@ -3072,6 +3962,9 @@ static void* state_write_thread(void* arg)
 		if (disk->mapping_idx < 0)
 			continue;
 
+		/* the section of the disk starts here */
+		offset = stell(f);
+
 		/* for each file */
 		for (j = disk->filelist; j != 0; j = j->next) {
 			struct snapraid_file* file = j->data;
@@ -3079,6 +3972,7 @@ static void* state_write_thread(void* arg)
 			uint64_t mtime_sec;
 			int32_t mtime_nsec;
 			uint64_t inode;
+			unsigned char* blockvec;
 
 			size = file->size;
 			mtime_sec = file->mtime_sec;
@@ -3104,9 +3998,10 @@ static void* state_write_thread(void* arg)
 			}
 
 			/* for all the blocks of the file */
+			blockvec = state_write_blockvec(context, disk, file);
 			begin = 0;
 			while (begin < file->blockmax) {
-				unsigned v_state = block_state_get(fs_file2block_get(file, begin));
+				unsigned v_state = block_state_get(state_write_block(blockvec, begin));
 				block_off_t v_pos = fs_file2par_get(disk, file, begin);
 				uint32_t v_count;
 
@@ -3115,7 +4010,7 @@ static void* state_write_thread(void* arg)
 				/* find the end of run of blocks */
 				end = begin + 1;
 				while (end < file->blockmax) {
-					if (v_state != block_state_get(fs_file2block_get(file, end)))
+					if (v_state != block_state_get(state_write_block(blockvec, end)))
 						break;
 					if (v_pos + (end - begin) != fs_file2par_get(disk, file, end))
 						break;
@@ -3146,7 +4041,7 @@ static void* state_write_thread(void* arg)
 
 				/* write hashes */
 				for (idx = begin; idx < end; ++idx) {
-					struct snapraid_block* block = fs_file2block_get(file, idx);
+					struct snapraid_block* block = state_write_block(blockvec, idx);
 
 					swrite(block->hash, BLOCK_HASH_SIZE, f);
 				}
@@ -3241,8 +4136,15 @@ static void* state_write_thread(void* arg)
 				/* write all the hash */
 				while (begin < end) {
 					struct snapraid_block* block = fs_par2block_get(disk, begin);
+					unsigned char hash[BLOCK_HASH_SIZE];
 
-					swrite(block->hash, BLOCK_HASH_SIZE, f);
+					memcpy(hash, block->hash, BLOCK_HASH_SIZE);
+
+					/* in a background write, a changed hash may be not the one in the parity */
+					if (state_write_is_changing(state, begin))
+						hash_invalid_set(hash);
+
+					swrite(hash, BLOCK_HASH_SIZE, f);
 
 					++begin;
 				}
@@ -3262,6 +4164,14 @@ static void* state_write_thread(void* arg)
 				/* LCOV_EXCL_STOP */
 			}
 		}
+
+		/* the section of the disk ends here */
+		if (version == 4) {
+			context->section_map[count_section].mapping = disk->mapping_idx;
+			context->section_map[count_section].offset = offset;
+			context->section_map[count_section].size = stell(f) - offset;
+			++count_section;
+		}
 	}
 
 	/* write the info for each block */
@@ -3274,12 +4184,12 @@ static void* state_write_thread(void* arg)
 		time_t t;
 		unsigned flag;
 
-		info = info_get(&state->infoarr, begin);
+		info = state_write_info_get(state, begin);
 
 		/* find the end of run of blocks */
 		end = begin + 1;
 		while (end < blockmax
-			&& info == info_get(&state->infoarr, end)
+			&& info == state_write_info_get(state, end)
 		) {
 			++end;
 		}
@@ -3327,6 +4237,30 @@ static void* state_write_thread(void* arg)
 		begin = end;
 	}
 
+	/* write the index of the disk sections */
+	if (version == 4) {
+		offset = stell(f);
+
+		sputc('X', f);
+		sputb32(count_section, f);
+		for (s = 0; s < count_section; ++s) {
+			sputb32(context->section_map[s].mapping, f);
+			sputb64(context->section_map[s].offset, f);
+			sputb64(context->section_map[s].size, f);
+		}
+
+		/* the offset of the index is at a fixed position from the end */
+		sputble32(offset & 0xFFFFFFFF, f);
+		sputble32(offset >> 32, f);
+
+		if (serror(f)) {
+			/* LCOV_EXCL_START */
+			log_fatal("Error writing the content file '%s'. %s.\n", serrorfile(f), strerror(errno));
+			return context;
+			/* LCOV_EXCL_STOP */
+		}
+	}
+
 	sputc('N', f);
 
 	/* flush data written to the disk */
@@ -3369,18 +4303,15 @@ static void* state_write_thread(void* arg)
 	return 0;
 }
 
-static void state_write_content(struct snapraid_state* state, uint32_t* out_crc)
+/**
+ * Prepare the state for writing.
+ *
+ * It clears the unused info and it maps the disks, so it must be called
+ * when nobody else is accessing the state.
+ */
+static struct state_write_thread_context* state_write_prepare(struct snapraid_state* state)
 {
-#if HAVE_MT_WRITE
-	int fail;
-	int first;
-#else
-	STREAM* f;
-	unsigned count_content;
-	unsigned k;
 	struct state_write_thread_context* context;
-	void* retval;
-#endif
 	tommy_node* i;
 	block_off_t blockmax;
 	time_t info_oldest;
@@ -3388,11 +4319,6 @@ static void state_write_content(struct snapraid_state* state, uint32_t* out_crc)
 	int info_has_rehash;
 	int mapping_idx;
 	block_off_t idx;
-	uint32_t crc;
-	unsigned count_file;
-	unsigned count_hardlink;
-	unsigned count_symlink;
-	unsigned count_dir;
 
 	/* blocks of all array */
 	blockmax = parity_allocated_size(state);
@@ -3455,133 +4381,42 @@ static void state_write_content(struct snapraid_state* state, uint32_t* out_crc)
 		}
 	}
 
-#if HAVE_MT_WRITE
-	/* start all writing threads */
-	i = tommy_list_head(&state->contentlist);
-	while (i) {
-		struct snapraid_content* content = i->data;
-		struct state_write_thread_context* context;
-		char tmp[PATH_MAX];
-		STREAM* f;
-
-		msg_progress("Saving state to %s...\n", content->content);
-
-		pathprint(tmp, sizeof(tmp), "%s.tmp", content->content);
-
-		/* ensure to delete a previous stale file */
-		if (remove(tmp) != 0) {
-			if (errno != ENOENT) {
-				/* LCOV_EXCL_START */
-				log_fatal("Error removing the stale content file '%s'. %s.\n", tmp, strerror(errno));
-				exit(EXIT_FAILURE);
-				/* LCOV_EXCL_STOP */
-			}
-		}
-
-		f = sopen_write(tmp);
-		if (f == 0) {
-			/* LCOV_EXCL_START */
-			log_fatal("Error opening the temporary content file '%s'. %s.\n", tmp, strerror(errno));
-			exit(EXIT_FAILURE);
-			/* LCOV_EXCL_STOP */
-		}
-
-		/* allocate the thread context */
-		context = malloc_nofail(sizeof(struct state_write_thread_context));
-		content->context = context;
-
-		/* initialize */
-		context->state = state;
-		context->blockmax = blockmax;
-		context->info_oldest = info_oldest;
-		context->info_now = info_now;
-		context->info_has_rehash = info_has_rehash;
-		context->f = f;
-
-		thread_create(&context->thread, 0, state_write_thread, context);
-
-		i = i->next;
-	}
-
-	/* join all thread */
-	fail = 0;
-	first = 1;
-	crc = 0;
-	count_file = 0;
-	count_hardlink = 0;
-	count_symlink = 0;
-	count_dir = 0;
-	i = tommy_list_head(&state->contentlist);
-	while (i) {
-		struct snapraid_content* content = i->data;
-		struct state_write_thread_context* context = content->context;
-		void* retval;
-
-		thread_join(context->thread, &retval);
-
-		if (retval) {
-			/* LCOV_EXCL_START */
-			fail = 1;
-			/* LCOV_EXCL_STOP */
-		} else {
-			STREAM* f = context->f;
-
-			/* Use the sequence fflush() -> fsync() -> fclose() -> rename() to ensure */
-			/* than even in a system crash event we have one valid copy of the file. */
-			if (sflush(f) != 0) {
-				/* LCOV_EXCL_START */
-				log_fatal("Error writing the content file '%s', in flush(). %s.\n", serrorfile(f), strerror(errno));
-				exit(EXIT_FAILURE);
-				/* LCOV_EXCL_STOP */
-			}
-
-#if HAVE_FSYNC
-			if (ssync(f) != 0) {
-				/* LCOV_EXCL_START */
-				log_fatal("Error writing the content file '%s' in sync(). %s.\n", serrorfile(f), strerror(errno));
-				exit(EXIT_FAILURE);
-				/* LCOV_EXCL_STOP */
-			}
-#endif
-
-			if (sclose(f) != 0) {
-				/* LCOV_EXCL_START */
-				log_fatal("Error closing the content file. %s.\n", strerror(errno));
-				exit(EXIT_FAILURE);
-				/* LCOV_EXCL_STOP */
-			}
+	/* allocate the thread context */
+	context = malloc_nofail(sizeof(struct state_write_thread_context));
 
-			if (first) {
-				first = 0;
-				crc = context->crc;
-				count_file = context->count_file;
-				count_hardlink = context->count_hardlink;
-				count_symlink = context->count_symlink;
-				count_dir = context->count_dir;
-			} else {
-				if (crc != context->crc) {
-					/* LCOV_EXCL_START */
-					log_fatal("Different CRCs writing content streams.\n");
-					log_fatal("DANGER! Your RAM memory is broken! DO NOT PROCEED UNTIL FIXED!\n");
-					log_fatal("Try running a memory test like http://www.memtest86.com/\n");
-					exit(EXIT_FAILURE);
-					/* LCOV_EXCL_STOP */
-				}
-			}
-		}
+	/* initialize */
+	context->state = state;
+	context->blockmax = blockmax;
+	context->info_oldest = info_oldest;
+	context->info_now = info_now;
+	context->info_has_rehash = info_has_rehash;
+	context->f = 0;
+	context->blockvec = 0;
+	context->blockvec_size = 0;
+	context->section_map = 0;
 
-		free(context);
+	return context;
+}
 
-		i = i->next;
-	}
+/**
+ * Write all the content files.
+ *
+ * The context is released.
+ */
+static void state_write_content(struct state_write_thread_context* context, uint32_t* out_crc)
+{
+	struct snapraid_state* state = context->state;
+	STREAM* f;
+	unsigned count_content;
+	unsigned k;
+	void* retval;
+	tommy_node* i;
+	uint32_t crc;
+	unsigned count_file;
+	unsigned count_hardlink;
+	unsigned count_symlink;
+	unsigned count_dir;
 
-	/* abort on failure */
-	if (fail) {
-		/* LCOV_EXCL_START */
-		exit(EXIT_FAILURE);
-		/* LCOV_EXCL_STOP */
-	}
-#else
 	/* count the content files */
 	count_content = 0;
 	i = tommy_list_head(&state->contentlist);
@@ -3629,15 +4464,6 @@ static void state_write_content(struct snapraid_state* state, uint32_t* out_crc)
 		i = i->next;
 	}
 
-	/* allocate the thread context */
-	context = malloc_nofail(sizeof(struct state_write_thread_context));
-
-	/* initialize */
-	context->state = state;
-	context->blockmax = blockmax;
-	context->info_oldest = info_oldest;
-	context->info_now = info_now;
-	context->info_has_rehash = info_has_rehash;
 	context->f = f;
 
 	retval = state_write_thread(context);
@@ -3680,8 +4506,9 @@ static void state_write_content(struct snapraid_state* state, uint32_t* out_crc)
 	count_symlink = context->count_symlink;
 	count_dir = context->count_dir;
 
+	free(context->blockvec);
+	free(context->section_map);
 	free(context);
-#endif
 
 	msg_verbose("%8u files\n", count_file);
 	msg_verbose("%8u hardlinks\n", count_hardlink);
@@ -3791,6 +4618,11 @@ void state_read(struct snapraid_state* state)
 		node = node->next;
 	}
 
+#if HAVE_HASHSTORE
+	if (state->hashstore)
+		state_read_hashstore(state, path, f, st.st_size);
+#endif
+
 	/* start with a undefined default. */
 	/* it's for compatibility with version 1.0 where MD5 was implicit. */
 	state->hash = HASH_UNDEFINED;
@@ -3835,6 +4667,9 @@ void state_read(struct snapraid_state* state)
 
 	state_content_check(state, path);
 
+	/* get the position in the journal of the changes not yet scanned */
+	journal_checkpoint_read(state);
+
 	/* mark that we read the content file, and it passed all the checks */
 	state->checked_read = 1;
 }
@@ -4061,10 +4896,14 @@ static void state_rename_content(struct snapraid_state* state)
 
 void state_write(struct snapraid_state* state)
 {
+	struct state_write_thread_context* context;
 	uint32_t crc;
 
+	/* prepare the state */
+	context = state_write_prepare(state);
+
 	/* write all the content files */
-	state_write_content(state, &crc);
+	state_write_content(context, &crc);
 
 	/* verify the just written files */
 	state_verify_content(state, crc);
@@ -4072,10 +4911,138 @@ void state_write(struct snapraid_state* state)
 	/* rename the new files, over the old ones */
 	state_rename_content(state);
 
+#if HAVE_HASHSTORE
+	/* save the hashes matching the new files */
+	if (state->hashstore)
+		state_write_hashstore(state, crc);
+#endif
+
+	/* save the position in the journal of the changes already scanned */
+	state->content_crc = crc;
+	journal_checkpoint_write(state);
+
 	state->need_write = 0; /* no write needed anymore */
 	state->checked_read = 0; /* what we wrote is not checked in read */
 }
 
+struct state_write_background_context {
+	struct snapraid_state* state;
+	struct snapraid_parity_handle* parity_handle;
+	struct state_write_thread_context* write;
+	int ret;
+#if HAVE_PTHREAD
+	pthread_t thread;
+#endif
+};
+
+static void* state_write_background_thread(void* arg)
+{
+	struct state_write_background_context* context = arg;
+	struct snapraid_state* state = context->state;
+	uint32_t crc;
+	unsigned l;
+
+	/* before writing the new content file we ensure that */
+	/* the parity is really written flushing the disk cache */
+	for (l = 0; l < state->level; ++l) {
+		if (parity_sync(&context->parity_handle[l]) == -1) {
+			/* LCOV_EXCL_START */
+			log_tag("parity_error:%u:%s: Sync error\n", state->write_snapshot, lev_config_name(l));
+			log_fatal("DANGER! Unexpected sync error in %s disk.\n", lev_name(l));
+			log_fatal("Ensure that disk '%s' is sane.\n", lev_config_name(l));
+			free(context->write);
+			context->ret = -1;
+			return context;
+			/* LCOV_EXCL_STOP */
+		}
+	}
+
+	/* write all the content files */
+	state_write_content(context->write, &crc);
+
+	/* verify the just written files */
+	state_verify_content(state, crc);
+
+	/* rename the new files, over the old ones */
+	state_rename_content(state);
+
+	/* save the position in the journal of the changes already scanned */
+	state->content_crc = crc;
+	journal_checkpoint_write(state);
+
+	context->ret = 0;
+	return 0;
+}
+
+void state_write_background_begin(struct snapraid_state* state, struct snapraid_parity_handle* parity_handle, block_off_t blockstart)
+{
+	struct state_write_background_context* context;
+
+	context = malloc_nofail(sizeof(struct state_write_background_context));
+	context->state = state;
+	context->parity_handle = parity_handle;
+	context->ret = 0;
+
+	/* prepare the state in this thread, as it changes it */
+	context->write = state_write_prepare(state);
+
+	/* ensure that the sync doesn't need to grow the info vector */
+	/* while the background write is reading it */
+	tommy_arrayblkof_grow(&state->infoarr, context->write->blockmax);
+
+	state->write_snapshot = blockstart;
+	state->write_progress = blockstart;
+	state->write_context = context;
+
+#if HAVE_PTHREAD
+	state->write_background = 1;
+
+	thread_create(&context->thread, 0, state_write_background_thread, context);
+#else
+	state_write_background_thread(context);
+#endif
+}
+
+void state_write_background_progress(struct snapraid_state* state, block_off_t blockcur)
+{
+	if (!state->write_background)
+		return;
+
+#if HAVE_PTHREAD
+	__atomic_store_n(&state->write_progress, blockcur + 1, __ATOMIC_SEQ_CST);
+
+	/* the next changes of the state must happen after the progress is visible */
+	__atomic_thread_fence(__ATOMIC_SEQ_CST);
+#else
+	state->write_progress = blockcur + 1;
+#endif
+}
+
+int state_write_background_end(struct snapraid_state* state)
+{
+	struct state_write_background_context* context = state->write_context;
+	int ret;
+
+	if (!context)
+		return 0;
+
+#if HAVE_PTHREAD
+	thread_join(context->thread, 0);
+#endif
+
+	ret = context->ret;
+
+	free(context);
+
+	state->write_background = 0;
+	state->write_context = 0;
+
+	/* the state is still changed by the sync, so it still needs a write */
+	state->checked_read = 0; /* what we wrote is not checked in read */
+
+	return ret;
+}
+
 void state_skip(struct snapraid_state* state)
 {
 	tommy_node* i;
@@ -4401,6 +5368,15 @@ static void state_progress_graph(struct snapraid_state* state, struct snapraid_i
 		printc(' ', 5 + pad + 1 + bar / 2 - strlen(legend) / 2);
 		printf("%s", legend);
 		printf("\n");
+
+		printf("\n");
+
+		/* files opened and reused from the descriptor cache */
+		for (i = state->disklist; i != 0; i = i->next) {
+			struct snapraid_disk* disk = i->data;
+			printr(disk->name, pad);
+			printf("%8" PRIu64 " opened, %8" PRIu64 " reused\n", disk->open_count, disk->open_cached);
+		}
 	}
 
 	printf("\n");
@@ -22,6 +22,7 @@
 
 struct snapraid_handle;
 struct snapraid_io;
+struct snapraid_parity_handle;
 
 /****************************************************************************/
 /* parity level */
@@ -29,15 +30,15 @@ struct snapraid_io;
 /**
  * Max level of parity supported.
  */
-#define LEV_MAX 6
+#define LEV_MAX 8
 
 /**
- * Return the parity name: Parity, 2-Parity, 3-Parity, 4-Parity, 5-Parity, 6-Parity.
+ * Return the parity name: Parity, 2-Parity, 3-Parity, ..., 8-Parity.
  */
 const char* lev_name(unsigned level);
 
 /**
- * Return the parity name used in the config file: parity, 2-parity, 3-parity, 4-parity, 5-parity, 6-parity.
+ * Return the parity name used in the config file: parity, 2-parity, 3-parity, ..., 8-parity.
  */
 const char* lev_config_name(unsigned level);
 
@@ -76,6 +77,7 @@ struct snapraid_option {
 	int badonly; /**< In fix, fixes only the blocks marked as bad. */
 	int syncedonly; /**< In fix, fixes only files that are synced. */
 	int prehash; /**< Enables the prehash mode for sync. */
+	int delta_update; /**< Enables the incremental parity update for sync. */
 	unsigned io_error_limit; /**< Max number of input/output errors before aborting. */
 	int force_zero; /**< Forced dangerous operations of syncing files now with zero size. */
 	int force_empty; /**< Forced dangerous operations of syncing disks now empty. */
@@ -115,6 +117,10 @@ struct snapraid_option {
 	int match_first_uuid; /**< Force the matching of the first UUID. */
 	int force_parity_update; /**< Force parity update even if data is not changed. */
 	unsigned io_cache; /**< Number of IO buffers to use. 0 for default. */
+	unsigned io_uring; /**< Queue depth per device for the io_uring mode. 0 to disable. */
+	int io_physical; /**< Read the blocks of every disk in physical order. */
+	unsigned raid_thread; /**< Number of threads for the RAID computation. 0 for default. */
+	int scan_uring; /**< Use io_uring to read the stat info in the scan. */
 	int auto_conf; /**< Allow to run without configuration file. */
 	int force_stats; /**< Force stats print during process. */
 	uint64_t parity_limit_size; /**< Test limit for parity files. */
@@ -124,6 +130,9 @@ struct snapraid_state {
 	struct snapraid_option opt; /**< Setup options. */
 	int filter_hidden; /**< Filter out hidden files. */
 	uint64_t autosave; /**< Autosave after the specified amount of data. 0 to disable. */
+	int hashstore; /**< Save the block hashes in a file memory mapped at loading. */
+	int bgsave; /**< Write the autosave in background, while the sync continues. */
+	unsigned scan_thread; /**< Number of threads reading the directories of each disk. */
 	int need_write; /**< If the state is changed. */
 	int checked_read; /**< If the state was read and checked. */
 	uint32_t block_size; /**< Block size in bytes. */
@@ -136,6 +145,10 @@ struct snapraid_state {
 	unsigned char hashseed[HASH_MAX]; /**< Hash seed. Just after a uint64 to provide a minimal alignment. */
 	unsigned char prevhashseed[HASH_MAX]; /**< Previous hash seed. In case of rehash. */
 	char lockfile[PATH_MAX]; /**< Path of the lock file to use. */
+	char journalfile[PATH_MAX]; /**< Path of the change journal. */
+	uint64_t journal_id; /**< ID of the watcher that wrote the journal. 0 if unknown. */
+	uint64_t journal_pos; /**< Position in the journal of the changes not yet scanned. */
+	uint32_t content_crc; /**< CRC of the content file read or written. */
 	unsigned level; /**< Number of parity levels. 1 for PAR1, 2 for PAR2. */
 	unsigned hash; /**< Hash kind used. */
 	unsigned prevhash; /**< Previous hash kind used.  In case of rehash. */
@@ -188,6 +201,18 @@ struct snapraid_state {
 	int progress_tick; /**< Number of measures done. */
 
 	int no_conf; /**< Automatically add missing info. Used to load content without a configuration file. */
+
+	/**
+	 * Background write of the state.
+	 *
+	 * The positions in the range [write_snapshot, write_progress) may be
+	 * changed by the sync while the state is written, and they are saved
+	 * as not synced.
+	 */
+	int write_background; /**< If a background write is running. */
+	block_off_t write_snapshot; /**< First position not yet synced when the write started. */
+	block_off_t write_progress; /**< First position not yet touched by the sync. Accessed atomically. */
+	void* write_context; /**< Context of the background write. */
 };
 
 /**
@@ -215,6 +240,35 @@ void state_read(struct snapraid_state* state);
  */
 void state_write(struct snapraid_state* state);
 
+/**
+ * Start writing the new state in background.
+ *
+ * The parity is flushed with parity_sync() before writing the content
+ * files, and all of this happens in a separate thread.
+ *
+ * Meanwhile the caller can continue the sync from the specified position,
+ * calling state_write_background_progress() before changing the state
+ * of any position, and deferring any block deallocation after
+ * state_write_background_end().
+ *
+ * Without thread support, the state is written before returning.
+ */
+void state_write_background_begin(struct snapraid_state* state, struct snapraid_parity_handle* parity_handle, block_off_t blockstart);
+
+/**
+ * Mark the position that is going to be changed by the sync.
+ *
+ * The positions must be increasing.
+ */
+void state_write_background_progress(struct snapraid_state* state, block_off_t blockcur);
+
+/**
+ * Wait the end of the background write.
+ *
+ * \return 0 on success, -1 if the flush of the parity failed and the state was not written.
+ */
+int state_write_background_end(struct snapraid_state* state);
+
 /**
  * Diff all the disks.
  */
@@ -225,6 +279,13 @@ int state_diff(struct snapraid_state* state);
  */
 void state_scan(struct snapraid_state* state);
 
+/**
+ * Relocate the files to compact the parity.
+ * The parity is then updated by the sync.
+ * \param blockcount Max number of blocks to relocate. 0 for no limit.
+ */
+void state_compact(struct snapraid_state* state, block_off_t blockcount);
+
 /**
  * Set the nanosecond timestamp of all files that have a zero value.
  */
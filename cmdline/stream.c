@@ -26,6 +26,44 @@
 
 unsigned STREAM_SIZE = 64 * 1024;
 
+#if HAVE_PTHREAD
+/**
+ * Number of buffers used to write multiple files.
+ *
+ * While one buffer is filled, the others are written by the threads.
+ */
+#define STREAM_FANOUT_MAX 8
+
+struct stream_fanout_thread {
+	struct stream_fanout* fanout;
+	unsigned index; /**< Index of the handle to write. */
+	int f; /**< Handle to write. */
+	unsigned done; /**< Number of buffers written. */
+	pthread_t thread;
+};
+
+/**
+ * Concurrent write of the same buffers in multiple files.
+ *
+ * The buffers are queued in order, and each thread writes all of them in
+ * its file. A buffer is retired only when all the threads have written it,
+ * and only then its CRC is computed, as it happens with a single file.
+ */
+struct stream_fanout {
+	pthread_mutex_t mutex;
+	pthread_cond_t cond; /**< Signaled at every change of the state. */
+	unsigned char* buffer[STREAM_FANOUT_MAX];
+	size_t size[STREAM_FANOUT_MAX];
+	unsigned head; /**< Number of buffers queued. */
+	unsigned tail; /**< Number of buffers retired. */
+	int exit; /**< Exit condition for all threads. */
+	int error_index; /**< Index of the first handle with a write error. -1 if none. */
+	int error_errno; /**< The errno of the write error. */
+	unsigned thread_max;
+	struct stream_fanout_thread* thread_map;
+};
+#endif
+
 STREAM* sopen_read(const char* file)
 {
 #if HAVE_POSIX_FADVISE
@@ -63,6 +101,7 @@ STREAM* sopen_read(const char* file)
 	}
 #endif
 
+	s->fanout = 0;
 	s->buffer = malloc_nofail_test(STREAM_SIZE);
 	s->pos = s->buffer;
 	s->end = s->buffer;
@@ -70,6 +109,7 @@ STREAM* sopen_read(const char* file)
 	s->state_index = 0;
 	s->offset = 0;
 	s->offset_uncached = 0;
+	s->partial = 0;
 	s->crc = 0;
 	s->crc_uncached = 0;
 	s->crc_stream = CRC_IV;
@@ -89,6 +129,7 @@ STREAM* sopen_multi_write(unsigned count)
 	for (i = 0; i < count; ++i)
 		s->handle[i].f = -1;
 
+	s->fanout = 0;
 	s->buffer = malloc_nofail_test(STREAM_SIZE);
 	s->pos = s->buffer;
 	s->end = s->buffer + STREAM_SIZE;
@@ -96,6 +137,7 @@ STREAM* sopen_multi_write(unsigned count)
 	s->state_index = 0;
 	s->offset = 0;
 	s->offset_uncached = 0;
+	s->partial = 0;
 	s->crc = 0;
 	s->crc_uncached = 0;
 	s->crc_stream = CRC_IV;
@@ -153,6 +195,228 @@ STREAM* sopen_write(const char* file)
 	return s;
 }
 
+#if HAVE_PTHREAD
+static void* sfanout_thread(void* arg)
+{
+	struct stream_fanout_thread* thread = arg;
+	struct stream_fanout* fanout = thread->fanout;
+
+	thread_mutex_lock(&fanout->mutex);
+
+	while (1) {
+		unsigned char* buffer;
+		size_t size;
+		ssize_t ret;
+
+		/* wait for a new buffer */
+		while (!fanout->exit && thread->done == fanout->head)
+			thread_cond_wait(&fanout->cond, &fanout->mutex);
+
+		/* exit only when all the buffers are written */
+		if (thread->done == fanout->head)
+			break;
+
+		buffer = fanout->buffer[thread->done % STREAM_FANOUT_MAX];
+		size = fanout->size[thread->done % STREAM_FANOUT_MAX];
+
+		thread_mutex_unlock(&fanout->mutex);
+
+		ret = write(thread->f, buffer, size);
+
+		thread_mutex_lock(&fanout->mutex);
+
+		if (ret != (ssize_t)size && fanout->error_index < 0) {
+			/* LCOV_EXCL_START */
+			fanout->error_index = thread->index;
+			fanout->error_errno = errno;
+			/* LCOV_EXCL_STOP */
+		}
+
+		++thread->done;
+
+		thread_cond_broadcast(&fanout->cond);
+	}
+
+	thread_mutex_unlock(&fanout->mutex);
+
+	return 0;
+}
+
+/**
+ * Start the writing threads, one for each file.
+ */
+static void sfanout_init(STREAM* s)
+{
+	struct stream_fanout* fanout;
+	unsigned i;
+
+	fanout = malloc_nofail(sizeof(struct stream_fanout));
+
+	thread_mutex_init(&fanout->mutex, 0);
+	thread_cond_init(&fanout->cond, 0);
+
+	/* the current buffer is the first one */
+	fanout->buffer[0] = s->buffer;
+	for (i = 1; i < STREAM_FANOUT_MAX; ++i)
+		fanout->buffer[i] = malloc_nofail_test(STREAM_SIZE);
+
+	fanout->head = 0;
+	fanout->tail = 0;
+	fanout->exit = 0;
+	fanout->error_index = -1;
+	fanout->error_errno = 0;
+
+	fanout->thread_max = s->handle_size;
+	fanout->thread_map = malloc_nofail(s->handle_size * sizeof(struct stream_fanout_thread));
+	for (i = 0; i < s->handle_size; ++i) {
+		struct stream_fanout_thread* thread = &fanout->thread_map[i];
+
+		thread->fanout = fanout;
+		thread->index = i;
+		thread->f = s->handle[i].f;
+		thread->done = 0;
+
+		thread_create(&thread->thread, 0, sfanout_thread, thread);
+	}
+
+	s->fanout = fanout;
+}
+
+/**
+ * Stop the writing threads, after they have written all the queued buffers.
+ */
+static void sfanout_done(STREAM* s)
+{
+	struct stream_fanout* fanout = s->fanout;
+	unsigned i;
+
+	thread_mutex_lock(&fanout->mutex);
+	fanout->exit = 1;
+	thread_cond_broadcast_and_unlock(&fanout->cond, &fanout->mutex);
+
+	for (i = 0; i < fanout->thread_max; ++i) {
+		void* retval;
+
+		thread_join(fanout->thread_map[i].thread, &retval);
+	}
+
+	/* keep only the current buffer, freed with the stream */
+	for (i = 0; i < STREAM_FANOUT_MAX; ++i) {
+		if (fanout->buffer[i] != s->buffer)
+			free(fanout->buffer[i]);
+	}
+
+	thread_cond_destroy(&fanout->cond);
+	thread_mutex_destroy(&fanout->mutex);
+
+	free(fanout->thread_map);
+	free(fanout);
+
+	s->fanout = 0;
+}
+
+/**
+ * Return the number of buffers written by all the threads.
+ *
+ * It must be called with the mutex locked.
+ */
+static unsigned sfanout_written(struct stream_fanout* fanout)
+{
+	unsigned written = fanout->head;
+	unsigned i;
+
+	for (i = 0; i < fanout->thread_max; ++i) {
+		/* use the difference to support the wrap around of the counters */
+		if (fanout->thread_map[i].done - fanout->tail < written - fanout->tail)
+			written = fanout->thread_map[i].done;
+	}
+
+	return written;
+}
+
+/**
+ * Queue the current buffer for writing, and wait until no more than
+ * the specified number of buffers are still pending.
+ */
+static int sfanout_flush(STREAM* s, unsigned pending)
+{
+	struct stream_fanout* fanout;
+	size_t size;
+	int error_index;
+	int error_errno;
+
+	if (!s->fanout)
+		sfanout_init(s);
+
+	fanout = s->fanout;
+
+	size = s->pos - s->buffer;
+
+	thread_mutex_lock(&fanout->mutex);
+
+	/* queue the current buffer */
+	if (size != 0) {
+		fanout->size[fanout->head % STREAM_FANOUT_MAX] = size;
+		++fanout->head;
+
+		thread_cond_broadcast(&fanout->cond);
+	}
+
+	/* retire the written buffers */
+	while (fanout->head - fanout->tail > pending) {
+		unsigned char* buffer;
+
+		if (sfanout_written(fanout) == fanout->tail) {
+			thread_cond_wait(&fanout->cond, &fanout->mutex);
+			continue;
+		}
+
+		buffer = fanout->buffer[fanout->tail % STREAM_FANOUT_MAX];
+		size = fanout->size[fanout->tail % STREAM_FANOUT_MAX];
+
+		thread_mutex_unlock(&fanout->mutex);
+
+		/*
+		 * Update the crc *after* writing the data.
+		 *
+		 * Like in sflush(), to be able to detect memory errors
+		 * on the buffer, happening during the write.
+		 */
+		s->crc = crc32c(s->crc, buffer, size);
+		s->crc_uncached = s->crc;
+
+		/* update the offset */
+		s->offset += size;
+		s->offset_uncached = s->offset;
+
+		thread_mutex_lock(&fanout->mutex);
+
+		++fanout->tail;
+	}
+
+	error_index = fanout->error_index;
+	error_errno = fanout->error_errno;
+
+	thread_mutex_unlock(&fanout->mutex);
+
+	if (error_index >= 0) {
+		/* LCOV_EXCL_START */
+		errno = error_errno;
+		s->state = STREAM_STATE_ERROR;
+		s->state_index = error_index;
+		return EOF;
+		/* LCOV_EXCL_STOP */
+	}
+
+	/* continue with the next free buffer */
+	s->buffer = fanout->buffer[fanout->head % STREAM_FANOUT_MAX];
+	s->pos = s->buffer;
+	s->end = s->buffer + STREAM_SIZE;
+
+	return 0;
+}
+#endif
+
 int sclose(STREAM* s)
 {
 	int fail = 0;
@@ -166,6 +430,11 @@ int sclose(STREAM* s)
 		}
 	}
 
+#if HAVE_PTHREAD
+	if (s->fanout)
+		sfanout_done(s);
+#endif
+
 	for (i = 0; i < s->handle_size; ++i) {
 		if (close(s->handle[i].f) != 0) {
 			/* LCOV_EXCL_START */
@@ -289,6 +558,11 @@ int sflush(STREAM* s)
 		/* LCOV_EXCL_STOP */
 	}
 
+#if HAVE_PTHREAD
+	if (s->handle_size > 1)
+		return sfanout_flush(s, 0);
+#endif
+
 	size = s->pos - s->buffer;
 	if (!size)
 		return 0;
@@ -324,14 +598,98 @@ int sflush(STREAM* s)
 	return 0;
 }
 
+int sflush_queue(STREAM* s)
+{
+#if HAVE_PTHREAD
+	if (s->state == STREAM_STATE_WRITE && s->handle_size > 1)
+		return sfanout_flush(s, STREAM_FANOUT_MAX - 1);
+#endif
+
+	return sflush(s);
+}
+
 int64_t stell(STREAM* s)
 {
-	return s->offset_uncached + (s->pos - s->buffer);
+	int64_t offset = s->offset_uncached;
+
+#if HAVE_PTHREAD
+	/* include the buffers queued, but not yet retired */
+	if (s->fanout) {
+		struct stream_fanout* fanout = s->fanout;
+		unsigned i;
+
+		for (i = fanout->tail; i != fanout->head; ++i)
+			offset += fanout->size[i % STREAM_FANOUT_MAX];
+	}
+#endif
+
+	return offset + (s->pos - s->buffer);
+}
+
+int sseek(STREAM* s, int64_t offset)
+{
+	if (s->state != STREAM_STATE_READ && s->state != STREAM_STATE_EOF) {
+		/* LCOV_EXCL_START */
+		return EOF;
+		/* LCOV_EXCL_STOP */
+	}
+
+	if (lseek(s->handle[0].f, offset, SEEK_SET) != offset) {
+		/* LCOV_EXCL_START */
+		s->state = STREAM_STATE_ERROR;
+		return EOF;
+		/* LCOV_EXCL_STOP */
+	}
+
+	s->state = STREAM_STATE_READ;
+	s->pos = s->buffer;
+	s->end = s->buffer;
+	s->offset = offset;
+	s->offset_uncached = offset;
+	s->partial = 1;
+	s->crc = 0;
+	s->crc_uncached = 0;
+
+	return 0;
+}
+
+int sskip(STREAM* s, uint64_t size)
+{
+	while (size != 0) {
+		uint64_t run;
+
+		/* if at the end of the buffer, fill it */
+		if (s->pos == s->end && sfill(s) != 0)
+			return EOF;
+
+		run = s->end - s->pos;
+		if (run > size)
+			run = size;
+
+		s->pos += run;
+		size -= run;
+	}
+
+	return 0;
 }
 
 uint32_t scrc(STREAM*s)
 {
-	return crc32c(s->crc_uncached, s->buffer, s->pos - s->buffer);
+	uint32_t crc = s->crc_uncached;
+
+#if HAVE_PTHREAD
+	/* include the buffers queued, but not yet retired */
+	/* note that the queue is changed only by this thread */
+	if (s->fanout) {
+		struct stream_fanout* fanout = s->fanout;
+		unsigned i;
+
+		for (i = fanout->tail; i != fanout->head; ++i)
+			crc = crc32c(crc, fanout->buffer[i % STREAM_FANOUT_MAX], fanout->size[i % STREAM_FANOUT_MAX]);
+	}
+#endif
+
+	return crc32c(crc, s->buffer, s->pos - s->buffer);
 }
 
 uint32_t scrc_stream(STREAM*s)
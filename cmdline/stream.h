@@ -48,8 +48,10 @@ struct stream {
 	int state_index; /**< Index of the handle causing a state change. */
 	unsigned handle_size; /**< Number of handles. */
 	struct stream_handle* handle; /**< Set of handles. */
+	struct stream_fanout* fanout; /**< Writing threads for multiple handles. 0 if not used. */
 	off_t offset; /**< Offset into the file. */
 	off_t offset_uncached; /**< Offset into the file excluding the cached data. */
+	int partial; /**< If the stream was moved with sseek(), and the CRC covers only the data after it. */
 
 	/**
 	 * CRC of the data read or written in the file.
@@ -109,6 +111,10 @@ STREAM* sopen_write(const char* file);
 
 /**
  * Open a set of streams for writing. Like fopen("w").
+ *
+ * The data is written only once in the stream buffer, and the CRC
+ * is computed only once. If threads are available, the buffers are
+ * then written concurrently in all the files.
  */
 STREAM* sopen_multi_write(unsigned count);
 
@@ -137,15 +143,37 @@ int sdeplete(STREAM* s, unsigned char* last);
 
 /**
  * Flush the write stream buffer.
+ * All the data is written in the files when it returns.
  * \return 0 on success, or EOF on error.
  */
 int sflush(STREAM* s);
 
+/**
+ * Queue the write stream buffer for writing, and get an empty one.
+ * The data may be still not written in the files when it returns.
+ * \return 0 on success, or EOF on error.
+ */
+int sflush_queue(STREAM* s);
+
 /**
  * Get the file pointer.
  */
 int64_t stell(STREAM* s);
 
+/**
+ * Move the read stream to the specified offset.
+ * After it, the CRC of the stream is computed only from this offset.
+ * \return 0 on success, or EOF on error.
+ */
+int sseek(STREAM* s, int64_t offset);
+
+/**
+ * Skip data from the read stream.
+ * The skipped data is still included in the CRC.
+ * \return 0 on success, or EOF on error.
+ */
+int sskip(STREAM* s, uint64_t size);
+
 /**
  * Get the CRC of the processed data.
  */
@@ -188,6 +216,14 @@ static inline int serror(STREAM* s)
 	return s->state == STREAM_STATE_ERROR;
 }
 
+/**
+ * Check if the CRC covers only part of the file, after a sseek().
+ */
+static inline int spartial(STREAM* s)
+{
+	return s->partial;
+}
+
 /**
  * Check the eof status. Like feof().
  */
@@ -348,7 +384,7 @@ int sgetbs(STREAM* f, char* str, int size);
 static inline int sputc(int c, STREAM* s)
 {
 	if (s->pos == s->end) {
-		if (sflush(s) != 0)
+		if (sflush_queue(s) != 0)
 			return -1;
 	}
 
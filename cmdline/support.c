@@ -1005,23 +1005,17 @@ int advise_open(struct advise_struct* advise, int f)
 	return 0;
 }
 
-int advise_write(struct advise_struct* advise, int f, data_off_t offset, data_off_t size)
+/**
+ * Get the operations to do after a write, updating the dirty range.
+ */
+static void advise_write_op(struct advise_struct* advise, data_off_t offset, data_off_t size, struct advise_op* op)
 {
-	data_off_t flush_offset;
-	data_off_t flush_size;
-	data_off_t discard_offset;
-	data_off_t discard_size;
-
-	(void)f;
-	(void)flush_offset;
-	(void)flush_size;
-	(void)discard_offset;
-	(void)discard_size;
-
-	flush_offset = 0;
-	flush_size = 0;
-	discard_offset = 0;
-	discard_size = 0;
+	op->flush_offset = 0;
+	op->flush_size = 0;
+	op->discard_offset = 0;
+	op->discard_size = 0;
+	op->drop_offset = 0;
+	op->drop_size = 0;
 
 	/*
 	 * Follow Linus recommendations about fast writes.
@@ -1078,12 +1072,12 @@ int advise_write(struct advise_struct* advise, int f, data_off_t offset, data_of
 
 	switch (advise->mode) {
 	case ADVISE_FLUSH :
-		flush_offset = offset;
-		flush_size = size;
+		op->flush_offset = offset;
+		op->flush_size = size;
 		break;
 	case ADVISE_DISCARD :
-		discard_offset = offset;
-		discard_size = size;
+		op->discard_offset = offset;
+		op->discard_size = size;
 		break;
 	case ADVISE_FLUSH_WINDOW :
 		/* if the dirty range can be extended */
@@ -1094,16 +1088,16 @@ int advise_write(struct advise_struct* advise, int f, data_off_t offset, data_of
 			/* if we reached the window size */
 			if (advise->dirty_end - advise->dirty_begin >= ADVISE_WINDOW_SIZE) {
 				/* flush the window  */
-				flush_offset = advise->dirty_begin;
-				flush_size = ADVISE_WINDOW_SIZE;
+				op->flush_offset = advise->dirty_begin;
+				op->flush_size = ADVISE_WINDOW_SIZE;
 
 				/* remove it from the dirty range */
 				advise->dirty_begin += ADVISE_WINDOW_SIZE;
 			}
 		} else {
 			/* otherwise flush the existing dirty */
-			flush_offset = advise->dirty_begin;
-			flush_size = advise->dirty_end - advise->dirty_begin;
+			op->flush_offset = advise->dirty_begin;
+			op->flush_size = advise->dirty_end - advise->dirty_begin;
 
 			/* and set the new range as dirty */
 			advise->dirty_begin = offset;
@@ -1119,20 +1113,20 @@ int advise_write(struct advise_struct* advise, int f, data_off_t offset, data_of
 			/* if we reached the double window size */
 			if (advise->dirty_end - advise->dirty_begin >= 2 * ADVISE_WINDOW_SIZE) {
 				/* discard the first window */
-				discard_offset = advise->dirty_begin;
-				discard_size = ADVISE_WINDOW_SIZE;
+				op->discard_offset = advise->dirty_begin;
+				op->discard_size = ADVISE_WINDOW_SIZE;
 
 				/* remove it from the dirty range */
 				advise->dirty_begin += ADVISE_WINDOW_SIZE;
 
 				/* flush the second window */
-				flush_offset = advise->dirty_begin;
-				flush_size = ADVISE_WINDOW_SIZE;
+				op->flush_offset = advise->dirty_begin;
+				op->flush_size = ADVISE_WINDOW_SIZE;
 			}
 		} else {
 			/* otherwise discard the existing dirty */
-			discard_offset = advise->dirty_begin;
-			discard_size = advise->dirty_end - advise->dirty_begin;
+			op->discard_offset = advise->dirty_begin;
+			op->discard_size = advise->dirty_end - advise->dirty_begin;
 
 			/* and set the new range as dirty */
 			advise->dirty_begin = offset;
@@ -1140,13 +1134,22 @@ int advise_write(struct advise_struct* advise, int f, data_off_t offset, data_of
 		}
 		break;
 	}
+}
+
+/**
+ * Do the operations on the file.
+ */
+static int advise_apply(int f, struct advise_op* op)
+{
+	(void)f;
+	(void)op;
 
 #if HAVE_SYNC_FILE_RANGE
-	if (flush_size != 0) {
+	if (op->flush_size != 0) {
 		int ret;
 
 		/* start writing immediately */
-		ret = sync_file_range(f, flush_offset, flush_size, SYNC_FILE_RANGE_WRITE);
+		ret = sync_file_range(f, op->flush_offset, op->flush_size, SYNC_FILE_RANGE_WRITE);
 		if (ret != 0) {
 			/* LCOV_EXCL_START */
 			return -1;
@@ -1156,11 +1159,11 @@ int advise_write(struct advise_struct* advise, int f, data_off_t offset, data_of
 #endif
 
 #if HAVE_SYNC_FILE_RANGE && HAVE_POSIX_FADVISE
-	if (discard_size != 0) {
+	if (op->discard_size != 0) {
 		int ret;
 
 		/* send the data to the disk and wait until it's written */
-		ret = sync_file_range(f, discard_offset, discard_size, SYNC_FILE_RANGE_WAIT_BEFORE | SYNC_FILE_RANGE_WRITE | SYNC_FILE_RANGE_WAIT_AFTER);
+		ret = sync_file_range(f, op->discard_offset, op->discard_size, SYNC_FILE_RANGE_WAIT_BEFORE | SYNC_FILE_RANGE_WRITE | SYNC_FILE_RANGE_WAIT_AFTER);
 		if (ret != 0) {
 			/* LCOV_EXCL_START */
 			return -1;
@@ -1168,7 +1171,7 @@ int advise_write(struct advise_struct* advise, int f, data_off_t offset, data_of
 		}
 
 		/* flush the data from the cache */
-		ret = posix_fadvise(f, discard_offset, discard_size, POSIX_FADV_DONTNEED);
+		ret = posix_fadvise(f, op->discard_offset, op->discard_size, POSIX_FADV_DONTNEED);
 		/* for POSIX_FADV_DONTNEED we don't allow failure with ENOSYS */
 		if (ret != 0) {
 			/* LCOV_EXCL_START */
@@ -1179,24 +1182,12 @@ int advise_write(struct advise_struct* advise, int f, data_off_t offset, data_of
 	}
 #endif
 
-	return 0;
-}
-
-int advise_read(struct advise_struct* advise, int f, data_off_t offset, data_off_t size)
-{
-	(void)advise;
-	(void)f;
-	(void)offset;
-	(void)size;
-
 #if HAVE_POSIX_FADVISE
-	if (advise->mode == ADVISE_DISCARD
-		|| advise->mode == ADVISE_DISCARD_WINDOW
-	) {
+	if (op->drop_size != 0) {
 		int ret;
 
 		/* flush the data from the cache */
-		ret = posix_fadvise(f, offset, size, POSIX_FADV_DONTNEED);
+		ret = posix_fadvise(f, op->drop_offset, op->drop_size, POSIX_FADV_DONTNEED);
 		/* for POSIX_FADV_DONTNEED we don't allow failure with ENOSYS */
 		if (ret != 0) {
 			/* LCOV_EXCL_START */
@@ -1207,6 +1198,38 @@ int advise_read(struct advise_struct* advise, int f, data_off_t offset, data_off
 	}
 #endif
 
+	return 0;
+}
+
+int advise_write(struct advise_struct* advise, int f, data_off_t offset, data_off_t size)
+{
+	struct advise_op op;
+
+	advise_write_op(advise, offset, size, &op);
+
+	return advise_apply(f, &op);
+}
+
+/**
+ * Get the operations to do after a read.
+ */
+static void advise_read_op(struct advise_struct* advise, data_off_t offset, data_off_t size, struct advise_op* op)
+{
+	op->flush_offset = 0;
+	op->flush_size = 0;
+	op->discard_offset = 0;
+	op->discard_size = 0;
+	op->drop_offset = 0;
+	op->drop_size = 0;
+
+	if (advise->mode == ADVISE_DISCARD
+		|| advise->mode == ADVISE_DISCARD_WINDOW
+	) {
+		/* flush the data from the cache */
+		op->drop_offset = offset;
+		op->drop_size = size;
+	}
+
 	/*
 	 * Here we cannot call posix_fadvise(..., POSIX_FADV_WILLNEED) for the next block
 	 * because it may be blocking.
@@ -1244,8 +1267,85 @@ int advise_read(struct advise_struct* advise, int f, data_off_t offset, data_off
 	 * has access to kill a particular readahead request, etc.
 	 * ---
 	 */
+}
 
-	return 0;
+int advise_read(struct advise_struct* advise, int f, data_off_t offset, data_off_t size)
+{
+	struct advise_op op;
+
+	advise_read_op(advise, offset, size, &op);
+
+	return advise_apply(f, &op);
+}
+
+/****************************************************************************/
+/* defer */
+
+void defer_init(struct defer_struct* defer)
+{
+	defer->state = DEFER_NONE;
+	defer->advise_f = -1;
+}
+
+void defer_set(struct defer_struct* defer, int is_write, int f, struct advise_struct* advise, unsigned char* buffer, unsigned size, unsigned min_size, data_off_t offset)
+{
+	defer_clear(defer);
+
+	defer->state = DEFER_QUEUED;
+	defer->is_write = is_write;
+	defer->f = f;
+	defer->buffer = buffer;
+	defer->size = size;
+	defer->min_size = min_size;
+	defer->offset = offset;
+	defer->result = 0;
+
+	/* the dirty range of the advise is updated now, in the order of the requests */
+	if (is_write)
+		advise_write_op(advise, offset, size, &defer->advise_op);
+	else
+		advise_read_op(advise, offset, size, &defer->advise_op);
+
+	if (defer->advise_op.flush_size == 0
+		&& defer->advise_op.discard_size == 0
+		&& defer->advise_op.drop_size == 0)
+		return;
+
+	/* the file may be closed before the completion, so keep our own handle */
+	defer->advise_f = dup(f);
+	if (defer->advise_f == -1) {
+		/* LCOV_EXCL_START */
+		/* without a handle, advise now, as in the synchronous mode */
+		if (advise_apply(f, &defer->advise_op) != 0)
+			log_fatal("WARNING! Error advising a file. %s.\n", strerror(errno));
+		/* LCOV_EXCL_STOP */
+	}
+}
+
+void defer_clear(struct defer_struct* defer)
+{
+	defer->state = DEFER_NONE;
+
+	if (defer->advise_f != -1) {
+		close(defer->advise_f);
+		defer->advise_f = -1;
+	}
+}
+
+int defer_advise(struct defer_struct* defer)
+{
+	int ret;
+
+	defer->state = DEFER_NONE;
+
+	if (defer->advise_f == -1)
+		return 0;
+
+	ret = advise_apply(defer->advise_f, &defer->advise_op);
+
+	defer_clear(defer);
+
+	return ret;
 }
 
 /****************************************************************************/
@@ -359,6 +359,74 @@ int advise_open(struct advise_struct* advise, int f);
 int advise_write(struct advise_struct* advise, int f, data_off_t offset, data_off_t size);
 int advise_read(struct advise_struct* advise, int f, data_off_t offset, data_off_t size);
 
+/**
+ * Operations to do on a file after a read or a write.
+ */
+struct advise_op {
+	data_off_t flush_offset; /**< Range to start writing. */
+	data_off_t flush_size;
+	data_off_t discard_offset; /**< Range to write, and to remove from the cache. */
+	data_off_t discard_size;
+	data_off_t drop_offset; /**< Range to remove from the cache. */
+	data_off_t drop_size;
+};
+
+/****************************************************************************/
+/* defer */
+
+#define DEFER_NONE 0 /**< No request. */
+#define DEFER_QUEUED 1 /**< Request stored and not yet completed. */
+#define DEFER_COMPLETED 2 /**< Request completed, but result not yet checked. */
+
+/**
+ * Deferred read/write request.
+ *
+ * If a file handle has a defer struct associated, the read and write
+ * functions only validate the request and store it here, leaving
+ * to the owner of the struct the execution of the real I/O.
+ */
+struct defer_struct {
+	int state; /**< State of the request. One of the DEFER_*. */
+	int is_write; /**< If it's a write request. */
+	int f; /**< Handle of the file. */
+	int advise_f; /**< Duplicated handle of the file for the advise, or -1 if nothing to advise. */
+	struct advise_op advise_op; /**< Advise to do when the request completes. */
+	unsigned char* buffer; /**< Buffer to read or write. */
+	unsigned size; /**< Size of the request. */
+	unsigned min_size; /**< Minimum size to consider the request completed. The rest is padded with 0. */
+	data_off_t offset; /**< Offset in the file. */
+	int result; /**< Number of bytes transferred, or negated errno. */
+};
+
+/**
+ * Initialize the request, without any request stored.
+ */
+void defer_init(struct defer_struct* defer);
+
+/**
+ * Store a request.
+ *
+ * The advise of the file is computed now, and done at the completion
+ * with defer_advise(). If something has to be done, the file handle is
+ * duplicated, to keep it valid even if the file is closed before.
+ */
+void defer_set(struct defer_struct* defer, int is_write, int f, struct advise_struct* advise, unsigned char* buffer, unsigned size, unsigned min_size, data_off_t offset);
+
+/**
+ * Remove the request, without doing its advise.
+ */
+void defer_clear(struct defer_struct* defer);
+
+/**
+ * Do the advise of a completed request, and remove it.
+ *
+ * It's the deferred counterpart of the advise_read() and advise_write()
+ * calls done after a synchronous read or write.
+ *
+ * \return 0 on success, or -1 on error with errno set.
+ */
+int defer_advise(struct defer_struct* defer);
+
 /****************************************************************************/
 /* memory */
 
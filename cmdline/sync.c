@@ -24,18 +24,242 @@
 #include "handle.h"
 #include "io.h"
 #include "raid/raid.h"
+#include "raidmt.h"
 
 /****************************************************************************/
 /* hash */
 
+/**
+ * Hash plan to use.
+ */
+struct snapraid_hash_plan {
+	unsigned handle_max;
+	struct snapraid_handle* handle_map;
+};
+
+/**
+ * Check if the block has to be hashed.
+ *
+ * Only REP and CHG blocks are processed.
+ */
+static int block_is_hashable(struct snapraid_block* block)
+{
+	unsigned block_state = block_state_get(block);
+
+	return block_state == BLOCK_STATE_REP || block_state == BLOCK_STATE_CHG;
+}
+
+/**
+ * Check if we have to process the specified block index ::i.
+ */
+static int hash_block_is_enabled(void* void_plan, block_off_t i)
+{
+	struct snapraid_hash_plan* plan = void_plan;
+	unsigned j;
+
+	for (j = 0; j < plan->handle_max; ++j) {
+		struct snapraid_disk* disk = plan->handle_map[j].disk;
+
+		/* if no disk, nothing to check */
+		if (!disk)
+			continue;
+
+		if (block_is_hashable(fs_par2block_find(disk, i)))
+			return 1;
+	}
+
+	return 0;
+}
+
+/**
+ * Read the block of a file for the task, setting the task state.
+ *
+ * It's shared by the readers of the pre-hash and of the sync. The file
+ * open and changed checks are the same, and they differ only on read
+ * errors.
+ *
+ * \param eio_continue If an input/output read error allows to continue,
+ *   skipping the block, or it stops the process.
+ */
+static void sync_file_reader(struct snapraid_worker* worker, struct snapraid_task* task, int eio_continue)
+{
+	struct snapraid_io* io = worker->io;
+	struct snapraid_state* state = io->state;
+	struct snapraid_handle* handle = worker->handle;
+	struct snapraid_disk* disk = handle->disk;
+	block_off_t blockcur = task->position;
+	unsigned char* buffer = task->buffer;
+	int ret;
+	char esc_buffer[ESC_MAX];
+
+	/* get the file of this block */
+	task->file = fs_par2file_get_cursor(disk, &worker->cursor, blockcur, &task->file_pos);
+
+	/* if the file is different than the current one, close it */
+	if (handle->file != 0 && handle->file != task->file) {
+		/* keep a pointer at the file we are going to close for error reporting */
+		struct snapraid_file* report = handle->file;
+		ret = handle_close(handle);
+		if (ret == -1) {
+			/* LCOV_EXCL_START */
+			/* This one is really an unexpected error, because we are only reading */
+			/* and closing a descriptor should never fail */
+			if (errno == EIO) {
+				log_tag("error:%u:%s:%s: Close EIO error. %s\n", blockcur, disk->name, esc_tag(report->sub, esc_buffer), strerror(errno));
+				log_fatal("DANGER! Unexpected input/output close error in a data disk, it isn't possible to sync.\n");
+				log_fatal("Ensure that disk '%s' is sane and that file '%s' can be accessed.\n", disk->dir, handle->path);
+				log_fatal("Stopping at block %u\n", blockcur);
+				task->state = TASK_STATE_IOERROR;
+				return;
+			}
+
+			log_tag("error:%u:%s:%s: Close error. %s\n", blockcur, disk->name, esc_tag(report->sub, esc_buffer), strerror(errno));
+			log_fatal("WARNING! Unexpected close error in a data disk, it isn't possible to sync.\n");
+			log_fatal("Ensure that file '%s' can be accessed.\n", handle->path);
+			log_fatal("Stopping at block %u\n", blockcur);
+			task->state = TASK_STATE_ERROR;
+			return;
+			/* LCOV_EXCL_STOP */
+		}
+	}
+
+	ret = handle_open(handle, task->file, state->file_mode, log_error, 0);
+	if (ret == -1) {
+		if (errno == EIO) {
+			/* LCOV_EXCL_START */
+			log_tag("error:%u:%s:%s: Open EIO error. %s\n", blockcur, disk->name, esc_tag(task->file->sub, esc_buffer), strerror(errno));
+			log_fatal("DANGER! Unexpected input/output open error in a data disk, it isn't possible to sync.\n");
+			log_fatal("Ensure that disk '%s' is sane and that file '%s' can be accessed.\n", disk->dir, handle->path);
+			log_fatal("Stopping at block %u\n", blockcur);
+			task->state = TASK_STATE_IOERROR;
+			return;
+			/* LCOV_EXCL_STOP */
+		}
+
+		if (errno == ENOENT) {
+			log_tag("error:%u:%s:%s: Open ENOENT error. %s\n", blockcur, disk->name, esc_tag(task->file->sub, esc_buffer), strerror(errno));
+			log_error("Missing file '%s'.\n", handle->path);
+			log_error("WARNING! You cannot modify data disk during a sync.\n");
+			log_error("Rerun the sync command when finished.\n");
+			/* if the file is missing, it means that it was removed during sync */
+			/* this isn't a serious error, so we skip this block, and continue with others */
+			task->state = TASK_STATE_ERROR_CONTINUE;
+			return;
+		}
+
+		if (errno == EACCES) {
+			log_tag("error:%u:%s:%s: Open EACCES error. %s\n", blockcur, disk->name, esc_tag(task->file->sub, esc_buffer), strerror(errno));
+			log_error("No access at file '%s'.\n", handle->path);
+			log_error("WARNING! Please fix the access permission in the data disk.\n");
+			log_error("Rerun the sync command when finished.\n");
+			/* this isn't a serious error, so we skip this block, and continue with others */
+			task->state = TASK_STATE_ERROR_CONTINUE;
+			return;
+		}
+
+		/* LCOV_EXCL_START */
+		log_tag("error:%u:%s:%s: Open error. %s\n", blockcur, disk->name, esc_tag(task->file->sub, esc_buffer), strerror(errno));
+		log_fatal("WARNING! Unexpected open error in a data disk, it isn't possible to sync.\n");
+		log_fatal("Ensure that file '%s' can be accessed.\n", handle->path);
+		log_fatal("Stopping to allow recovery. Try with 'snapraid check -f /%s'\n", fmt_poll(disk, task->file->sub, esc_buffer));
+		task->state = TASK_STATE_ERROR;
+		return;
+		/* LCOV_EXCL_STOP */
+	}
+
+	/* check if the file is changed */
+	if (handle->st.st_size != task->file->size
+		|| handle->st.st_mtime != task->file->mtime_sec
+		|| STAT_NSEC(&handle->st) != task->file->mtime_nsec
+		|| handle->st.st_ino != task->file->inode
+	) {
+		log_tag("error:%u:%s:%s: Unexpected attribute change\n", blockcur, disk->name, esc_tag(task->file->sub, esc_buffer));
+		if (handle->st.st_size != task->file->size) {
+			log_error("Unexpected size change at file '%s' from %" PRIu64 " to %" PRIu64 ".\n", handle->path, task->file->size, (uint64_t)handle->st.st_size);
+		} else if (handle->st.st_mtime != task->file->mtime_sec
+			|| STAT_NSEC(&handle->st) != task->file->mtime_nsec) {
+			log_error("Unexpected time change at file '%s' from %" PRIu64 ".%d to %" PRIu64 ".%d.\n", handle->path, task->file->mtime_sec, task->file->mtime_nsec, (uint64_t)handle->st.st_mtime, STAT_NSEC(&handle->st));
+		} else {
+			log_error("Unexpected inode change from %" PRIu64 " to %" PRIu64 " at file '%s'.\n", task->file->inode, (uint64_t)handle->st.st_ino, handle->path);
+		}
+		log_error("WARNING! You cannot modify files during a sync.\n");
+		log_error("Rerun the sync command when finished.\n");
+		/* if the file is changed, it means that it was modified during sync */
+		/* this isn't a serious error, so we skip this block, and continue with others */
+		task->state = TASK_STATE_ERROR_CONTINUE;
+		return;
+	}
+
+	task->read_size = handle_read(handle, task->file_pos, buffer, state->block_size, eio_continue ? log_error : log_fatal, 0);
+	if (task->read_size == -1) {
+		/* LCOV_EXCL_START */
+		if (errno == EIO) {
+			log_tag("error:%u:%s:%s: Read EIO error at position %u. %s\n", blockcur, disk->name, esc_tag(task->file->sub, esc_buffer), task->file_pos, strerror(errno));
+			if (eio_continue) {
+				log_error("Input/Output error in file '%s' at position '%u'\n", handle->path, task->file_pos);
+				task->state = TASK_STATE_IOERROR_CONTINUE;
+				return;
+			}
+			log_fatal("DANGER! Unexpected input/output read error in a data disk, it isn't possible to sync.\n");
+			log_fatal("Ensure that disk '%s' is sane and that file '%s' can be read.\n", disk->dir, handle->path);
+			log_fatal("Stopping at block %u\n", blockcur);
+			task->state = TASK_STATE_IOERROR;
+			return;
+		}
+
+		log_tag("error:%u:%s:%s: Read error at position %u. %s\n", blockcur, disk->name, esc_tag(task->file->sub, esc_buffer), task->file_pos, strerror(errno));
+		log_fatal("WARNING! Unexpected read error in a data disk, it isn't possible to sync.\n");
+		log_fatal("Ensure that file '%s' can be read.\n", handle->path);
+		log_fatal("Stopping to allow recovery. Try with 'snapraid check -f /%s'\n", fmt_poll(disk, task->file->sub, esc_buffer));
+		task->state = TASK_STATE_ERROR;
+		return;
+		/* LCOV_EXCL_STOP */
+	}
+
+	/* store the path of the opened file */
+	pathcpy(task->path, sizeof(task->path), handle->path);
+
+	/* hash the data in the worker thread, if enabled */
+	io_data_hash(worker, task);
+
+	task->state = TASK_STATE_DONE;
+}
+
+static void hash_data_reader(struct snapraid_worker* worker, struct snapraid_task* task)
+{
+	struct snapraid_handle* handle = worker->handle;
+	struct snapraid_disk* disk = handle->disk;
+	block_off_t blockcur = task->position;
+	struct snapraid_block* block;
+
+	/* if the disk position is not used */
+	if (!disk) {
+		task->state = TASK_STATE_DONE;
+		return;
+	}
+
+	block = fs_par2block_find_cursor(disk, &worker->cursor, blockcur);
+
+	/* if the block doesn't need the hash, skip it */
+	if (!block_is_hashable(block)) {
+		task->state = TASK_STATE_DONE;
+		return;
+	}
+
+	/* set the block only for the ones to hash */
+	task->block = block;
+
+	sync_file_reader(worker, task, 0);
+}
+
 static int state_hash_process(struct snapraid_state* state, block_off_t blockstart, block_off_t blockmax, int* skip_sync)
 {
+	struct snapraid_io io;
+	struct snapraid_hash_plan plan;
 	struct snapraid_handle* handle;
 	unsigned diskmax;
-	block_off_t i;
+	block_off_t blockcur;
 	unsigned j;
-	void* buffer;
-	void* buffer_alloc;
 	data_off_t countsize;
 	block_off_t countpos;
 	block_off_t countmax;
@@ -43,15 +267,20 @@ static int state_hash_process(struct snapraid_state* state, block_off_t blocksta
 	unsigned error;
 	unsigned silent_error;
 	unsigned io_error;
+	unsigned* waiting_map;
+	unsigned waiting_mac;
 	char esc_buffer[ESC_MAX];
 
 	/* maps the disks to handles */
 	handle = handle_mapping(state, &diskmax);
 
-	/* buffer for reading */
-	buffer = malloc_nofail_direct(state->block_size, &buffer_alloc);
-	if (!state->opt.skip_self)
-		mtest_vector(1, state->block_size, &buffer);
+	/* initialize the io threads, with only data readers */
+	/* all the disks are read in parallel, and the hash computed by the workers */
+	io_init(&io, state, state->opt.io_cache, diskmax, hash_data_reader, handle, diskmax, 0, 0, 0, 0);
+
+	/* possibly waiting disks */
+	waiting_mac = diskmax > RAID_PARITY_MAX ? diskmax : RAID_PARITY_MAX;
+	waiting_map = malloc_nofail(waiting_mac * sizeof(unsigned));
 
 	error = 0;
 	silent_error = 0;
@@ -66,197 +295,125 @@ static int state_hash_process(struct snapraid_state* state, block_off_t blocksta
 		if (!disk)
 			continue;
 
-		for (i = blockstart; i < blockmax; ++i) {
-			struct snapraid_block* block;
-			unsigned block_state;
-
-			block = fs_par2block_find(disk, i);
-
-			/* get the state of the block */
-			block_state = block_state_get(block);
-
-			/* process REP and CHG blocks */
-			if (block_state != BLOCK_STATE_REP && block_state != BLOCK_STATE_CHG)
+		for (blockcur = blockstart; blockcur < blockmax; ++blockcur) {
+			if (!block_is_hashable(fs_par2block_find(disk, blockcur)))
 				continue;
 
 			++countmax;
 		}
 	}
 
+	plan.handle_max = diskmax;
+	plan.handle_map = handle;
+
 	/* drop until now */
 	state_usage_waste(state);
 
 	countsize = 0;
 	countpos = 0;
+
+	/* start all the worker threads */
+	io_start(&io, blockstart, blockmax, &hash_block_is_enabled, &plan);
+
 	if (!state_progress_begin(state, blockstart, blockmax, countmax))
 		goto end;
 
-	for (j = 0; j < diskmax; ++j) {
-		struct snapraid_disk* disk = handle[j].disk;
+	while (1) {
+		snapraid_info info;
+		int rehash;
+		void** buffer;
 
-		/* if no disk, nothing to check */
-		if (!disk)
-			continue;
+		/* go to the next block */
+		blockcur = io_read_next(&io, &buffer);
+		if (blockcur >= blockmax)
+			break;
 
-		for (i = blockstart; i < blockmax; ++i) {
-			snapraid_info info;
-			int rehash;
-			struct snapraid_block* block;
+		/* until now is scheduling */
+		state_usage_sched(state);
+
+		/* get block specific info */
+		info = info_get(&state->infoarr, blockcur);
+
+		/* if we have to use the old hash */
+		rehash = info_get_rehash(info);
+
+		/* for each disk, process the block */
+		for (j = 0; j < diskmax; ++j) {
+			struct snapraid_task* task;
 			int read_size;
 			unsigned char hash[HASH_MAX];
+			struct snapraid_block* block;
 			unsigned block_state;
+			struct snapraid_disk* disk;
 			struct snapraid_file* file;
 			block_off_t file_pos;
+			unsigned diskcur;
 
-			block = fs_par2block_find(disk, i);
+			/* until now is misc */
+			state_usage_misc(state);
 
-			/* get the state of the block */
-			block_state = block_state_get(block);
+			task = io_data_read(&io, &diskcur, waiting_map, &waiting_mac);
 
-			/* process REP and CHG blocks */
-			if (block_state != BLOCK_STATE_REP && block_state != BLOCK_STATE_CHG)
-				continue;
+			/* until now is disk */
+			state_usage_disk(state, handle, waiting_map, waiting_mac);
 
-			/* get the file of this block */
-			file = fs_par2file_get(disk, i, &file_pos);
+			/* get the results */
+			disk = task->disk;
+			block = task->block;
+			file = task->file;
+			file_pos = task->file_pos;
+			read_size = task->read_size;
 
-			/* get block specific info */
-			info = info_get(&state->infoarr, i);
+			/* if the disk position is not used */
+			if (!disk)
+				continue;
 
-			/* if we have to use the old hash */
-			rehash = info_get_rehash(info);
-
-			/* until now is misc */
-			state_usage_misc(state);
-
-			/* if the file is different than the current one, close it */
-			if (handle[j].file != 0 && handle[j].file != file) {
-				/* keep a pointer at the file we are going to close for error reporting */
-				struct snapraid_file* report = handle[j].file;
-				ret = handle_close(&handle[j]);
-				if (ret == -1) {
-					/* LCOV_EXCL_START */
-					/* This one is really an unexpected error, because we are only reading */
-					/* and closing a descriptor should never fail */
-					if (errno == EIO) {
-						log_tag("error:%u:%s:%s: Close EIO error. %s\n", i, disk->name, esc_tag(report->sub, esc_buffer), strerror(errno));
-						log_fatal("DANGER! Unexpected input/output close error in a data disk, it isn't possible to sync.\n");
-						log_fatal("Ensure that disk '%s' is sane and that file '%s' can be accessed.\n", disk->dir, handle[j].path);
-						log_fatal("Stopping at block %u\n", i);
-						++io_error;
-						goto bail;
-					}
+			/* if the block doesn't need the hash */
+			if (!block)
+				continue;
 
-					log_tag("error:%u:%s:%s: Close error. %s\n", i, disk->name, esc_tag(report->sub, esc_buffer), strerror(errno));
-					log_fatal("WARNING! Unexpected close error in a data disk, it isn't possible to sync.\n");
-					log_fatal("Ensure that file '%s' can be accessed.\n", handle[j].path);
-					log_fatal("Stopping at block %u\n", i);
-					++error;
-					goto bail;
-					/* LCOV_EXCL_STOP */
-				}
+			/* handle error conditions */
+			if (task->state == TASK_STATE_IOERROR) {
+				/* LCOV_EXCL_START */
+				++io_error;
+				goto bail;
+				/* LCOV_EXCL_STOP */
 			}
-
-			ret = handle_open(&handle[j], file, state->file_mode, log_error, 0);
-			if (ret == -1) {
-				if (errno == EIO) {
-					/* LCOV_EXCL_START */
-					log_tag("error:%u:%s:%s: Open EIO error. %s\n", i, disk->name, esc_tag(file->sub, esc_buffer), strerror(errno));
-					log_fatal("DANGER! Unexpected input/output open error in a data disk, it isn't possible to sync.\n");
-					log_fatal("Ensure that disk '%s' is sane and that file '%s' can be accessed.\n", disk->dir, handle[j].path);
-					log_fatal("Stopping at block %u\n", i);
-					++io_error;
-					goto bail;
-					/* LCOV_EXCL_STOP */
-				}
-
-				if (errno == ENOENT) {
-					log_tag("error:%u:%s:%s: Open ENOENT error. %s\n", i, disk->name, esc_tag(file->sub, esc_buffer), strerror(errno));
-					log_error("Missing file '%s'.\n", handle[j].path);
-					log_error("WARNING! You cannot modify data disk during a sync.\n");
-					log_error("Rerun the sync command when finished.\n");
-					++error;
-					/* if the file is missing, it means that it was removed during sync */
-					/* this isn't a serious error, so we skip this block, and continue with others */
-					continue;
-				}
-
-				if (errno == EACCES) {
-					log_tag("error:%u:%s:%s: Open EACCES error. %s\n", i, disk->name, esc_tag(file->sub, esc_buffer), strerror(errno));
-					log_error("No access at file '%s'.\n", handle[j].path);
-					log_error("WARNING! Please fix the access permission in the data disk.\n");
-					log_error("Rerun the sync command when finished.\n");
-					++error;
-					/* this isn't a serious error, so we skip this block, and continue with others */
-					continue;
-				}
-
+			if (task->state == TASK_STATE_ERROR) {
 				/* LCOV_EXCL_START */
-				log_tag("error:%u:%s:%s: Open error. %s\n", i, disk->name, esc_tag(file->sub, esc_buffer), strerror(errno));
-				log_fatal("WARNING! Unexpected open error in a data disk, it isn't possible to sync.\n");
-				log_fatal("Ensure that file '%s' can be accessed.\n", handle[j].path);
-				log_fatal("Stopping to allow recovery. Try with 'snapraid check -f /%s'\n", fmt_poll(disk, file->sub, esc_buffer));
 				++error;
 				goto bail;
 				/* LCOV_EXCL_STOP */
 			}
-
-			/* check if the file is changed */
-			if (handle[j].st.st_size != file->size
-				|| handle[j].st.st_mtime != file->mtime_sec
-				|| STAT_NSEC(&handle[j].st) != file->mtime_nsec
-				|| handle[j].st.st_ino != file->inode
-			) {
-				log_tag("error:%u:%s:%s: Unexpected attribute change\n", i, disk->name, esc_tag(file->sub, esc_buffer));
-				if (handle[j].st.st_size != file->size) {
-					log_error("Unexpected size change at file '%s' from %" PRIu64 " to %" PRIu64 ".\n", handle[j].path, file->size, (uint64_t)handle[j].st.st_size);
-				} else if (handle[j].st.st_mtime != file->mtime_sec
-					|| STAT_NSEC(&handle[j].st) != file->mtime_nsec) {
-					log_error("Unexpected time change at file '%s' from %" PRIu64 ".%d to %" PRIu64 ".%d.\n", handle[j].path, file->mtime_sec, file->mtime_nsec, (uint64_t)handle[j].st.st_mtime, STAT_NSEC(&handle[j].st));
-				} else {
-					log_error("Unexpected inode change from %" PRIu64 " to %" PRIu64 " at file '%s'.\n", file->inode, (uint64_t)handle[j].st.st_ino, handle[j].path);
-				}
-				log_error("WARNING! You cannot modify files during a sync.\n");
-				log_error("Rerun the sync command when finished.\n");
+			if (task->state == TASK_STATE_ERROR_CONTINUE) {
 				++error;
-				/* if the file is changed, it means that it was modified during sync */
-				/* this isn't a serious error, so we skip this block, and continue with others */
 				continue;
 			}
-
-			read_size = handle_read(&handle[j], file_pos, buffer, state->block_size, log_fatal, 0);
-			if (read_size == -1) {
+			if (task->state != TASK_STATE_DONE) {
 				/* LCOV_EXCL_START */
-				if (errno == EIO) {
-					log_tag("error:%u:%s:%s: Read EIO error at position %u. %s\n", i, disk->name, esc_tag(file->sub, esc_buffer), file_pos, strerror(errno));
-					log_fatal("DANGER! Unexpected input/output read error in a data disk, it isn't possible to sync.\n");
-					log_fatal("Ensure that disk '%s' is sane and that file '%s' can be read.\n", disk->dir, handle[j].path);
-					log_fatal("Stopping at block %u\n", i);
-					++io_error;
-					goto bail;
-				}
-
-				log_tag("error:%u:%s:%s: Read error at position %u. %s\n", i, disk->name, esc_tag(file->sub, esc_buffer), file_pos, strerror(errno));
-				log_fatal("WARNING! Unexpected read error in a data disk, it isn't possible to sync.\n");
-				log_fatal("Ensure that file '%s' can be read.\n", handle[j].path);
-				log_fatal("Stopping to allow recovery. Try with 'snapraid check -f /%s'\n", fmt_poll(disk, file->sub, esc_buffer));
-				++error;
-				goto bail;
+				log_fatal("Internal inconsistency in task state\n");
+				os_abort();
 				/* LCOV_EXCL_STOP */
 			}
 
-			/* until now is disk */
-			state_usage_disk(state, handle, &j, 1);
-
 			state_usage_file(state, disk, file);
 
 			countsize += read_size;
 
-			/* now compute the hash */
+			/* get the state of the block */
+			block_state = block_state_get(block);
+
+			/* now compute the hash, if not already computed by the worker */
 			if (rehash) {
-				memhash(state->prevhash, state->prevhashseed, hash, buffer, read_size);
+				if (task->is_hashed)
+					memcpy(hash, task->prevhash, HASH_MAX);
+				else
+					memhash(state->prevhash, state->prevhashseed, hash, task->buffer, read_size);
 			} else {
-				memhash(state->hash, state->hashseed, hash, buffer, read_size);
+				if (task->is_hashed)
+					memcpy(hash, task->hash, HASH_MAX);
+				else
+					memhash(state->hash, state->hashseed, hash, task->buffer, read_size);
 			}
 
 			/* until now is hash */
@@ -265,8 +422,8 @@ static int state_hash_process(struct snapraid_state* state, block_off_t blocksta
 			if (block_state == BLOCK_STATE_REP) {
 				/* compare the hash */
 				if (memcmp(hash, block->hash, BLOCK_HASH_SIZE) != 0) {
-					log_tag("error:%u:%s:%s: Unexpected data change\n", i, disk->name, esc_tag(file->sub, esc_buffer));
-					log_error("Data change at file '%s' at position '%u'\n", handle[j].path, file_pos);
+					log_tag("error:%u:%s:%s: Unexpected data change\n", blockcur, disk->name, esc_tag(file->sub, esc_buffer));
+					log_error("Data change at file '%s' at position '%u'\n", task->path, file_pos);
 					log_error("WARNING! Unexpected data modification of a file without parity!\n");
 
 					if (file_flag_has(file, FILE_IS_COPY)) {
@@ -301,42 +458,14 @@ static int state_hash_process(struct snapraid_state* state, block_off_t blocksta
 
 			/* count the number of processed block */
 			++countpos;
-
-			/* progress */
-			if (state_progress(state, 0, i, countpos, countmax, countsize)) {
-				/* LCOV_EXCL_START */
-				*skip_sync = 1; /* avoid to run the next sync */
-				break;
-				/* LCOV_EXCL_STOP */
-			}
 		}
 
-		/* close the last file in the disk */
-		if (handle[j].file != 0) {
-			/* keep a pointer at the file we are going to close for error reporting */
-			struct snapraid_file* report = handle[j].file;
-			ret = handle_close(&handle[j]);
-			if (ret == -1) {
-				/* LCOV_EXCL_START */
-				/* This one is really an unexpected error, because we are only reading */
-				/* and closing a descriptor should never fail */
-				if (errno == EIO) {
-					log_tag("error:%u:%s:%s: Close EIO error. %s\n", blockmax, disk->name, esc_tag(report->sub, esc_buffer), strerror(errno));
-					log_fatal("DANGER! Unexpected input/output close error in a data disk, it isn't possible to sync.\n");
-					log_fatal("Ensure that disk '%s' is sane and that file '%s' can be accessed.\n", disk->dir, handle[j].path);
-					log_fatal("Stopping at block %u\n", blockmax);
-					++io_error;
-					goto bail;
-				}
-
-				log_tag("error:%u:%s:%s: Close error. %s\n", blockmax, disk->name, esc_tag(report->sub, esc_buffer), strerror(errno));
-				log_fatal("WARNING! Unexpected close error in a data disk, it isn't possible to sync.\n");
-				log_fatal("Ensure that file '%s' can be accessed.\n", handle[j].path);
-				log_fatal("Stopping at block %u\n", blockmax);
-				++error;
-				goto bail;
-				/* LCOV_EXCL_STOP */
-			}
+		/* progress */
+		if (state_progress(state, &io, blockcur, countpos, countmax, countsize)) {
+			/* LCOV_EXCL_START */
+			*skip_sync = 1; /* avoid to run the next sync */
+			break;
+			/* LCOV_EXCL_STOP */
 		}
 	}
 
@@ -370,22 +499,28 @@ bail:
 	/* on bail, don't run the next sync */
 	*skip_sync = 1;
 
+finish:
+	/* stop all the worker threads */
+	io_stop(&io);
+
 	/* close files left open */
 	for (j = 0; j < diskmax; ++j) {
 		struct snapraid_file* file = handle[j].file;
 		struct snapraid_disk* disk = handle[j].disk;
 		ret = handle_close(&handle[j]);
 		if (ret == -1) {
-			log_tag("error:%u:%s:%s: Close error. %s\n", i, disk->name, esc_tag(file->sub, esc_buffer), strerror(errno));
+			/* LCOV_EXCL_START */
+			log_tag("error:%u:%s:%s: Close error. %s\n", blockmax, disk->name, esc_tag(file->sub, esc_buffer), strerror(errno));
 			log_fatal("DANGER! Unexpected close error in a data disk.\n");
 			++error;
 			/* continue, as we are already exiting */
+			/* LCOV_EXCL_STOP */
 		}
 	}
 
-finish:
 	free(handle);
-	free(buffer_alloc);
+	free(waiting_map);
+	io_done(&io);
 
 	if (error + io_error + silent_error != 0)
 		return -1;
@@ -482,8 +617,6 @@ static void sync_data_reader(struct snapraid_worker* worker, struct snapraid_tas
 	struct snapraid_disk* disk = handle->disk;
 	block_off_t blockcur = task->position;
 	unsigned char* buffer = task->buffer;
-	int ret;
-	char esc_buffer[ESC_MAX];
 
 	/* if the disk position is not used */
 	if (!disk) {
@@ -494,7 +627,7 @@ static void sync_data_reader(struct snapraid_worker* worker, struct snapraid_tas
 	}
 
 	/* get the block */
-	task->block = fs_par2block_find(disk, blockcur);
+	task->block = fs_par2block_find_cursor(disk, &worker->cursor, blockcur);
 
 	/* if the block has no file, meaning that it's EMPTY or DELETED, */
 	/* it doesn't participate in the new parity computation */
@@ -505,127 +638,7 @@ static void sync_data_reader(struct snapraid_worker* worker, struct snapraid_tas
 		return;
 	}
 
-	/* get the file of this block */
-	task->file = fs_par2file_get(disk, blockcur, &task->file_pos);
-
-	/* if the file is different than the current one, close it */
-	if (handle->file != 0 && handle->file != task->file) {
-		/* keep a pointer at the file we are going to close for error reporting */
-		struct snapraid_file* report = handle->file;
-		ret = handle_close(handle);
-		if (ret == -1) {
-			/* LCOV_EXCL_START */
-			/* This one is really an unexpected error, because we are only reading */
-			/* and closing a descriptor should never fail */
-			if (errno == EIO) {
-				log_tag("error:%u:%s:%s: Close EIO error. %s\n", blockcur, disk->name, esc_tag(report->sub, esc_buffer), strerror(errno));
-				log_fatal("DANGER! Unexpected input/output close error in a data disk, it isn't possible to sync.\n");
-				log_fatal("Ensure that disk '%s' is sane and that file '%s' can be accessed.\n", disk->dir, handle->path);
-				log_fatal("Stopping at block %u\n", blockcur);
-				task->state = TASK_STATE_IOERROR;
-				return;
-			}
-
-			log_tag("error:%u:%s:%s: Close error. %s\n", blockcur, disk->name, esc_tag(report->sub, esc_buffer), strerror(errno));
-			log_fatal("WARNING! Unexpected close error in a data disk, it isn't possible to sync.\n");
-			log_fatal("Ensure that file '%s' can be accessed.\n", handle->path);
-			log_fatal("Stopping at block %u\n", blockcur);
-			task->state = TASK_STATE_ERROR;
-			return;
-			/* LCOV_EXCL_STOP */
-		}
-	}
-
-	ret = handle_open(handle, task->file, state->file_mode, log_error, 0);
-	if (ret == -1) {
-		if (errno == EIO) {
-			/* LCOV_EXCL_START */
-			log_tag("error:%u:%s:%s: Open EIO error. %s\n", blockcur, disk->name, esc_tag(task->file->sub, esc_buffer), strerror(errno));
-			log_fatal("DANGER! Unexpected input/output open error in a data disk, it isn't possible to sync.\n");
-			log_fatal("Ensure that disk '%s' is sane and that file '%s' can be accessed.\n", disk->dir, handle->path);
-			log_fatal("Stopping at block %u\n", blockcur);
-			task->state = TASK_STATE_IOERROR;
-			return;
-			/* LCOV_EXCL_STOP */
-		}
-
-		if (errno == ENOENT) {
-			log_tag("error:%u:%s:%s: Open ENOENT error. %s\n", blockcur, disk->name, esc_tag(task->file->sub, esc_buffer), strerror(errno));
-			log_error("Missing file '%s'.\n", handle->path);
-			log_error("WARNING! You cannot modify data disk during a sync.\n");
-			log_error("Rerun the sync command when finished.\n");
-			/* if the file is missing, it means that it was removed during sync */
-			/* this isn't a serious error, so we skip this block, and continue with others */
-			task->state = TASK_STATE_ERROR_CONTINUE;
-			return;
-		}
-
-		if (errno == EACCES) {
-			log_tag("error:%u:%s:%s: Open EACCES error. %s\n", blockcur, disk->name, esc_tag(task->file->sub, esc_buffer), strerror(errno));
-			log_error("No access at file '%s'.\n", handle->path);
-			log_error("WARNING! Please fix the access permission in the data disk.\n");
-			log_error("Rerun the sync command when finished.\n");
-			/* this isn't a serious error, so we skip this block, and continue with others */
-			task->state = TASK_STATE_ERROR_CONTINUE;
-			return;
-		}
-
-		/* LCOV_EXCL_START */
-		log_tag("error:%u:%s:%s: Open error. %s\n", blockcur, disk->name, esc_tag(task->file->sub, esc_buffer), strerror(errno));
-		log_fatal("WARNING! Unexpected open error in a data disk, it isn't possible to sync.\n");
-		log_fatal("Ensure that file '%s' can be accessed.\n", handle->path);
-		log_fatal("Stopping to allow recovery. Try with 'snapraid check -f /%s'\n", fmt_poll(disk, task->file->sub, esc_buffer));
-		task->state = TASK_STATE_ERROR;
-		return;
-		/* LCOV_EXCL_STOP */
-	}
-
-	/* check if the file is changed */
-	if (handle->st.st_size != task->file->size
-		|| handle->st.st_mtime != task->file->mtime_sec
-		|| STAT_NSEC(&handle->st) != task->file->mtime_nsec
-		|| handle->st.st_ino != task->file->inode
-	) {
-		log_tag("error:%u:%s:%s: Unexpected attribute change\n", blockcur, disk->name, esc_tag(task->file->sub, esc_buffer));
-		if (handle->st.st_size != task->file->size) {
-			log_error("Unexpected size change at file '%s' from %" PRIu64 " to %" PRIu64 ".\n", handle->path, task->file->size, (uint64_t)handle->st.st_size);
-		} else if (handle->st.st_mtime != task->file->mtime_sec
-			|| STAT_NSEC(&handle->st) != task->file->mtime_nsec) {
-			log_error("Unexpected time change at file '%s' from %" PRIu64 ".%d to %" PRIu64 ".%d.\n", handle->path, task->file->mtime_sec, task->file->mtime_nsec, (uint64_t)handle->st.st_mtime, STAT_NSEC(&handle->st));
-		} else {
-			log_error("Unexpected inode change from %" PRIu64 " to %" PRIu64 " at file '%s'.\n", task->file->inode, (uint64_t)handle->st.st_ino, handle->path);
-		}
-		log_error("WARNING! You cannot modify files during a sync.\n");
-		log_error("Rerun the sync command when finished.\n");
-		/* if the file is changed, it means that it was modified during sync */
-		/* this isn't a serious error, so we skip this block, and continue with others */
-		task->state = TASK_STATE_ERROR_CONTINUE;
-		return;
-	}
-
-	task->read_size = handle_read(handle, task->file_pos, buffer, state->block_size, log_error, 0);
-	if (task->read_size == -1) {
-		/* LCOV_EXCL_START */
-		if (errno == EIO) {
-			log_tag("error:%u:%s:%s: Read EIO error at position %u. %s\n", blockcur, disk->name, esc_tag(task->file->sub, esc_buffer), task->file_pos, strerror(errno));
-			log_error("Input/Output error in file '%s' at position '%u'\n", handle->path, task->file_pos);
-			task->state = TASK_STATE_IOERROR_CONTINUE;
-			return;
-		}
-
-		log_tag("error:%u:%s:%s: Read error at position %u. %s\n", blockcur, disk->name, esc_tag(task->file->sub, esc_buffer), task->file_pos, strerror(errno));
-		log_fatal("WARNING! Unexpected read error in a data disk, it isn't possible to sync.\n");
-		log_fatal("Ensure that file '%s' can be read.\n", handle->path);
-		log_fatal("Stopping to allow recovery. Try with 'snapraid check -f /%s'\n", fmt_poll(disk, task->file->sub, esc_buffer));
-		task->state = TASK_STATE_ERROR;
-		return;
-		/* LCOV_EXCL_STOP */
-	}
-
-	/* store the path of the opened file */
-	pathcpy(task->path, sizeof(task->path), handle->path);
-
-	task->state = TASK_STATE_DONE;
+	sync_file_reader(worker, task, 1);
 }
 
 static void sync_parity_writer(struct snapraid_worker* worker, struct snapraid_task* task)
@@ -661,6 +674,53 @@ static void sync_parity_writer(struct snapraid_worker* worker, struct snapraid_t
 	task->state = TASK_STATE_DONE;
 }
 
+/**
+ * Block deallocation deferred after the end of the processing.
+ */
+struct snapraid_deallocate {
+	struct snapraid_disk* disk;
+	block_off_t pos;
+};
+
+/**
+ * Deallocate a block.
+ *
+ * The extents cannot change while the worker threads search them,
+ * and while the state is written in background, so the deallocation
+ * is deferred after both are stopped.
+ *
+ * The block is instead immediately marked as empty, as it's not anymore
+ * in the parity, and a save in the meantime must not store it as deleted.
+ */
+static void sync_deallocate(tommy_arrayblkof* deallocatearr, tommy_size_t* deallocatemax, struct snapraid_disk* disk, struct snapraid_block* block, block_off_t pos)
+{
+	struct snapraid_deallocate* deallocate;
+
+	block_state_set(block, BLOCK_STATE_EMPTY);
+
+	tommy_arrayblkof_grow(deallocatearr, *deallocatemax + 1);
+	deallocate = tommy_arrayblkof_ref(deallocatearr, *deallocatemax);
+	deallocate->disk = disk;
+	deallocate->pos = pos;
+	++*deallocatemax;
+}
+
+/**
+ * Apply the deferred deallocations.
+ */
+static void sync_deallocate_flush(tommy_arrayblkof* deallocatearr, tommy_size_t* deallocatemax)
+{
+	tommy_size_t i;
+
+	for (i = 0; i < *deallocatemax; ++i) {
+		struct snapraid_deallocate* deallocate = tommy_arrayblkof_ref(deallocatearr, i);
+
+		fs_deallocate(deallocate->disk, deallocate->pos);
+	}
+
+	*deallocatemax = 0;
+}
+
 static int state_sync_process(struct snapraid_state* state, struct snapraid_parity_handle* parity_handle, block_off_t blockstart, block_off_t blockmax)
 {
 	struct snapraid_io io;
@@ -692,6 +752,8 @@ static int state_sync_process(struct snapraid_state* state, struct snapraid_pari
 	unsigned l;
 	unsigned* waiting_map;
 	unsigned waiting_mac;
+	tommy_arrayblkof deallocatearr;
+	tommy_size_t deallocatemax;
 	char esc_buffer[ESC_MAX];
 
 	/* the sync process assumes that all the hashes are correct */
@@ -704,6 +766,10 @@ static int state_sync_process(struct snapraid_state* state, struct snapraid_pari
 	/* maps the disks to handles */
 	handle = handle_mapping(state, &diskmax);
 
+	/* deallocations deferred by the background write of the state */
+	tommy_arrayblkof_init(&deallocatearr, sizeof(struct snapraid_deallocate));
+	deallocatemax = 0;
+
 	/* rehash buffers */
 	rehandle = malloc_nofail_align(diskmax * sizeof(struct snapraid_rehash), &rehandle_alloc);
 
@@ -780,6 +846,9 @@ static int state_sync_process(struct snapraid_state* state, struct snapraid_pari
 		if (blockcur >= blockmax)
 			break;
 
+		/* the state of this block is going to change */
+		state_write_background_progress(state, blockcur);
+
 		/* until now is scheduling */
 		state_usage_sched(state);
 
@@ -928,15 +997,24 @@ static int state_sync_process(struct snapraid_state* state, struct snapraid_pari
 
 			countsize += read_size;
 
-			/* now compute the hash */
+			/* now compute the hash, if not already done by the worker */
 			if (rehash) {
-				memhash(state->prevhash, state->prevhashseed, hash, buffer[diskcur], read_size);
+				if (task->is_hashed)
+					memcpy(hash, task->prevhash, HASH_MAX);
+				else
+					memhash(state->prevhash, state->prevhashseed, hash, buffer[diskcur], read_size);
 
 				/* compute the new hash, and store it */
 				rehandle[diskcur].block = block;
-				memhash(state->hash, state->hashseed, rehandle[diskcur].hash, buffer[diskcur], read_size);
+				if (task->is_hashed)
+					memcpy(rehandle[diskcur].hash, task->hash, HASH_MAX);
+				else
+					memhash(state->hash, state->hashseed, rehandle[diskcur].hash, buffer[diskcur], read_size);
 			} else {
-				memhash(state->hash, state->hashseed, hash, buffer[diskcur], read_size);
+				if (task->is_hashed)
+					memcpy(hash, task->hash, HASH_MAX);
+				else
+					memhash(state->hash, state->hashseed, hash, buffer[diskcur], read_size);
 			}
 
 			/* until now is hash */
@@ -1105,7 +1183,7 @@ static int state_sync_process(struct snapraid_state* state, struct snapraid_pari
 					/* note that this is a simple fix algorithm, that doesn't take into */
 					/* account the case of a wrong parity */
 					/* only 'fix' supports the most advanced fixing */
-					raid_rec(failed_mac, failed_map, diskmax, state->level, state->block_size, buffer);
+					raidmt_rec(failed_mac, failed_map, diskmax, state->level, state->block_size, buffer);
 
 					/* until now is raid */
 					state_usage_raid(state);
@@ -1147,141 +1225,672 @@ static int state_sync_process(struct snapraid_state* state, struct snapraid_pari
 						}
 					}
 
-					/* if all is processed, we have fixed it */
-					if (j == failed_count)
-						fixed_error_on_this_block = 1;
-				}
-			}
-		}
+					/* if all is processed, we have fixed it */
+					if (j == failed_count)
+						fixed_error_on_this_block = 1;
+				}
+			}
+		}
+
+		/* if we have read all the data required and it's correct, proceed with the parity */
+		if (!error_on_this_block && !io_error_on_this_block
+			&& (!silent_error_on_this_block || fixed_error_on_this_block)
+		) {
+			/* update the parity only if really needed */
+			if (parity_needs_to_be_updated) {
+				/* compute the parity */
+				raidmt_gen(diskmax, state->level, state->block_size, buffer);
+
+				/* until now is raid */
+				state_usage_raid(state);
+
+				/* mark that the parity is going to be written */
+				parity_going_to_be_updated = 1;
+			}
+
+			/* for each disk, mark the blocks as processed */
+			for (j = 0; j < diskmax; ++j) {
+				struct snapraid_block* block;
+
+				if (!handle[j].disk)
+					continue;
+
+				block = fs_par2block_find(handle[j].disk, blockcur);
+
+				if (block == BLOCK_NULL) {
+					/* nothing to do */
+					continue;
+				}
+
+				/* if it's a deleted block */
+				if (block_state_get(block) == BLOCK_STATE_DELETED) {
+					/* the parity is now updated without this block, so it's now empty */
+					sync_deallocate(&deallocatearr, &deallocatemax, handle[j].disk, block, blockcur);
+					continue;
+				}
+
+				/* now all the blocks have the hash and the parity computed */
+				block_state_set(block, BLOCK_STATE_BLK);
+			}
+
+			/* we update the info block only if we really have updated the parity */
+			/* because otherwise the time/justsynced info would be misleading as we didn't */
+			/* wrote the parity at this time */
+			/* we also update the info block only if no silent error was found */
+			/* because has no sense to refresh the time for data that we know bad */
+			if (parity_needs_to_be_updated
+				&& !silent_error_on_this_block
+			) {
+				/* if rehash is needed */
+				if (rehash) {
+					/* store all the new hash already computed */
+					for (j = 0; j < diskmax; ++j) {
+						if (rehandle[j].block)
+							memcpy(rehandle[j].block->hash, rehandle[j].hash, BLOCK_HASH_SIZE);
+					}
+				}
+
+				/* update the time info of the block */
+				/* we are also clearing any previous bad and rehash flag */
+				info_set(&state->infoarr, blockcur, info_make(now, 0, 0, 1));
+			}
+		}
+
+		/* if a silent (even if corrected) or input/output error was found */
+		/* mark the block as bad to have check/fix to handle it */
+		/* because our correction is in memory only and not yet written */
+		if (silent_error_on_this_block || io_error_on_this_block) {
+			/* set the error status keeping the other info */
+			info_set(&state->infoarr, blockcur, info_set_bad(info));
+		}
+
+		/* finally schedule parity write */
+		/* Note that the calls to io_parity_write() are mandatory */
+		/* even if the parity doesn't need to be updated */
+		/* This because we want to keep track of the time usage */
+		state_usage_misc(state);
+
+		/* write start */
+		io_write_preset(&io, blockcur, !parity_going_to_be_updated);
+
+		/* write the parity */
+		for (l = 0; l < state->level; ++l) {
+			unsigned levcur;
+
+			io_parity_write(&io, &levcur, waiting_map, &waiting_mac);
+
+			/* until now is parity */
+			state_usage_parity(state, waiting_map, waiting_mac);
+		}
+
+		/* write finished */
+		io_write_next(&io, blockcur, !parity_going_to_be_updated, writer_error);
+
+		/* handle errors reported */
+		for (j = 0; j < IO_WRITER_ERROR_MAX; ++j) {
+			if (writer_error[j]) {
+				switch (j + IO_WRITER_ERROR_BASE) {
+				case TASK_STATE_IOERROR_CONTINUE :
+					++io_error;
+					if (io_error >= state->opt.io_error_limit) {
+						/* LCOV_EXCL_START */
+						log_fatal("DANGER! Unexpected input/output write error in a parity disk, it isn't possible to sync.\n");
+						log_fatal("Stopping at block %u\n", blockcur);
+						goto bail;
+						/* LCOV_EXCL_STOP */
+					}
+					break;
+				case TASK_STATE_ERROR_CONTINUE :
+					++error;
+					break;
+				case TASK_STATE_IOERROR :
+					/* LCOV_EXCL_START */
+					++io_error;
+					goto bail;
+					/* LCOV_EXCL_STOP */
+				case TASK_STATE_ERROR :
+					/* LCOV_EXCL_START */
+					++error;
+					goto bail;
+					/* LCOV_EXCL_STOP */
+				}
+			}
+		}
+
+		/* mark the state as needing write */
+		state->need_write = 1;
+
+		/* count the number of processed block */
+		++countpos;
+
+		/* progress */
+		if (state_progress(state, &io, blockcur, countpos, countmax, countsize)) {
+			/* LCOV_EXCL_START */
+			break;
+			/* LCOV_EXCL_STOP */
+		}
+
+		/* autosave */
+		if ((state->autosave != 0
+			&& autosavedone >= autosavelimit /* if we have reached the limit */
+			&& autosavemissing >= autosavelimit) /* if we have at least a full step to do */
+		        /* or if we have a forced autosave at the specified block */
+			|| (state->opt.force_autosave_at != 0 && state->opt.force_autosave_at == blockcur)
+		) {
+			autosavedone = 0; /* restart the counter */
+
+			/* until now is misc */
+			state_usage_misc(state);
+
+			state_progress_stop(state);
+
+			msg_progress("Autosaving...\n");
+
+			if (state->bgsave) {
+				/* wait for the previous background write */
+				ret = state_write_background_end(state);
+				if (ret == -1) {
+					/* LCOV_EXCL_START */
+					log_fatal("Stopping at block %u\n", blockcur);
+					++error;
+					goto bail;
+					/* LCOV_EXCL_STOP */
+				}
+
+				/* write the content file in background, while continuing the sync */
+				state_write_background_begin(state, parity_handle, blockcur + 1);
+			} else {
+				/* before writing the new content file we ensure that */
+				/* the parity is really written flushing the disk cache */
+				for (l = 0; l < state->level; ++l) {
+					ret = parity_sync(&parity_handle[l]);
+					if (ret == -1) {
+						/* LCOV_EXCL_START */
+						log_tag("parity_error:%u:%s: Sync error\n", blockcur, lev_config_name(l));
+						log_fatal("DANGER! Unexpected sync error in %s disk.\n", lev_name(l));
+						log_fatal("Ensure that disk '%s' is sane.\n", lev_config_name(l));
+						log_fatal("Stopping at block %u\n", blockcur);
+						++error;
+						goto bail;
+						/* LCOV_EXCL_STOP */
+					}
+				}
+
+				/* now we can safely write the content file */
+				state_write(state);
+			}
+
+			state_progress_restart(state);
+
+			/* drop until now */
+			state_usage_waste(state);
+		}
+	}
+
+end:
+	state_progress_end(state, countpos, countmax, countsize);
+
+	state_usage_print(state);
+
+	/* wait for the background write */
+	ret = state_write_background_end(state);
+	if (ret == -1) {
+		/* LCOV_EXCL_START */
+		++error;
+		goto bail;
+		/* LCOV_EXCL_STOP */
+	}
+
+	/* before returning we ensure that */
+	/* the parity is really written flushing the disk cache */
+	for (l = 0; l < state->level; ++l) {
+		ret = parity_sync(&parity_handle[l]);
+		if (ret == -1) {
+			/* LCOV_EXCL_START */
+			log_tag("parity_error:%u:%s: Sync error\n", blockcur, lev_config_name(l));
+			log_fatal("DANGER! Unexpected sync error in %s disk.\n", lev_name(l));
+			log_fatal("Ensure that disk '%s' is sane.\n", lev_config_name(l));
+			log_fatal("Stopping at block %u\n", blockcur);
+			++error;
+			goto bail;
+			/* LCOV_EXCL_STOP */
+		}
+	}
+
+	if (error || silent_error || io_error) {
+		msg_status("\n");
+		msg_status("%8u file errors\n", error);
+		msg_status("%8u io errors\n", io_error);
+		msg_status("%8u data errors\n", silent_error);
+	} else {
+		/* print the result only if processed something */
+		if (countpos != 0)
+			msg_status("Everything OK\n");
+	}
+
+	if (error)
+		log_fatal("WARNING! Unexpected file errors!\n");
+	if (io_error)
+		log_fatal("DANGER! Unexpected input/output errors! The failing blocks are now marked as bad!\n");
+	if (silent_error)
+		log_fatal("DANGER! Unexpected data errors! The failing blocks are now marked as bad!\n");
+	if (io_error || silent_error) {
+		log_fatal("Use 'snapraid status' to list the bad blocks.\n");
+		log_fatal("Use 'snapraid -e fix' to recover.\n");
+	}
+
+	log_tag("summary:error_file:%u\n", error);
+	log_tag("summary:error_io:%u\n", io_error);
+	log_tag("summary:error_data:%u\n", silent_error);
+	if (error + silent_error + io_error == 0)
+		log_tag("summary:exit:ok\n");
+	else
+		log_tag("summary:exit:error\n");
+	log_flush();
+
+bail:
+	/* stop all the worker threads */
+	io_stop(&io);
+
+	/* wait for the background write, if still running */
+	ret = state_write_background_end(state);
+	if (ret == -1) {
+		/* LCOV_EXCL_START */
+		++error;
+		/* continue, as we are already exiting */
+		/* LCOV_EXCL_STOP */
+	}
+
+	/* now the extents can change */
+	sync_deallocate_flush(&deallocatearr, &deallocatemax);
+
+	for (j = 0; j < diskmax; ++j) {
+		struct snapraid_file* file = handle[j].file;
+		struct snapraid_disk* disk = handle[j].disk;
+		ret = handle_close(&handle[j]);
+		if (ret == -1) {
+			/* LCOV_EXCL_START */
+			log_tag("error:%u:%s:%s: Close error. %s\n", blockcur, disk->name, esc_tag(file->sub, esc_buffer), strerror(errno));
+			log_fatal("DANGER! Unexpected close error in a data disk.\n");
+			++error;
+			/* continue, as we are already exiting */
+			/* LCOV_EXCL_STOP */
+		}
+	}
+
+	free(handle);
+	free(zero_alloc);
+	free(copy_alloc);
+	free(copy);
+	free(rehandle_alloc);
+	free(failed);
+	free(failed_map);
+	free(waiting_map);
+	tommy_arrayblkof_done(&deallocatearr);
+	io_done(&io);
+
+	if (state->opt.expect_recoverable) {
+		if (error + silent_error + io_error == 0)
+			return -1;
+	} else {
+		if (error + silent_error + io_error != 0)
+			return -1;
+	}
+	return 0;
+}
+
+/****************************************************************************/
+/* delta */
+
+/**
+ * Delta plan to use.
+ */
+struct snapraid_delta_plan {
+	struct snapraid_state* state;
+	unsigned handle_max;
+	struct snapraid_handle* handle_map;
+	block_off_t parity_max; /**< Number of blocks in the parity before resizing it. */
+};
+
+/**
+ * Get the index of the disk to update incrementally at the specified position.
+ *
+ * The parity can be updated incrementally only if a single block has invalid
+ * parity, and such block is a CHG one that was EMPTY before, and then
+ * represented in the parity as filled with zero.
+ *
+ * Note that the content file is always saved before starting to write the parity,
+ * and CHG blocks loaded from it get an invalid hash. This means that a block
+ * with the zero hash was really EMPTY in the parity, even after an aborted sync.
+ *
+ * Return -1 if the parity cannot be updated incrementally.
+ */
+static int delta_disk_index(struct snapraid_delta_plan* plan, block_off_t i)
+{
+	snapraid_info info;
+	int index;
+	unsigned j;
+
+	/* the parity must exist */
+	if (i >= plan->parity_max)
+		return -1;
+
+	info = info_get(&plan->state->infoarr, i);
+
+	/* bad blocks need a full update, because the parity may be wrong */
+	/* and the rehash needs all the blocks to compute the new hashes */
+	if (info_get_bad(info) || info_get_rehash(info))
+		return -1;
+
+	index = -1;
+	for (j = 0; j < plan->handle_max; ++j) {
+		struct snapraid_block* block;
+		struct snapraid_disk* disk = plan->handle_map[j].disk;
+
+		/* if no disk, nothing to check */
+		if (!disk)
+			continue;
+
+		block = fs_par2block_find(disk, i);
+
+		if (!block_has_invalid_parity(block))
+			continue;
+
+		/* only one block can be changed */
+		if (index != -1)
+			return -1;
+
+		/* and it must be filled with zero in the parity */
+		if (block_state_get(block) != BLOCK_STATE_CHG || !hash_is_zero(block->hash))
+			return -1;
+
+		index = j;
+	}
+
+	return index;
+}
+
+/**
+ * Check if at the specified position there are blocks in the parity
+ * other than the one of the specified disk.
+ */
+static int delta_has_other(struct snapraid_delta_plan* plan, block_off_t i, unsigned index)
+{
+	unsigned j;
+
+	for (j = 0; j < plan->handle_max; ++j) {
+		struct snapraid_disk* disk = plan->handle_map[j].disk;
+
+		/* if no disk, nothing to check */
+		if (!disk || j == index)
+			continue;
+
+		if (block_has_file(fs_par2block_find(disk, i)))
+			return 1;
+	}
+
+	return 0;
+}
+
+/**
+ * Check if we have to process the specified block index ::i.
+ */
+static int delta_block_is_enabled(void* void_plan, block_off_t i)
+{
+	struct snapraid_delta_plan* plan = void_plan;
+
+	return delta_disk_index(plan, i) != -1;
+}
+
+static void delta_data_reader(struct snapraid_worker* worker, struct snapraid_task* task)
+{
+	struct snapraid_delta_plan* plan = worker->io->block_arg;
+	int index = worker->handle - plan->handle_map;
+
+	/* read only the changed disk */
+	if (delta_disk_index(plan, task->position) != index) {
+		task->state = TASK_STATE_DONE;
+		return;
+	}
+
+	sync_data_reader(worker, task);
+}
+
+/**
+ * Update the parity incrementally, reading only the new data and the old parity.
+ *
+ * Any position with a not fatal error is left to the full sync that follows,
+ * that is going to report it.
+ */
+static int state_delta_process(struct snapraid_state* state, struct snapraid_parity_handle* parity_handle, block_off_t blockstart, block_off_t blockmax, block_off_t paritymax)
+{
+	struct snapraid_io io;
+	struct snapraid_delta_plan plan;
+	struct snapraid_handle* handle;
+	unsigned diskmax;
+	block_off_t blockcur;
+	unsigned j;
+	unsigned buffermax;
+	data_off_t countsize;
+	block_off_t countpos;
+	block_off_t countmax;
+	int ret;
+	unsigned error;
+	unsigned io_error;
+	time_t now;
+	unsigned l;
+	unsigned* waiting_map;
+	unsigned waiting_mac;
+	char esc_buffer[ESC_MAX];
+
+	/* get the present time */
+	now = time(0);
+
+	/* maps the disks to handles */
+	handle = handle_mapping(state, &diskmax);
+
+	/* we need 1 * data + 1 * parity */
+	buffermax = diskmax + state->level;
+
+	/* initialize the io threads, with only data readers */
+	/* the parity is read and written directly, as it's only a fraction of the I/O */
+	io_init(&io, state, state->opt.io_cache, buffermax, delta_data_reader, handle, diskmax, 0, 0, 0, 0);
+
+	/* possibly waiting disks */
+	waiting_mac = diskmax > RAID_PARITY_MAX ? diskmax : RAID_PARITY_MAX;
+	waiting_map = malloc_nofail(waiting_mac * sizeof(unsigned));
+
+	error = 0;
+	io_error = 0;
+
+	plan.state = state;
+	plan.handle_max = diskmax;
+	plan.handle_map = handle;
+	plan.parity_max = paritymax;
+
+	/* first count the number of blocks to process */
+	countmax = 0;
+	for (blockcur = blockstart; blockcur < blockmax; ++blockcur) {
+		if (!delta_block_is_enabled(&plan, blockcur))
+			continue;
+		++countmax;
+	}
+
+	/* drop until now */
+	state_usage_waste(state);
+
+	countsize = 0;
+	countpos = 0;
+
+	/* start all the worker threads */
+	io_start(&io, blockstart, blockmax, &delta_block_is_enabled, &plan);
+
+	if (!state_progress_begin(state, blockstart, blockmax, countmax))
+		goto end;
+
+	while (1) {
+		struct snapraid_task* changed;
+		unsigned char hash[HASH_MAX];
+		unsigned changedcur;
+		snapraid_info info;
+		void* v[1 + RAID_PARITY_MAX];
+		void** buffer;
+
+		/* go to the next block */
+		blockcur = io_read_next(&io, &buffer);
+		if (blockcur >= blockmax)
+			break;
+
+		/* until now is scheduling */
+		state_usage_sched(state);
+
+		/* for each disk, get the only block read */
+		changed = 0;
+		changedcur = 0;
+		for (j = 0; j < diskmax; ++j) {
+			struct snapraid_task* task;
+			unsigned diskcur;
+
+			/* until now is misc */
+			state_usage_misc(state);
 
-		/* if we have read all the data required and it's correct, proceed with the parity */
-		if (!error_on_this_block && !io_error_on_this_block
-			&& (!silent_error_on_this_block || fixed_error_on_this_block)
-		) {
-			/* update the parity only if really needed */
-			if (parity_needs_to_be_updated) {
-				/* compute the parity */
-				raid_gen(diskmax, state->level, state->block_size, buffer);
+			task = io_data_read(&io, &diskcur, waiting_map, &waiting_mac);
 
-				/* until now is raid */
-				state_usage_raid(state);
+			/* until now is disk */
+			state_usage_disk(state, handle, waiting_map, waiting_mac);
 
-				/* mark that the parity is going to be written */
-				parity_going_to_be_updated = 1;
+			/* if the block was not read */
+			if (!task->block)
+				continue;
+
+			/* handle error conditions */
+			if (task->state == TASK_STATE_IOERROR) {
+				/* LCOV_EXCL_START */
+				++io_error;
+				goto bail;
+				/* LCOV_EXCL_STOP */
+			}
+			if (task->state == TASK_STATE_ERROR) {
+				/* LCOV_EXCL_START */
+				++error;
+				goto bail;
+				/* LCOV_EXCL_STOP */
+			}
+			if (task->state == TASK_STATE_ERROR_CONTINUE
+				|| task->state == TASK_STATE_IOERROR_CONTINUE
+			) {
+				/* leave the block to the full sync */
+				continue;
+			}
+			if (task->state != TASK_STATE_DONE) {
+				/* LCOV_EXCL_START */
+				log_fatal("Internal inconsistency in task state\n");
+				os_abort();
+				/* LCOV_EXCL_STOP */
 			}
 
-			/* for each disk, mark the blocks as processed */
-			for (j = 0; j < diskmax; ++j) {
-				struct snapraid_block* block;
+			changed = task;
+			changedcur = diskcur;
+		}
 
-				if (!handle[j].disk)
-					continue;
+		/* if nothing was read, there is nothing to update */
+		if (!changed)
+			goto next;
 
-				block = fs_par2block_find(handle[j].disk, blockcur);
+		state_usage_file(state, changed->disk, changed->file);
 
-				if (block == BLOCK_NULL) {
-					/* nothing to do */
-					continue;
-				}
+		countsize += changed->read_size;
 
-				/* if it's a deleted block */
-				if (block_state_get(block) == BLOCK_STATE_DELETED) {
-					/* the parity is now updated without this block, so it's now empty */
-					fs_deallocate(handle[j].disk, blockcur);
-					continue;
-				}
+		/* compute the hash, if not already done by the worker */
+		if (changed->is_hashed)
+			memcpy(hash, changed->hash, HASH_MAX);
+		else
+			memhash(state->hash, state->hashseed, hash, buffer[changedcur], changed->read_size);
 
-				/* now all the blocks have the hash and the parity computed */
-				block_state_set(block, BLOCK_STATE_BLK);
-			}
+		/* until now is hash */
+		state_usage_hash(state);
 
-			/* we update the info block only if we really have updated the parity */
-			/* because otherwise the time/justsynced info would be misleading as we didn't */
-			/* wrote the parity at this time */
-			/* we also update the info block only if no silent error was found */
-			/* because has no sense to refresh the time for data that we know bad */
-			if (parity_needs_to_be_updated
-				&& !silent_error_on_this_block
-			) {
-				/* if rehash is needed */
-				if (rehash) {
-					/* store all the new hash already computed */
-					for (j = 0; j < diskmax; ++j) {
-						if (rehandle[j].block)
-							memcpy(rehandle[j].block->hash, rehandle[j].hash, BLOCK_HASH_SIZE);
+		/* setup the vector for the update */
+		v[0] = buffer[changedcur];
+		for (l = 0; l < state->level; ++l)
+			v[1 + l] = buffer[diskmax + l];
+
+		/* if the parity contains other blocks, read it */
+		if (delta_has_other(&plan, blockcur, changedcur)) {
+			for (l = 0; l < state->level; ++l) {
+				ret = parity_read(&parity_handle[l], blockcur, v[1 + l], state->block_size, log_error);
+				if (ret == -1) {
+					/* LCOV_EXCL_START */
+					if (errno == EIO) {
+						/* leave the block to the full sync, that doesn't need to read the parity */
+						log_tag("parity_error:%u:%s: Read EIO error. %s\n", blockcur, lev_config_name(l), strerror(errno));
+						goto next;
 					}
+
+					log_tag("parity_error:%u:%s: Read error. %s\n", blockcur, lev_config_name(l), strerror(errno));
+					log_fatal("WARNING! Unexpected read error in the %s disk, it isn't possible to sync.\n", lev_name(l));
+					log_fatal("Ensure that disk '%s' can be read.\n", lev_config_name(l));
+					log_fatal("Stopping at block %u\n", blockcur);
+					++error;
+					goto bail;
+					/* LCOV_EXCL_STOP */
 				}
 
-				/* update the time info of the block */
-				/* we are also clearing any previous bad and rehash flag */
-				info_set(&state->infoarr, blockcur, info_make(now, 0, 0, 1));
+				/* until now is parity */
+				state_usage_parity(state, &l, 1);
 			}
+		} else {
+			/* otherwise the parity is all zero */
+			for (l = 0; l < state->level; ++l)
+				memset(v[1 + l], 0, state->block_size);
 		}
 
-		/* if a silent (even if corrected) or input/output error was found */
-		/* mark the block as bad to have check/fix to handle it */
-		/* because our correction is in memory only and not yet written */
-		if (silent_error_on_this_block || io_error_on_this_block) {
-			/* set the error status keeping the other info */
-			info_set(&state->infoarr, blockcur, info_set_bad(info));
-		}
-
-		/* finally schedule parity write */
-		/* Note that the calls to io_parity_write() are mandatory */
-		/* even if the parity doesn't need to be updated */
-		/* This because we want to keep track of the time usage */
-		state_usage_misc(state);
+		/* add the new data to the parity */
+		raid_add(changedcur, state->level, state->block_size, v);
 
-		/* write start */
-		io_write_preset(&io, blockcur, !parity_going_to_be_updated);
+		/* until now is raid */
+		state_usage_raid(state);
 
 		/* write the parity */
 		for (l = 0; l < state->level; ++l) {
-			unsigned levcur;
+			ret = parity_write(&parity_handle[l], blockcur, v[1 + l], state->block_size);
+			if (ret == -1) {
+				/* LCOV_EXCL_START */
+				if (errno == EIO) {
+					/* leave the block to the full sync, that is going to write it again */
+					log_tag("parity_error:%u:%s: Write EIO error. %s\n", blockcur, lev_config_name(l), strerror(errno));
+					goto next;
+				}
 
-			io_parity_write(&io, &levcur, waiting_map, &waiting_mac);
+				log_tag("parity_error:%u:%s: Write error. %s\n", blockcur, lev_config_name(l), strerror(errno));
+				log_fatal("WARNING! Unexpected write error in the %s disk, it isn't possible to sync.\n", lev_name(l));
+				log_fatal("Ensure that disk '%s' has some free space available.\n", lev_config_name(l));
+				log_fatal("Stopping at block %u\n", blockcur);
+				++error;
+				goto bail;
+				/* LCOV_EXCL_STOP */
+			}
 
 			/* until now is parity */
-			state_usage_parity(state, waiting_map, waiting_mac);
+			state_usage_parity(state, &l, 1);
 		}
 
-		/* write finished */
-		io_write_next(&io, blockcur, !parity_going_to_be_updated, writer_error);
+		/* now the block has the hash and the parity computed */
+		memcpy(changed->block->hash, hash, BLOCK_HASH_SIZE);
+		block_state_set(changed->block, BLOCK_STATE_BLK);
 
-		/* handle errors reported */
-		for (j = 0; j < IO_WRITER_ERROR_MAX; ++j) {
-			if (writer_error[j]) {
-				switch (j + IO_WRITER_ERROR_BASE) {
-				case TASK_STATE_IOERROR_CONTINUE :
-					++io_error;
-					if (io_error >= state->opt.io_error_limit) {
-						/* LCOV_EXCL_START */
-						log_fatal("DANGER! Unexpected input/output write error in a parity disk, it isn't possible to sync.\n");
-						log_fatal("Stopping at block %u\n", blockcur);
-						goto bail;
-						/* LCOV_EXCL_STOP */
-					}
-					break;
-				case TASK_STATE_ERROR_CONTINUE :
-					++error;
-					break;
-				case TASK_STATE_IOERROR :
-					/* LCOV_EXCL_START */
-					++io_error;
-					goto bail;
-					/* LCOV_EXCL_STOP */
-				case TASK_STATE_ERROR :
-					/* LCOV_EXCL_START */
-					++error;
-					goto bail;
-					/* LCOV_EXCL_STOP */
-				}
-			}
-		}
+		/* the other blocks were not verified, so keep the time of the last full */
+		/* verification, if any, and mark the position as just synced for scrub */
+		info = info_get(&state->infoarr, blockcur);
+		if (info_get_time(info) != 0)
+			info_set(&state->infoarr, blockcur, info_make(info_get_time(info), 0, 0, 1));
+		else
+			info_set(&state->infoarr, blockcur, info_make(now, 0, 0, 1));
 
 		/* mark the state as needing write */
 		state->need_write = 1;
 
+next:
 		/* count the number of processed block */
 		++countpos;
 
@@ -1291,47 +1900,6 @@ static int state_sync_process(struct snapraid_state* state, struct snapraid_pari
 			break;
 			/* LCOV_EXCL_STOP */
 		}
-
-		/* autosave */
-		if ((state->autosave != 0
-			&& autosavedone >= autosavelimit /* if we have reached the limit */
-			&& autosavemissing >= autosavelimit) /* if we have at least a full step to do */
-		        /* or if we have a forced autosave at the specified block */
-			|| (state->opt.force_autosave_at != 0 && state->opt.force_autosave_at == blockcur)
-		) {
-			autosavedone = 0; /* restart the counter */
-
-			/* until now is misc */
-			state_usage_misc(state);
-
-			state_progress_stop(state);
-
-			msg_progress("Autosaving...\n");
-
-			/* before writing the new content file we ensure that */
-			/* the parity is really written flushing the disk cache */
-			for (l = 0; l < state->level; ++l) {
-				ret = parity_sync(&parity_handle[l]);
-				if (ret == -1) {
-					/* LCOV_EXCL_START */
-					log_tag("parity_error:%u:%s: Sync error\n", blockcur, lev_config_name(l));
-					log_fatal("DANGER! Unexpected sync error in %s disk.\n", lev_name(l));
-					log_fatal("Ensure that disk '%s' is sane.\n", lev_config_name(l));
-					log_fatal("Stopping at block %u\n", blockcur);
-					++error;
-					goto bail;
-					/* LCOV_EXCL_STOP */
-				}
-			}
-
-			/* now we can safely write the content file */
-			state_write(state);
-
-			state_progress_restart(state);
-
-			/* drop until now */
-			state_usage_waste(state);
-		}
 	}
 
 end:
@@ -1339,53 +1907,6 @@ end:
 
 	state_usage_print(state);
 
-	/* before returning we ensure that */
-	/* the parity is really written flushing the disk cache */
-	for (l = 0; l < state->level; ++l) {
-		ret = parity_sync(&parity_handle[l]);
-		if (ret == -1) {
-			/* LCOV_EXCL_START */
-			log_tag("parity_error:%u:%s: Sync error\n", blockcur, lev_config_name(l));
-			log_fatal("DANGER! Unexpected sync error in %s disk.\n", lev_name(l));
-			log_fatal("Ensure that disk '%s' is sane.\n", lev_config_name(l));
-			log_fatal("Stopping at block %u\n", blockcur);
-			++error;
-			goto bail;
-			/* LCOV_EXCL_STOP */
-		}
-	}
-
-	if (error || silent_error || io_error) {
-		msg_status("\n");
-		msg_status("%8u file errors\n", error);
-		msg_status("%8u io errors\n", io_error);
-		msg_status("%8u data errors\n", silent_error);
-	} else {
-		/* print the result only if processed something */
-		if (countpos != 0)
-			msg_status("Everything OK\n");
-	}
-
-	if (error)
-		log_fatal("WARNING! Unexpected file errors!\n");
-	if (io_error)
-		log_fatal("DANGER! Unexpected input/output errors! The failing blocks are now marked as bad!\n");
-	if (silent_error)
-		log_fatal("DANGER! Unexpected data errors! The failing blocks are now marked as bad!\n");
-	if (io_error || silent_error) {
-		log_fatal("Use 'snapraid status' to list the bad blocks.\n");
-		log_fatal("Use 'snapraid -e fix' to recover.\n");
-	}
-
-	log_tag("summary:error_file:%u\n", error);
-	log_tag("summary:error_io:%u\n", io_error);
-	log_tag("summary:error_data:%u\n", silent_error);
-	if (error + silent_error + io_error == 0)
-		log_tag("summary:exit:ok\n");
-	else
-		log_tag("summary:exit:error\n");
-	log_flush();
-
 bail:
 	/* stop all the worker threads */
 	io_stop(&io);
@@ -1396,7 +1917,7 @@ bail:
 		ret = handle_close(&handle[j]);
 		if (ret == -1) {
 			/* LCOV_EXCL_START */
-			log_tag("error:%u:%s:%s: Close error. %s\n", blockcur, disk->name, esc_tag(file->sub, esc_buffer), strerror(errno));
+			log_tag("error:%u:%s:%s: Close error. %s\n", blockmax, disk->name, esc_tag(file->sub, esc_buffer), strerror(errno));
 			log_fatal("DANGER! Unexpected close error in a data disk.\n");
 			++error;
 			/* continue, as we are already exiting */
@@ -1405,22 +1926,11 @@ bail:
 	}
 
 	free(handle);
-	free(zero_alloc);
-	free(copy_alloc);
-	free(copy);
-	free(rehandle_alloc);
-	free(failed);
-	free(failed_map);
 	free(waiting_map);
 	io_done(&io);
 
-	if (state->opt.expect_recoverable) {
-		if (error + silent_error + io_error == 0)
-			return -1;
-	} else {
-		if (error + silent_error + io_error != 0)
-			return -1;
-	}
+	if (error + io_error != 0)
+		return -1;
 	return 0;
 }
 
@@ -1575,11 +2085,24 @@ int state_sync(struct snapraid_state* state, block_off_t blockstart, block_off_t
 			log_fatal("WARNING! Skipped state write for --test-skip-content-write option.\n");
 		}
 
-		msg_progress("Syncing...\n");
-
 		/* skip degenerated cases of empty parity, or skipping all */
 		if (blockstart < blockmax) {
-			ret = state_sync_process(state, parity_handle, blockstart, blockmax);
+			ret = 0;
+
+			/* first update incrementally the parity where possible */
+			/* note that this is done after saving the content file, like the sync */
+			if (state->opt.delta_update) {
+				msg_progress("Updating...\n");
+
+				ret = state_delta_process(state, parity_handle, blockstart, blockmax, file_paritymax);
+			}
+
+			if (ret == 0) {
+				msg_progress("Syncing...\n");
+
+				ret = state_sync_process(state, parity_handle, blockstart, blockmax);
+			}
+
 			if (ret == -1) {
 				/* LCOV_EXCL_START */
 				++unrecoverable_error;
@@ -1587,6 +2110,7 @@ int state_sync(struct snapraid_state* state, block_off_t blockstart, block_off_t
 				/* LCOV_EXCL_STOP */
 			}
 		} else {
+			msg_progress("Syncing...\n");
 			msg_status("Nothing to do\n");
 		}
 	}
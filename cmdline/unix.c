@@ -68,6 +68,41 @@ const char* stat_desc(struct stat* st)
 	return "unknown";
 }
 
+#if HAVE_STATX
+void statx_to_stat(const struct statx* stx, struct stat* st)
+{
+	memset(st, 0, sizeof(struct stat));
+
+	st->st_mode = stx->stx_mode;
+	st->st_ino = stx->stx_ino;
+	st->st_nlink = stx->stx_nlink;
+	st->st_size = stx->stx_size;
+	st->st_mtim.tv_sec = stx->stx_mtime.tv_sec;
+	st->st_mtim.tv_nsec = stx->stx_mtime.tv_nsec;
+	st->st_dev = makedev(stx->stx_dev_major, stx->stx_dev_minor);
+}
+#endif
+
+int lstat_scan(const char* file, struct stat* st)
+{
+#if HAVE_STATX
+	struct statx stx;
+
+	if (statx(AT_FDCWD, file, AT_SYMLINK_NOFOLLOW | AT_NO_AUTOMOUNT, STATX_SCAN_MASK, &stx) != 0) {
+		/* if not supported by the kernel, use lstat() */
+		if (errno == ENOSYS)
+			return lstat(file, st);
+		return -1;
+	}
+
+	statx_to_stat(&stx, st);
+
+	return 0;
+#else
+	return lstat(file, st);
+#endif
+}
+
 /**
  * Get the device file from the device number.
  *
@@ -1561,5 +1596,18 @@ size_t direct_size(void)
 	return size;
 }
 
+unsigned cpu_count(void)
+{
+	long count;
+
+	count = sysconf(_SC_NPROCESSORS_ONLN);
+
+	/* if not available, assume a single processor */
+	if (count < 1)
+		return 1;
+
+	return count;
+}
+
 #endif
 
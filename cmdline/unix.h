@@ -58,10 +58,37 @@ int dirent_hidden(struct dirent* dd);
  */
 const char* stat_desc(struct stat* st);
 
+/**
+ * Like lstat(), but it gets only the info used to scan a file.
+ * The type, mode, inode, links, size, mtime and device.
+ *
+ * In Linux it uses statx() requesting only these fields, allowing
+ * the file-system to skip the others.
+ */
+int lstat_scan(const char* file, struct stat* st);
+
+#if HAVE_STATX
+/**
+ * Fields requested to statx() by lstat_scan().
+ */
+#define STATX_SCAN_MASK (STATX_TYPE | STATX_MODE | STATX_NLINK | STATX_INO | STATX_SIZE | STATX_MTIME)
+
+/**
+ * Convert the result of statx() to a stat result.
+ * Only the fields of lstat_scan() are set.
+ */
+void statx_to_stat(const struct statx* stx, struct stat* st);
+#endif
+
 /**
  * Return the aligment requirement for direct IO.
  */
 size_t direct_size(void);
 
+/**
+ * Return the number of processors available.
+ */
+unsigned cpu_count(void);
+
 #endif
 
@@ -0,0 +1,302 @@
+/*
+ * Copyright (C) 2016 Andrea Mazzoleni
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "portable.h"
+
+#include "uring.h"
+
+/****************************************************************************/
+/* uring */
+
+#if HAVE_IO_URING
+
+/**
+ * Memory barriers to access the rings shared with the kernel.
+ */
+#define uring_load_acquire(p) __atomic_load_n(p, __ATOMIC_ACQUIRE)
+#define uring_store_release(p, v) __atomic_store_n(p, v, __ATOMIC_RELEASE)
+
+int uring_init(struct snapraid_uring* ring, unsigned entries)
+{
+	struct io_uring_params p;
+	unsigned char* sq;
+	unsigned char* cq;
+	int f;
+
+	ring->f = -1;
+
+	memset(&p, 0, sizeof(p));
+
+	/* the kernel limits the number of entries, clamp it */
+	p.flags = IORING_SETUP_CLAMP;
+
+	f = syscall(__NR_io_uring_setup, entries, &p);
+	if (f < 0) {
+		/* LCOV_EXCL_START */
+		return -1;
+		/* LCOV_EXCL_STOP */
+	}
+
+	ring->sq_size = p.sq_off.array + p.sq_entries * sizeof(unsigned);
+	ring->cq_size = p.cq_off.cqes + p.cq_entries * sizeof(struct io_uring_cqe);
+	ring->sqe_size = p.sq_entries * sizeof(struct io_uring_sqe);
+
+	ring->sq_ptr = mmap(0, ring->sq_size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, f, IORING_OFF_SQ_RING);
+	if (ring->sq_ptr == MAP_FAILED) {
+		/* LCOV_EXCL_START */
+		goto bail_f;
+		/* LCOV_EXCL_STOP */
+	}
+
+	ring->cq_ptr = mmap(0, ring->cq_size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, f, IORING_OFF_CQ_RING);
+	if (ring->cq_ptr == MAP_FAILED) {
+		/* LCOV_EXCL_START */
+		goto bail_sq;
+		/* LCOV_EXCL_STOP */
+	}
+
+	ring->sqe_ptr = mmap(0, ring->sqe_size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, f, IORING_OFF_SQES);
+	if (ring->sqe_ptr == MAP_FAILED) {
+		/* LCOV_EXCL_START */
+		goto bail_cq;
+		/* LCOV_EXCL_STOP */
+	}
+
+	sq = ring->sq_ptr;
+	ring->sq_head = (unsigned*)(sq + p.sq_off.head);
+	ring->sq_tail = (unsigned*)(sq + p.sq_off.tail);
+	ring->sq_mask = (unsigned*)(sq + p.sq_off.ring_mask);
+	ring->sq_array = (unsigned*)(sq + p.sq_off.array);
+
+	cq = ring->cq_ptr;
+	ring->cq_head = (unsigned*)(cq + p.cq_off.head);
+	ring->cq_tail = (unsigned*)(cq + p.cq_off.tail);
+	ring->cq_mask = (unsigned*)(cq + p.cq_off.ring_mask);
+	ring->cqes = cq + p.cq_off.cqes;
+
+	ring->f = f;
+	ring->entries = p.sq_entries;
+	ring->inflight = 0;
+	ring->queued = 0;
+
+	return 0;
+
+	/* LCOV_EXCL_START */
+bail_cq:
+	munmap(ring->cq_ptr, ring->cq_size);
+bail_sq:
+	munmap(ring->sq_ptr, ring->sq_size);
+bail_f:
+	close(f);
+	return -1;
+	/* LCOV_EXCL_STOP */
+}
+
+void uring_done(struct snapraid_uring* ring)
+{
+	if (ring->f == -1)
+		return;
+
+	munmap(ring->sqe_ptr, ring->sqe_size);
+	munmap(ring->cq_ptr, ring->cq_size);
+	munmap(ring->sq_ptr, ring->sq_size);
+	close(ring->f);
+
+	ring->f = -1;
+}
+
+/**
+ * Get the next free submission entry, cleared.
+ * Return 0 if the ring is full.
+ */
+static struct io_uring_sqe* uring_sqe(struct snapraid_uring* ring)
+{
+	struct io_uring_sqe* sqe;
+	unsigned tail;
+	unsigned index;
+
+	/* the completion ring is at least as big as the submission one */
+	/* so limiting the requests in flight we never overflow it */
+	if (ring->inflight + ring->queued >= ring->entries)
+		return 0;
+
+	tail = *ring->sq_tail + ring->queued;
+	index = tail & *ring->sq_mask;
+
+	sqe = (struct io_uring_sqe*)ring->sqe_ptr + index;
+	memset(sqe, 0, sizeof(*sqe));
+
+	ring->sq_array[index] = index;
+
+	++ring->queued;
+
+	return sqe;
+}
+
+int uring_queue(struct snapraid_uring* ring, int is_write, int f, void* buffer, unsigned size, data_off_t offset, void* arg)
+{
+	struct io_uring_sqe* sqe;
+
+	sqe = uring_sqe(ring);
+	if (!sqe)
+		return -1;
+
+	sqe->opcode = is_write ? IORING_OP_WRITE : IORING_OP_READ;
+	sqe->fd = f;
+	sqe->addr = (uintptr_t)buffer;
+	sqe->len = size;
+	sqe->off = offset;
+	sqe->user_data = (uintptr_t)arg;
+
+	return 0;
+}
+
+#if HAVE_IO_URING_STATX
+int uring_queue_statx(struct snapraid_uring* ring, int dir, const char* name, struct statx* stx, void* arg)
+{
+	struct io_uring_sqe* sqe;
+
+	sqe = uring_sqe(ring);
+	if (!sqe)
+		return -1;
+
+	sqe->opcode = IORING_OP_STATX;
+	sqe->fd = dir;
+	sqe->addr = (uintptr_t)name;
+	sqe->len = STATX_SCAN_MASK;
+	sqe->off = (uintptr_t)stx;
+	sqe->statx_flags = AT_SYMLINK_NOFOLLOW | AT_NO_AUTOMOUNT;
+	sqe->user_data = (uintptr_t)arg;
+
+	return 0;
+}
+#endif
+
+int uring_submit(struct snapraid_uring* ring)
+{
+	unsigned tail;
+	int ret;
+
+	if (ring->queued == 0)
+		return 0;
+
+	/* publish the new entries to the kernel */
+	tail = *ring->sq_tail + ring->queued;
+	uring_store_release(ring->sq_tail, tail);
+
+	ring->inflight += ring->queued;
+	ring->queued = 0;
+
+	/* the kernel may consume only part of the entries, loop until all are submitted */
+	while (uring_load_acquire(ring->sq_head) != tail) {
+		ret = syscall(__NR_io_uring_enter, ring->f, tail - uring_load_acquire(ring->sq_head), 0, 0, 0, 0);
+		if (ret < 0) {
+			/* LCOV_EXCL_START */
+			if (errno == EINTR || errno == EAGAIN || errno == EBUSY)
+				continue;
+			return -1;
+			/* LCOV_EXCL_STOP */
+		}
+	}
+
+	return 0;
+}
+
+int uring_wait(struct snapraid_uring* ring, void** arg, int* result)
+{
+	struct io_uring_cqe* cqe;
+	unsigned head;
+	int ret;
+
+	while (1) {
+		head = *ring->cq_head;
+
+		/* if there is a completion, consume it */
+		if (head != uring_load_acquire(ring->cq_tail))
+			break;
+
+		ret = syscall(__NR_io_uring_enter, ring->f, 0, 1, IORING_ENTER_GETEVENTS, 0, 0);
+		if (ret < 0) {
+			/* LCOV_EXCL_START */
+			if (errno == EINTR || errno == EAGAIN || errno == EBUSY)
+				continue;
+			return -1;
+			/* LCOV_EXCL_STOP */
+		}
+	}
+
+	cqe = (struct io_uring_cqe*)ring->cqes + (head & *ring->cq_mask);
+	*arg = (void*)(uintptr_t)cqe->user_data;
+	*result = cqe->res;
+
+	uring_store_release(ring->cq_head, head + 1);
+
+	--ring->inflight;
+
+	return 0;
+}
+
+#else
+
+int uring_init(struct snapraid_uring* ring, unsigned entries)
+{
+	(void)entries;
+
+	ring->f = -1;
+
+	errno = ENOSYS;
+	return -1;
+}
+
+void uring_done(struct snapraid_uring* ring)
+{
+	(void)ring;
+}
+
+int uring_queue(struct snapraid_uring* ring, int is_write, int f, void* buffer, unsigned size, data_off_t offset, void* arg)
+{
+	(void)ring;
+	(void)is_write;
+	(void)f;
+	(void)buffer;
+	(void)size;
+	(void)offset;
+	(void)arg;
+
+	return -1;
+}
+
+int uring_submit(struct snapraid_uring* ring)
+{
+	(void)ring;
+
+	errno = ENOSYS;
+	return -1;
+}
+
+int uring_wait(struct snapraid_uring* ring, void** arg, int* result)
+{
+	(void)ring;
+	(void)arg;
+	(void)result;
+
+	errno = ENOSYS;
+	return -1;
+}
+
+#endif
+
@@ -0,0 +1,100 @@
+/*
+ * Copyright (C) 2016 Andrea Mazzoleni
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef __URING_H
+#define __URING_H
+
+#include "support.h"
+
+/****************************************************************************/
+/* uring */
+
+/**
+ * Minimal io_uring ring.
+ *
+ * It uses directly the kernel interface, without requiring liburing.
+ * Only plain read, write and statx requests are supported, and the ring
+ * is only accessed by a single thread.
+ */
+struct snapraid_uring {
+	int f; /**< Handle of the ring. -1 if not initialized. */
+	unsigned entries; /**< Number of submission entries. */
+	unsigned inflight; /**< Number of requests submitted and not yet completed. */
+	unsigned queued; /**< Number of requests queued and not yet submitted. */
+
+	void* sq_ptr; /**< Mapping of the submission ring. */
+	size_t sq_size;
+	void* cq_ptr; /**< Mapping of the completion ring. */
+	size_t cq_size;
+	void* sqe_ptr; /**< Mapping of the submission entries. */
+	size_t sqe_size;
+
+	unsigned* sq_head;
+	unsigned* sq_tail;
+	unsigned* sq_mask;
+	unsigned* sq_array;
+	unsigned* cq_head;
+	unsigned* cq_tail;
+	unsigned* cq_mask;
+	void* cqes;
+};
+
+/**
+ * Create a ring with at least the specified number of entries.
+ * Return -1 on error with errno set. ENOSYS if not supported.
+ */
+int uring_init(struct snapraid_uring* ring, unsigned entries);
+
+/**
+ * Destroy the ring.
+ * All the requests must be already completed.
+ */
+void uring_done(struct snapraid_uring* ring);
+
+/**
+ * Queue a read or write request.
+ * The request is not started until uring_submit() is called.
+ * Return -1 if the ring is full.
+ */
+int uring_queue(struct snapraid_uring* ring, int is_write, int f, void* buffer, unsigned size, data_off_t offset, void* arg);
+
+#if HAVE_IO_URING_STATX
+/**
+ * Queue a statx request for a file in a directory.
+ * The fields requested are the ones of lstat_scan().
+ * The name and the statx buffer must remain valid until completion.
+ * Return -1 if the ring is full.
+ */
+int uring_queue_statx(struct snapraid_uring* ring, int dir, const char* name, struct statx* stx, void* arg);
+#endif
+
+/**
+ * Submit all the queued requests.
+ * Return -1 on error with errno set.
+ */
+int uring_submit(struct snapraid_uring* ring);
+
+/**
+ * Wait for the completion of a request.
+ * \param arg The argument of the request completed.
+ * \param result The number of bytes transferred or the negated errno.
+ * Return -1 on error with errno set.
+ */
+int uring_wait(struct snapraid_uring* ring, void** arg, int* result);
+
+#endif
+
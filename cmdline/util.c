@@ -442,6 +442,43 @@ uint32_t crc32c_x86(uint32_t crc, const unsigned char* ptr, unsigned size)
 
 uint32_t (*crc32c)(uint32_t crc, const unsigned char* ptr, unsigned size);
 
+/**
+ * Multiply two polynomials modulo the CRC-32 (Castagnoli) one.
+ *
+ * The polynomials are in the reflected bit order of the CRC.
+ */
+static uint32_t crc32c_multmodp(uint32_t a, uint32_t b)
+{
+	uint32_t m = (uint32_t)1 << 31;
+	uint32_t p = 0;
+
+	while (m != 0) {
+		if (a & m)
+			p ^= b;
+		m >>= 1;
+		b = b & 1 ? (b >> 1) ^ 0x82F63B78 : b >> 1;
+	}
+
+	return p;
+}
+
+uint32_t crc32c_combine(uint32_t crc1, uint32_t crc2, uint64_t size2)
+{
+	uint32_t p = (uint32_t)1 << 31; /* x^0 */
+	uint32_t x = (uint32_t)1 << 23; /* x^8, the shift of one byte */
+
+	/* compute x^(8*size2) squaring x for each bit of the size */
+	while (size2 != 0) {
+		if (size2 & 1)
+			p = crc32c_multmodp(x, p);
+		x = crc32c_multmodp(x, x);
+		size2 >>= 1;
+	}
+
+	/* shift the first crc after the second block */
+	return crc32c_multmodp(p, crc1) ^ crc2;
+}
+
 void crc32c_init(void)
 {
 	crc32c = crc32c_gen;
@@ -163,6 +163,16 @@ static inline uint32_t crc32c_plain(uint32_t crc, const unsigned char* ptr, unsi
  */
 uint32_t (*crc32c)(uint32_t crc, const unsigned char* ptr, unsigned size);
 
+/**
+ * Combine the CRC-32 (Castagnoli) of two consecutive blocks of data.
+ *
+ * \param crc1 CRC of the first block.
+ * \param crc2 CRC of the second block.
+ * \param size2 Size of the second block.
+ * \return The CRC of the two blocks together.
+ */
+uint32_t crc32c_combine(uint32_t crc1, uint32_t crc2, uint64_t size2);
+
 /**
  * Internal entry points for testing.
  */
@@ -134,6 +134,8 @@ int raid_check(int nr, int *ir, int nd, int np, size_t size, void **v)
 	BUG_ON(nr >= 4 && ir[2] >= ir[3]);
 	BUG_ON(nr >= 5 && ir[3] >= ir[4]);
 	BUG_ON(nr >= 6 && ir[4] >= ir[5]);
+	BUG_ON(nr >= 7 && ir[5] >= ir[6]);
+	BUG_ON(nr >= 8 && ir[6] >= ir[7]); /* never true, as nr < np, but kept like raid_rec() */
 
 	/* enforce limit on index vector */
 	BUG_ON(nr > 0 && ir[nr-1] >= nd + np);
@@ -212,6 +212,30 @@ static inline int raid_cpu_has_avx512bw(void)
 		(3 << 1) | (7 << 5)); /* OS saves XMM, YMM and ZMM registers */
 }
 
+static inline int raid_cpu_has_gfni(void)
+{
+	uint32_t reg[4];
+
+	/*
+	 * Intel Architecture Instruction Set Extensions Programming Reference
+	 * 319433-030 October 2017
+	 *
+	 * 1.4 Detection of GFNI instructions
+	 * Galois Field New Instructions are supported if CPUID.(EAX=07H, ECX=0H):ECX.GFNI[bit 8] = 1.
+	 * The 512-bit forms of the instructions require also the support of AVX512F.
+	 */
+
+	/* we use only the 512-bit forms, together with AVX512BW instructions */
+	if (!raid_cpu_has_avx512bw())
+		return 0;
+
+	raid_cpuid(7, 0, reg);
+	if ((reg[2] & (1 << 8)) == 0)
+		return 0;
+
+	return 1;
+}
+
 /**
  * Check if it's an Intel Atom CPU.
  */
@@ -325,6 +349,88 @@ static inline int raid_cpu_has_slowextendedreg(void)
 
 	return 0;
 }
+
+/**
+ * Gets the size of the L2 cache in bytes.
+ * It returns 0 if the size is not reported by the processor.
+ */
+static inline size_t raid_cpu_cache_l2(void)
+{
+	uint32_t reg[4];
+
+	raid_cpuid(0x80000000, 0, reg);
+	if (reg[0] < 0x80000006)
+		return 0;
+
+	/* both Intel and AMD report the L2 size in KiB in ECX[31:16] */
+	raid_cpuid(0x80000006, 0, reg);
+
+	return (size_t)(reg[2] >> 16) * 1024;
+}
+
+/**
+ * Gets the share of the last level cache for each logical processor in bytes.
+ * It returns 0 if the cache is not reported by the processor.
+ */
+static inline size_t raid_cpu_cache_llc_share(void)
+{
+	char vendor[CPU_VENDOR_MAX];
+	unsigned family;
+	unsigned model;
+	uint32_t reg[4];
+	uint32_t leaf;
+	unsigned level;
+	size_t share;
+	unsigned i;
+
+	raid_cpu_info(vendor, &family, &model);
+
+	/* the deterministic cache parameters are in leaf 4 for Intel */
+	/* and in leaf 0x8000001D for AMD, with the same format */
+	if (strcmp(vendor, "AuthenticAMD") == 0) {
+		leaf = 0x8000001D;
+		raid_cpuid(0x80000000, 0, reg);
+	} else {
+		leaf = 4;
+		raid_cpuid(0, 0, reg);
+	}
+	if (reg[0] < leaf)
+		return 0;
+
+	level = 0;
+	share = 0;
+	for (i = 0; i < 16; ++i) {
+		unsigned type;
+		size_t size;
+
+		raid_cpuid(leaf, i, reg);
+
+		/* no more caches */
+		type = reg[0] & 0x1F;
+		if (type == 0)
+			break;
+
+		/* skip the instruction cache */
+		if (type == 2)
+			continue;
+
+		/* keep the highest level */
+		if (((reg[0] >> 5) & 0x7) < level)
+			continue;
+		level = (reg[0] >> 5) & 0x7;
+
+		/* ways * partitions * line size * sets */
+		size = (size_t)((reg[1] >> 22) + 1)
+			* (((reg[1] >> 12) & 0x3FF) + 1)
+			* ((reg[1] & 0xFFF) + 1)
+			* (reg[2] + 1);
+
+		/* divided by the number of logical processors sharing it */
+		share = size / (((reg[0] >> 14) & 0xFFF) + 1);
+	}
+
+	return share;
+}
 #endif
 
 #endif
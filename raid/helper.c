@@ -67,6 +67,45 @@ void raid_sort(int n, int *v)
 		RAID_SWAP(1, 2);
 		RAID_SWAP(3, 4);
 		break;
+	case 7:
+		RAID_SWAP(0, 4);
+		RAID_SWAP(1, 5);
+		RAID_SWAP(2, 6);
+		RAID_SWAP(0, 2);
+		RAID_SWAP(1, 3);
+		RAID_SWAP(4, 6);
+		RAID_SWAP(2, 4);
+		RAID_SWAP(3, 5);
+		RAID_SWAP(0, 1);
+		RAID_SWAP(2, 3);
+		RAID_SWAP(4, 5);
+		RAID_SWAP(1, 4);
+		RAID_SWAP(3, 6);
+		RAID_SWAP(1, 2);
+		RAID_SWAP(3, 4);
+		RAID_SWAP(5, 6);
+		break;
+	case 8:
+		RAID_SWAP(0, 4);
+		RAID_SWAP(1, 5);
+		RAID_SWAP(2, 6);
+		RAID_SWAP(3, 7);
+		RAID_SWAP(0, 2);
+		RAID_SWAP(1, 3);
+		RAID_SWAP(4, 6);
+		RAID_SWAP(5, 7);
+		RAID_SWAP(2, 4);
+		RAID_SWAP(3, 5);
+		RAID_SWAP(0, 1);
+		RAID_SWAP(2, 3);
+		RAID_SWAP(4, 5);
+		RAID_SWAP(6, 7);
+		RAID_SWAP(1, 4);
+		RAID_SWAP(3, 6);
+		RAID_SWAP(1, 2);
+		RAID_SWAP(3, 4);
+		RAID_SWAP(5, 6);
+		break;
 	}
 }
 
@@ -371,6 +371,84 @@ void raid_gen6_int8(int nd, size_t size, void **vv)
 	}
 }
 
+/*
+ * GENX (generic parity with Cauchy matrix) 8bit C implementation
+ *
+ * It computes from 3 to 8 parities, with @np expected to be a
+ * compile time constant. The compiler specializes the function for
+ * each parity level, removing all the checks on @np.
+ *
+ * Note that like the other 8bit functions, this is only a kind of
+ * reference function, and we are not really interested in speed.
+ */
+static __always_inline void raid_genX_int8(int np, int nd, size_t size, void **vv)
+{
+	uint8_t **v = (uint8_t **)vv;
+	uint8_t *p[RAID_PARITY_MAX];
+	int d, l, j;
+	size_t i;
+
+	uint8_t d0, a0, a1, a2, a3, a4, a5, a6, a7;
+
+	l = nd - 1;
+	for (j = 0; j < np; ++j)
+		p[j] = v[nd + j];
+
+	for (i = 0; i < size; i += 1) {
+		a0 = a1 = a2 = a3 = a4 = a5 = a6 = a7 = 0;
+		for (d = l; d > 0; --d) {
+			d0 = v_8(v[d][i]);
+
+			a0 ^= d0;
+			a1 ^= gfmul[d0][gfgen[1][d]];
+			a2 ^= gfmul[d0][gfgen[2][d]];
+			if (np > 3)
+				a3 ^= gfmul[d0][gfgen[3][d]];
+			if (np > 4)
+				a4 ^= gfmul[d0][gfgen[4][d]];
+			if (np > 5)
+				a5 ^= gfmul[d0][gfgen[5][d]];
+			if (np > 6)
+				a6 ^= gfmul[d0][gfgen[6][d]];
+			if (np > 7)
+				a7 ^= gfmul[d0][gfgen[7][d]];
+		}
+
+		/* first disk with all coefficients at 1 */
+		d0 = v_8(v[0][i]);
+
+		v_8(p[0][i]) = a0 ^ d0;
+		v_8(p[1][i]) = a1 ^ d0;
+		v_8(p[2][i]) = a2 ^ d0;
+		if (np > 3)
+			v_8(p[3][i]) = a3 ^ d0;
+		if (np > 4)
+			v_8(p[4][i]) = a4 ^ d0;
+		if (np > 5)
+			v_8(p[5][i]) = a5 ^ d0;
+		if (np > 6)
+			v_8(p[6][i]) = a6 ^ d0;
+		if (np > 7)
+			v_8(p[7][i]) = a7 ^ d0;
+	}
+}
+
+/*
+ * GEN7 (hepta parity with Cauchy matrix) 8bit C implementation
+ */
+void raid_gen7_int8(int nd, size_t size, void **vv)
+{
+	raid_genX_int8(7, nd, size, vv);
+}
+
+/*
+ * GEN8 (octa parity with Cauchy matrix) 8bit C implementation
+ */
+void raid_gen8_int8(int nd, size_t size, void **vv)
+{
+	raid_genX_int8(8, nd, size, vv);
+}
+
 /*
  * Recover failure of one data block at index id[0] using parity at index
  * ip[0] for any RAID level.
@@ -445,8 +523,7 @@ void raid_rec2_int8(int nr, int *id, int *ip, int nd, size_t size, void **vv)
 	uint8_t *qa;
 	const int N = 2;
 	const uint8_t *T[N][N];
-	uint8_t G[N * N];
-	uint8_t V[N * N];
+	const uint8_t *V;
 	size_t i;
 	int j, k;
 
@@ -458,13 +535,8 @@ void raid_rec2_int8(int nr, int *id, int *ip, int nd, size_t size, void **vv)
 		return;
 	}
 
-	/* setup the coefficients matrix */
-	for (j = 0; j < N; ++j)
-		for (k = 0; k < N; ++k)
-			G[j * N + k] = A(ip[j], id[k]);
-
-	/* invert it to solve the system of linear equations */
-	raid_invert(G, V, N);
+	/* get the inverted coefficients matrix to solve the system of linear equations */
+	V = raid_rec_matrix(N, id, ip);
 
 	/* get multiplication tables */
 	for (j = 0; j < N; ++j)
@@ -510,18 +582,12 @@ void raid_recX_int8(int nr, int *id, int *ip, int nd, size_t size, void **vv)
 	uint8_t *p[RAID_PARITY_MAX];
 	uint8_t *pa[RAID_PARITY_MAX];
 	const uint8_t *T[RAID_PARITY_MAX][RAID_PARITY_MAX];
-	uint8_t G[RAID_PARITY_MAX * RAID_PARITY_MAX];
-	uint8_t V[RAID_PARITY_MAX * RAID_PARITY_MAX];
+	const uint8_t *V;
 	size_t i;
 	int j, k;
 
-	/* setup the coefficients matrix */
-	for (j = 0; j < nr; ++j)
-		for (k = 0; k < nr; ++k)
-			G[j * nr + k] = A(ip[j], id[k]);
-
-	/* invert it to solve the system of linear equations */
-	raid_invert(G, V, nr);
+	/* get the inverted coefficients matrix to solve the system of linear equations */
+	V = raid_rec_matrix(nr, id, ip);
 
 	/* get multiplication tables */
 	for (j = 0; j < nr; ++j)
@@ -554,3 +620,29 @@ void raid_recX_int8(int nr, int *id, int *ip, int nd, size_t size, void **vv)
 	}
 }
 
+/*
+ * Parity update 8bit C implementation
+ */
+void raid_add_int8(int id, int np, size_t size, void **vv)
+{
+	uint8_t **v = (uint8_t **)vv;
+	uint8_t *d;
+	size_t i;
+	int j;
+
+	d = v[0];
+
+	/* the first parity has always coefficient 1, and it's a plain xor */
+	for (i = 0; i < size; i += 8)
+		v_64(v[1][i]) ^= v_64(d[i]);
+
+	/* the other parities are multiplied by their coefficient */
+	for (j = 1; j < np; ++j) {
+		const uint8_t *T = gfmul[gfgen[j][id]];
+		uint8_t *p = v[1 + j];
+
+		for (i = 0; i < size; ++i)
+			p[i] ^= T[d[i]];
+	}
+}
+
@@ -43,7 +43,7 @@
 #endif
 #endif
 
-/* Enables SSE2, SSSE3, AVX2 only if the assembler supports it */
+/* Enables SSE2, SSSE3, AVX2, AVX512BW, GFNI only if the assembler supports it */
 #if HAVE_SSE2
 #define CONFIG_SSE2 1
 #endif
@@ -53,6 +53,12 @@
 #if HAVE_AVX2
 #define CONFIG_AVX2 1
 #endif
+#if HAVE_AVX512BW
+#define CONFIG_AVX512BW 1
+#endif
+#if HAVE_GFNI
+#define CONFIG_GFNI 1
+#endif
 
 #else /* if HAVE_CONFIG_H is not defined */
 
@@ -72,6 +78,8 @@
 #define CONFIG_SSE2 1
 #define CONFIG_SSSE3 1
 #define CONFIG_AVX2 1
+#define CONFIG_AVX512BW 1
+#define CONFIG_GFNI 1
 #endif
 #endif
 
@@ -95,6 +103,13 @@
 #define __always_inline inline __attribute__((always_inline))
 #endif
 
+/*
+ * Thread local storage.
+ */
+#ifndef __thread_local
+#define __thread_local __thread
+#endif
+
 /*
  * Forced alignment.
  */
@@ -128,39 +143,95 @@ static __always_inline void *__align_ptr(void *ptr, uintptr_t size)
 int raid_selftest(void);
 void raid_gen_ref(int nd, int np, size_t size, void **vv);
 void raid_invert(uint8_t *M, uint8_t *V, int n);
+void raid_rec_invert(int nr, int *id, int *ip, uint8_t *V);
+const uint8_t *raid_rec_matrix(int nr, int *id, int *ip);
 void raid_delta_gen(int nr, int *id, int *ip, int nd, size_t size, void **v);
 void raid_rec1of1(int *id, int nd, size_t size, void **v);
 void raid_rec2of2_int8(int *id, int *ip, int nd, size_t size, void **vv);
 void raid_gen1_int32(int nd, size_t size, void **vv);
 void raid_gen1_int64(int nd, size_t size, void **vv);
 void raid_gen1_sse2(int nd, size_t size, void **vv);
+void raid_gen1_sse2_temporal(int nd, size_t size, void **vv);
 void raid_gen1_avx2(int nd, size_t size, void **vv);
+void raid_gen1_avx2_temporal(int nd, size_t size, void **vv);
+void raid_gen1_avx512bw(int nd, size_t size, void **vv);
+void raid_gen1_avx512bw_temporal(int nd, size_t size, void **vv);
 void raid_gen2_int32(int nd, size_t size, void **vv);
 void raid_gen2_int64(int nd, size_t size, void **vv);
 void raid_gen2_sse2(int nd, size_t size, void **vv);
+void raid_gen2_sse2_temporal(int nd, size_t size, void **vv);
 void raid_gen2_avx2(int nd, size_t size, void **vv);
+void raid_gen2_avx2_temporal(int nd, size_t size, void **vv);
+void raid_gen2_avx512bw(int nd, size_t size, void **vv);
+void raid_gen2_avx512bw_temporal(int nd, size_t size, void **vv);
 void raid_gen2_sse2ext(int nd, size_t size, void **vv);
+void raid_gen2_sse2ext_temporal(int nd, size_t size, void **vv);
 void raid_genz_int32(int nd, size_t size, void **vv);
 void raid_genz_int64(int nd, size_t size, void **vv);
 void raid_genz_sse2(int nd, size_t size, void **vv);
+void raid_genz_sse2_temporal(int nd, size_t size, void **vv);
 void raid_genz_sse2ext(int nd, size_t size, void **vv);
+void raid_genz_sse2ext_temporal(int nd, size_t size, void **vv);
 void raid_genz_avx2ext(int nd, size_t size, void **vv);
+void raid_genz_avx2ext_temporal(int nd, size_t size, void **vv);
 void raid_gen3_int8(int nd, size_t size, void **vv);
 void raid_gen3_ssse3(int nd, size_t size, void **vv);
+void raid_gen3_ssse3_temporal(int nd, size_t size, void **vv);
 void raid_gen3_ssse3ext(int nd, size_t size, void **vv);
+void raid_gen3_ssse3ext_temporal(int nd, size_t size, void **vv);
 void raid_gen3_avx2ext(int nd, size_t size, void **vv);
+void raid_gen3_avx2ext_temporal(int nd, size_t size, void **vv);
+void raid_gen3_avx512bwext(int nd, size_t size, void **vv);
+void raid_gen3_avx512bwext_temporal(int nd, size_t size, void **vv);
+void raid_gen3_gfni(int nd, size_t size, void **vv);
+void raid_gen3_gfni_temporal(int nd, size_t size, void **vv);
 void raid_gen4_int8(int nd, size_t size, void **vv);
 void raid_gen4_ssse3(int nd, size_t size, void **vv);
+void raid_gen4_ssse3_temporal(int nd, size_t size, void **vv);
 void raid_gen4_ssse3ext(int nd, size_t size, void **vv);
+void raid_gen4_ssse3ext_temporal(int nd, size_t size, void **vv);
 void raid_gen4_avx2ext(int nd, size_t size, void **vv);
+void raid_gen4_avx2ext_temporal(int nd, size_t size, void **vv);
+void raid_gen4_avx512bwext(int nd, size_t size, void **vv);
+void raid_gen4_avx512bwext_temporal(int nd, size_t size, void **vv);
+void raid_gen4_gfni(int nd, size_t size, void **vv);
+void raid_gen4_gfni_temporal(int nd, size_t size, void **vv);
 void raid_gen5_int8(int nd, size_t size, void **vv);
 void raid_gen5_ssse3(int nd, size_t size, void **vv);
+void raid_gen5_ssse3_temporal(int nd, size_t size, void **vv);
 void raid_gen5_ssse3ext(int nd, size_t size, void **vv);
+void raid_gen5_ssse3ext_temporal(int nd, size_t size, void **vv);
 void raid_gen5_avx2ext(int nd, size_t size, void **vv);
+void raid_gen5_avx2ext_temporal(int nd, size_t size, void **vv);
+void raid_gen5_avx512bwext(int nd, size_t size, void **vv);
+void raid_gen5_avx512bwext_temporal(int nd, size_t size, void **vv);
+void raid_gen5_gfni(int nd, size_t size, void **vv);
+void raid_gen5_gfni_temporal(int nd, size_t size, void **vv);
 void raid_gen6_int8(int nd, size_t size, void **vv);
 void raid_gen6_ssse3(int nd, size_t size, void **vv);
+void raid_gen6_ssse3_temporal(int nd, size_t size, void **vv);
 void raid_gen6_ssse3ext(int nd, size_t size, void **vv);
+void raid_gen6_ssse3ext_temporal(int nd, size_t size, void **vv);
 void raid_gen6_avx2ext(int nd, size_t size, void **vv);
+void raid_gen6_avx2ext_temporal(int nd, size_t size, void **vv);
+void raid_gen6_avx512bwext(int nd, size_t size, void **vv);
+void raid_gen6_avx512bwext_temporal(int nd, size_t size, void **vv);
+void raid_gen6_gfni(int nd, size_t size, void **vv);
+void raid_gen6_gfni_temporal(int nd, size_t size, void **vv);
+void raid_gen7_int8(int nd, size_t size, void **vv);
+void raid_gen7_ssse3ext(int nd, size_t size, void **vv);
+void raid_gen7_avx2ext(int nd, size_t size, void **vv);
+void raid_gen7_avx512bwext(int nd, size_t size, void **vv);
+void raid_gen7_avx512bwext_temporal(int nd, size_t size, void **vv);
+void raid_gen7_gfniext(int nd, size_t size, void **vv);
+void raid_gen7_gfniext_temporal(int nd, size_t size, void **vv);
+void raid_gen8_int8(int nd, size_t size, void **vv);
+void raid_gen8_ssse3ext(int nd, size_t size, void **vv);
+void raid_gen8_avx2ext(int nd, size_t size, void **vv);
+void raid_gen8_avx512bwext(int nd, size_t size, void **vv);
+void raid_gen8_avx512bwext_temporal(int nd, size_t size, void **vv);
+void raid_gen8_gfniext(int nd, size_t size, void **vv);
+void raid_gen8_gfniext_temporal(int nd, size_t size, void **vv);
 void raid_rec1_int8(int nr, int *id, int *ip, int nd, size_t size, void **vv);
 void raid_rec2_int8(int nr, int *id, int *ip, int nd, size_t size, void **vv);
 void raid_recX_int8(int nr, int *id, int *ip, int nd, size_t size, void **vv);
@@ -170,6 +241,14 @@ void raid_recX_ssse3(int nr, int *id, int *ip, int nd, size_t size, void **vv);
 void raid_rec1_avx2(int nr, int *id, int *ip, int nd, size_t size, void **vv);
 void raid_rec2_avx2(int nr, int *id, int *ip, int nd, size_t size, void **vv);
 void raid_recX_avx2(int nr, int *id, int *ip, int nd, size_t size, void **vv);
+void raid_rec1_avx512bw(int nr, int *id, int *ip, int nd, size_t size, void **vv);
+void raid_recX_avx512bw(int nr, int *id, int *ip, int nd, size_t size, void **vv);
+void raid_rec1_gfni(int nr, int *id, int *ip, int nd, size_t size, void **vv);
+void raid_recX_gfni(int nr, int *id, int *ip, int nd, size_t size, void **vv);
+void raid_add_int8(int id, int np, size_t size, void **vv);
+void raid_add_ssse3(int id, int np, size_t size, void **vv);
+void raid_add_avx2(int id, int np, size_t size, void **vv);
+void raid_add_gfni(int id, int np, size_t size, void **vv);
 
 /*
  * Internal naming.
@@ -183,9 +262,12 @@ const char *raid_gen3_tag(void);
 const char *raid_gen4_tag(void);
 const char *raid_gen5_tag(void);
 const char *raid_gen6_tag(void);
+const char *raid_gen7_tag(void);
+const char *raid_gen8_tag(void);
 const char *raid_rec1_tag(void);
 const char *raid_rec2_tag(void);
 const char *raid_recX_tag(void);
+const char *raid_add_tag(void);
 
 /*
  * Internal forwarders.
@@ -196,6 +278,22 @@ extern void (*raid_gen_ptr[RAID_PARITY_MAX])(
 	int nd, size_t size, void **vv);
 extern void (*raid_rec_ptr[RAID_PARITY_MAX])(
 	int nr, int *id, int *ip, int nd, size_t size, void **vv);
+extern void (*raid_add_ptr)(int id, int np, size_t size, void **vv);
+extern void (*raid_gen3_temporal_ptr)(int nd, size_t size, void **vv);
+extern void (*raid_genz_temporal_ptr)(int nd, size_t size, void **vv);
+extern void (*raid_gen_temporal_ptr[RAID_PARITY_MAX])(
+	int nd, size_t size, void **vv);
+
+/*
+ * Size of the blocks processed together over which non-temporal stores are used.
+ */
+extern size_t raid_stream_size;
+
+/*
+ * Tiling configuration set by raid_tile().
+ */
+extern size_t raid_tile_cache;
+extern int raid_tile_prefetch;
 
 /*
  * Tables.
@@ -204,9 +302,11 @@ extern const uint8_t raid_gfmul[256][256] __aligned(256);
 extern const uint8_t raid_gfexp[256] __aligned(256);
 extern const uint8_t raid_gfinv[256] __aligned(256);
 extern const uint8_t raid_gfvandermonde[3][256] __aligned(256);
-extern const uint8_t raid_gfcauchy[6][256] __aligned(256);
-extern const uint8_t raid_gfcauchypshufb[251][4][2][16] __aligned(256);
+extern const uint8_t raid_gfcauchy[8][256] __aligned(256);
+extern const uint8_t raid_gfcauchypshufb[251][8][2][16] __aligned(256);
 extern const uint8_t raid_gfmulpshufb[256][2][16] __aligned(256);
+extern const uint64_t raid_gfcauchyaffine[251][8] __aligned(256);
+extern const uint64_t raid_gfmulaffine[256] __aligned(256);
 extern const uint8_t (*raid_gfgen)[256];
 #define gfmul raid_gfmul
 #define gfexp raid_gfexp
@@ -215,6 +315,8 @@ extern const uint8_t (*raid_gfgen)[256];
 #define gfcauchy raid_gfcauchy
 #define gfgenpshufb raid_gfcauchypshufb
 #define gfmulpshufb raid_gfmulpshufb
+#define gfgenaffine raid_gfcauchyaffine
+#define gfmulaffine raid_gfmulaffine
 #define gfgen raid_gfgen
 
 /*
@@ -252,7 +354,7 @@ static __always_inline void raid_sse_end(void)
 }
 #endif
 
-#ifdef CONFIG_AVX2
+#if defined(CONFIG_AVX2) || defined(CONFIG_AVX512BW)
 static __always_inline void raid_avx_begin(void)
 {
 	raid_sse_begin();
@@ -262,7 +364,7 @@ static __always_inline void raid_avx_end(void)
 {
 	raid_sse_end();
 
-	/* reset the upper part of the ymm registers */
+	/* reset the upper part of the ymm and zmm registers */
 	/* to avoid the 70 clocks penality on the next */
 	/* xmm register use */
 	asm volatile ("vzeroupper" : : : "memory");
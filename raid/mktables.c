@@ -49,13 +49,21 @@ uint8_t gfinv[256];
  * Number of parities.
  * This is the number of rows of the generator matrix.
  */
-#define PARITY 6
+#define PARITY 8
+
+/**
+ * Number of parities with the full number of disks.
+ */
+#define PARITY_FULL 6
 
 /**
  * Number of disks.
  * This is the number of columns of the generator matrix.
+ *
+ * Rows after PARITY_FULL are valid only for a reduced number of disks,
+ * at most 257 minus the number of parities. See set_cauchy().
  */
-#define DISK (257 - PARITY)
+#define DISK (257 - PARITY_FULL)
 
 /**
  * Setup the Cauchy matrix used to generate the parity.
@@ -130,6 +138,10 @@ static void set_cauchy(uint8_t *matrix)
 	 *
 	 * with 2^-i + 2^j != 0 for any i,j with i>=0,j>=1,i+j<255
 	 *
+	 * This limits the number of disks with more than PARITY_FULL rows,
+	 * because the last row with j=PARITY-2 is valid only for i<257-PARITY.
+	 * The elements after such limit must not be used.
+	 *
 	 * In the example we get:
 	 *
 	 * y_1 = 2
@@ -201,6 +213,32 @@ static void set_power(uint8_t *matrix)
 	}
 }
 
+/**
+ * GF2P8AFFINEQB matrix for the multiplication by a constant in GF(2^8).
+ *
+ * The byte 7-i of the matrix is the row computing the bit i of the result,
+ * and the bit j of the row is the bit i of the constant multiplied by 2^j.
+ */
+static uint64_t gfaffine(uint8_t a)
+{
+	uint64_t m;
+	int i, j;
+
+	m = 0;
+	for (i = 0; i < 8; ++i) {
+		uint8_t row = 0;
+
+		for (j = 0; j < 8; ++j) {
+			if ((gfmul(a, 1 << j) >> i) & 1)
+				row |= 1 << j;
+		}
+
+		m |= (uint64_t)row << (8 * (7 - i));
+	}
+
+	return m;
+}
+
 /**
  * Next power of 2.
  */
@@ -335,7 +373,8 @@ int main(void)
 
 	printf("/**\n");
 	printf(" * Cauchy matrix used to generate parity.\n");
-	printf(" * This matrix is valid for up to %u parity with %u data disks.\n", PARITY, DISK);
+	printf(" * This matrix is valid for up to %u parity with %u data disks.\n", PARITY_FULL, DISK);
+	printf(" * With up to %u parity, each additional one removes a data disk.\n", PARITY);
 	printf(" *\n");
 	for (p = 0; p < PARITY; ++p) {
 		printf(" *");
@@ -423,6 +462,48 @@ int main(void)
 	printf("};\n");
 	printf("#endif\n\n");
 
+	printf("#ifdef CONFIG_X86\n");
+	printf("/**\n");
+	printf(" * GF2P8AFFINEQB matrices for the Cauchy matrix.\n");
+	printf(" *\n");
+	printf(" * Indexes are [DISK][PARITY - 2].\n");
+	printf(" * Where DISK is from 0 to %u, PARITY from 2 to %u.\n", DISK - 1, PARITY - 1);
+	printf(" */\n");
+	printf("const uint64_t __aligned(256) raid_gfcauchyaffine[%u][%u] =\n", DISK, np(PARITY - 2));
+	printf("{\n");
+	for (i = 0; i < DISK; ++i) {
+		printf("\t{ ");
+		for (p = 2; p < PARITY; ++p) {
+			printf("0x%016llxULL", (unsigned long long)gfaffine(matrix[p * DISK + i]));
+			if (p != PARITY - 1)
+				printf(", ");
+		}
+		printf(" },\n");
+	}
+	printf("};\n");
+	printf("#endif\n\n");
+
+	printf("#ifdef CONFIG_X86\n");
+	printf("/**\n");
+	printf(" * GF2P8AFFINEQB matrices for generic multiplication.\n");
+	printf(" *\n");
+	printf(" * Indexes are [MULTIPLER].\n");
+	printf(" * Where MULTIPLER is from 0 to 255.\n");
+	printf(" */\n");
+	printf("const uint64_t __aligned(256) raid_gfmulaffine[256] =\n");
+	printf("{\n");
+	for (i = 0; i < 256; ++i) {
+		if (i % 4 == 0)
+			printf("\t");
+		printf("0x%016llxULL,", (unsigned long long)gfaffine(i));
+		if (i % 4 == 3)
+			printf("\n");
+		else
+			printf(" ");
+	}
+	printf("};\n");
+	printf("#endif\n\n");
+
 	return 0;
 }
 
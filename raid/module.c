@@ -22,18 +22,32 @@
 void raid_init(void)
 {
 	raid_gen3_ptr = raid_gen3_int8;
+	raid_gen3_temporal_ptr = raid_gen3_int8;
 	raid_gen_ptr[3] = raid_gen4_int8;
+	raid_gen_temporal_ptr[3] = raid_gen4_int8;
 	raid_gen_ptr[4] = raid_gen5_int8;
+	raid_gen_temporal_ptr[4] = raid_gen5_int8;
 	raid_gen_ptr[5] = raid_gen6_int8;
+	raid_gen_temporal_ptr[5] = raid_gen6_int8;
+	raid_gen_ptr[6] = raid_gen7_int8;
+	raid_gen_temporal_ptr[6] = raid_gen7_int8;
+	raid_gen_ptr[7] = raid_gen8_int8;
+	raid_gen_temporal_ptr[7] = raid_gen8_int8;
 
 	if (sizeof(void *) == 4) {
 		raid_gen_ptr[0] = raid_gen1_int32;
+		raid_gen_temporal_ptr[0] = raid_gen1_int32;
 		raid_gen_ptr[1] = raid_gen2_int32;
+		raid_gen_temporal_ptr[1] = raid_gen2_int32;
 		raid_genz_ptr = raid_genz_int32;
+		raid_genz_temporal_ptr = raid_genz_int32;
 	} else {
 		raid_gen_ptr[0] = raid_gen1_int64;
+		raid_gen_temporal_ptr[0] = raid_gen1_int64;
 		raid_gen_ptr[1] = raid_gen2_int64;
+		raid_gen_temporal_ptr[1] = raid_gen2_int64;
 		raid_genz_ptr = raid_genz_int64;
+		raid_genz_temporal_ptr = raid_genz_int64;
 	}
 
 	raid_rec_ptr[0] = raid_rec1_int8;
@@ -42,22 +56,31 @@ void raid_init(void)
 	raid_rec_ptr[3] = raid_recX_int8;
 	raid_rec_ptr[4] = raid_recX_int8;
 	raid_rec_ptr[5] = raid_recX_int8;
+	raid_rec_ptr[6] = raid_recX_int8;
+	raid_rec_ptr[7] = raid_recX_int8;
+	raid_add_ptr = raid_add_int8;
 
 #ifdef CONFIG_X86
 #ifdef CONFIG_SSE2
 	if (raid_cpu_has_sse2()) {
 		raid_gen_ptr[0] = raid_gen1_sse2;
+		raid_gen_temporal_ptr[0] = raid_gen1_sse2_temporal;
 #ifdef CONFIG_X86_64
 		if (raid_cpu_has_slowextendedreg()) {
 			raid_gen_ptr[1] = raid_gen2_sse2;
+			raid_gen_temporal_ptr[1] = raid_gen2_sse2_temporal;
 		} else {
 			raid_gen_ptr[1] = raid_gen2_sse2ext;
+			raid_gen_temporal_ptr[1] = raid_gen2_sse2ext_temporal;
 		}
 		/* note that raid_cpu_has_slowextendedreg() doesn't affect parz */
 		raid_genz_ptr = raid_genz_sse2ext;
+		raid_genz_temporal_ptr = raid_genz_sse2ext_temporal;
 #else
 		raid_gen_ptr[1] = raid_gen2_sse2;
+		raid_gen_temporal_ptr[1] = raid_gen2_sse2_temporal;
 		raid_genz_ptr = raid_genz_sse2;
+		raid_genz_temporal_ptr = raid_genz_sse2_temporal;
 #endif
 	}
 #endif
@@ -67,20 +90,37 @@ void raid_init(void)
 #ifdef CONFIG_X86_64
 		if (raid_cpu_has_slowextendedreg()) {
 			raid_gen3_ptr = raid_gen3_ssse3;
+			raid_gen3_temporal_ptr = raid_gen3_ssse3_temporal;
 			raid_gen_ptr[3] = raid_gen4_ssse3;
+			raid_gen_temporal_ptr[3] = raid_gen4_ssse3_temporal;
 			raid_gen_ptr[4] = raid_gen5_ssse3;
+			raid_gen_temporal_ptr[4] = raid_gen5_ssse3_temporal;
 			raid_gen_ptr[5] = raid_gen6_ssse3;
+			raid_gen_temporal_ptr[5] = raid_gen6_ssse3_temporal;
 		} else {
 			raid_gen3_ptr = raid_gen3_ssse3ext;
+			raid_gen3_temporal_ptr = raid_gen3_ssse3ext_temporal;
 			raid_gen_ptr[3] = raid_gen4_ssse3ext;
+			raid_gen_temporal_ptr[3] = raid_gen4_ssse3ext_temporal;
 			raid_gen_ptr[4] = raid_gen5_ssse3ext;
+			raid_gen_temporal_ptr[4] = raid_gen5_ssse3ext_temporal;
 			raid_gen_ptr[5] = raid_gen6_ssse3ext;
+			raid_gen_temporal_ptr[5] = raid_gen6_ssse3ext_temporal;
 		}
+		/* note that raid_cpu_has_slowextendedreg() doesn't affect gen7 and gen8 */
+		raid_gen_ptr[6] = raid_gen7_ssse3ext;
+		raid_gen_temporal_ptr[6] = raid_gen7_ssse3ext;
+		raid_gen_ptr[7] = raid_gen8_ssse3ext;
+		raid_gen_temporal_ptr[7] = raid_gen8_ssse3ext;
 #else
 		raid_gen3_ptr = raid_gen3_ssse3;
+		raid_gen3_temporal_ptr = raid_gen3_ssse3_temporal;
 		raid_gen_ptr[3] = raid_gen4_ssse3;
+		raid_gen_temporal_ptr[3] = raid_gen4_ssse3_temporal;
 		raid_gen_ptr[4] = raid_gen5_ssse3;
+		raid_gen_temporal_ptr[4] = raid_gen5_ssse3_temporal;
 		raid_gen_ptr[5] = raid_gen6_ssse3;
+		raid_gen_temporal_ptr[5] = raid_gen6_ssse3_temporal;
 #endif
 		raid_rec_ptr[0] = raid_rec1_ssse3;
 		raid_rec_ptr[1] = raid_rec2_ssse3;
@@ -88,19 +128,33 @@ void raid_init(void)
 		raid_rec_ptr[3] = raid_recX_ssse3;
 		raid_rec_ptr[4] = raid_recX_ssse3;
 		raid_rec_ptr[5] = raid_recX_ssse3;
+		raid_rec_ptr[6] = raid_recX_ssse3;
+		raid_rec_ptr[7] = raid_recX_ssse3;
+		raid_add_ptr = raid_add_ssse3;
 	}
 #endif
 
 #ifdef CONFIG_AVX2
 	if (raid_cpu_has_avx2()) {
 		raid_gen_ptr[0] = raid_gen1_avx2;
+		raid_gen_temporal_ptr[0] = raid_gen1_avx2_temporal;
 		raid_gen_ptr[1] = raid_gen2_avx2;
+		raid_gen_temporal_ptr[1] = raid_gen2_avx2_temporal;
 #ifdef CONFIG_X86_64
 		raid_gen3_ptr = raid_gen3_avx2ext;
+		raid_gen3_temporal_ptr = raid_gen3_avx2ext_temporal;
 		raid_genz_ptr = raid_genz_avx2ext;
+		raid_genz_temporal_ptr = raid_genz_avx2ext_temporal;
 		raid_gen_ptr[3] = raid_gen4_avx2ext;
+		raid_gen_temporal_ptr[3] = raid_gen4_avx2ext_temporal;
 		raid_gen_ptr[4] = raid_gen5_avx2ext;
+		raid_gen_temporal_ptr[4] = raid_gen5_avx2ext_temporal;
 		raid_gen_ptr[5] = raid_gen6_avx2ext;
+		raid_gen_temporal_ptr[5] = raid_gen6_avx2ext_temporal;
+		raid_gen_ptr[6] = raid_gen7_avx2ext;
+		raid_gen_temporal_ptr[6] = raid_gen7_avx2ext;
+		raid_gen_ptr[7] = raid_gen8_avx2ext;
+		raid_gen_temporal_ptr[7] = raid_gen8_avx2ext;
 #endif
 		raid_rec_ptr[0] = raid_rec1_avx2;
 		raid_rec_ptr[1] = raid_rec2_avx2;
@@ -108,10 +162,82 @@ void raid_init(void)
 		raid_rec_ptr[3] = raid_recX_avx2;
 		raid_rec_ptr[4] = raid_recX_avx2;
 		raid_rec_ptr[5] = raid_recX_avx2;
+		raid_rec_ptr[6] = raid_recX_avx2;
+		raid_rec_ptr[7] = raid_recX_avx2;
+		raid_add_ptr = raid_add_avx2;
+	}
+#endif
+
+#ifdef CONFIG_AVX512BW
+	if (raid_cpu_has_avx512bw()) {
+		raid_gen_ptr[0] = raid_gen1_avx512bw;
+		raid_gen_temporal_ptr[0] = raid_gen1_avx512bw_temporal;
+		raid_gen_ptr[1] = raid_gen2_avx512bw;
+		raid_gen_temporal_ptr[1] = raid_gen2_avx512bw_temporal;
+#ifdef CONFIG_X86_64
+		raid_gen3_ptr = raid_gen3_avx512bwext;
+		raid_gen3_temporal_ptr = raid_gen3_avx512bwext_temporal;
+		raid_gen_ptr[3] = raid_gen4_avx512bwext;
+		raid_gen_temporal_ptr[3] = raid_gen4_avx512bwext_temporal;
+		raid_gen_ptr[4] = raid_gen5_avx512bwext;
+		raid_gen_temporal_ptr[4] = raid_gen5_avx512bwext_temporal;
+		raid_gen_ptr[5] = raid_gen6_avx512bwext;
+		raid_gen_temporal_ptr[5] = raid_gen6_avx512bwext_temporal;
+		raid_gen_ptr[6] = raid_gen7_avx512bwext;
+		raid_gen_temporal_ptr[6] = raid_gen7_avx512bwext_temporal;
+		raid_gen_ptr[7] = raid_gen8_avx512bwext;
+		raid_gen_temporal_ptr[7] = raid_gen8_avx512bwext_temporal;
+#endif
+		raid_rec_ptr[0] = raid_rec1_avx512bw;
+		raid_rec_ptr[1] = raid_recX_avx512bw;
+		raid_rec_ptr[2] = raid_recX_avx512bw;
+		raid_rec_ptr[3] = raid_recX_avx512bw;
+		raid_rec_ptr[4] = raid_recX_avx512bw;
+		raid_rec_ptr[5] = raid_recX_avx512bw;
+		raid_rec_ptr[6] = raid_recX_avx512bw;
+		raid_rec_ptr[7] = raid_recX_avx512bw;
+	}
+#endif
+
+#ifdef CONFIG_GFNI
+	if (raid_cpu_has_gfni()) {
+		raid_gen3_ptr = raid_gen3_gfni;
+		raid_gen3_temporal_ptr = raid_gen3_gfni_temporal;
+		raid_gen_ptr[3] = raid_gen4_gfni;
+		raid_gen_temporal_ptr[3] = raid_gen4_gfni_temporal;
+		raid_gen_ptr[4] = raid_gen5_gfni;
+		raid_gen_temporal_ptr[4] = raid_gen5_gfni_temporal;
+		raid_gen_ptr[5] = raid_gen6_gfni;
+		raid_gen_temporal_ptr[5] = raid_gen6_gfni_temporal;
+#ifdef CONFIG_X86_64
+		raid_gen_ptr[6] = raid_gen7_gfniext;
+		raid_gen_temporal_ptr[6] = raid_gen7_gfniext_temporal;
+		raid_gen_ptr[7] = raid_gen8_gfniext;
+		raid_gen_temporal_ptr[7] = raid_gen8_gfniext_temporal;
+#endif
+		raid_rec_ptr[0] = raid_rec1_gfni;
+		raid_rec_ptr[1] = raid_recX_gfni;
+		raid_rec_ptr[2] = raid_recX_gfni;
+		raid_rec_ptr[3] = raid_recX_gfni;
+		raid_rec_ptr[4] = raid_recX_gfni;
+		raid_rec_ptr[5] = raid_recX_gfni;
+		raid_rec_ptr[6] = raid_recX_gfni;
+		raid_rec_ptr[7] = raid_recX_gfni;
+		raid_add_ptr = raid_add_gfni;
 	}
 #endif
 #endif /* CONFIG_X86 */
 
+	/* set the default tiling at half of the L2 cache */
+	/* and use non-temporal stores only for blocks exceeding the cache share */
+#ifdef CONFIG_X86
+	raid_tile(raid_cpu_cache_l2() / 2, 0);
+	raid_stream_size = raid_cpu_cache_llc_share();
+#else
+	raid_tile(0, 0);
+	raid_stream_size = 0;
+#endif
+
 	/* set the default mode */
 	raid_mode(RAID_MODE_CAUCHY);
 }
@@ -318,6 +444,10 @@ int raid_selftest(void)
 	int ip[RAID_PARITY_MAX];
 	int i, np;
 	int ret = 0;
+	size_t tile_cache = raid_tile_cache;
+	int tile_prefetch = raid_tile_prefetch;
+	size_t stream_size = raid_stream_size;
+	const uint8_t (*gfgen_mode)[256] = raid_gfgen;
 
 	/* ensure to have enough space for data */
 	BUG_ON(nd * size > 65536);
@@ -332,6 +462,9 @@ int raid_selftest(void)
 	memset(v[nv - 1], 0, size);
 	raid_zero(v[nv - 1]);
 
+	/* the tests up to RAID_PARITY_MAX need the Cauchy mode */
+	raid_mode(RAID_MODE_CAUCHY);
+
 	/* use the multiplication table as data */
 	for (i = 0; i < nd; ++i)
 		ref[i] = ((uint8_t *)gfmul) + size * i;
@@ -462,9 +595,91 @@ int raid_selftest(void)
 		/* LCOV_EXCL_STOP */
 	}
 
+	/* repeat the tests splitting the blocks in the smallest tiles */
+	raid_tile(1, 1);
+
+	for (np = 1; np <= RAID_PARITY_MAX; ++np) {
+		/* test parity generation with non-temporal stores */
+		raid_stream_size = 0;
+		ret = raid_test_par(nd, np, size, v, ref);
+		if (ret != 0) {
+			/* LCOV_EXCL_START */
+			goto bail;
+			/* LCOV_EXCL_STOP */
+		}
+
+		/* test parity generation with temporal stores */
+		raid_stream_size = (size_t)-1;
+		ret = raid_test_par(nd, np, size, v, ref);
+		if (ret != 0) {
+			/* LCOV_EXCL_START */
+			goto bail;
+			/* LCOV_EXCL_STOP */
+		}
+
+		/* test recovering with broken leading data and broken leading parity */
+		for (i = 0; i < np / 2; ++i) {
+			/* bad data */
+			ir[i] = i;
+
+			/* good parity */
+			ip[i] = (np + 1) / 2 + i;
+		}
+
+		/* bad parity */
+		for (i = 0; i < (np + 1) / 2; ++i)
+			ir[np / 2 + i] = nd + i;
+
+		ret = raid_test_rec(np, ir, nd, np, size, v, ref);
+		if (ret != 0) {
+			/* LCOV_EXCL_START */
+			goto bail;
+			/* LCOV_EXCL_STOP */
+		}
+
+		ret = raid_test_data(np / 2, ir, ip, nd, np, size, v, ref);
+		if (ret != 0) {
+			/* LCOV_EXCL_START */
+			goto bail;
+			/* LCOV_EXCL_STOP */
+		}
+	}
+
+	/* repeat the same recovering changing mode, to check the cached matrices */
+	for (i = 0; i < 3; ++i)
+		ir[i] = i;
+
+	ret = raid_test_rec(3, ir, nd, 3, size, v, ref);
+	if (ret != 0) {
+		/* LCOV_EXCL_START */
+		goto bail;
+		/* LCOV_EXCL_STOP */
+	}
+
+	raid_mode(RAID_MODE_VANDERMONDE);
+	raid_gen_ref(nd, 3, size, ref);
+	ret = raid_test_rec(3, ir, nd, 3, size, v, ref);
+	if (ret != 0) {
+		/* LCOV_EXCL_START */
+		goto bail;
+		/* LCOV_EXCL_STOP */
+	}
+
+	raid_mode(RAID_MODE_CAUCHY);
+	raid_gen_ref(nd, 3, size, ref);
+	ret = raid_test_rec(3, ir, nd, 3, size, v, ref);
+	if (ret != 0) {
+		/* LCOV_EXCL_START */
+		goto bail;
+		/* LCOV_EXCL_STOP */
+	}
+
 	ret = 0;
 
 bail:
+	raid_mode(gfgen_mode == gfvandermonde ? RAID_MODE_VANDERMONDE : RAID_MODE_CAUCHY);
+	raid_tile(tile_cache, tile_prefetch);
+	raid_stream_size = stream_size;
 	free(v);
 	free(v_alloc);
 
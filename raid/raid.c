@@ -18,7 +18,7 @@
 /*
  * This is a RAID implementation working in the Galois Field GF(2^8) with
  * the primitive polynomial x^8 + x^4 + x^3 + x^2 + 1 (285 decimal), and
- * supporting up to six parity levels.
+ * supporting up to eight parity levels.
  *
  * For RAID5 and RAID6 it works as as described in the H. Peter Anvin's
  * paper "The mathematics of RAID-6" [1]. Please refer to this paper for a
@@ -173,13 +173,25 @@
  */
 const uint8_t (*raid_gfgen)[256];
 
+/**
+ * Generation of the generator matrix.
+ *
+ * Incremented at every mode change to invalidate the cached
+ * recovery matrices computed with the previous generator.
+ */
+static unsigned raid_gfgen_generation;
+
 void raid_mode(int mode)
 {
+	++raid_gfgen_generation;
+
 	if (mode == RAID_MODE_VANDERMONDE) {
 		raid_gen_ptr[2] = raid_genz_ptr;
+		raid_gen_temporal_ptr[2] = raid_genz_temporal_ptr;
 		raid_gfgen = gfvandermonde;
 	} else {
 		raid_gen_ptr[2] = raid_gen3_ptr;
+		raid_gen_temporal_ptr[2] = raid_gen3_temporal_ptr;
 		raid_gfgen = gfcauchy;
 	}
 }
@@ -194,6 +206,86 @@ void raid_zero(void *zero)
 	raid_zero_block = zero;
 }
 
+/**
+ * Cache size used to split the computation in tiles.
+ */
+size_t raid_tile_cache;
+
+/**
+ * If the next tile has to be prefetched.
+ */
+int raid_tile_prefetch;
+
+void raid_tile(size_t cache_size, int prefetch)
+{
+	raid_tile_cache = cache_size;
+	raid_tile_prefetch = prefetch;
+}
+
+/**
+ * Gets the size of the tiles to use for the specified number of blocks.
+ *
+ * With a lot of blocks, processing them whole means to read more
+ * memory than the cache can hold before completing a step, evicting
+ * the lines still in use by the other blocks.
+ * Splitting them in tiles keeps the working set in the cache.
+ *
+ * @n Number of blocks processed together.
+ * @size Size of the blocks.
+ * @return Size of the tile. It's equal to @size if no tiling is required.
+ */
+static size_t raid_tile_size(int n, size_t size)
+{
+	size_t tile;
+
+	if (raid_tile_cache == 0)
+		return size;
+
+	/* split the cache between all the blocks, keeping the 64 bytes granularity */
+	tile = (raid_tile_cache / n) & ~(size_t)63;
+	if (tile < 64)
+		tile = 64;
+	if (tile > size)
+		tile = size;
+
+	return tile;
+}
+
+/**
+ * Sets the vector of blocks of a tile, and prefetches the next one.
+ *
+ * @nd Number of data blocks to prefetch.
+ * @n Number of blocks in the vectors.
+ * @offset Offset of the tile.
+ * @tile Size of the tile.
+ * @size Size of the blocks.
+ * @v Vector of the blocks. Null pointers are kept.
+ * @t Destination vector of the tile blocks.
+ */
+static void raid_tile_setup(int nd, int n, size_t offset, size_t tile, size_t size, void **v, void **t)
+{
+	int j;
+
+	for (j = 0; j < n; ++j)
+		t[j] = v[j] ? (uint8_t *)v[j] + offset : 0;
+
+	if (raid_tile_prefetch && offset + tile < size) {
+		size_t next = size - offset - tile;
+		size_t i;
+
+		if (next > tile)
+			next = tile;
+
+		/* prefetch only the data, as the parity is written */
+		for (j = 0; j < nd; ++j) {
+			const uint8_t *d = (const uint8_t *)v[j] + offset + tile;
+
+			for (i = 0; i < next; i += 64)
+				__builtin_prefetch(d + i, 0, 2);
+		}
+	}
+}
+
 /*
  * Forwarders for parity computation.
  *
@@ -220,8 +312,32 @@ void (*raid_gen_ptr[RAID_PARITY_MAX])(int nd, size_t size, void **vv);
 void (*raid_gen3_ptr)(int nd, size_t size, void **vv);
 void (*raid_genz_ptr)(int nd, size_t size, void **vv);
 
+/*
+ * Forwarders for parity computation with temporal stores.
+ *
+ * The default forwarders write the parity with non-temporal stores,
+ * bypassing the cache, to not evict the data still in use when the
+ * blocks are too big to fit in it.
+ * With smaller blocks, writing through the cache is faster, and
+ * it's also required when the parity is read back immediately, like
+ * when recovering.
+ */
+void (*raid_gen_temporal_ptr[RAID_PARITY_MAX])(int nd, size_t size, void **vv);
+void (*raid_gen3_temporal_ptr)(int nd, size_t size, void **vv);
+void (*raid_genz_temporal_ptr)(int nd, size_t size, void **vv);
+
+/**
+ * Size of the blocks processed together over which non-temporal stores are used.
+ */
+size_t raid_stream_size;
+
 void raid_gen(int nd, int np, size_t size, void **v)
 {
+	void (*gen)(int nd, size_t size, void **vv);
+	void *t[RAID_DISK_MAX];
+	size_t tile;
+	size_t offset;
+
 	/* enforce limit on size */
 	BUG_ON(size % 64 != 0);
 
@@ -229,7 +345,56 @@ void raid_gen(int nd, int np, size_t size, void **v)
 	BUG_ON(np < 1);
 	BUG_ON(np > RAID_PARITY_MAX);
 
-	raid_gen_ptr[np - 1](nd, size, v);
+	/* enforce limit on number of disks */
+	BUG_ON(nd + np > RAID_DISK_MAX);
+
+	/* bypass the cache only if the blocks don't fit in it */
+	if ((nd + np) * size > raid_stream_size)
+		gen = raid_gen_ptr[np - 1];
+	else
+		gen = raid_gen_temporal_ptr[np - 1];
+
+	tile = raid_tile_size(nd + np, size);
+	if (tile == size) {
+		gen(nd, size, v);
+		return;
+	}
+
+	for (offset = 0; offset < size; offset += tile) {
+		if (tile > size - offset)
+			tile = size - offset;
+
+		raid_tile_setup(nd, nd + np, offset, tile, size, v, t);
+
+		gen(nd, tile, t);
+	}
+}
+
+/*
+ * Forwarder for parity update.
+ *
+ * It accumulates a single data block to all the parities at once.
+ *
+ * @id Index of the data block.
+ * @np Number of parities.
+ * @size Size of the blocks pointed by @v. It must be a multipler of 64.
+ * @v Vector of pointers to the data block and to the parity blocks.
+ */
+void (*raid_add_ptr)(int id, int np, size_t size, void **vv);
+
+void raid_add(int id, int np, size_t size, void **v)
+{
+	/* enforce limit on size */
+	BUG_ON(size % 64 != 0);
+
+	/* enforce limit on number of parities */
+	BUG_ON(np < 1);
+	BUG_ON(np > RAID_PARITY_MAX);
+
+	/* enforce limit on number of disks */
+	BUG_ON(id + 1 + np > RAID_DISK_MAX);
+
+	raid_add_ptr(id, np, size, v);
 }
 
 /**
@@ -282,6 +447,95 @@ void raid_invert(uint8_t *M, uint8_t *V, int n)
 	}
 }
 
+/**
+ * Computes the inverted matrix used to recover the data blocks.
+ *
+ * @nr Number of failed data blocks to recover.
+ * @id[] Vector of @nr indexes of the data blocks to recover.
+ * @ip[] Vector of @nr indexes of the parity blocks to use in the recovering.
+ * @V Destination matrix with @nr rows and @nr columns.
+ */
+void raid_rec_invert(int nr, int *id, int *ip, uint8_t *V)
+{
+	uint8_t G[RAID_PARITY_MAX * RAID_PARITY_MAX];
+	int j, k;
+
+	/* setup the coefficients matrix */
+	for (j = 0; j < nr; ++j)
+		for (k = 0; k < nr; ++k)
+			G[j * nr + k] = A(ip[j], id[k]);
+
+	/* invert it to solve the system of linear equations */
+	raid_invert(G, V, nr);
+}
+
+/*
+ * Cache of the inverted recovery matrices.
+ *
+ * When fixing a whole disk, the same failure pattern is repeated
+ * for every block, so we keep the latest matrices to avoid to setup
+ * and invert them at every call.
+ *
+ * The matrix depends on the data and parity indexes, and on the
+ * generator matrix set by raid_mode(), but not on the number of data
+ * blocks. The generator is keyed by its generation counter.
+ *
+ * The cache is thread local, because raid_rec() is called
+ * concurrently by multiple threads, and each one works on the same
+ * failure pattern.
+ */
+#define RAID_REC_CACHE_MAX 4
+
+struct raid_rec_cache {
+	int nr; /* number of failed blocks, 0 if the entry is unused */
+	unsigned generation; /* generation of the generator matrix */
+	int id[RAID_PARITY_MAX];
+	int ip[RAID_PARITY_MAX];
+	uint8_t V[RAID_PARITY_MAX * RAID_PARITY_MAX];
+};
+
+static __thread_local struct raid_rec_cache raid_rec_cache_map[RAID_REC_CACHE_MAX];
+static __thread_local unsigned raid_rec_cache_next;
+
+/**
+ * Gets the inverted matrix used to recover the data blocks.
+ *
+ * The returned matrix remains valid until the next call
+ * of this function in the same thread.
+ *
+ * @nr Number of failed data blocks to recover.
+ * @id[] Vector of @nr indexes of the data blocks to recover.
+ * @ip[] Vector of @nr indexes of the parity blocks to use in the recovering.
+ * @return Matrix with @nr rows and @nr columns.
+ */
+const uint8_t *raid_rec_matrix(int nr, int *id, int *ip)
+{
+	struct raid_rec_cache *entry;
+	unsigned i;
+
+	for (i = 0; i < RAID_REC_CACHE_MAX; ++i) {
+		entry = &raid_rec_cache_map[i];
+
+		if (entry->nr == nr
+			&& entry->generation == raid_gfgen_generation
+			&& memcmp(entry->id, id, nr * sizeof(int)) == 0
+			&& memcmp(entry->ip, ip, nr * sizeof(int)) == 0)
+			return entry->V;
+	}
+
+	/* replace the oldest entry */
+	entry = &raid_rec_cache_map[raid_rec_cache_next];
+	raid_rec_cache_next = (raid_rec_cache_next + 1) % RAID_REC_CACHE_MAX;
+
+	entry->nr = nr;
+	entry->generation = raid_gfgen_generation;
+	memcpy(entry->id, id, nr * sizeof(int));
+	memcpy(entry->ip, ip, nr * sizeof(int));
+	raid_rec_invert(nr, id, ip, entry->V);
+
+	return entry->V;
+}
+
 /**
  * Computes the parity without the missing data blocks
  * and store it in the buffers of such data blocks.
@@ -360,7 +614,8 @@ void raid_delta_gen(int nr, int *id, int *ip, int nd, size_t size, void **v)
 
 	/* recompute the parity, note that np may be smaller than the */
 	/* total number of parities available */
-	raid_gen(nd, np, size, v);
+	/* the delta parity is read back immediately, so keep it in the cache */
+	raid_gen_temporal_ptr[np - 1](nd, size, v);
 
 	/* restore data buffers as before */
 	for (j = 0; j < nr; ++j)
@@ -496,6 +751,11 @@ void raid_rec(int nr, int *ir, int nd, int np, size_t size, void **v)
 {
 	int nrd; /* number of data blocks to recover */
 	int nrp; /* number of parity blocks to recover */
+	int ip[RAID_PARITY_MAX];
+	void (*gen)(int nd, size_t size, void **vv);
+	void *t[RAID_DISK_MAX];
+	size_t tile;
+	size_t offset;
 
 	/* enforce limit on size */
 	BUG_ON(size % 64 != 0);
@@ -504,12 +764,17 @@ void raid_rec(int nr, int *ir, int nd, int np, size_t size, void **v)
 	BUG_ON(nr > np);
 	BUG_ON(np > RAID_PARITY_MAX);
 
+	/* enforce limit on number of disks */
+	BUG_ON(nd + np > RAID_DISK_MAX);
+
 	/* enforce order in index vector */
 	BUG_ON(nr >= 2 && ir[0] >= ir[1]);
 	BUG_ON(nr >= 3 && ir[1] >= ir[2]);
 	BUG_ON(nr >= 4 && ir[2] >= ir[3]);
 	BUG_ON(nr >= 5 && ir[3] >= ir[4]);
 	BUG_ON(nr >= 6 && ir[4] >= ir[5]);
+	BUG_ON(nr >= 7 && ir[5] >= ir[6]);
+	BUG_ON(nr >= 8 && ir[6] >= ir[7]);
 
 	/* enforce limit on index vector */
 	BUG_ON(nr > 0 && ir[nr-1] >= nd + np);
@@ -528,7 +793,6 @@ void raid_rec(int nr, int *ir, int nd, int np, size_t size, void **v)
 
 	/* if failed data is present */
 	if (nrd != 0) {
-		int ip[RAID_PARITY_MAX];
 		int i, j, k;
 
 		/* setup the vector of parities to use */
@@ -542,15 +806,37 @@ void raid_rec(int nr, int *ir, int nd, int np, size_t size, void **v)
 				++k;
 			}
 		}
+	}
+
+	/* the parity to recompute is not read back */
+	gen = 0;
+	if (nrp != 0) {
+		int npr = ir[nr - 1] - nd + 1;
+
+		if ((nd + npr) * size > raid_stream_size)
+			gen = raid_gen_ptr[npr - 1];
+		else
+			gen = raid_gen_temporal_ptr[npr - 1];
+	}
+
+	/* process each tile completely, to recompute the parity */
+	/* while the recovered data is still in the cache */
+	tile = raid_tile_size(nd + np, size);
+	for (offset = 0; offset < size; offset += tile) {
+		if (tile > size - offset)
+			tile = size - offset;
+
+		raid_tile_setup(nd, nd + np, offset, tile, size, v, t);
 
 		/* recover the nrd data blocks specified in ir[], */
 		/* using the first nrd parity in ip[] for recovering */
-		raid_rec_ptr[nrd - 1](nrd, ir, ip, nd, size, v);
-	}
+		if (nrd != 0)
+			raid_rec_ptr[nrd - 1](nrd, ir, ip, nd, tile, t);
 
-	/* recompute all the parities up to the last bad one */
-	if (nrp != 0)
-		raid_gen(nd, ir[nr - 1] - nd + 1, size, v);
+		/* recompute all the parities up to the last bad one */
+		if (nrp != 0)
+			gen(nd, tile, t);
+	}
 }
 
 void raid_data(int nr, int *id, int *ip, int nd, size_t size, void **v)
@@ -568,6 +854,8 @@ void raid_data(int nr, int *id, int *ip, int nd, size_t size, void **v)
 	BUG_ON(nr >= 4 && id[2] >= id[3]);
 	BUG_ON(nr >= 5 && id[3] >= id[4]);
 	BUG_ON(nr >= 6 && id[4] >= id[5]);
+	BUG_ON(nr >= 7 && id[5] >= id[6]);
+	BUG_ON(nr >= 8 && id[6] >= id[7]);
 
 	/* enforce limit on index vector for data */
 	BUG_ON(nr > 0 && id[nr-1] >= nd);
@@ -578,9 +866,28 @@ void raid_data(int nr, int *id, int *ip, int nd, size_t size, void **v)
 	BUG_ON(nr >= 4 && ip[2] >= ip[3]);
 	BUG_ON(nr >= 5 && ip[3] >= ip[4]);
 	BUG_ON(nr >= 6 && ip[4] >= ip[5]);
+	BUG_ON(nr >= 7 && ip[5] >= ip[6]);
+	BUG_ON(nr >= 8 && ip[6] >= ip[7]);
+
+	/* enforce limit on index vector for parity */
+	BUG_ON(nr > 0 && nd + ip[nr-1] >= RAID_DISK_MAX);
 
 	/* if failed data is present */
-	if (nr != 0)
-		raid_rec_ptr[nr - 1](nr, id, ip, nd, size, v);
+	if (nr != 0) {
+		void *t[RAID_DISK_MAX];
+		size_t tile;
+		size_t offset;
+		int n = nd + ip[nr - 1] + 1;
+
+		tile = raid_tile_size(n, size);
+		for (offset = 0; offset < size; offset += tile) {
+			if (tile > size - offset)
+				tile = size - offset;
+
+			raid_tile_setup(nd, n, offset, tile, size, v, t);
+
+			raid_rec_ptr[nr - 1](nr, id, ip, nd, tile, t);
+		}
+	}
 }
 
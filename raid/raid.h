@@ -16,7 +16,7 @@
 #define __RAID_H
 
 /**
- * RAID mode supporting up to 6 parities.
+ * RAID mode supporting up to 8 parities.
  *
  * It requires SSSE3 to get good performance with triple or more parities.
  *
@@ -37,13 +37,21 @@
 /**
  * Maximum number of parity disks supported.
  */
-#define RAID_PARITY_MAX 6
+#define RAID_PARITY_MAX 8
 
 /**
  * Maximum number of data disks supported.
  */
 #define RAID_DATA_MAX 251
 
+/**
+ * Maximum number of data and parity disks supported together.
+ *
+ * Up to 6 parities it doesn't limit the data disks, but with more
+ * parities each additional one reduces the number of data disks by one.
+ */
+#define RAID_DISK_MAX 257
+
 /**
  * Initializes the RAID system.
  *
@@ -84,6 +92,22 @@ void raid_mode(int mode);
  */
 void raid_zero(void *zero);
 
+/**
+ * Sets the tiling used in raid_gen(), raid_rec() and raid_data().
+ *
+ * The blocks are processed in tiles sized to keep the tile of all
+ * the data and parity blocks in the specified cache size.
+ * This avoids to thrash the cache when using a lot of data blocks.
+ *
+ * If @prefetch is not 0, the next tile of the data blocks is prefetched
+ * in the cache before processing the current one.
+ *
+ * A @cache_size of 0 disables the tiling.
+ *
+ * raid_init() sets it at half of the L2 cache size, if detected, without prefetch.
+ */
+void raid_tile(size_t cache_size, int prefetch);
+
 /**
  * Computes parity blocks.
  *
@@ -103,6 +127,28 @@ void raid_zero(void *zero);
  */
 void raid_gen(int nd, int np, size_t size, void **v);
 
+/**
+ * Updates parity blocks adding a single data block.
+ *
+ * This function adds to the parity blocks the contribution of the
+ * specified data block, without reading any other data block.
+ *
+ * If the data block was filled with zero when the parity was computed,
+ * the result is the same of calling raid_gen() with the new data.
+ * Otherwise, you have to pass as data block the xor of the old and new
+ * content.
+ *
+ * @id Index of the data block in the array. Starting from 0.
+ * @np Number of parities blocks to update.
+ * @size Size of the blocks pointed by @v. It must be a multiplier of 64.
+ * @v Vector of pointers to the blocks of data and parity.
+ *   It has (1 + @np) elements. The first element is the data block to
+ *   add, following with the parity blocks to update.
+ *   The data block is only read and not modified. Parity blocks are updated.
+ *   Each block has @size bytes.
+ */
+void raid_add(int id, int np, size_t size, void **v);
+
 /**
  * Recovers failures in data and parity blocks.
  *
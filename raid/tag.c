@@ -22,6 +22,8 @@ static struct raid_func {
 	{ "int8", raid_gen4_int8 },
 	{ "int8", raid_gen5_int8 },
 	{ "int8", raid_gen6_int8 },
+	{ "int8", raid_gen7_int8 },
+	{ "int8", raid_gen8_int8 },
 	{ "int32", raid_gen1_int32 },
 	{ "int64", raid_gen1_int64 },
 	{ "int32", raid_gen2_int32 },
@@ -31,6 +33,7 @@ static struct raid_func {
 	{ "int8", raid_rec1_int8 },
 	{ "int8", raid_rec2_int8 },
 	{ "int8", raid_recX_int8 },
+	{ "int8", raid_add_int8 },
 
 #ifdef CONFIG_X86
 #ifdef CONFIG_SSE2
@@ -46,6 +49,7 @@ static struct raid_func {
 	{ "ssse3", raid_rec1_ssse3 },
 	{ "ssse3", raid_rec2_ssse3 },
 	{ "ssse3", raid_recX_ssse3 },
+	{ "ssse3", raid_add_ssse3 },
 #endif
 #ifdef CONFIG_AVX2
 	{ "avx2", raid_gen1_avx2 },
@@ -53,6 +57,22 @@ static struct raid_func {
 	{ "avx2", raid_rec1_avx2 },
 	{ "avx2", raid_rec2_avx2 },
 	{ "avx2", raid_recX_avx2 },
+	{ "avx2", raid_add_avx2 },
+#endif
+#ifdef CONFIG_AVX512BW
+	{ "avx512", raid_gen1_avx512bw },
+	{ "avx512", raid_gen2_avx512bw },
+	{ "avx512", raid_rec1_avx512bw },
+	{ "avx512", raid_recX_avx512bw },
+#endif
+#ifdef CONFIG_GFNI
+	{ "gfni", raid_gen3_gfni },
+	{ "gfni", raid_gen4_gfni },
+	{ "gfni", raid_gen5_gfni },
+	{ "gfni", raid_gen6_gfni },
+	{ "gfni", raid_rec1_gfni },
+	{ "gfni", raid_recX_gfni },
+	{ "gfni", raid_add_gfni },
 #endif
 #endif
 
@@ -66,6 +86,8 @@ static struct raid_func {
 	{ "ssse3e", raid_gen4_ssse3ext },
 	{ "ssse3e", raid_gen5_ssse3ext },
 	{ "ssse3e", raid_gen6_ssse3ext },
+	{ "ssse3e", raid_gen7_ssse3ext },
+	{ "ssse3e", raid_gen8_ssse3ext },
 #endif
 #ifdef CONFIG_AVX2
 	{ "avx2e", raid_gen3_avx2ext },
@@ -73,6 +95,20 @@ static struct raid_func {
 	{ "avx2e", raid_gen4_avx2ext },
 	{ "avx2e", raid_gen5_avx2ext },
 	{ "avx2e", raid_gen6_avx2ext },
+	{ "avx2e", raid_gen7_avx2ext },
+	{ "avx2e", raid_gen8_avx2ext },
+#endif
+#ifdef CONFIG_AVX512BW
+	{ "avx512e", raid_gen3_avx512bwext },
+	{ "avx512e", raid_gen4_avx512bwext },
+	{ "avx512e", raid_gen5_avx512bwext },
+	{ "avx512e", raid_gen6_avx512bwext },
+	{ "avx512e", raid_gen7_avx512bwext },
+	{ "avx512e", raid_gen8_avx512bwext },
+#endif
+#ifdef CONFIG_GFNI
+	{ "gfnie", raid_gen7_gfniext },
+	{ "gfnie", raid_gen8_gfniext },
 #endif
 #endif
 	{ 0, 0 }
@@ -128,6 +164,16 @@ const char *raid_gen6_tag(void)
 	return raid_tag(raid_gen_ptr[5]);
 }
 
+const char *raid_gen7_tag(void)
+{
+	return raid_tag(raid_gen_ptr[6]);
+}
+
+const char *raid_gen8_tag(void)
+{
+	return raid_tag(raid_gen_ptr[7]);
+}
+
 const char *raid_rec1_tag(void)
 {
 	return raid_tag(raid_rec_ptr[0]);
@@ -143,3 +189,8 @@ const char *raid_recX_tag(void)
 	return raid_tag(raid_rec_ptr[2]);
 }
 
+const char *raid_add_tag(void)
+{
+	return raid_tag(raid_add_ptr);
+}
+
@@ -145,7 +145,7 @@ int raid_test_sort(void)
 
 int raid_test_rec(int mode, int nd, size_t size)
 {
-	void (*f[RAID_PARITY_MAX][4])(
+	void (*f[RAID_PARITY_MAX][5])(
 		int nr, int *id, int *ip, int nd, size_t size, void **vbuf);
 	void *v_alloc;
 	void **v;
@@ -208,6 +208,14 @@ int raid_test_rec(int mode, int nd, size_t size)
 			if (raid_cpu_has_avx2())
 				f[i][nf[i]++] = raid_rec1_avx2;
 #endif
+#ifdef CONFIG_AVX512BW
+			if (raid_cpu_has_avx512bw())
+				f[i][nf[i]++] = raid_rec1_avx512bw;
+#endif
+#ifdef CONFIG_GFNI
+			if (raid_cpu_has_gfni())
+				f[i][nf[i]++] = raid_rec1_gfni;
+#endif
 #endif
 		} else if (i == 1) {
 			f[i][nf[i]++] = raid_rec2_int8;
@@ -220,6 +228,14 @@ int raid_test_rec(int mode, int nd, size_t size)
 			if (raid_cpu_has_avx2())
 				f[i][nf[i]++] = raid_rec2_avx2;
 #endif
+#ifdef CONFIG_AVX512BW
+			if (raid_cpu_has_avx512bw())
+				f[i][nf[i]++] = raid_recX_avx512bw;
+#endif
+#ifdef CONFIG_GFNI
+			if (raid_cpu_has_gfni())
+				f[i][nf[i]++] = raid_recX_gfni;
+#endif
 #endif
 		} else {
 			f[i][nf[i]++] = raid_recX_int8;
@@ -232,6 +248,14 @@ int raid_test_rec(int mode, int nd, size_t size)
 			if (raid_cpu_has_avx2())
 				f[i][nf[i]++] = raid_recX_avx2;
 #endif
+#ifdef CONFIG_AVX512BW
+			if (raid_cpu_has_avx512bw())
+				f[i][nf[i]++] = raid_recX_avx512bw;
+#endif
+#ifdef CONFIG_GFNI
+			if (raid_cpu_has_gfni())
+				f[i][nf[i]++] = raid_recX_gfni;
+#endif
 #endif
 		}
 	}
@@ -300,7 +324,7 @@ bail:
 
 int raid_test_par(int mode, int nd, size_t size)
 {
-	void (*f[64])(int nd, size_t size, void **vbuf);
+	void (*f[128])(int nd, size_t size, void **vbuf);
 	void *v_alloc;
 	void **v;
 	int nv;
@@ -352,9 +376,12 @@ int raid_test_par(int mode, int nd, size_t size)
 #ifdef CONFIG_SSE2
 	if (raid_cpu_has_sse2()) {
 		f[nf++] = raid_gen1_sse2;
+		f[nf++] = raid_gen1_sse2_temporal;
 		f[nf++] = raid_gen2_sse2;
+		f[nf++] = raid_gen2_sse2_temporal;
 #ifdef CONFIG_X86_64
 		f[nf++] = raid_gen2_sse2ext;
+		f[nf++] = raid_gen2_sse2ext_temporal;
 #endif
 	}
 #endif
@@ -362,7 +389,18 @@ int raid_test_par(int mode, int nd, size_t size)
 #ifdef CONFIG_AVX2
 	if (raid_cpu_has_avx2()) {
 		f[nf++] = raid_gen1_avx2;
+		f[nf++] = raid_gen1_avx2_temporal;
 		f[nf++] = raid_gen2_avx2;
+		f[nf++] = raid_gen2_avx2_temporal;
+	}
+#endif
+
+#ifdef CONFIG_AVX512BW
+	if (raid_cpu_has_avx512bw()) {
+		f[nf++] = raid_gen1_avx512bw;
+		f[nf++] = raid_gen1_avx512bw_temporal;
+		f[nf++] = raid_gen2_avx512bw;
+		f[nf++] = raid_gen2_avx512bw_temporal;
 	}
 #endif
 #endif /* CONFIG_X86 */
@@ -372,19 +410,31 @@ int raid_test_par(int mode, int nd, size_t size)
 		f[nf++] = raid_gen4_int8;
 		f[nf++] = raid_gen5_int8;
 		f[nf++] = raid_gen6_int8;
+		f[nf++] = raid_gen7_int8;
+		f[nf++] = raid_gen8_int8;
 
 #ifdef CONFIG_X86
 #ifdef CONFIG_SSSE3
 		if (raid_cpu_has_ssse3()) {
 			f[nf++] = raid_gen3_ssse3;
+			f[nf++] = raid_gen3_ssse3_temporal;
 			f[nf++] = raid_gen4_ssse3;
+			f[nf++] = raid_gen4_ssse3_temporal;
 			f[nf++] = raid_gen5_ssse3;
+			f[nf++] = raid_gen5_ssse3_temporal;
 			f[nf++] = raid_gen6_ssse3;
+			f[nf++] = raid_gen6_ssse3_temporal;
 #ifdef CONFIG_X86_64
 			f[nf++] = raid_gen3_ssse3ext;
+			f[nf++] = raid_gen3_ssse3ext_temporal;
 			f[nf++] = raid_gen4_ssse3ext;
+			f[nf++] = raid_gen4_ssse3ext_temporal;
 			f[nf++] = raid_gen5_ssse3ext;
+			f[nf++] = raid_gen5_ssse3ext_temporal;
 			f[nf++] = raid_gen6_ssse3ext;
+			f[nf++] = raid_gen6_ssse3ext_temporal;
+			f[nf++] = raid_gen7_ssse3ext;
+			f[nf++] = raid_gen8_ssse3ext;
 #endif
 		}
 #endif
@@ -393,12 +443,56 @@ int raid_test_par(int mode, int nd, size_t size)
 #ifdef CONFIG_X86_64
 		if (raid_cpu_has_avx2()) {
 			f[nf++] = raid_gen3_avx2ext;
+			f[nf++] = raid_gen3_avx2ext_temporal;
 			f[nf++] = raid_gen4_avx2ext;
+			f[nf++] = raid_gen4_avx2ext_temporal;
 			f[nf++] = raid_gen5_avx2ext;
+			f[nf++] = raid_gen5_avx2ext_temporal;
 			f[nf++] = raid_gen6_avx2ext;
+			f[nf++] = raid_gen6_avx2ext_temporal;
+			f[nf++] = raid_gen7_avx2ext;
+			f[nf++] = raid_gen8_avx2ext;
 		}
 #endif
 #endif
+
+#ifdef CONFIG_AVX512BW
+#ifdef CONFIG_X86_64
+		if (raid_cpu_has_avx512bw()) {
+			f[nf++] = raid_gen3_avx512bwext;
+			f[nf++] = raid_gen3_avx512bwext_temporal;
+			f[nf++] = raid_gen4_avx512bwext;
+			f[nf++] = raid_gen4_avx512bwext_temporal;
+			f[nf++] = raid_gen5_avx512bwext;
+			f[nf++] = raid_gen5_avx512bwext_temporal;
+			f[nf++] = raid_gen6_avx512bwext;
+			f[nf++] = raid_gen6_avx512bwext_temporal;
+			f[nf++] = raid_gen7_avx512bwext;
+			f[nf++] = raid_gen7_avx512bwext_temporal;
+			f[nf++] = raid_gen8_avx512bwext;
+			f[nf++] = raid_gen8_avx512bwext_temporal;
+		}
+#endif
+#endif
+
+#ifdef CONFIG_GFNI
+		if (raid_cpu_has_gfni()) {
+			f[nf++] = raid_gen3_gfni;
+			f[nf++] = raid_gen3_gfni_temporal;
+			f[nf++] = raid_gen4_gfni;
+			f[nf++] = raid_gen4_gfni_temporal;
+			f[nf++] = raid_gen5_gfni;
+			f[nf++] = raid_gen5_gfni_temporal;
+			f[nf++] = raid_gen6_gfni;
+			f[nf++] = raid_gen6_gfni_temporal;
+#ifdef CONFIG_X86_64
+			f[nf++] = raid_gen7_gfniext;
+			f[nf++] = raid_gen7_gfniext_temporal;
+			f[nf++] = raid_gen8_gfniext;
+			f[nf++] = raid_gen8_gfniext_temporal;
+#endif
+		}
+#endif
 #endif /* CONFIG_X86 */
 	} else {
 		f[nf++] = raid_genz_int32;
@@ -408,16 +502,20 @@ int raid_test_par(int mode, int nd, size_t size)
 #ifdef CONFIG_SSE2
 		if (raid_cpu_has_sse2()) {
 			f[nf++] = raid_genz_sse2;
+			f[nf++] = raid_genz_sse2_temporal;
 #ifdef CONFIG_X86_64
 			f[nf++] = raid_genz_sse2ext;
+			f[nf++] = raid_genz_sse2ext_temporal;
 #endif
 		}
 #endif
 
 #ifdef CONFIG_AVX2
 #ifdef CONFIG_X86_64
-		if (raid_cpu_has_avx2())
+		if (raid_cpu_has_avx2()) {
 			f[nf++] = raid_genz_avx2ext;
+			f[nf++] = raid_genz_avx2ext_temporal;
+		}
 #endif
 #endif
 #endif /* CONFIG_X86 */
@@ -450,3 +548,98 @@ bail:
 	/* LCOV_EXCL_STOP */
 }
 
+int raid_test_add(int mode, int nd, size_t size)
+{
+	void (*f[16])(int id, int np, size_t size, void **vbuf);
+	void *v_alloc;
+	void **v;
+	void *u[1 + RAID_PARITY_MAX];
+	int nv;
+	int i, j, k;
+	int nf;
+	int np;
+
+	raid_mode(mode);
+	if (mode == RAID_MODE_CAUCHY)
+		np = RAID_PARITY_MAX;
+	else
+		np = 3;
+
+	/* data, parity, expected parity, and a copy of the data block */
+	nv = nd + np * 2 + 1;
+
+	v = raid_malloc_vector(nd, nv, size, &v_alloc);
+	if (!v) {
+		/* LCOV_EXCL_START */
+		return -1;
+		/* LCOV_EXCL_STOP */
+	}
+
+	/* fill with pseudo-random data with the arbitrary seed "3" */
+	raid_mrand_vector(3, nv, size, v);
+
+	/* load all the available functions */
+	nf = 0;
+
+	f[nf++] = raid_add;
+	f[nf++] = raid_add_int8;
+
+#ifdef CONFIG_X86
+#ifdef CONFIG_SSSE3
+	if (raid_cpu_has_ssse3())
+		f[nf++] = raid_add_ssse3;
+#endif
+
+#ifdef CONFIG_AVX2
+	if (raid_cpu_has_avx2())
+		f[nf++] = raid_add_avx2;
+#endif
+
+#ifdef CONFIG_GFNI
+	if (raid_cpu_has_gfni())
+		f[nf++] = raid_add_gfni;
+#endif
+#endif
+
+	for (k = 0; k < nf; ++k) {
+		for (i = 0; i < nd; ++i) {
+			/* compute the expected parity */
+			raid_gen_ref(nd, np, size, v);
+			for (j = 0; j < np; ++j)
+				memcpy(v[nd + np + j], v[nd + j], size);
+
+			/* compute the parity with the data block filled with zero */
+			memcpy(v[nv - 1], v[i], size);
+			memset(v[i], 0, size);
+			raid_gen_ref(nd, np, size, v);
+			memcpy(v[i], v[nv - 1], size);
+
+			/* add the data block */
+			u[0] = v[i];
+			for (j = 0; j < np; ++j)
+				u[1 + j] = v[nd + j];
+			f[k](i, np, size, u);
+
+			/* check it */
+			for (j = 0; j < np; ++j) {
+				if (memcmp(v[nd + np + j], v[nd + j], size) != 0) {
+					/* LCOV_EXCL_START */
+					goto bail;
+					/* LCOV_EXCL_STOP */
+				}
+			}
+		}
+	}
+
+	free(v_alloc);
+	free(v);
+	return 0;
+
+bail:
+	/* LCOV_EXCL_START */
+	free(v_alloc);
+	free(v);
+	return -1;
+	/* LCOV_EXCL_STOP */
+}
+
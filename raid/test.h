@@ -64,5 +64,15 @@ int raid_test_rec(unsigned mode, int nd, size_t size);
  */
 int raid_test_par(unsigned mode, int nd, size_t size);
 
+/**
+ * Tests parity update function.
+ *
+ * All the raid_add() functions are tested adding every data block to the
+ * parity computed with such block filled with zero.
+ *
+ * Returns 0 on success.
+ */
+int raid_test_add(unsigned mode, int nd, size_t size);
+
 #endif
 
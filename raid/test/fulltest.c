@@ -30,9 +30,9 @@
  * Number of disks in the long parity test.
  */
 #ifdef COVERAGE
-#define TEST_COUNT 10
+#define TEST_COUNT 8
 #else
-#define TEST_COUNT 32
+#define TEST_COUNT 18
 #endif
 
 int main(void)
@@ -48,6 +48,10 @@ int main(void)
 		printf("Including x86 SSSE3 functions\n");
 	if (raid_cpu_has_avx2())
 		printf("Including x86 AVX2 functions\n");
+	if (raid_cpu_has_avx512bw())
+		printf("Including x86 AVX512BW functions\n");
+	if (raid_cpu_has_gfni())
+		printf("Including x86 GFNI functions\n");
 #endif
 #ifdef CONFIG_X86_64
 	printf("Including x64 extended SSE register set\n");
@@ -90,7 +94,14 @@ int main(void)
 		/* LCOV_EXCL_STOP */
 	}
 
-	printf("Test Cauchy recovering with all combinations of %u data and 6 parity blocks...\n", TEST_COUNT);
+	printf("Test Cauchy parity update with %u data disks...\n", RAID_DISK_MAX - RAID_PARITY_MAX);
+	if (raid_test_add(RAID_MODE_CAUCHY, RAID_DISK_MAX - RAID_PARITY_MAX, TEST_SIZE) != 0) {
+		/* LCOV_EXCL_START */
+		goto bail;
+		/* LCOV_EXCL_STOP */
+	}
+
+	printf("Test Cauchy recovering with all combinations of %u data and %u parity blocks...\n", TEST_COUNT, RAID_PARITY_MAX);
 	if (raid_test_rec(RAID_MODE_CAUCHY, TEST_COUNT, TEST_SIZE) != 0) {
 		/* LCOV_EXCL_START */
 		goto bail;
@@ -104,6 +115,13 @@ int main(void)
 		/* LCOV_EXCL_STOP */
 	}
 
+	printf("Test Vandermonde parity update with %u data disks...\n", RAID_DATA_MAX);
+	if (raid_test_add(RAID_MODE_VANDERMONDE, RAID_DATA_MAX, TEST_SIZE) != 0) {
+		/* LCOV_EXCL_START */
+		goto bail;
+		/* LCOV_EXCL_STOP */
+	}
+
 	printf("Test Vandermonde recovering with all combinations of %u data and 3 parity blocks...\n", TEST_COUNT);
 	if (raid_test_rec(RAID_MODE_VANDERMONDE, TEST_COUNT, TEST_SIZE) != 0) {
 		/* LCOV_EXCL_START */
@@ -63,6 +63,15 @@ static __always_inline int raid_invert_fast(uint8_t *M, int n)
 
 #define TEST_REFRESH (4 * 1024 * 1024)
 
+/**
+ * Number of parities and data disks of the tested matrix.
+ *
+ * The rows after the sixth are valid only with fewer data disks,
+ * and testing them all would take months.
+ */
+#define TEST_PARITY 6
+#define TEST_DATA RAID_DATA_MAX
+
 /**
  * Precomputed number of square submatrices of size nr.
  *
@@ -70,7 +79,7 @@ static __always_inline int raid_invert_fast(uint8_t *M, int n)
  *
  * With 1<=nr<=6 and bc(n, r) == binomial coefficient of (n over r).
  */
-long long EXPECTED[RAID_PARITY_MAX] = {
+long long EXPECTED[TEST_PARITY] = {
 	1506LL,
 	470625LL,
 	52082500LL,
@@ -81,11 +90,11 @@ long long EXPECTED[RAID_PARITY_MAX] = {
 
 static __always_inline int test_sub_matrix(int nr, long long *total)
 {
-	uint8_t M[RAID_PARITY_MAX * RAID_PARITY_MAX];
-	int np = RAID_PARITY_MAX;
-	int nd = RAID_DATA_MAX;
-	int ip[RAID_PARITY_MAX];
-	int id[RAID_DATA_MAX];
+	uint8_t M[TEST_PARITY * TEST_PARITY];
+	int np = TEST_PARITY;
+	int nd = TEST_DATA;
+	int ip[TEST_PARITY];
+	int id[TEST_DATA];
 	long long count;
 	long long expected;
 
@@ -133,7 +142,7 @@ int test_all_sub_matrix(void)
 	long long total;
 
 	printf("Invert all square submatrices of the %dx%d Cauchy matrix\n",
-		RAID_PARITY_MAX, RAID_DATA_MAX);
+		TEST_PARITY, TEST_DATA);
 
 	printf("\nPlease wait about 2 days...\n");
 
@@ -158,6 +167,89 @@ int test_all_sub_matrix(void)
 	return 0;
 }
 
+/**
+ * Number of random square submatrices tested for each size.
+ */
+#define TEST_SAMPLE (16 * 1024 * 1024)
+
+/**
+ * Pseudo random generator with an arbitrary fixed seed.
+ */
+static uint32_t test_seed = 1;
+
+static uint32_t test_rand(void)
+{
+	/* xorshift32 */
+	test_seed ^= test_seed << 13;
+	test_seed ^= test_seed >> 17;
+	test_seed ^= test_seed << 5;
+	return test_seed;
+}
+
+/**
+ * Select nr different random values from 0 to n - 1.
+ */
+static void test_rand_select(int nr, int n, int *v)
+{
+	int all[RAID_DISK_MAX];
+	int i;
+
+	for (i = 0; i < n; ++i)
+		all[i] = i;
+
+	/* partial Fisher-Yates shuffle */
+	for (i = 0; i < nr; ++i) {
+		int j = i + test_rand() % (n - i);
+		int t = all[i];
+		all[i] = all[j];
+		all[j] = t;
+		v[i] = all[i];
+	}
+}
+
+/**
+ * Invert random square submatrices of the Cauchy matrix with np parities.
+ *
+ * With more than six parities the number of data disks is limited
+ * by RAID_DISK_MAX, and all the submatrices cannot be tested in a
+ * reasonable time, so only a random sample is checked.
+ */
+static int test_random_sub_matrix(int np)
+{
+	uint8_t M[RAID_PARITY_MAX * RAID_PARITY_MAX];
+	int nd = RAID_DISK_MAX - np;
+	int ip[RAID_PARITY_MAX];
+	int id[RAID_DISK_MAX];
+	int nr;
+	int count;
+
+	printf("Invert random square submatrices of the %dx%d Cauchy matrix\n", np, nd);
+
+	for (nr = 1; nr <= np; ++nr) {
+		for (count = 0; count < TEST_SAMPLE; ++count) {
+			int i, j;
+
+			test_rand_select(nr, nd, id);
+			test_rand_select(nr, np, ip);
+
+			/* setup the submatrix */
+			for (i = 0; i < nr; ++i)
+				for (j = 0; j < nr; ++j)
+					M[i * nr + j] = gfgen[ip[i]][id[j]];
+
+			/* invert */
+			if (raid_invert_fast(M, nr) != 0)
+				return -1;
+		}
+
+		printf("Tested %d matrix %dx%d\n", count, nr, nr);
+	}
+
+	printf("\n");
+
+	return 0;
+}
+
 int main(void)
 {
 	printf("Matrix inversion test for the RAID Cauchy library\n\n");
@@ -165,6 +257,12 @@ int main(void)
 	/* required to set the gfgen table */
 	raid_init();
 
+	if (test_random_sub_matrix(7) != 0
+		|| test_random_sub_matrix(8) != 0) {
+		printf("FAILED!\n");
+		exit(EXIT_FAILURE);
+	}
+
 	if (test_all_sub_matrix() != 0) {
 		printf("FAILED!\n");
 		exit(EXIT_FAILURE);
@@ -149,6 +149,8 @@ void speed(void)
 #ifdef CONFIG_X86_64
 	printf("%8s", "avx2e");
 #endif
+	printf("%8s", "avx512");
+	printf("%8s", "gfni");
 #endif
 	printf("\n");
 
@@ -202,6 +204,19 @@ void speed(void)
 		fflush(stdout);
 	}
 #endif
+#ifdef CONFIG_X86_64
+	printf("%8s", "");
+#endif
+#ifdef CONFIG_AVX512BW
+	if (raid_cpu_has_avx512bw()) {
+		SPEED_START {
+			raid_gen1_avx512bw(nd, size, v);
+		} SPEED_STOP
+
+		printf("%8" PRIu64, ds / dt);
+		fflush(stdout);
+	}
+#endif
 #endif
 	printf("\n");
 
@@ -261,6 +276,19 @@ void speed(void)
 		fflush(stdout);
 	}
 #endif
+#ifdef CONFIG_X86_64
+	printf("%8s", "");
+#endif
+#ifdef CONFIG_AVX512BW
+	if (raid_cpu_has_avx512bw()) {
+		SPEED_START {
+			raid_gen2_avx512bw(nd, size, v);
+		} SPEED_STOP
+
+		printf("%8" PRIu64, ds / dt);
+		fflush(stdout);
+	}
+#endif
 #endif
 	printf("\n");
 
@@ -386,6 +414,18 @@ void speed(void)
 		fflush(stdout);
 	}
 #endif
+#endif
+
+	printf("%8s", "");
+#ifdef CONFIG_GFNI
+	if (raid_cpu_has_gfni()) {
+		SPEED_START {
+			raid_gen3_gfni(nd, size, v);
+		} SPEED_STOP
+
+		printf("%8" PRIu64, ds / dt);
+		fflush(stdout);
+	}
 #endif
 #endif
 	printf("\n");
@@ -451,6 +491,18 @@ void speed(void)
 		fflush(stdout);
 	}
 #endif
+#endif
+
+	printf("%8s", "");
+#ifdef CONFIG_GFNI
+	if (raid_cpu_has_gfni()) {
+		SPEED_START {
+			raid_gen4_gfni(nd, size, v);
+		} SPEED_STOP
+
+		printf("%8" PRIu64, ds / dt);
+		fflush(stdout);
+	}
 #endif
 #endif
 	printf("\n");
@@ -516,6 +568,18 @@ void speed(void)
 		fflush(stdout);
 	}
 #endif
+#endif
+
+	printf("%8s", "");
+#ifdef CONFIG_GFNI
+	if (raid_cpu_has_gfni()) {
+		SPEED_START {
+			raid_gen5_gfni(nd, size, v);
+		} SPEED_STOP
+
+		printf("%8" PRIu64, ds / dt);
+		fflush(stdout);
+	}
 #endif
 #endif
 	printf("\n");
@@ -581,6 +645,166 @@ void speed(void)
 		fflush(stdout);
 	}
 #endif
+#endif
+
+	printf("%8s", "");
+#ifdef CONFIG_GFNI
+	if (raid_cpu_has_gfni()) {
+		SPEED_START {
+			raid_gen6_gfni(nd, size, v);
+		} SPEED_STOP
+
+		printf("%8" PRIu64, ds / dt);
+		fflush(stdout);
+	}
+#endif
+#endif
+	printf("\n");
+
+	/* GEN7 */
+	printf("%8s", "gen7");
+	printf("%8s", raid_gen7_tag());
+	fflush(stdout);
+
+	SPEED_START {
+		raid_gen7_int8(nd, size, v);
+	} SPEED_STOP
+
+	printf("%8" PRIu64, ds / dt);
+	fflush(stdout);
+
+	printf("%8s", "");
+	printf("%8s", "");
+
+#ifdef CONFIG_X86
+#ifdef CONFIG_SSE2
+	if (raid_cpu_has_sse2()) {
+		printf("%8s", "");
+
+#ifdef CONFIG_X86_64
+		printf("%8s", "");
+#endif
+	}
+#endif
+#endif
+
+#ifdef CONFIG_X86
+#ifdef CONFIG_SSSE3
+	if (raid_cpu_has_ssse3()) {
+		printf("%8s", "");
+
+#ifdef CONFIG_X86_64
+		SPEED_START {
+			raid_gen7_ssse3ext(nd, size, v);
+		} SPEED_STOP
+
+		printf("%8" PRIu64, ds / dt);
+		fflush(stdout);
+#endif
+	}
+#endif
+
+	printf("%8s", "");
+
+#ifdef CONFIG_X86_64
+#ifdef CONFIG_AVX2
+	if (raid_cpu_has_avx2()) {
+		SPEED_START {
+			raid_gen7_avx2ext(nd, size, v);
+		} SPEED_STOP
+
+		printf("%8" PRIu64, ds / dt);
+		fflush(stdout);
+	}
+#endif
+#endif
+
+	printf("%8s", "");
+#ifdef CONFIG_X86_64
+#ifdef CONFIG_GFNI
+	if (raid_cpu_has_gfni()) {
+		SPEED_START {
+			raid_gen7_gfniext(nd, size, v);
+		} SPEED_STOP
+
+		printf("%8" PRIu64, ds / dt);
+		fflush(stdout);
+	}
+#endif
+#endif
+#endif
+	printf("\n");
+
+	/* GEN8 */
+	printf("%8s", "gen8");
+	printf("%8s", raid_gen8_tag());
+	fflush(stdout);
+
+	SPEED_START {
+		raid_gen8_int8(nd, size, v);
+	} SPEED_STOP
+
+	printf("%8" PRIu64, ds / dt);
+	fflush(stdout);
+
+	printf("%8s", "");
+	printf("%8s", "");
+
+#ifdef CONFIG_X86
+#ifdef CONFIG_SSE2
+	if (raid_cpu_has_sse2()) {
+		printf("%8s", "");
+
+#ifdef CONFIG_X86_64
+		printf("%8s", "");
+#endif
+	}
+#endif
+#endif
+
+#ifdef CONFIG_X86
+#ifdef CONFIG_SSSE3
+	if (raid_cpu_has_ssse3()) {
+		printf("%8s", "");
+
+#ifdef CONFIG_X86_64
+		SPEED_START {
+			raid_gen8_ssse3ext(nd, size, v);
+		} SPEED_STOP
+
+		printf("%8" PRIu64, ds / dt);
+		fflush(stdout);
+#endif
+	}
+#endif
+
+	printf("%8s", "");
+
+#ifdef CONFIG_X86_64
+#ifdef CONFIG_AVX2
+	if (raid_cpu_has_avx2()) {
+		SPEED_START {
+			raid_gen8_avx2ext(nd, size, v);
+		} SPEED_STOP
+
+		printf("%8" PRIu64, ds / dt);
+		fflush(stdout);
+	}
+#endif
+#endif
+
+	printf("%8s", "");
+#ifdef CONFIG_X86_64
+#ifdef CONFIG_GFNI
+	if (raid_cpu_has_gfni()) {
+		SPEED_START {
+			raid_gen8_gfniext(nd, size, v);
+		} SPEED_STOP
+
+		printf("%8" PRIu64, ds / dt);
+		fflush(stdout);
+	}
+#endif
 #endif
 #endif
 	printf("\n");
@@ -594,6 +818,7 @@ void speed(void)
 #ifdef CONFIG_X86
 	printf("%8s", "ssse3");
 	printf("%8s", "avx2");
+	printf("%8s", "gfni");
 #endif
 	printf("\n");
 
@@ -633,6 +858,17 @@ void speed(void)
 		printf("%8" PRIu64, ds / dt);
 	}
 #endif
+#ifdef CONFIG_GFNI
+	if (raid_cpu_has_gfni()) {
+		SPEED_START {
+			for (j = 0; j < nd; ++j)
+				/* +1 to avoid GEN1 optimized case */
+				raid_rec1_gfni(1, id, ip + 1, nd, size, v);
+		} SPEED_STOP
+
+		printf("%8" PRIu64, ds / dt);
+	}
+#endif
 #endif
 	printf("\n");
 
@@ -672,6 +908,17 @@ void speed(void)
 		printf("%8" PRIu64, ds / dt);
 	}
 #endif
+#ifdef CONFIG_GFNI
+	if (raid_cpu_has_gfni()) {
+		SPEED_START {
+			for (j = 0; j < nd; ++j)
+				/* +1 to avoid GEN2 optimized case */
+				raid_recX_gfni(2, id, ip + 1, nd, size, v);
+		} SPEED_STOP
+
+		printf("%8" PRIu64, ds / dt);
+	}
+#endif
 #endif
 	printf("\n");
 
@@ -708,6 +955,16 @@ void speed(void)
 		printf("%8" PRIu64, ds / dt);
 	}
 #endif
+#ifdef CONFIG_GFNI
+	if (raid_cpu_has_gfni()) {
+		SPEED_START {
+			for (j = 0; j < nd; ++j)
+				raid_recX_gfni(3, id, ip, nd, size, v);
+		} SPEED_STOP
+
+		printf("%8" PRIu64, ds / dt);
+	}
+#endif
 #endif
 	printf("\n");
 
@@ -744,6 +1001,16 @@ void speed(void)
 		printf("%8" PRIu64, ds / dt);
 	}
 #endif
+#ifdef CONFIG_GFNI
+	if (raid_cpu_has_gfni()) {
+		SPEED_START {
+			for (j = 0; j < nd; ++j)
+				raid_recX_gfni(4, id, ip, nd, size, v);
+		} SPEED_STOP
+
+		printf("%8" PRIu64, ds / dt);
+	}
+#endif
 #endif
 	printf("\n");
 
@@ -780,6 +1047,16 @@ void speed(void)
 		printf("%8" PRIu64, ds / dt);
 	}
 #endif
+#ifdef CONFIG_GFNI
+	if (raid_cpu_has_gfni()) {
+		SPEED_START {
+			for (j = 0; j < nd; ++j)
+				raid_recX_gfni(5, id, ip, nd, size, v);
+		} SPEED_STOP
+
+		printf("%8" PRIu64, ds / dt);
+	}
+#endif
 #endif
 	printf("\n");
 
@@ -816,6 +1093,108 @@ void speed(void)
 		printf("%8" PRIu64, ds / dt);
 	}
 #endif
+#ifdef CONFIG_GFNI
+	if (raid_cpu_has_gfni()) {
+		SPEED_START {
+			for (j = 0; j < nd; ++j)
+				raid_recX_gfni(6, id, ip, nd, size, v);
+		} SPEED_STOP
+
+		printf("%8" PRIu64, ds / dt);
+	}
+#endif
+#endif
+	printf("\n");
+
+	printf("%8s", "rec7");
+	printf("%8s", raid_recX_tag());
+	fflush(stdout);
+
+	SPEED_START {
+		for (j = 0; j < nd; ++j)
+			raid_recX_int8(7, id, ip, nd, size, v);
+	} SPEED_STOP
+
+	printf("%8" PRIu64, ds / dt);
+	fflush(stdout);
+
+#ifdef CONFIG_X86
+#ifdef CONFIG_SSSE3
+	if (raid_cpu_has_ssse3()) {
+		SPEED_START {
+			for (j = 0; j < nd; ++j)
+				raid_recX_ssse3(7, id, ip, nd, size, v);
+		} SPEED_STOP
+
+		printf("%8" PRIu64, ds / dt);
+	}
+#endif
+#ifdef CONFIG_AVX2
+	if (raid_cpu_has_avx2()) {
+		SPEED_START {
+			for (j = 0; j < nd; ++j)
+				raid_recX_avx2(7, id, ip, nd, size, v);
+		} SPEED_STOP
+
+		printf("%8" PRIu64, ds / dt);
+	}
+#endif
+#ifdef CONFIG_GFNI
+	if (raid_cpu_has_gfni()) {
+		SPEED_START {
+			for (j = 0; j < nd; ++j)
+				raid_recX_gfni(7, id, ip, nd, size, v);
+		} SPEED_STOP
+
+		printf("%8" PRIu64, ds / dt);
+	}
+#endif
+#endif
+	printf("\n");
+
+	printf("%8s", "rec8");
+	printf("%8s", raid_recX_tag());
+	fflush(stdout);
+
+	SPEED_START {
+		for (j = 0; j < nd; ++j)
+			raid_recX_int8(8, id, ip, nd, size, v);
+	} SPEED_STOP
+
+	printf("%8" PRIu64, ds / dt);
+	fflush(stdout);
+
+#ifdef CONFIG_X86
+#ifdef CONFIG_SSSE3
+	if (raid_cpu_has_ssse3()) {
+		SPEED_START {
+			for (j = 0; j < nd; ++j)
+				raid_recX_ssse3(8, id, ip, nd, size, v);
+		} SPEED_STOP
+
+		printf("%8" PRIu64, ds / dt);
+	}
+#endif
+#ifdef CONFIG_AVX2
+	if (raid_cpu_has_avx2()) {
+		SPEED_START {
+			for (j = 0; j < nd; ++j)
+				raid_recX_avx2(8, id, ip, nd, size, v);
+		} SPEED_STOP
+
+		printf("%8" PRIu64, ds / dt);
+	}
+#endif
+#ifdef CONFIG_GFNI
+	if (raid_cpu_has_gfni()) {
+		SPEED_START {
+			for (j = 0; j < nd; ++j)
+				raid_recX_gfni(8, id, ip, nd, size, v);
+		} SPEED_STOP
+
+		printf("%8" PRIu64, ds / dt);
+	}
+#endif
 #endif
 	printf("\n");
 	printf("\n");
@@ -837,6 +1216,10 @@ int main(void)
 		printf("Including x86 SSSE3 functions\n");
 	if (raid_cpu_has_avx2())
 		printf("Including x86 AVX2 functions\n");
+	if (raid_cpu_has_avx512bw())
+		printf("Including x86 AVX512BW functions\n");
+	if (raid_cpu_has_gfni())
+		printf("Including x86 GFNI functions\n");
 #endif
 #ifdef CONFIG_X86_64
 	printf("Including x64 extended SSE register set\n");
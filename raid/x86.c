@@ -33,7 +33,7 @@
  * cache block, and processing 128 bytes doesn't increase performance, and in
  * some cases it even decreases it.
  */
-void raid_gen1_sse2(int nd, size_t size, void **vv)
+static __always_inline void raid_gen1_sse2_store(int nt, int nd, size_t size, void **vv)
 {
 	uint8_t **v = (uint8_t **)vv;
 	uint8_t *p;
@@ -56,14 +56,31 @@ void raid_gen1_sse2(int nd, size_t size, void **vv)
 			asm volatile ("pxor %0,%%xmm2" : : "m" (v[d][i + 32]));
 			asm volatile ("pxor %0,%%xmm3" : : "m" (v[d][i + 48]));
 		}
-		asm volatile ("movntdq %%xmm0,%0" : "=m" (p[i]));
-		asm volatile ("movntdq %%xmm1,%0" : "=m" (p[i + 16]));
-		asm volatile ("movntdq %%xmm2,%0" : "=m" (p[i + 32]));
-		asm volatile ("movntdq %%xmm3,%0" : "=m" (p[i + 48]));
+		if (nt) {
+			asm volatile ("movntdq %%xmm0,%0" : "=m" (p[i]));
+			asm volatile ("movntdq %%xmm1,%0" : "=m" (p[i + 16]));
+			asm volatile ("movntdq %%xmm2,%0" : "=m" (p[i + 32]));
+			asm volatile ("movntdq %%xmm3,%0" : "=m" (p[i + 48]));
+		} else {
+			asm volatile ("movdqa %%xmm0,%0" : "=m" (p[i]));
+			asm volatile ("movdqa %%xmm1,%0" : "=m" (p[i + 16]));
+			asm volatile ("movdqa %%xmm2,%0" : "=m" (p[i + 32]));
+			asm volatile ("movdqa %%xmm3,%0" : "=m" (p[i + 48]));
+		}
 	}
 
 	raid_sse_end();
 }
+
+void raid_gen1_sse2(int nd, size_t size, void **vv)
+{
+	raid_gen1_sse2_store(1, nd, size, vv);
+}
+
+void raid_gen1_sse2_temporal(int nd, size_t size, void **vv)
+{
+	raid_gen1_sse2_store(0, nd, size, vv);
+}
 #endif
 
 #if defined(CONFIG_X86) && defined(CONFIG_AVX2)
@@ -74,7 +91,7 @@ void raid_gen1_sse2(int nd, size_t size, void **vv)
  * cache block, and processing 128 bytes doesn't increase performance, and in
  * some cases it even decreases it.
  */
-void raid_gen1_avx2(int nd, size_t size, void **vv)
+static __always_inline void raid_gen1_avx2_store(int nt, int nd, size_t size, void **vv)
 {
 	uint8_t **v = (uint8_t **)vv;
 	uint8_t *p;
@@ -93,12 +110,71 @@ void raid_gen1_avx2(int nd, size_t size, void **vv)
 			asm volatile ("vpxor %0,%%ymm0,%%ymm0" : : "m" (v[d][i]));
 			asm volatile ("vpxor %0,%%ymm1,%%ymm1" : : "m" (v[d][i + 32]));
 		}
-		asm volatile ("vmovntdq %%ymm0,%0" : "=m" (p[i]));
-		asm volatile ("vmovntdq %%ymm1,%0" : "=m" (p[i + 32]));
+		if (nt) {
+			asm volatile ("vmovntdq %%ymm0,%0" : "=m" (p[i]));
+			asm volatile ("vmovntdq %%ymm1,%0" : "=m" (p[i + 32]));
+		} else {
+			asm volatile ("vmovdqa %%ymm0,%0" : "=m" (p[i]));
+			asm volatile ("vmovdqa %%ymm1,%0" : "=m" (p[i + 32]));
+		}
+	}
+
+	raid_avx_end();
+}
+
+void raid_gen1_avx2(int nd, size_t size, void **vv)
+{
+	raid_gen1_avx2_store(1, nd, size, vv);
+}
+
+void raid_gen1_avx2_temporal(int nd, size_t size, void **vv)
+{
+	raid_gen1_avx2_store(0, nd, size, vv);
+}
+#endif
+
+#if defined(CONFIG_X86) && defined(CONFIG_AVX512BW)
+/*
+ * GEN1 (RAID5 with xor) AVX512BW implementation
+ *
+ * It processes 64 bytes with a single zmm register, that is the typical
+ * cache block.
+ */
+static __always_inline void raid_gen1_avx512bw_store(int nt, int nd, size_t size, void **vv)
+{
+	uint8_t **v = (uint8_t **)vv;
+	uint8_t *p;
+	int d, l;
+	size_t i;
+
+	l = nd - 1;
+	p = v[nd];
+
+	raid_avx_begin();
+
+	for (i = 0; i < size; i += 64) {
+		asm volatile ("vmovdqa64 %0,%%zmm0" : : "m" (v[l][i]));
+		for (d = l - 1; d >= 0; --d)
+			asm volatile ("vpxorq %0,%%zmm0,%%zmm0" : : "m" (v[d][i]));
+		if (nt) {
+			asm volatile ("vmovntdq %%zmm0,%0" : "=m" (p[i]));
+		} else {
+			asm volatile ("vmovdqa64 %%zmm0,%0" : "=m" (p[i]));
+		}
 	}
 
 	raid_avx_end();
 }
+
+void raid_gen1_avx512bw(int nd, size_t size, void **vv)
+{
+	raid_gen1_avx512bw_store(1, nd, size, vv);
+}
+
+void raid_gen1_avx512bw_temporal(int nd, size_t size, void **vv)
+{
+	raid_gen1_avx512bw_store(0, nd, size, vv);
+}
 #endif
 
 #if defined(CONFIG_X86) && defined(CONFIG_SSE2)
@@ -121,7 +197,7 @@ static const struct gfconst16 {
 /*
  * GEN2 (RAID6 with powers of 2) SSE2 implementation
  */
-void raid_gen2_sse2(int nd, size_t size, void **vv)
+static __always_inline void raid_gen2_sse2_store(int nt, int nd, size_t size, void **vv)
 {
 	uint8_t **v = (uint8_t **)vv;
 	uint8_t *p;
@@ -161,21 +237,38 @@ void raid_gen2_sse2(int nd, size_t size, void **vv)
 			asm volatile ("pxor %xmm4,%xmm2");
 			asm volatile ("pxor %xmm5,%xmm3");
 		}
-		asm volatile ("movntdq %%xmm0,%0" : "=m" (p[i]));
-		asm volatile ("movntdq %%xmm1,%0" : "=m" (p[i + 16]));
-		asm volatile ("movntdq %%xmm2,%0" : "=m" (q[i]));
-		asm volatile ("movntdq %%xmm3,%0" : "=m" (q[i + 16]));
+		if (nt) {
+			asm volatile ("movntdq %%xmm0,%0" : "=m" (p[i]));
+			asm volatile ("movntdq %%xmm1,%0" : "=m" (p[i + 16]));
+			asm volatile ("movntdq %%xmm2,%0" : "=m" (q[i]));
+			asm volatile ("movntdq %%xmm3,%0" : "=m" (q[i + 16]));
+		} else {
+			asm volatile ("movdqa %%xmm0,%0" : "=m" (p[i]));
+			asm volatile ("movdqa %%xmm1,%0" : "=m" (p[i + 16]));
+			asm volatile ("movdqa %%xmm2,%0" : "=m" (q[i]));
+			asm volatile ("movdqa %%xmm3,%0" : "=m" (q[i + 16]));
+		}
 	}
 
 	raid_sse_end();
 }
+
+void raid_gen2_sse2(int nd, size_t size, void **vv)
+{
+	raid_gen2_sse2_store(1, nd, size, vv);
+}
+
+void raid_gen2_sse2_temporal(int nd, size_t size, void **vv)
+{
+	raid_gen2_sse2_store(0, nd, size, vv);
+}
 #endif
 
 #if defined(CONFIG_X86) && defined(CONFIG_AVX2)
 /*
  * GEN2 (RAID6 with powers of 2) AVX2 implementation
  */
-void raid_gen2_avx2(int nd, size_t size, void **vv)
+static __always_inline void raid_gen2_avx2_store(int nt, int nd, size_t size, void **vv)
 {
 	uint8_t **v = (uint8_t **)vv;
 	uint8_t *p;
@@ -214,14 +307,89 @@ void raid_gen2_avx2(int nd, size_t size, void **vv)
 			asm volatile ("vpxor %ymm4,%ymm2,%ymm2");
 			asm volatile ("vpxor %ymm5,%ymm3,%ymm3");
 		}
-		asm volatile ("vmovntdq %%ymm0,%0" : "=m" (p[i]));
-		asm volatile ("vmovntdq %%ymm1,%0" : "=m" (p[i + 32]));
-		asm volatile ("vmovntdq %%ymm2,%0" : "=m" (q[i]));
-		asm volatile ("vmovntdq %%ymm3,%0" : "=m" (q[i + 32]));
+		if (nt) {
+			asm volatile ("vmovntdq %%ymm0,%0" : "=m" (p[i]));
+			asm volatile ("vmovntdq %%ymm1,%0" : "=m" (p[i + 32]));
+			asm volatile ("vmovntdq %%ymm2,%0" : "=m" (q[i]));
+			asm volatile ("vmovntdq %%ymm3,%0" : "=m" (q[i + 32]));
+		} else {
+			asm volatile ("vmovdqa %%ymm0,%0" : "=m" (p[i]));
+			asm volatile ("vmovdqa %%ymm1,%0" : "=m" (p[i + 32]));
+			asm volatile ("vmovdqa %%ymm2,%0" : "=m" (q[i]));
+			asm volatile ("vmovdqa %%ymm3,%0" : "=m" (q[i + 32]));
+		}
+	}
+
+	raid_avx_end();
+}
+
+void raid_gen2_avx2(int nd, size_t size, void **vv)
+{
+	raid_gen2_avx2_store(1, nd, size, vv);
+}
+
+void raid_gen2_avx2_temporal(int nd, size_t size, void **vv)
+{
+	raid_gen2_avx2_store(0, nd, size, vv);
+}
+#endif
+
+#if defined(CONFIG_X86) && defined(CONFIG_AVX512BW)
+/*
+ * GEN2 (RAID6 with powers of 2) AVX512BW implementation
+ *
+ * The multiplication by 2 gets the bytes with the high bit set in a mask
+ * register with VPMOVB2M, and the three way xor is done with VPTERNLOGQ.
+ */
+static __always_inline void raid_gen2_avx512bw_store(int nt, int nd, size_t size, void **vv)
+{
+	uint8_t **v = (uint8_t **)vv;
+	uint8_t *p;
+	uint8_t *q;
+	int d, l;
+	size_t i;
+
+	l = nd - 1;
+	p = v[nd];
+	q = v[nd + 1];
+
+	raid_avx_begin();
+
+	asm volatile ("vbroadcasti32x4 %0,%%zmm7" : : "m" (gfconst16.poly[0]));
+
+	for (i = 0; i < size; i += 64) {
+		asm volatile ("vmovdqa64 %0,%%zmm0" : : "m" (v[l][i]));
+		asm volatile ("vmovdqa64 %zmm0,%zmm1");
+		for (d = l - 1; d >= 0; --d) {
+			asm volatile ("vmovdqa64 %0,%%zmm3" : : "m" (v[d][i]));
+
+			asm volatile ("vpmovb2m %zmm1,%k1");
+			asm volatile ("vpaddb %zmm1,%zmm1,%zmm1");
+			asm volatile ("vmovdqu8 %zmm7,%zmm2{%k1}{z}");
+			asm volatile ("vpxorq %zmm3,%zmm0,%zmm0");
+			asm volatile ("vpternlogq $0x96,%zmm3,%zmm2,%zmm1");
+		}
+		if (nt) {
+			asm volatile ("vmovntdq %%zmm0,%0" : "=m" (p[i]));
+			asm volatile ("vmovntdq %%zmm1,%0" : "=m" (q[i]));
+		} else {
+			asm volatile ("vmovdqa64 %%zmm0,%0" : "=m" (p[i]));
+			asm volatile ("vmovdqa64 %%zmm1,%0" : "=m" (q[i]));
+		}
 	}
 
 	raid_avx_end();
 }
+
+void raid_gen2_avx512bw(int nd, size_t size, void **vv)
+{
+	raid_gen2_avx512bw_store(1, nd, size, vv);
+}
+
+void raid_gen2_avx512bw_temporal(int nd, size_t size, void **vv)
+{
+	raid_gen2_avx512bw_store(0, nd, size, vv);
+}
 #endif
 
 #if defined(CONFIG_X86_64) && defined(CONFIG_SSE2)
@@ -230,7 +398,7 @@ void raid_gen2_avx2(int nd, size_t size, void **vv)
  *
  * Note that it uses 16 registers, meaning that x64 is required.
  */
-void raid_gen2_sse2ext(int nd, size_t size, void **vv)
+static __always_inline void raid_gen2_sse2ext_store(int nt, int nd, size_t size, void **vv)
 {
 	uint8_t **v = (uint8_t **)vv;
 	uint8_t *p;
@@ -290,25 +458,46 @@ void raid_gen2_sse2ext(int nd, size_t size, void **vv)
 			asm volatile ("pxor %xmm10,%xmm6");
 			asm volatile ("pxor %xmm11,%xmm7");
 		}
-		asm volatile ("movntdq %%xmm0,%0" : "=m" (p[i]));
-		asm volatile ("movntdq %%xmm1,%0" : "=m" (p[i + 16]));
-		asm volatile ("movntdq %%xmm2,%0" : "=m" (p[i + 32]));
-		asm volatile ("movntdq %%xmm3,%0" : "=m" (p[i + 48]));
-		asm volatile ("movntdq %%xmm4,%0" : "=m" (q[i]));
-		asm volatile ("movntdq %%xmm5,%0" : "=m" (q[i + 16]));
-		asm volatile ("movntdq %%xmm6,%0" : "=m" (q[i + 32]));
-		asm volatile ("movntdq %%xmm7,%0" : "=m" (q[i + 48]));
+		if (nt) {
+			asm volatile ("movntdq %%xmm0,%0" : "=m" (p[i]));
+			asm volatile ("movntdq %%xmm1,%0" : "=m" (p[i + 16]));
+			asm volatile ("movntdq %%xmm2,%0" : "=m" (p[i + 32]));
+			asm volatile ("movntdq %%xmm3,%0" : "=m" (p[i + 48]));
+			asm volatile ("movntdq %%xmm4,%0" : "=m" (q[i]));
+			asm volatile ("movntdq %%xmm5,%0" : "=m" (q[i + 16]));
+			asm volatile ("movntdq %%xmm6,%0" : "=m" (q[i + 32]));
+			asm volatile ("movntdq %%xmm7,%0" : "=m" (q[i + 48]));
+		} else {
+			asm volatile ("movdqa %%xmm0,%0" : "=m" (p[i]));
+			asm volatile ("movdqa %%xmm1,%0" : "=m" (p[i + 16]));
+			asm volatile ("movdqa %%xmm2,%0" : "=m" (p[i + 32]));
+			asm volatile ("movdqa %%xmm3,%0" : "=m" (p[i + 48]));
+			asm volatile ("movdqa %%xmm4,%0" : "=m" (q[i]));
+			asm volatile ("movdqa %%xmm5,%0" : "=m" (q[i + 16]));
+			asm volatile ("movdqa %%xmm6,%0" : "=m" (q[i + 32]));
+			asm volatile ("movdqa %%xmm7,%0" : "=m" (q[i + 48]));
+		}
 	}
 
 	raid_sse_end();
 }
+
+void raid_gen2_sse2ext(int nd, size_t size, void **vv)
+{
+	raid_gen2_sse2ext_store(1, nd, size, vv);
+}
+
+void raid_gen2_sse2ext_temporal(int nd, size_t size, void **vv)
+{
+	raid_gen2_sse2ext_store(0, nd, size, vv);
+}
 #endif
 
 #if defined(CONFIG_X86) && defined(CONFIG_SSSE3)
 /*
  * GEN3 (triple parity with Cauchy matrix) SSSE3 implementation
  */
-void raid_gen3_ssse3(int nd, size_t size, void **vv)
+static __always_inline void raid_gen3_ssse3_store(int nt, int nd, size_t size, void **vv)
 {
 	uint8_t **v = (uint8_t **)vv;
 	uint8_t *p;
@@ -392,13 +581,29 @@ void raid_gen3_ssse3(int nd, size_t size, void **vv)
 		asm volatile ("pxor %xmm4,%xmm1");
 		asm volatile ("pxor %xmm4,%xmm2");
 
-		asm volatile ("movntdq %%xmm0,%0" : "=m" (p[i]));
-		asm volatile ("movntdq %%xmm1,%0" : "=m" (q[i]));
-		asm volatile ("movntdq %%xmm2,%0" : "=m" (r[i]));
+		if (nt) {
+			asm volatile ("movntdq %%xmm0,%0" : "=m" (p[i]));
+			asm volatile ("movntdq %%xmm1,%0" : "=m" (q[i]));
+			asm volatile ("movntdq %%xmm2,%0" : "=m" (r[i]));
+		} else {
+			asm volatile ("movdqa %%xmm0,%0" : "=m" (p[i]));
+			asm volatile ("movdqa %%xmm1,%0" : "=m" (q[i]));
+			asm volatile ("movdqa %%xmm2,%0" : "=m" (r[i]));
+		}
 	}
 
 	raid_sse_end();
 }
+
+void raid_gen3_ssse3(int nd, size_t size, void **vv)
+{
+	raid_gen3_ssse3_store(1, nd, size, vv);
+}
+
+void raid_gen3_ssse3_temporal(int nd, size_t size, void **vv)
+{
+	raid_gen3_ssse3_store(0, nd, size, vv);
+}
 #endif
 
 #if defined(CONFIG_X86_64) && defined(CONFIG_SSSE3)
@@ -407,7 +612,7 @@ void raid_gen3_ssse3(int nd, size_t size, void **vv)
  *
  * Note that it uses 16 registers, meaning that x64 is required.
  */
-void raid_gen3_ssse3ext(int nd, size_t size, void **vv)
+static __always_inline void raid_gen3_ssse3ext_store(int nt, int nd, size_t size, void **vv)
 {
 	uint8_t **v = (uint8_t **)vv;
 	uint8_t *p;
@@ -530,16 +735,35 @@ void raid_gen3_ssse3ext(int nd, size_t size, void **vv)
 		asm volatile ("pxor %xmm12,%xmm9");
 		asm volatile ("pxor %xmm12,%xmm10");
 
-		asm volatile ("movntdq %%xmm0,%0" : "=m" (p[i]));
-		asm volatile ("movntdq %%xmm8,%0" : "=m" (p[i + 16]));
-		asm volatile ("movntdq %%xmm1,%0" : "=m" (q[i]));
-		asm volatile ("movntdq %%xmm9,%0" : "=m" (q[i + 16]));
-		asm volatile ("movntdq %%xmm2,%0" : "=m" (r[i]));
-		asm volatile ("movntdq %%xmm10,%0" : "=m" (r[i + 16]));
+		if (nt) {
+			asm volatile ("movntdq %%xmm0,%0" : "=m" (p[i]));
+			asm volatile ("movntdq %%xmm8,%0" : "=m" (p[i + 16]));
+			asm volatile ("movntdq %%xmm1,%0" : "=m" (q[i]));
+			asm volatile ("movntdq %%xmm9,%0" : "=m" (q[i + 16]));
+			asm volatile ("movntdq %%xmm2,%0" : "=m" (r[i]));
+			asm volatile ("movntdq %%xmm10,%0" : "=m" (r[i + 16]));
+		} else {
+			asm volatile ("movdqa %%xmm0,%0" : "=m" (p[i]));
+			asm volatile ("movdqa %%xmm8,%0" : "=m" (p[i + 16]));
+			asm volatile ("movdqa %%xmm1,%0" : "=m" (q[i]));
+			asm volatile ("movdqa %%xmm9,%0" : "=m" (q[i + 16]));
+			asm volatile ("movdqa %%xmm2,%0" : "=m" (r[i]));
+			asm volatile ("movdqa %%xmm10,%0" : "=m" (r[i + 16]));
+		}
 	}
 
 	raid_sse_end();
 }
+
+void raid_gen3_ssse3ext(int nd, size_t size, void **vv)
+{
+	raid_gen3_ssse3ext_store(1, nd, size, vv);
+}
+
+void raid_gen3_ssse3ext_temporal(int nd, size_t size, void **vv)
+{
+	raid_gen3_ssse3ext_store(0, nd, size, vv);
+}
 #endif
 
 #if defined(CONFIG_X86_64) && defined(CONFIG_AVX2)
@@ -548,7 +772,7 @@ void raid_gen3_ssse3ext(int nd, size_t size, void **vv)
  *
  * Note that it uses 16 registers, meaning that x64 is required.
  */
-void raid_gen3_avx2ext(int nd, size_t size, void **vv)
+static __always_inline void raid_gen3_avx2ext_store(int nt, int nd, size_t size, void **vv)
 {
 	uint8_t **v = (uint8_t **)vv;
 	uint8_t *p;
@@ -663,23 +887,112 @@ void raid_gen3_avx2ext(int nd, size_t size, void **vv)
 		asm volatile ("vpxor %ymm12,%ymm9,%ymm9");
 		asm volatile ("vpxor %ymm12,%ymm10,%ymm10");
 
-		asm volatile ("vmovntdq %%ymm0,%0" : "=m" (p[i]));
-		asm volatile ("vmovntdq %%ymm8,%0" : "=m" (p[i + 32]));
-		asm volatile ("vmovntdq %%ymm1,%0" : "=m" (q[i]));
-		asm volatile ("vmovntdq %%ymm9,%0" : "=m" (q[i + 32]));
-		asm volatile ("vmovntdq %%ymm2,%0" : "=m" (r[i]));
-		asm volatile ("vmovntdq %%ymm10,%0" : "=m" (r[i + 32]));
+		if (nt) {
+			asm volatile ("vmovntdq %%ymm0,%0" : "=m" (p[i]));
+			asm volatile ("vmovntdq %%ymm8,%0" : "=m" (p[i + 32]));
+			asm volatile ("vmovntdq %%ymm1,%0" : "=m" (q[i]));
+			asm volatile ("vmovntdq %%ymm9,%0" : "=m" (q[i + 32]));
+			asm volatile ("vmovntdq %%ymm2,%0" : "=m" (r[i]));
+			asm volatile ("vmovntdq %%ymm10,%0" : "=m" (r[i + 32]));
+		} else {
+			asm volatile ("vmovdqa %%ymm0,%0" : "=m" (p[i]));
+			asm volatile ("vmovdqa %%ymm8,%0" : "=m" (p[i + 32]));
+			asm volatile ("vmovdqa %%ymm1,%0" : "=m" (q[i]));
+			asm volatile ("vmovdqa %%ymm9,%0" : "=m" (q[i + 32]));
+			asm volatile ("vmovdqa %%ymm2,%0" : "=m" (r[i]));
+			asm volatile ("vmovdqa %%ymm10,%0" : "=m" (r[i + 32]));
+		}
+	}
+
+	raid_avx_end();
+}
+
+void raid_gen3_avx2ext(int nd, size_t size, void **vv)
+{
+	raid_gen3_avx2ext_store(1, nd, size, vv);
+}
+
+void raid_gen3_avx2ext_temporal(int nd, size_t size, void **vv)
+{
+	raid_gen3_avx2ext_store(0, nd, size, vv);
+}
+#endif
+
+#if defined(CONFIG_X86) && defined(CONFIG_GFNI)
+/*
+ * GEN3 (triple parity with Cauchy matrix) GFNI implementation
+ *
+ * The multiplications by the Cauchy coefficients are done with a single
+ * GF2P8AFFINEQB using the bit matrix of the coefficient, instead of
+ * two PSHUFB lookups. Note that GF2P8MULB cannot be used because it
+ * works with a different polynomial.
+ */
+static __always_inline void raid_gen3_gfni_store(int nt, int nd, size_t size, void **vv)
+{
+	uint8_t **v = (uint8_t **)vv;
+	uint8_t *p;
+	uint8_t *q;
+	uint8_t *r;
+	int d, l;
+	size_t i;
+
+	l = nd - 1;
+	p = v[nd];
+	q = v[nd + 1];
+	r = v[nd + 2];
+
+	raid_avx_begin();
+
+	for (i = 0; i < size; i += 64) {
+		/* last disk without the by two multiplication */
+		asm volatile ("vmovdqa64 %0,%%zmm6" : : "m" (v[l][i]));
+
+		asm volatile ("vmovdqa64 %zmm6,%zmm0");
+		asm volatile ("vmovdqa64 %zmm6,%zmm1");
+		asm volatile ("vgf2p8affineqb $0,%0%{1to8%},%%zmm6,%%zmm2" : : "m" (gfgenaffine[l][0]));
+
+		/* other disks */
+		for (d = l - 1; d >= 0; --d) {
+			asm volatile ("vmovdqa64 %0,%%zmm6" : : "m" (v[d][i]));
+
+			asm volatile ("vgf2p8affineqb $0,%0%{1to8%},%%zmm1,%%zmm1" : : "m" (gfmulaffine[2]));
+			asm volatile ("vpxorq %zmm6,%zmm0,%zmm0");
+			asm volatile ("vpxorq %zmm6,%zmm1,%zmm1");
+
+			asm volatile ("vgf2p8affineqb $0,%0%{1to8%},%%zmm6,%%zmm7" : : "m" (gfgenaffine[d][0]));
+			asm volatile ("vpxorq %zmm7,%zmm2,%zmm2");
+		}
+
+		if (nt) {
+			asm volatile ("vmovntdq %%zmm0,%0" : "=m" (p[i]));
+			asm volatile ("vmovntdq %%zmm1,%0" : "=m" (q[i]));
+			asm volatile ("vmovntdq %%zmm2,%0" : "=m" (r[i]));
+		} else {
+			asm volatile ("vmovdqa64 %%zmm0,%0" : "=m" (p[i]));
+			asm volatile ("vmovdqa64 %%zmm1,%0" : "=m" (q[i]));
+			asm volatile ("vmovdqa64 %%zmm2,%0" : "=m" (r[i]));
+		}
 	}
 
 	raid_avx_end();
 }
+
+void raid_gen3_gfni(int nd, size_t size, void **vv)
+{
+	raid_gen3_gfni_store(1, nd, size, vv);
+}
+
+void raid_gen3_gfni_temporal(int nd, size_t size, void **vv)
+{
+	raid_gen3_gfni_store(0, nd, size, vv);
+}
 #endif
 
 #if defined(CONFIG_X86) && defined(CONFIG_SSSE3)
 /*
  * GEN4 (quad parity with Cauchy matrix) SSSE3 implementation
  */
-void raid_gen4_ssse3(int nd, size_t size, void **vv)
+static __always_inline void raid_gen4_ssse3_store(int nt, int nd, size_t size, void **vv)
 {
 	uint8_t **v = (uint8_t **)vv;
 	uint8_t *p;
@@ -781,14 +1094,31 @@ void raid_gen4_ssse3(int nd, size_t size, void **vv)
 		asm volatile ("pxor %xmm4,%xmm2");
 		asm volatile ("pxor %xmm4,%xmm3");
 
-		asm volatile ("movntdq %%xmm0,%0" : "=m" (p[i]));
-		asm volatile ("movntdq %%xmm1,%0" : "=m" (q[i]));
-		asm volatile ("movntdq %%xmm2,%0" : "=m" (r[i]));
-		asm volatile ("movntdq %%xmm3,%0" : "=m" (s[i]));
+		if (nt) {
+			asm volatile ("movntdq %%xmm0,%0" : "=m" (p[i]));
+			asm volatile ("movntdq %%xmm1,%0" : "=m" (q[i]));
+			asm volatile ("movntdq %%xmm2,%0" : "=m" (r[i]));
+			asm volatile ("movntdq %%xmm3,%0" : "=m" (s[i]));
+		} else {
+			asm volatile ("movdqa %%xmm0,%0" : "=m" (p[i]));
+			asm volatile ("movdqa %%xmm1,%0" : "=m" (q[i]));
+			asm volatile ("movdqa %%xmm2,%0" : "=m" (r[i]));
+			asm volatile ("movdqa %%xmm3,%0" : "=m" (s[i]));
+		}
 	}
 
 	raid_sse_end();
 }
+
+void raid_gen4_ssse3(int nd, size_t size, void **vv)
+{
+	raid_gen4_ssse3_store(1, nd, size, vv);
+}
+
+void raid_gen4_ssse3_temporal(int nd, size_t size, void **vv)
+{
+	raid_gen4_ssse3_store(0, nd, size, vv);
+}
 #endif
 
 #if defined(CONFIG_X86_64) && defined(CONFIG_SSSE3)
@@ -797,7 +1127,7 @@ void raid_gen4_ssse3(int nd, size_t size, void **vv)
  *
  * Note that it uses 16 registers, meaning that x64 is required.
  */
-void raid_gen4_ssse3ext(int nd, size_t size, void **vv)
+static __always_inline void raid_gen4_ssse3ext_store(int nt, int nd, size_t size, void **vv)
 {
 	uint8_t **v = (uint8_t **)vv;
 	uint8_t *p;
@@ -950,18 +1280,39 @@ void raid_gen4_ssse3ext(int nd, size_t size, void **vv)
 		asm volatile ("pxor %xmm12,%xmm10");
 		asm volatile ("pxor %xmm12,%xmm11");
 
-		asm volatile ("movntdq %%xmm0,%0" : "=m" (p[i]));
-		asm volatile ("movntdq %%xmm8,%0" : "=m" (p[i + 16]));
-		asm volatile ("movntdq %%xmm1,%0" : "=m" (q[i]));
-		asm volatile ("movntdq %%xmm9,%0" : "=m" (q[i + 16]));
-		asm volatile ("movntdq %%xmm2,%0" : "=m" (r[i]));
-		asm volatile ("movntdq %%xmm10,%0" : "=m" (r[i + 16]));
-		asm volatile ("movntdq %%xmm3,%0" : "=m" (s[i]));
-		asm volatile ("movntdq %%xmm11,%0" : "=m" (s[i + 16]));
+		if (nt) {
+			asm volatile ("movntdq %%xmm0,%0" : "=m" (p[i]));
+			asm volatile ("movntdq %%xmm8,%0" : "=m" (p[i + 16]));
+			asm volatile ("movntdq %%xmm1,%0" : "=m" (q[i]));
+			asm volatile ("movntdq %%xmm9,%0" : "=m" (q[i + 16]));
+			asm volatile ("movntdq %%xmm2,%0" : "=m" (r[i]));
+			asm volatile ("movntdq %%xmm10,%0" : "=m" (r[i + 16]));
+			asm volatile ("movntdq %%xmm3,%0" : "=m" (s[i]));
+			asm volatile ("movntdq %%xmm11,%0" : "=m" (s[i + 16]));
+		} else {
+			asm volatile ("movdqa %%xmm0,%0" : "=m" (p[i]));
+			asm volatile ("movdqa %%xmm8,%0" : "=m" (p[i + 16]));
+			asm volatile ("movdqa %%xmm1,%0" : "=m" (q[i]));
+			asm volatile ("movdqa %%xmm9,%0" : "=m" (q[i + 16]));
+			asm volatile ("movdqa %%xmm2,%0" : "=m" (r[i]));
+			asm volatile ("movdqa %%xmm10,%0" : "=m" (r[i + 16]));
+			asm volatile ("movdqa %%xmm3,%0" : "=m" (s[i]));
+			asm volatile ("movdqa %%xmm11,%0" : "=m" (s[i + 16]));
+		}
 	}
 
 	raid_sse_end();
 }
+
+void raid_gen4_ssse3ext(int nd, size_t size, void **vv)
+{
+	raid_gen4_ssse3ext_store(1, nd, size, vv);
+}
+
+void raid_gen4_ssse3ext_temporal(int nd, size_t size, void **vv)
+{
+	raid_gen4_ssse3ext_store(0, nd, size, vv);
+}
 #endif
 
 #if defined(CONFIG_X86_64) && defined(CONFIG_AVX2)
@@ -970,7 +1321,7 @@ void raid_gen4_ssse3ext(int nd, size_t size, void **vv)
  *
  * Note that it uses 16 registers, meaning that x64 is required.
  */
-void raid_gen4_avx2ext(int nd, size_t size, void **vv)
+static __always_inline void raid_gen4_avx2ext_store(int nt, int nd, size_t size, void **vv)
 {
 	uint8_t **v = (uint8_t **)vv;
 	uint8_t *p;
@@ -1111,25 +1462,119 @@ void raid_gen4_avx2ext(int nd, size_t size, void **vv)
 		asm volatile ("vpxor %ymm12,%ymm10,%ymm10");
 		asm volatile ("vpxor %ymm12,%ymm11,%ymm11");
 
-		asm volatile ("vmovntdq %%ymm0,%0" : "=m" (p[i]));
-		asm volatile ("vmovntdq %%ymm8,%0" : "=m" (p[i + 32]));
-		asm volatile ("vmovntdq %%ymm1,%0" : "=m" (q[i]));
-		asm volatile ("vmovntdq %%ymm9,%0" : "=m" (q[i + 32]));
-		asm volatile ("vmovntdq %%ymm2,%0" : "=m" (r[i]));
-		asm volatile ("vmovntdq %%ymm10,%0" : "=m" (r[i + 32]));
-		asm volatile ("vmovntdq %%ymm3,%0" : "=m" (s[i]));
-		asm volatile ("vmovntdq %%ymm11,%0" : "=m" (s[i + 32]));
+		if (nt) {
+			asm volatile ("vmovntdq %%ymm0,%0" : "=m" (p[i]));
+			asm volatile ("vmovntdq %%ymm8,%0" : "=m" (p[i + 32]));
+			asm volatile ("vmovntdq %%ymm1,%0" : "=m" (q[i]));
+			asm volatile ("vmovntdq %%ymm9,%0" : "=m" (q[i + 32]));
+			asm volatile ("vmovntdq %%ymm2,%0" : "=m" (r[i]));
+			asm volatile ("vmovntdq %%ymm10,%0" : "=m" (r[i + 32]));
+			asm volatile ("vmovntdq %%ymm3,%0" : "=m" (s[i]));
+			asm volatile ("vmovntdq %%ymm11,%0" : "=m" (s[i + 32]));
+		} else {
+			asm volatile ("vmovdqa %%ymm0,%0" : "=m" (p[i]));
+			asm volatile ("vmovdqa %%ymm8,%0" : "=m" (p[i + 32]));
+			asm volatile ("vmovdqa %%ymm1,%0" : "=m" (q[i]));
+			asm volatile ("vmovdqa %%ymm9,%0" : "=m" (q[i + 32]));
+			asm volatile ("vmovdqa %%ymm2,%0" : "=m" (r[i]));
+			asm volatile ("vmovdqa %%ymm10,%0" : "=m" (r[i + 32]));
+			asm volatile ("vmovdqa %%ymm3,%0" : "=m" (s[i]));
+			asm volatile ("vmovdqa %%ymm11,%0" : "=m" (s[i + 32]));
+		}
+	}
+
+	raid_avx_end();
+}
+
+void raid_gen4_avx2ext(int nd, size_t size, void **vv)
+{
+	raid_gen4_avx2ext_store(1, nd, size, vv);
+}
+
+void raid_gen4_avx2ext_temporal(int nd, size_t size, void **vv)
+{
+	raid_gen4_avx2ext_store(0, nd, size, vv);
+}
+#endif
+
+#if defined(CONFIG_X86) && defined(CONFIG_GFNI)
+/*
+ * GEN4 (quad parity with Cauchy matrix) GFNI implementation
+ */
+static __always_inline void raid_gen4_gfni_store(int nt, int nd, size_t size, void **vv)
+{
+	uint8_t **v = (uint8_t **)vv;
+	uint8_t *p;
+	uint8_t *q;
+	uint8_t *r;
+	uint8_t *s;
+	int d, l;
+	size_t i;
+
+	l = nd - 1;
+	p = v[nd];
+	q = v[nd + 1];
+	r = v[nd + 2];
+	s = v[nd + 3];
+
+	raid_avx_begin();
+
+	for (i = 0; i < size; i += 64) {
+		/* last disk without the by two multiplication */
+		asm volatile ("vmovdqa64 %0,%%zmm6" : : "m" (v[l][i]));
+
+		asm volatile ("vmovdqa64 %zmm6,%zmm0");
+		asm volatile ("vmovdqa64 %zmm6,%zmm1");
+		asm volatile ("vgf2p8affineqb $0,%0%{1to8%},%%zmm6,%%zmm2" : : "m" (gfgenaffine[l][0]));
+		asm volatile ("vgf2p8affineqb $0,%0%{1to8%},%%zmm6,%%zmm3" : : "m" (gfgenaffine[l][1]));
+
+		/* other disks */
+		for (d = l - 1; d >= 0; --d) {
+			asm volatile ("vmovdqa64 %0,%%zmm6" : : "m" (v[d][i]));
+
+			asm volatile ("vgf2p8affineqb $0,%0%{1to8%},%%zmm1,%%zmm1" : : "m" (gfmulaffine[2]));
+			asm volatile ("vpxorq %zmm6,%zmm0,%zmm0");
+			asm volatile ("vpxorq %zmm6,%zmm1,%zmm1");
+
+			asm volatile ("vgf2p8affineqb $0,%0%{1to8%},%%zmm6,%%zmm7" : : "m" (gfgenaffine[d][0]));
+			asm volatile ("vpxorq %zmm7,%zmm2,%zmm2");
+
+			asm volatile ("vgf2p8affineqb $0,%0%{1to8%},%%zmm6,%%zmm7" : : "m" (gfgenaffine[d][1]));
+			asm volatile ("vpxorq %zmm7,%zmm3,%zmm3");
+		}
+
+		if (nt) {
+			asm volatile ("vmovntdq %%zmm0,%0" : "=m" (p[i]));
+			asm volatile ("vmovntdq %%zmm1,%0" : "=m" (q[i]));
+			asm volatile ("vmovntdq %%zmm2,%0" : "=m" (r[i]));
+			asm volatile ("vmovntdq %%zmm3,%0" : "=m" (s[i]));
+		} else {
+			asm volatile ("vmovdqa64 %%zmm0,%0" : "=m" (p[i]));
+			asm volatile ("vmovdqa64 %%zmm1,%0" : "=m" (q[i]));
+			asm volatile ("vmovdqa64 %%zmm2,%0" : "=m" (r[i]));
+			asm volatile ("vmovdqa64 %%zmm3,%0" : "=m" (s[i]));
+		}
 	}
 
 	raid_avx_end();
 }
+
+void raid_gen4_gfni(int nd, size_t size, void **vv)
+{
+	raid_gen4_gfni_store(1, nd, size, vv);
+}
+
+void raid_gen4_gfni_temporal(int nd, size_t size, void **vv)
+{
+	raid_gen4_gfni_store(0, nd, size, vv);
+}
 #endif
 
 #if defined(CONFIG_X86) && defined(CONFIG_SSSE3)
 /*
  * GEN5 (penta parity with Cauchy matrix) SSSE3 implementation
  */
-void raid_gen5_ssse3(int nd, size_t size, void **vv)
+static __always_inline void raid_gen5_ssse3_store(int nt, int nd, size_t size, void **vv)
 {
 	uint8_t **v = (uint8_t **)vv;
 	uint8_t *p;
@@ -1251,15 +1696,33 @@ void raid_gen5_ssse3(int nd, size_t size, void **vv)
 		asm volatile ("pxor %xmm4,%xmm3");
 		asm volatile ("pxor %xmm4,%xmm6");
 
-		asm volatile ("movntdq %%xmm6,%0" : "=m" (p[i]));
-		asm volatile ("movntdq %%xmm0,%0" : "=m" (q[i]));
-		asm volatile ("movntdq %%xmm1,%0" : "=m" (r[i]));
-		asm volatile ("movntdq %%xmm2,%0" : "=m" (s[i]));
-		asm volatile ("movntdq %%xmm3,%0" : "=m" (t[i]));
+		if (nt) {
+			asm volatile ("movntdq %%xmm6,%0" : "=m" (p[i]));
+			asm volatile ("movntdq %%xmm0,%0" : "=m" (q[i]));
+			asm volatile ("movntdq %%xmm1,%0" : "=m" (r[i]));
+			asm volatile ("movntdq %%xmm2,%0" : "=m" (s[i]));
+			asm volatile ("movntdq %%xmm3,%0" : "=m" (t[i]));
+		} else {
+			asm volatile ("movdqa %%xmm6,%0" : "=m" (p[i]));
+			asm volatile ("movdqa %%xmm0,%0" : "=m" (q[i]));
+			asm volatile ("movdqa %%xmm1,%0" : "=m" (r[i]));
+			asm volatile ("movdqa %%xmm2,%0" : "=m" (s[i]));
+			asm volatile ("movdqa %%xmm3,%0" : "=m" (t[i]));
+		}
 	}
 
 	raid_sse_end();
 }
+
+void raid_gen5_ssse3(int nd, size_t size, void **vv)
+{
+	raid_gen5_ssse3_store(1, nd, size, vv);
+}
+
+void raid_gen5_ssse3_temporal(int nd, size_t size, void **vv)
+{
+	raid_gen5_ssse3_store(0, nd, size, vv);
+}
 #endif
 
 #if defined(CONFIG_X86_64) && defined(CONFIG_SSSE3)
@@ -1268,7 +1731,7 @@ void raid_gen5_ssse3(int nd, size_t size, void **vv)
  *
  * Note that it uses 16 registers, meaning that x64 is required.
  */
-void raid_gen5_ssse3ext(int nd, size_t size, void **vv)
+static __always_inline void raid_gen5_ssse3ext_store(int nt, int nd, size_t size, void **vv)
 {
 	uint8_t **v = (uint8_t **)vv;
 	uint8_t *p;
@@ -1384,24 +1847,42 @@ void raid_gen5_ssse3ext(int nd, size_t size, void **vv)
 		asm volatile ("pxor %xmm10,%xmm3");
 		asm volatile ("pxor %xmm10,%xmm4");
 
-		asm volatile ("movntdq %%xmm0,%0" : "=m" (p[i]));
-		asm volatile ("movntdq %%xmm1,%0" : "=m" (q[i]));
-		asm volatile ("movntdq %%xmm2,%0" : "=m" (r[i]));
-		asm volatile ("movntdq %%xmm3,%0" : "=m" (s[i]));
-		asm volatile ("movntdq %%xmm4,%0" : "=m" (t[i]));
+		if (nt) {
+			asm volatile ("movntdq %%xmm0,%0" : "=m" (p[i]));
+			asm volatile ("movntdq %%xmm1,%0" : "=m" (q[i]));
+			asm volatile ("movntdq %%xmm2,%0" : "=m" (r[i]));
+			asm volatile ("movntdq %%xmm3,%0" : "=m" (s[i]));
+			asm volatile ("movntdq %%xmm4,%0" : "=m" (t[i]));
+		} else {
+			asm volatile ("movdqa %%xmm0,%0" : "=m" (p[i]));
+			asm volatile ("movdqa %%xmm1,%0" : "=m" (q[i]));
+			asm volatile ("movdqa %%xmm2,%0" : "=m" (r[i]));
+			asm volatile ("movdqa %%xmm3,%0" : "=m" (s[i]));
+			asm volatile ("movdqa %%xmm4,%0" : "=m" (t[i]));
+		}
 	}
 
 	raid_sse_end();
 }
-#endif
 
-#if defined(CONFIG_X86_64) && defined(CONFIG_AVX2)
+void raid_gen5_ssse3ext(int nd, size_t size, void **vv)
+{
+	raid_gen5_ssse3ext_store(1, nd, size, vv);
+}
+
+void raid_gen5_ssse3ext_temporal(int nd, size_t size, void **vv)
+{
+	raid_gen5_ssse3ext_store(0, nd, size, vv);
+}
+#endif
+
+#if defined(CONFIG_X86_64) && defined(CONFIG_AVX2)
 /*
  * GEN5 (penta parity with Cauchy matrix) AVX2 implementation
  *
  * Note that it uses 16 registers, meaning that x64 is required.
  */
-void raid_gen5_avx2ext(int nd, size_t size, void **vv)
+static __always_inline void raid_gen5_avx2ext_store(int nt, int nd, size_t size, void **vv)
 {
 	uint8_t **v = (uint8_t **)vv;
 	uint8_t *p;
@@ -1514,22 +1995,121 @@ void raid_gen5_avx2ext(int nd, size_t size, void **vv)
 		asm volatile ("vpxor %ymm10,%ymm3,%ymm3");
 		asm volatile ("vpxor %ymm10,%ymm4,%ymm4");
 
-		asm volatile ("vmovntdq %%ymm0,%0" : "=m" (p[i]));
-		asm volatile ("vmovntdq %%ymm1,%0" : "=m" (q[i]));
-		asm volatile ("vmovntdq %%ymm2,%0" : "=m" (r[i]));
-		asm volatile ("vmovntdq %%ymm3,%0" : "=m" (s[i]));
-		asm volatile ("vmovntdq %%ymm4,%0" : "=m" (t[i]));
+		if (nt) {
+			asm volatile ("vmovntdq %%ymm0,%0" : "=m" (p[i]));
+			asm volatile ("vmovntdq %%ymm1,%0" : "=m" (q[i]));
+			asm volatile ("vmovntdq %%ymm2,%0" : "=m" (r[i]));
+			asm volatile ("vmovntdq %%ymm3,%0" : "=m" (s[i]));
+			asm volatile ("vmovntdq %%ymm4,%0" : "=m" (t[i]));
+		} else {
+			asm volatile ("vmovdqa %%ymm0,%0" : "=m" (p[i]));
+			asm volatile ("vmovdqa %%ymm1,%0" : "=m" (q[i]));
+			asm volatile ("vmovdqa %%ymm2,%0" : "=m" (r[i]));
+			asm volatile ("vmovdqa %%ymm3,%0" : "=m" (s[i]));
+			asm volatile ("vmovdqa %%ymm4,%0" : "=m" (t[i]));
+		}
+	}
+
+	raid_avx_end();
+}
+
+void raid_gen5_avx2ext(int nd, size_t size, void **vv)
+{
+	raid_gen5_avx2ext_store(1, nd, size, vv);
+}
+
+void raid_gen5_avx2ext_temporal(int nd, size_t size, void **vv)
+{
+	raid_gen5_avx2ext_store(0, nd, size, vv);
+}
+#endif
+
+#if defined(CONFIG_X86) && defined(CONFIG_GFNI)
+/*
+ * GEN5 (penta parity with Cauchy matrix) GFNI implementation
+ */
+static __always_inline void raid_gen5_gfni_store(int nt, int nd, size_t size, void **vv)
+{
+	uint8_t **v = (uint8_t **)vv;
+	uint8_t *p;
+	uint8_t *q;
+	uint8_t *r;
+	uint8_t *s;
+	uint8_t *t;
+	int d, l;
+	size_t i;
+
+	l = nd - 1;
+	p = v[nd];
+	q = v[nd + 1];
+	r = v[nd + 2];
+	s = v[nd + 3];
+	t = v[nd + 4];
+
+	raid_avx_begin();
+
+	for (i = 0; i < size; i += 64) {
+		/* last disk without the by two multiplication */
+		asm volatile ("vmovdqa64 %0,%%zmm6" : : "m" (v[l][i]));
+
+		asm volatile ("vmovdqa64 %zmm6,%zmm0");
+		asm volatile ("vmovdqa64 %zmm6,%zmm1");
+		asm volatile ("vgf2p8affineqb $0,%0%{1to8%},%%zmm6,%%zmm2" : : "m" (gfgenaffine[l][0]));
+		asm volatile ("vgf2p8affineqb $0,%0%{1to8%},%%zmm6,%%zmm3" : : "m" (gfgenaffine[l][1]));
+		asm volatile ("vgf2p8affineqb $0,%0%{1to8%},%%zmm6,%%zmm4" : : "m" (gfgenaffine[l][2]));
+
+		/* other disks */
+		for (d = l - 1; d >= 0; --d) {
+			asm volatile ("vmovdqa64 %0,%%zmm6" : : "m" (v[d][i]));
+
+			asm volatile ("vgf2p8affineqb $0,%0%{1to8%},%%zmm1,%%zmm1" : : "m" (gfmulaffine[2]));
+			asm volatile ("vpxorq %zmm6,%zmm0,%zmm0");
+			asm volatile ("vpxorq %zmm6,%zmm1,%zmm1");
+
+			asm volatile ("vgf2p8affineqb $0,%0%{1to8%},%%zmm6,%%zmm7" : : "m" (gfgenaffine[d][0]));
+			asm volatile ("vpxorq %zmm7,%zmm2,%zmm2");
+
+			asm volatile ("vgf2p8affineqb $0,%0%{1to8%},%%zmm6,%%zmm7" : : "m" (gfgenaffine[d][1]));
+			asm volatile ("vpxorq %zmm7,%zmm3,%zmm3");
+
+			asm volatile ("vgf2p8affineqb $0,%0%{1to8%},%%zmm6,%%zmm7" : : "m" (gfgenaffine[d][2]));
+			asm volatile ("vpxorq %zmm7,%zmm4,%zmm4");
+		}
+
+		if (nt) {
+			asm volatile ("vmovntdq %%zmm0,%0" : "=m" (p[i]));
+			asm volatile ("vmovntdq %%zmm1,%0" : "=m" (q[i]));
+			asm volatile ("vmovntdq %%zmm2,%0" : "=m" (r[i]));
+			asm volatile ("vmovntdq %%zmm3,%0" : "=m" (s[i]));
+			asm volatile ("vmovntdq %%zmm4,%0" : "=m" (t[i]));
+		} else {
+			asm volatile ("vmovdqa64 %%zmm0,%0" : "=m" (p[i]));
+			asm volatile ("vmovdqa64 %%zmm1,%0" : "=m" (q[i]));
+			asm volatile ("vmovdqa64 %%zmm2,%0" : "=m" (r[i]));
+			asm volatile ("vmovdqa64 %%zmm3,%0" : "=m" (s[i]));
+			asm volatile ("vmovdqa64 %%zmm4,%0" : "=m" (t[i]));
+		}
 	}
 
 	raid_avx_end();
 }
+
+void raid_gen5_gfni(int nd, size_t size, void **vv)
+{
+	raid_gen5_gfni_store(1, nd, size, vv);
+}
+
+void raid_gen5_gfni_temporal(int nd, size_t size, void **vv)
+{
+	raid_gen5_gfni_store(0, nd, size, vv);
+}
 #endif
 
 #if defined(CONFIG_X86) && defined(CONFIG_SSSE3)
 /*
  * GEN6 (hexa parity with Cauchy matrix) SSSE3 implementation
  */
-void raid_gen6_ssse3(int nd, size_t size, void **vv)
+static __always_inline void raid_gen6_ssse3_store(int nt, int nd, size_t size, void **vv)
 {
 	uint8_t **v = (uint8_t **)vv;
 	uint8_t *p;
@@ -1671,16 +2251,35 @@ void raid_gen6_ssse3(int nd, size_t size, void **vv)
 		asm volatile ("pxor %xmm4,%xmm5");
 		asm volatile ("pxor %xmm4,%xmm6");
 
-		asm volatile ("movntdq %%xmm5,%0" : "=m" (p[i]));
-		asm volatile ("movntdq %%xmm6,%0" : "=m" (q[i]));
-		asm volatile ("movntdq %%xmm0,%0" : "=m" (r[i]));
-		asm volatile ("movntdq %%xmm1,%0" : "=m" (s[i]));
-		asm volatile ("movntdq %%xmm2,%0" : "=m" (t[i]));
-		asm volatile ("movntdq %%xmm3,%0" : "=m" (u[i]));
+		if (nt) {
+			asm volatile ("movntdq %%xmm5,%0" : "=m" (p[i]));
+			asm volatile ("movntdq %%xmm6,%0" : "=m" (q[i]));
+			asm volatile ("movntdq %%xmm0,%0" : "=m" (r[i]));
+			asm volatile ("movntdq %%xmm1,%0" : "=m" (s[i]));
+			asm volatile ("movntdq %%xmm2,%0" : "=m" (t[i]));
+			asm volatile ("movntdq %%xmm3,%0" : "=m" (u[i]));
+		} else {
+			asm volatile ("movdqa %%xmm5,%0" : "=m" (p[i]));
+			asm volatile ("movdqa %%xmm6,%0" : "=m" (q[i]));
+			asm volatile ("movdqa %%xmm0,%0" : "=m" (r[i]));
+			asm volatile ("movdqa %%xmm1,%0" : "=m" (s[i]));
+			asm volatile ("movdqa %%xmm2,%0" : "=m" (t[i]));
+			asm volatile ("movdqa %%xmm3,%0" : "=m" (u[i]));
+		}
 	}
 
 	raid_sse_end();
 }
+
+void raid_gen6_ssse3(int nd, size_t size, void **vv)
+{
+	raid_gen6_ssse3_store(1, nd, size, vv);
+}
+
+void raid_gen6_ssse3_temporal(int nd, size_t size, void **vv)
+{
+	raid_gen6_ssse3_store(0, nd, size, vv);
+}
 #endif
 
 #if defined(CONFIG_X86_64) && defined(CONFIG_SSSE3)
@@ -1689,7 +2288,7 @@ void raid_gen6_ssse3(int nd, size_t size, void **vv)
  *
  * Note that it uses 16 registers, meaning that x64 is required.
  */
-void raid_gen6_ssse3ext(int nd, size_t size, void **vv)
+static __always_inline void raid_gen6_ssse3ext_store(int nt, int nd, size_t size, void **vv)
 {
 	uint8_t **v = (uint8_t **)vv;
 	uint8_t *p;
@@ -1821,16 +2420,35 @@ void raid_gen6_ssse3ext(int nd, size_t size, void **vv)
 		asm volatile ("pxor %xmm10,%xmm4");
 		asm volatile ("pxor %xmm10,%xmm5");
 
-		asm volatile ("movntdq %%xmm0,%0" : "=m" (p[i]));
-		asm volatile ("movntdq %%xmm1,%0" : "=m" (q[i]));
-		asm volatile ("movntdq %%xmm2,%0" : "=m" (r[i]));
-		asm volatile ("movntdq %%xmm3,%0" : "=m" (s[i]));
-		asm volatile ("movntdq %%xmm4,%0" : "=m" (t[i]));
-		asm volatile ("movntdq %%xmm5,%0" : "=m" (u[i]));
+		if (nt) {
+			asm volatile ("movntdq %%xmm0,%0" : "=m" (p[i]));
+			asm volatile ("movntdq %%xmm1,%0" : "=m" (q[i]));
+			asm volatile ("movntdq %%xmm2,%0" : "=m" (r[i]));
+			asm volatile ("movntdq %%xmm3,%0" : "=m" (s[i]));
+			asm volatile ("movntdq %%xmm4,%0" : "=m" (t[i]));
+			asm volatile ("movntdq %%xmm5,%0" : "=m" (u[i]));
+		} else {
+			asm volatile ("movdqa %%xmm0,%0" : "=m" (p[i]));
+			asm volatile ("movdqa %%xmm1,%0" : "=m" (q[i]));
+			asm volatile ("movdqa %%xmm2,%0" : "=m" (r[i]));
+			asm volatile ("movdqa %%xmm3,%0" : "=m" (s[i]));
+			asm volatile ("movdqa %%xmm4,%0" : "=m" (t[i]));
+			asm volatile ("movdqa %%xmm5,%0" : "=m" (u[i]));
+		}
 	}
 
 	raid_sse_end();
 }
+
+void raid_gen6_ssse3ext(int nd, size_t size, void **vv)
+{
+	raid_gen6_ssse3ext_store(1, nd, size, vv);
+}
+
+void raid_gen6_ssse3ext_temporal(int nd, size_t size, void **vv)
+{
+	raid_gen6_ssse3ext_store(0, nd, size, vv);
+}
 #endif
 
 #if defined(CONFIG_X86_64) && defined(CONFIG_AVX2)
@@ -1839,7 +2457,7 @@ void raid_gen6_ssse3ext(int nd, size_t size, void **vv)
  *
  * Note that it uses 16 registers, meaning that x64 is required.
  */
-void raid_gen6_avx2ext(int nd, size_t size, void **vv)
+static __always_inline void raid_gen6_avx2ext_store(int nt, int nd, size_t size, void **vv)
 {
 	uint8_t **v = (uint8_t **)vv;
 	uint8_t *p;
@@ -1968,167 +2586,1144 @@ void raid_gen6_avx2ext(int nd, size_t size, void **vv)
 		asm volatile ("vpxor %ymm10,%ymm4,%ymm4");
 		asm volatile ("vpxor %ymm10,%ymm5,%ymm5");
 
-		asm volatile ("vmovntdq %%ymm0,%0" : "=m" (p[i]));
-		asm volatile ("vmovntdq %%ymm1,%0" : "=m" (q[i]));
-		asm volatile ("vmovntdq %%ymm2,%0" : "=m" (r[i]));
-		asm volatile ("vmovntdq %%ymm3,%0" : "=m" (s[i]));
-		asm volatile ("vmovntdq %%ymm4,%0" : "=m" (t[i]));
-		asm volatile ("vmovntdq %%ymm5,%0" : "=m" (u[i]));
+		if (nt) {
+			asm volatile ("vmovntdq %%ymm0,%0" : "=m" (p[i]));
+			asm volatile ("vmovntdq %%ymm1,%0" : "=m" (q[i]));
+			asm volatile ("vmovntdq %%ymm2,%0" : "=m" (r[i]));
+			asm volatile ("vmovntdq %%ymm3,%0" : "=m" (s[i]));
+			asm volatile ("vmovntdq %%ymm4,%0" : "=m" (t[i]));
+			asm volatile ("vmovntdq %%ymm5,%0" : "=m" (u[i]));
+		} else {
+			asm volatile ("vmovdqa %%ymm0,%0" : "=m" (p[i]));
+			asm volatile ("vmovdqa %%ymm1,%0" : "=m" (q[i]));
+			asm volatile ("vmovdqa %%ymm2,%0" : "=m" (r[i]));
+			asm volatile ("vmovdqa %%ymm3,%0" : "=m" (s[i]));
+			asm volatile ("vmovdqa %%ymm4,%0" : "=m" (t[i]));
+			asm volatile ("vmovdqa %%ymm5,%0" : "=m" (u[i]));
+		}
 	}
 
 	raid_avx_end();
 }
+
+void raid_gen6_avx2ext(int nd, size_t size, void **vv)
+{
+	raid_gen6_avx2ext_store(1, nd, size, vv);
+}
+
+void raid_gen6_avx2ext_temporal(int nd, size_t size, void **vv)
+{
+	raid_gen6_avx2ext_store(0, nd, size, vv);
+}
 #endif
 
-#if defined(CONFIG_X86) && defined(CONFIG_SSSE3)
+#if defined(CONFIG_X86) && defined(CONFIG_GFNI)
 /*
- * RAID recovering for one disk SSSE3 implementation
+ * GEN6 (hexa parity with Cauchy matrix) GFNI implementation
  */
-void raid_rec1_ssse3(int nr, int *id, int *ip, int nd, size_t size, void **vv)
+static __always_inline void raid_gen6_gfni_store(int nt, int nd, size_t size, void **vv)
 {
 	uint8_t **v = (uint8_t **)vv;
 	uint8_t *p;
-	uint8_t *pa;
-	uint8_t G;
-	uint8_t V;
+	uint8_t *q;
+	uint8_t *r;
+	uint8_t *s;
+	uint8_t *t;
+	uint8_t *u;
+	int d, l;
 	size_t i;
 
-	(void)nr; /* unused, it's always 1 */
+	l = nd - 1;
+	p = v[nd];
+	q = v[nd + 1];
+	r = v[nd + 2];
+	s = v[nd + 3];
+	t = v[nd + 4];
+	u = v[nd + 5];
 
-	/* if it's RAID5 uses the faster function */
-	if (ip[0] == 0) {
-		raid_rec1of1(id, nd, size, vv);
-		return;
-	}
+	raid_avx_begin();
 
-	/* setup the coefficients matrix */
-	G = A(ip[0], id[0]);
+	for (i = 0; i < size; i += 64) {
+		/* last disk without the by two multiplication */
+		asm volatile ("vmovdqa64 %0,%%zmm6" : : "m" (v[l][i]));
 
-	/* invert it to solve the system of linear equations */
-	V = inv(G);
+		asm volatile ("vmovdqa64 %zmm6,%zmm0");
+		asm volatile ("vmovdqa64 %zmm6,%zmm1");
+		asm volatile ("vgf2p8affineqb $0,%0%{1to8%},%%zmm6,%%zmm2" : : "m" (gfgenaffine[l][0]));
+		asm volatile ("vgf2p8affineqb $0,%0%{1to8%},%%zmm6,%%zmm3" : : "m" (gfgenaffine[l][1]));
+		asm volatile ("vgf2p8affineqb $0,%0%{1to8%},%%zmm6,%%zmm4" : : "m" (gfgenaffine[l][2]));
+		asm volatile ("vgf2p8affineqb $0,%0%{1to8%},%%zmm6,%%zmm5" : : "m" (gfgenaffine[l][3]));
 
-	/* compute delta parity */
-	raid_delta_gen(1, id, ip, nd, size, vv);
+		/* other disks */
+		for (d = l - 1; d >= 0; --d) {
+			asm volatile ("vmovdqa64 %0,%%zmm6" : : "m" (v[d][i]));
 
-	p = v[nd + ip[0]];
-	pa = v[id[0]];
+			asm volatile ("vgf2p8affineqb $0,%0%{1to8%},%%zmm1,%%zmm1" : : "m" (gfmulaffine[2]));
+			asm volatile ("vpxorq %zmm6,%zmm0,%zmm0");
+			asm volatile ("vpxorq %zmm6,%zmm1,%zmm1");
 
-	raid_sse_begin();
+			asm volatile ("vgf2p8affineqb $0,%0%{1to8%},%%zmm6,%%zmm7" : : "m" (gfgenaffine[d][0]));
+			asm volatile ("vpxorq %zmm7,%zmm2,%zmm2");
 
-	asm volatile ("movdqa %0,%%xmm7" : : "m" (gfconst16.low4[0]));
-	asm volatile ("movdqa %0,%%xmm4" : : "m" (gfmulpshufb[V][0][0]));
-	asm volatile ("movdqa %0,%%xmm5" : : "m" (gfmulpshufb[V][1][0]));
+			asm volatile ("vgf2p8affineqb $0,%0%{1to8%},%%zmm6,%%zmm7" : : "m" (gfgenaffine[d][1]));
+			asm volatile ("vpxorq %zmm7,%zmm3,%zmm3");
 
-	for (i = 0; i < size; i += 16) {
-		asm volatile ("movdqa %0,%%xmm0" : : "m" (p[i]));
-		asm volatile ("movdqa %0,%%xmm1" : : "m" (pa[i]));
-		asm volatile ("movdqa %xmm4,%xmm2");
-		asm volatile ("movdqa %xmm5,%xmm3");
-		asm volatile ("pxor   %xmm0,%xmm1");
-		asm volatile ("movdqa %xmm1,%xmm0");
-		asm volatile ("psrlw  $4,%xmm1");
-		asm volatile ("pand   %xmm7,%xmm0");
-		asm volatile ("pand   %xmm7,%xmm1");
-		asm volatile ("pshufb %xmm0,%xmm2");
-		asm volatile ("pshufb %xmm1,%xmm3");
-		asm volatile ("pxor   %xmm3,%xmm2");
-		asm volatile ("movdqa %%xmm2,%0" : "=m" (pa[i]));
+			asm volatile ("vgf2p8affineqb $0,%0%{1to8%},%%zmm6,%%zmm7" : : "m" (gfgenaffine[d][2]));
+			asm volatile ("vpxorq %zmm7,%zmm4,%zmm4");
+
+			asm volatile ("vgf2p8affineqb $0,%0%{1to8%},%%zmm6,%%zmm7" : : "m" (gfgenaffine[d][3]));
+			asm volatile ("vpxorq %zmm7,%zmm5,%zmm5");
+		}
+
+		if (nt) {
+			asm volatile ("vmovntdq %%zmm0,%0" : "=m" (p[i]));
+			asm volatile ("vmovntdq %%zmm1,%0" : "=m" (q[i]));
+			asm volatile ("vmovntdq %%zmm2,%0" : "=m" (r[i]));
+			asm volatile ("vmovntdq %%zmm3,%0" : "=m" (s[i]));
+			asm volatile ("vmovntdq %%zmm4,%0" : "=m" (t[i]));
+			asm volatile ("vmovntdq %%zmm5,%0" : "=m" (u[i]));
+		} else {
+			asm volatile ("vmovdqa64 %%zmm0,%0" : "=m" (p[i]));
+			asm volatile ("vmovdqa64 %%zmm1,%0" : "=m" (q[i]));
+			asm volatile ("vmovdqa64 %%zmm2,%0" : "=m" (r[i]));
+			asm volatile ("vmovdqa64 %%zmm3,%0" : "=m" (s[i]));
+			asm volatile ("vmovdqa64 %%zmm4,%0" : "=m" (t[i]));
+			asm volatile ("vmovdqa64 %%zmm5,%0" : "=m" (u[i]));
+		}
 	}
 
-	raid_sse_end();
+	raid_avx_end();
+}
+
+void raid_gen6_gfni(int nd, size_t size, void **vv)
+{
+	raid_gen6_gfni_store(1, nd, size, vv);
+}
+
+void raid_gen6_gfni_temporal(int nd, size_t size, void **vv)
+{
+	raid_gen6_gfni_store(0, nd, size, vv);
 }
 #endif
 
-#if defined(CONFIG_X86) && defined(CONFIG_SSSE3)
+#if defined(CONFIG_X86_64) && defined(CONFIG_SSSE3)
 /*
- * RAID recovering for two disks SSSE3 implementation
+ * GENX (generic parity with Cauchy matrix) SSSE3 implementation
+ *
+ * It computes from 3 to 8 parities, with @np expected to be a
+ * compile time constant. The compiler specializes the function for
+ * each parity level, removing all the checks on @np.
+ *
+ * Note that it uses 16 registers, meaning that x64 is required.
+ *
+ * Note that the parity is written with normal stores and not with
+ * non-temporal ones, because with more than six partial line streams
+ * the CPU runs out of write-combining buffers, slowing down a lot.
  */
-void raid_rec2_ssse3(int nr, int *id, int *ip, int nd, size_t size, void **vv)
+static __always_inline void raid_genX_ssse3ext(int np, int nd, size_t size, void **vv)
 {
 	uint8_t **v = (uint8_t **)vv;
-	const int N = 2;
-	uint8_t *p[N];
-	uint8_t *pa[N];
-	uint8_t G[N * N];
-	uint8_t V[N * N];
+	uint8_t *p[RAID_PARITY_MAX];
+	int d, l, j;
 	size_t i;
-	int j, k;
-
-	(void)nr; /* unused, it's always 2 */
-
-	/* setup the coefficients matrix */
-	for (j = 0; j < N; ++j)
-		for (k = 0; k < N; ++k)
-			G[j * N + k] = A(ip[j], id[k]);
-
-	/* invert it to solve the system of linear equations */
-	raid_invert(G, V, N);
 
-	/* compute delta parity */
-	raid_delta_gen(N, id, ip, nd, size, vv);
+	l = nd - 1;
+	for (j = 0; j < np; ++j)
+		p[j] = v[nd + j];
 
-	for (j = 0; j < N; ++j) {
-		p[j] = v[nd + ip[j]];
-		pa[j] = v[id[j]];
+	/* special case with only one data disk */
+	if (l == 0) {
+		for (j = 0; j < np; ++j)
+			memcpy(p[j], v[0], size);
+		return;
 	}
 
 	raid_sse_begin();
 
-	asm volatile ("movdqa %0,%%xmm7" : : "m" (gfconst16.low4[0]));
+	/* generic case with at least two data disks */
+	asm volatile ("movdqa %0,%%xmm14" : : "m" (gfconst16.poly[0]));
+	asm volatile ("movdqa %0,%%xmm15" : : "m" (gfconst16.low4[0]));
 
 	for (i = 0; i < size; i += 16) {
-		asm volatile ("movdqa %0,%%xmm0" : : "m" (p[0][i]));
-		asm volatile ("movdqa %0,%%xmm2" : : "m" (pa[0][i]));
-		asm volatile ("movdqa %0,%%xmm1" : : "m" (p[1][i]));
-		asm volatile ("movdqa %0,%%xmm3" : : "m" (pa[1][i]));
-		asm volatile ("pxor   %xmm2,%xmm0");
-		asm volatile ("pxor   %xmm3,%xmm1");
+		/* last disk without the by two multiplication */
+		asm volatile ("movdqa %0,%%xmm10" : : "m" (v[l][i]));
 
-		asm volatile ("pxor %xmm6,%xmm6");
+		asm volatile ("movdqa %xmm10,%xmm0");
+		asm volatile ("movdqa %xmm10,%xmm1");
 
-		asm volatile ("movdqa %0,%%xmm2" : : "m" (gfmulpshufb[V[0]][0][0]));
-		asm volatile ("movdqa %0,%%xmm3" : : "m" (gfmulpshufb[V[0]][1][0]));
-		asm volatile ("movdqa %xmm0,%xmm4");
-		asm volatile ("movdqa %xmm0,%xmm5");
-		asm volatile ("psrlw  $4,%xmm5");
-		asm volatile ("pand   %xmm7,%xmm4");
-		asm volatile ("pand   %xmm7,%xmm5");
-		asm volatile ("pshufb %xmm4,%xmm2");
-		asm volatile ("pshufb %xmm5,%xmm3");
-		asm volatile ("pxor   %xmm2,%xmm6");
-		asm volatile ("pxor   %xmm3,%xmm6");
+		asm volatile ("movdqa %xmm10,%xmm11");
+		asm volatile ("psrlw  $4,%xmm11");
+		asm volatile ("pand   %xmm15,%xmm10");
+		asm volatile ("pand   %xmm15,%xmm11");
 
-		asm volatile ("movdqa %0,%%xmm2" : : "m" (gfmulpshufb[V[1]][0][0]));
-		asm volatile ("movdqa %0,%%xmm3" : : "m" (gfmulpshufb[V[1]][1][0]));
-		asm volatile ("movdqa %xmm1,%xmm4");
-		asm volatile ("movdqa %xmm1,%xmm5");
-		asm volatile ("psrlw  $4,%xmm5");
-		asm volatile ("pand   %xmm7,%xmm4");
-		asm volatile ("pand   %xmm7,%xmm5");
-		asm volatile ("pshufb %xmm4,%xmm2");
-		asm volatile ("pshufb %xmm5,%xmm3");
-		asm volatile ("pxor   %xmm2,%xmm6");
-		asm volatile ("pxor   %xmm3,%xmm6");
+		asm volatile ("movdqa %0,%%xmm2" : : "m" (gfgenpshufb[l][0][0][0]));
+		asm volatile ("movdqa %0,%%xmm13" : : "m" (gfgenpshufb[l][0][1][0]));
+		asm volatile ("pshufb %xmm10,%xmm2");
+		asm volatile ("pshufb %xmm11,%xmm13");
+		asm volatile ("pxor   %xmm13,%xmm2");
 
-		asm volatile ("movdqa %%xmm6,%0" : "=m" (pa[0][i]));
+		if (np > 3) {
+			asm volatile ("movdqa %0,%%xmm3" : : "m" (gfgenpshufb[l][1][0][0]));
+			asm volatile ("movdqa %0,%%xmm13" : : "m" (gfgenpshufb[l][1][1][0]));
+			asm volatile ("pshufb %xmm10,%xmm3");
+			asm volatile ("pshufb %xmm11,%xmm13");
+			asm volatile ("pxor   %xmm13,%xmm3");
+		}
 
-		asm volatile ("pxor %xmm6,%xmm6");
+		if (np > 4) {
+			asm volatile ("movdqa %0,%%xmm4" : : "m" (gfgenpshufb[l][2][0][0]));
+			asm volatile ("movdqa %0,%%xmm13" : : "m" (gfgenpshufb[l][2][1][0]));
+			asm volatile ("pshufb %xmm10,%xmm4");
+			asm volatile ("pshufb %xmm11,%xmm13");
+			asm volatile ("pxor   %xmm13,%xmm4");
+		}
 
-		asm volatile ("movdqa %0,%%xmm2" : : "m" (gfmulpshufb[V[2]][0][0]));
-		asm volatile ("movdqa %0,%%xmm3" : : "m" (gfmulpshufb[V[2]][1][0]));
-		asm volatile ("movdqa %xmm0,%xmm4");
-		asm volatile ("movdqa %xmm0,%xmm5");
-		asm volatile ("psrlw  $4,%xmm5");
-		asm volatile ("pand   %xmm7,%xmm4");
-		asm volatile ("pand   %xmm7,%xmm5");
-		asm volatile ("pshufb %xmm4,%xmm2");
-		asm volatile ("pshufb %xmm5,%xmm3");
-		asm volatile ("pxor   %xmm2,%xmm6");
-		asm volatile ("pxor   %xmm3,%xmm6");
+		if (np > 5) {
+			asm volatile ("movdqa %0,%%xmm5" : : "m" (gfgenpshufb[l][3][0][0]));
+			asm volatile ("movdqa %0,%%xmm13" : : "m" (gfgenpshufb[l][3][1][0]));
+			asm volatile ("pshufb %xmm10,%xmm5");
+			asm volatile ("pshufb %xmm11,%xmm13");
+			asm volatile ("pxor   %xmm13,%xmm5");
+		}
 
-		asm volatile ("movdqa %0,%%xmm2" : : "m" (gfmulpshufb[V[3]][0][0]));
-		asm volatile ("movdqa %0,%%xmm3" : : "m" (gfmulpshufb[V[3]][1][0]));
-		asm volatile ("movdqa %xmm1,%xmm4");
+		if (np > 6) {
+			asm volatile ("movdqa %0,%%xmm6" : : "m" (gfgenpshufb[l][4][0][0]));
+			asm volatile ("movdqa %0,%%xmm13" : : "m" (gfgenpshufb[l][4][1][0]));
+			asm volatile ("pshufb %xmm10,%xmm6");
+			asm volatile ("pshufb %xmm11,%xmm13");
+			asm volatile ("pxor   %xmm13,%xmm6");
+		}
+
+		if (np > 7) {
+			asm volatile ("movdqa %0,%%xmm7" : : "m" (gfgenpshufb[l][5][0][0]));
+			asm volatile ("movdqa %0,%%xmm13" : : "m" (gfgenpshufb[l][5][1][0]));
+			asm volatile ("pshufb %xmm10,%xmm7");
+			asm volatile ("pshufb %xmm11,%xmm13");
+			asm volatile ("pxor   %xmm13,%xmm7");
+		}
+
+		/* intermediate disks */
+		for (d = l - 1; d > 0; --d) {
+			asm volatile ("movdqa %0,%%xmm10" : : "m" (v[d][i]));
+
+			asm volatile ("pxor %xmm11,%xmm11");
+			asm volatile ("pcmpgtb %xmm1,%xmm11");
+			asm volatile ("paddb %xmm1,%xmm1");
+			asm volatile ("pand %xmm14,%xmm11");
+			asm volatile ("pxor %xmm11,%xmm1");
+
+			asm volatile ("pxor %xmm10,%xmm0");
+			asm volatile ("pxor %xmm10,%xmm1");
+
+			asm volatile ("movdqa %xmm10,%xmm11");
+			asm volatile ("psrlw  $4,%xmm11");
+			asm volatile ("pand   %xmm15,%xmm10");
+			asm volatile ("pand   %xmm15,%xmm11");
+
+			asm volatile ("movdqa %0,%%xmm12" : : "m" (gfgenpshufb[d][0][0][0]));
+			asm volatile ("movdqa %0,%%xmm13" : : "m" (gfgenpshufb[d][0][1][0]));
+			asm volatile ("pshufb %xmm10,%xmm12");
+			asm volatile ("pshufb %xmm11,%xmm13");
+			asm volatile ("pxor   %xmm12,%xmm2");
+			asm volatile ("pxor   %xmm13,%xmm2");
+
+			if (np > 3) {
+				asm volatile ("movdqa %0,%%xmm12" : : "m" (gfgenpshufb[d][1][0][0]));
+				asm volatile ("movdqa %0,%%xmm13" : : "m" (gfgenpshufb[d][1][1][0]));
+				asm volatile ("pshufb %xmm10,%xmm12");
+				asm volatile ("pshufb %xmm11,%xmm13");
+				asm volatile ("pxor   %xmm12,%xmm3");
+				asm volatile ("pxor   %xmm13,%xmm3");
+			}
+
+			if (np > 4) {
+				asm volatile ("movdqa %0,%%xmm12" : : "m" (gfgenpshufb[d][2][0][0]));
+				asm volatile ("movdqa %0,%%xmm13" : : "m" (gfgenpshufb[d][2][1][0]));
+				asm volatile ("pshufb %xmm10,%xmm12");
+				asm volatile ("pshufb %xmm11,%xmm13");
+				asm volatile ("pxor   %xmm12,%xmm4");
+				asm volatile ("pxor   %xmm13,%xmm4");
+			}
+
+			if (np > 5) {
+				asm volatile ("movdqa %0,%%xmm12" : : "m" (gfgenpshufb[d][3][0][0]));
+				asm volatile ("movdqa %0,%%xmm13" : : "m" (gfgenpshufb[d][3][1][0]));
+				asm volatile ("pshufb %xmm10,%xmm12");
+				asm volatile ("pshufb %xmm11,%xmm13");
+				asm volatile ("pxor   %xmm12,%xmm5");
+				asm volatile ("pxor   %xmm13,%xmm5");
+			}
+
+			if (np > 6) {
+				asm volatile ("movdqa %0,%%xmm12" : : "m" (gfgenpshufb[d][4][0][0]));
+				asm volatile ("movdqa %0,%%xmm13" : : "m" (gfgenpshufb[d][4][1][0]));
+				asm volatile ("pshufb %xmm10,%xmm12");
+				asm volatile ("pshufb %xmm11,%xmm13");
+				asm volatile ("pxor   %xmm12,%xmm6");
+				asm volatile ("pxor   %xmm13,%xmm6");
+			}
+
+			if (np > 7) {
+				asm volatile ("movdqa %0,%%xmm12" : : "m" (gfgenpshufb[d][5][0][0]));
+				asm volatile ("movdqa %0,%%xmm13" : : "m" (gfgenpshufb[d][5][1][0]));
+				asm volatile ("pshufb %xmm10,%xmm12");
+				asm volatile ("pshufb %xmm11,%xmm13");
+				asm volatile ("pxor   %xmm12,%xmm7");
+				asm volatile ("pxor   %xmm13,%xmm7");
+			}
+		}
+
+		/* first disk with all coefficients at 1 */
+		asm volatile ("movdqa %0,%%xmm10" : : "m" (v[0][i]));
+
+		asm volatile ("pxor %xmm11,%xmm11");
+		asm volatile ("pcmpgtb %xmm1,%xmm11");
+		asm volatile ("paddb %xmm1,%xmm1");
+		asm volatile ("pand %xmm14,%xmm11");
+		asm volatile ("pxor %xmm11,%xmm1");
+
+		asm volatile ("pxor %xmm10,%xmm0");
+		asm volatile ("pxor %xmm10,%xmm1");
+		asm volatile ("pxor %xmm10,%xmm2");
+		if (np > 3)
+			asm volatile ("pxor %xmm10,%xmm3");
+		if (np > 4)
+			asm volatile ("pxor %xmm10,%xmm4");
+		if (np > 5)
+			asm volatile ("pxor %xmm10,%xmm5");
+		if (np > 6)
+			asm volatile ("pxor %xmm10,%xmm6");
+		if (np > 7)
+			asm volatile ("pxor %xmm10,%xmm7");
+
+		asm volatile ("movdqa %%xmm0,%0" : "=m" (p[0][i]));
+		asm volatile ("movdqa %%xmm1,%0" : "=m" (p[1][i]));
+		asm volatile ("movdqa %%xmm2,%0" : "=m" (p[2][i]));
+		if (np > 3)
+			asm volatile ("movdqa %%xmm3,%0" : "=m" (p[3][i]));
+		if (np > 4)
+			asm volatile ("movdqa %%xmm4,%0" : "=m" (p[4][i]));
+		if (np > 5)
+			asm volatile ("movdqa %%xmm5,%0" : "=m" (p[5][i]));
+		if (np > 6)
+			asm volatile ("movdqa %%xmm6,%0" : "=m" (p[6][i]));
+		if (np > 7)
+			asm volatile ("movdqa %%xmm7,%0" : "=m" (p[7][i]));
+	}
+
+	raid_sse_end();
+}
+
+/*
+ * GEN7 (hepta parity with Cauchy matrix) SSSE3 implementation
+ */
+void raid_gen7_ssse3ext(int nd, size_t size, void **vv)
+{
+	raid_genX_ssse3ext(7, nd, size, vv);
+}
+
+/*
+ * GEN8 (octa parity with Cauchy matrix) SSSE3 implementation
+ */
+void raid_gen8_ssse3ext(int nd, size_t size, void **vv)
+{
+	raid_genX_ssse3ext(8, nd, size, vv);
+}
+#endif
+
+#if defined(CONFIG_X86_64) && defined(CONFIG_AVX2)
+/*
+ * GENX (generic parity with Cauchy matrix) AVX2 implementation
+ *
+ * It computes from 3 to 8 parities, with @np expected to be a
+ * compile time constant. The compiler specializes the function for
+ * each parity level, removing all the checks on @np.
+ *
+ * Note that it uses 16 registers, meaning that x64 is required.
+ *
+ * Note that the parity is written with normal stores and not with
+ * non-temporal ones, because with more than six partial line streams
+ * the CPU runs out of write-combining buffers, slowing down a lot.
+ */
+static __always_inline void raid_genX_avx2ext(int np, int nd, size_t size, void **vv)
+{
+	uint8_t **v = (uint8_t **)vv;
+	uint8_t *p[RAID_PARITY_MAX];
+	int d, l, j;
+	size_t i;
+
+	l = nd - 1;
+	for (j = 0; j < np; ++j)
+		p[j] = v[nd + j];
+
+	/* special case with only one data disk */
+	if (l == 0) {
+		for (j = 0; j < np; ++j)
+			memcpy(p[j], v[0], size);
+		return;
+	}
+
+	raid_avx_begin();
+
+	/* generic case with at least two data disks */
+	asm volatile ("vpxor %ymm8,%ymm8,%ymm8");
+	asm volatile ("vbroadcasti128 %0,%%ymm14" : : "m" (gfconst16.poly[0]));
+	asm volatile ("vbroadcasti128 %0,%%ymm15" : : "m" (gfconst16.low4[0]));
+
+	for (i = 0; i < size; i += 32) {
+		/* last disk without the by two multiplication */
+		asm volatile ("vmovdqa %0,%%ymm10" : : "m" (v[l][i]));
+
+		asm volatile ("vmovdqa %ymm10,%ymm0");
+		asm volatile ("vmovdqa %ymm10,%ymm1");
+
+		asm volatile ("vpsrlw  $4,%ymm10,%ymm11");
+		asm volatile ("vpand   %ymm15,%ymm10,%ymm10");
+		asm volatile ("vpand   %ymm15,%ymm11,%ymm11");
+
+		asm volatile ("vbroadcasti128 %0,%%ymm2" : : "m" (gfgenpshufb[l][0][0][0]));
+		asm volatile ("vbroadcasti128 %0,%%ymm13" : : "m" (gfgenpshufb[l][0][1][0]));
+		asm volatile ("vpshufb %ymm10,%ymm2,%ymm2");
+		asm volatile ("vpshufb %ymm11,%ymm13,%ymm13");
+		asm volatile ("vpxor   %ymm13,%ymm2,%ymm2");
+
+		if (np > 3) {
+			asm volatile ("vbroadcasti128 %0,%%ymm3" : : "m" (gfgenpshufb[l][1][0][0]));
+			asm volatile ("vbroadcasti128 %0,%%ymm13" : : "m" (gfgenpshufb[l][1][1][0]));
+			asm volatile ("vpshufb %ymm10,%ymm3,%ymm3");
+			asm volatile ("vpshufb %ymm11,%ymm13,%ymm13");
+			asm volatile ("vpxor   %ymm13,%ymm3,%ymm3");
+		}
+
+		if (np > 4) {
+			asm volatile ("vbroadcasti128 %0,%%ymm4" : : "m" (gfgenpshufb[l][2][0][0]));
+			asm volatile ("vbroadcasti128 %0,%%ymm13" : : "m" (gfgenpshufb[l][2][1][0]));
+			asm volatile ("vpshufb %ymm10,%ymm4,%ymm4");
+			asm volatile ("vpshufb %ymm11,%ymm13,%ymm13");
+			asm volatile ("vpxor   %ymm13,%ymm4,%ymm4");
+		}
+
+		if (np > 5) {
+			asm volatile ("vbroadcasti128 %0,%%ymm5" : : "m" (gfgenpshufb[l][3][0][0]));
+			asm volatile ("vbroadcasti128 %0,%%ymm13" : : "m" (gfgenpshufb[l][3][1][0]));
+			asm volatile ("vpshufb %ymm10,%ymm5,%ymm5");
+			asm volatile ("vpshufb %ymm11,%ymm13,%ymm13");
+			asm volatile ("vpxor   %ymm13,%ymm5,%ymm5");
+		}
+
+		if (np > 6) {
+			asm volatile ("vbroadcasti128 %0,%%ymm6" : : "m" (gfgenpshufb[l][4][0][0]));
+			asm volatile ("vbroadcasti128 %0,%%ymm13" : : "m" (gfgenpshufb[l][4][1][0]));
+			asm volatile ("vpshufb %ymm10,%ymm6,%ymm6");
+			asm volatile ("vpshufb %ymm11,%ymm13,%ymm13");
+			asm volatile ("vpxor   %ymm13,%ymm6,%ymm6");
+		}
+
+		if (np > 7) {
+			asm volatile ("vbroadcasti128 %0,%%ymm7" : : "m" (gfgenpshufb[l][5][0][0]));
+			asm volatile ("vbroadcasti128 %0,%%ymm13" : : "m" (gfgenpshufb[l][5][1][0]));
+			asm volatile ("vpshufb %ymm10,%ymm7,%ymm7");
+			asm volatile ("vpshufb %ymm11,%ymm13,%ymm13");
+			asm volatile ("vpxor   %ymm13,%ymm7,%ymm7");
+		}
+
+		/* intermediate disks */
+		for (d = l - 1; d > 0; --d) {
+			asm volatile ("vmovdqa %0,%%ymm10" : : "m" (v[d][i]));
+
+			asm volatile ("vpcmpgtb %ymm1,%ymm8,%ymm11");
+			asm volatile ("vpaddb %ymm1,%ymm1,%ymm1");
+			asm volatile ("vpand %ymm14,%ymm11,%ymm11");
+			asm volatile ("vpxor %ymm11,%ymm1,%ymm1");
+
+			asm volatile ("vpxor %ymm10,%ymm0,%ymm0");
+			asm volatile ("vpxor %ymm10,%ymm1,%ymm1");
+
+			asm volatile ("vpsrlw  $4,%ymm10,%ymm11");
+			asm volatile ("vpand   %ymm15,%ymm10,%ymm10");
+			asm volatile ("vpand   %ymm15,%ymm11,%ymm11");
+
+			asm volatile ("vbroadcasti128 %0,%%ymm12" : : "m" (gfgenpshufb[d][0][0][0]));
+			asm volatile ("vbroadcasti128 %0,%%ymm13" : : "m" (gfgenpshufb[d][0][1][0]));
+			asm volatile ("vpshufb %ymm10,%ymm12,%ymm12");
+			asm volatile ("vpshufb %ymm11,%ymm13,%ymm13");
+			asm volatile ("vpxor   %ymm12,%ymm2,%ymm2");
+			asm volatile ("vpxor   %ymm13,%ymm2,%ymm2");
+
+			if (np > 3) {
+				asm volatile ("vbroadcasti128 %0,%%ymm12" : : "m" (gfgenpshufb[d][1][0][0]));
+				asm volatile ("vbroadcasti128 %0,%%ymm13" : : "m" (gfgenpshufb[d][1][1][0]));
+				asm volatile ("vpshufb %ymm10,%ymm12,%ymm12");
+				asm volatile ("vpshufb %ymm11,%ymm13,%ymm13");
+				asm volatile ("vpxor   %ymm12,%ymm3,%ymm3");
+				asm volatile ("vpxor   %ymm13,%ymm3,%ymm3");
+			}
+
+			if (np > 4) {
+				asm volatile ("vbroadcasti128 %0,%%ymm12" : : "m" (gfgenpshufb[d][2][0][0]));
+				asm volatile ("vbroadcasti128 %0,%%ymm13" : : "m" (gfgenpshufb[d][2][1][0]));
+				asm volatile ("vpshufb %ymm10,%ymm12,%ymm12");
+				asm volatile ("vpshufb %ymm11,%ymm13,%ymm13");
+				asm volatile ("vpxor   %ymm12,%ymm4,%ymm4");
+				asm volatile ("vpxor   %ymm13,%ymm4,%ymm4");
+			}
+
+			if (np > 5) {
+				asm volatile ("vbroadcasti128 %0,%%ymm12" : : "m" (gfgenpshufb[d][3][0][0]));
+				asm volatile ("vbroadcasti128 %0,%%ymm13" : : "m" (gfgenpshufb[d][3][1][0]));
+				asm volatile ("vpshufb %ymm10,%ymm12,%ymm12");
+				asm volatile ("vpshufb %ymm11,%ymm13,%ymm13");
+				asm volatile ("vpxor   %ymm12,%ymm5,%ymm5");
+				asm volatile ("vpxor   %ymm13,%ymm5,%ymm5");
+			}
+
+			if (np > 6) {
+				asm volatile ("vbroadcasti128 %0,%%ymm12" : : "m" (gfgenpshufb[d][4][0][0]));
+				asm volatile ("vbroadcasti128 %0,%%ymm13" : : "m" (gfgenpshufb[d][4][1][0]));
+				asm volatile ("vpshufb %ymm10,%ymm12,%ymm12");
+				asm volatile ("vpshufb %ymm11,%ymm13,%ymm13");
+				asm volatile ("vpxor   %ymm12,%ymm6,%ymm6");
+				asm volatile ("vpxor   %ymm13,%ymm6,%ymm6");
+			}
+
+			if (np > 7) {
+				asm volatile ("vbroadcasti128 %0,%%ymm12" : : "m" (gfgenpshufb[d][5][0][0]));
+				asm volatile ("vbroadcasti128 %0,%%ymm13" : : "m" (gfgenpshufb[d][5][1][0]));
+				asm volatile ("vpshufb %ymm10,%ymm12,%ymm12");
+				asm volatile ("vpshufb %ymm11,%ymm13,%ymm13");
+				asm volatile ("vpxor   %ymm12,%ymm7,%ymm7");
+				asm volatile ("vpxor   %ymm13,%ymm7,%ymm7");
+			}
+		}
+
+		/* first disk with all coefficients at 1 */
+		asm volatile ("vmovdqa %0,%%ymm10" : : "m" (v[0][i]));
+
+		asm volatile ("vpcmpgtb %ymm1,%ymm8,%ymm11");
+		asm volatile ("vpaddb %ymm1,%ymm1,%ymm1");
+		asm volatile ("vpand %ymm14,%ymm11,%ymm11");
+		asm volatile ("vpxor %ymm11,%ymm1,%ymm1");
+
+		asm volatile ("vpxor %ymm10,%ymm0,%ymm0");
+		asm volatile ("vpxor %ymm10,%ymm1,%ymm1");
+		asm volatile ("vpxor %ymm10,%ymm2,%ymm2");
+		if (np > 3)
+			asm volatile ("vpxor %ymm10,%ymm3,%ymm3");
+		if (np > 4)
+			asm volatile ("vpxor %ymm10,%ymm4,%ymm4");
+		if (np > 5)
+			asm volatile ("vpxor %ymm10,%ymm5,%ymm5");
+		if (np > 6)
+			asm volatile ("vpxor %ymm10,%ymm6,%ymm6");
+		if (np > 7)
+			asm volatile ("vpxor %ymm10,%ymm7,%ymm7");
+
+		asm volatile ("vmovdqa %%ymm0,%0" : "=m" (p[0][i]));
+		asm volatile ("vmovdqa %%ymm1,%0" : "=m" (p[1][i]));
+		asm volatile ("vmovdqa %%ymm2,%0" : "=m" (p[2][i]));
+		if (np > 3)
+			asm volatile ("vmovdqa %%ymm3,%0" : "=m" (p[3][i]));
+		if (np > 4)
+			asm volatile ("vmovdqa %%ymm4,%0" : "=m" (p[4][i]));
+		if (np > 5)
+			asm volatile ("vmovdqa %%ymm5,%0" : "=m" (p[5][i]));
+		if (np > 6)
+			asm volatile ("vmovdqa %%ymm6,%0" : "=m" (p[6][i]));
+		if (np > 7)
+			asm volatile ("vmovdqa %%ymm7,%0" : "=m" (p[7][i]));
+	}
+
+	raid_avx_end();
+}
+
+/*
+ * GEN7 (hepta parity with Cauchy matrix) AVX2 implementation
+ */
+void raid_gen7_avx2ext(int nd, size_t size, void **vv)
+{
+	raid_genX_avx2ext(7, nd, size, vv);
+}
+
+/*
+ * GEN8 (octa parity with Cauchy matrix) AVX2 implementation
+ */
+void raid_gen8_avx2ext(int nd, size_t size, void **vv)
+{
+	raid_genX_avx2ext(8, nd, size, vv);
+}
+#endif
+
+#if defined(CONFIG_X86_64) && defined(CONFIG_GFNI)
+/*
+ * GENX (generic parity with Cauchy matrix) GFNI implementation
+ *
+ * It computes from 3 to 8 parities, with @np expected to be a
+ * compile time constant. The compiler specializes the function for
+ * each parity level, removing all the checks on @np.
+ *
+ * Note that it uses 10 registers, meaning that x64 is required.
+ */
+static __always_inline void raid_genX_gfniext(int np, int nt, int nd, size_t size, void **vv)
+{
+	uint8_t **v = (uint8_t **)vv;
+	uint8_t *p[RAID_PARITY_MAX];
+	int d, l, j;
+	size_t i;
+
+	l = nd - 1;
+	for (j = 0; j < np; ++j)
+		p[j] = v[nd + j];
+
+	raid_avx_begin();
+
+	for (i = 0; i < size; i += 64) {
+		/* last disk without the by two multiplication */
+		asm volatile ("vmovdqa64 %0,%%zmm8" : : "m" (v[l][i]));
+
+		asm volatile ("vmovdqa64 %zmm8,%zmm0");
+		asm volatile ("vmovdqa64 %zmm8,%zmm1");
+		asm volatile ("vgf2p8affineqb $0,%0%{1to8%},%%zmm8,%%zmm2" : : "m" (gfgenaffine[l][0]));
+		if (np > 3)
+			asm volatile ("vgf2p8affineqb $0,%0%{1to8%},%%zmm8,%%zmm3" : : "m" (gfgenaffine[l][1]));
+		if (np > 4)
+			asm volatile ("vgf2p8affineqb $0,%0%{1to8%},%%zmm8,%%zmm4" : : "m" (gfgenaffine[l][2]));
+		if (np > 5)
+			asm volatile ("vgf2p8affineqb $0,%0%{1to8%},%%zmm8,%%zmm5" : : "m" (gfgenaffine[l][3]));
+		if (np > 6)
+			asm volatile ("vgf2p8affineqb $0,%0%{1to8%},%%zmm8,%%zmm6" : : "m" (gfgenaffine[l][4]));
+		if (np > 7)
+			asm volatile ("vgf2p8affineqb $0,%0%{1to8%},%%zmm8,%%zmm7" : : "m" (gfgenaffine[l][5]));
+
+		/* other disks */
+		for (d = l - 1; d >= 0; --d) {
+			asm volatile ("vmovdqa64 %0,%%zmm8" : : "m" (v[d][i]));
+
+			asm volatile ("vgf2p8affineqb $0,%0%{1to8%},%%zmm1,%%zmm1" : : "m" (gfmulaffine[2]));
+			asm volatile ("vpxorq %zmm8,%zmm0,%zmm0");
+			asm volatile ("vpxorq %zmm8,%zmm1,%zmm1");
+
+			asm volatile ("vgf2p8affineqb $0,%0%{1to8%},%%zmm8,%%zmm9" : : "m" (gfgenaffine[d][0]));
+			asm volatile ("vpxorq %zmm9,%zmm2,%zmm2");
+
+			if (np > 3) {
+				asm volatile ("vgf2p8affineqb $0,%0%{1to8%},%%zmm8,%%zmm9" : : "m" (gfgenaffine[d][1]));
+				asm volatile ("vpxorq %zmm9,%zmm3,%zmm3");
+			}
+
+			if (np > 4) {
+				asm volatile ("vgf2p8affineqb $0,%0%{1to8%},%%zmm8,%%zmm9" : : "m" (gfgenaffine[d][2]));
+				asm volatile ("vpxorq %zmm9,%zmm4,%zmm4");
+			}
+
+			if (np > 5) {
+				asm volatile ("vgf2p8affineqb $0,%0%{1to8%},%%zmm8,%%zmm9" : : "m" (gfgenaffine[d][3]));
+				asm volatile ("vpxorq %zmm9,%zmm5,%zmm5");
+			}
+
+			if (np > 6) {
+				asm volatile ("vgf2p8affineqb $0,%0%{1to8%},%%zmm8,%%zmm9" : : "m" (gfgenaffine[d][4]));
+				asm volatile ("vpxorq %zmm9,%zmm6,%zmm6");
+			}
+
+			if (np > 7) {
+				asm volatile ("vgf2p8affineqb $0,%0%{1to8%},%%zmm8,%%zmm9" : : "m" (gfgenaffine[d][5]));
+				asm volatile ("vpxorq %zmm9,%zmm7,%zmm7");
+			}
+		}
+
+		if (nt) {
+			asm volatile ("vmovntdq %%zmm0,%0" : "=m" (p[0][i]));
+			asm volatile ("vmovntdq %%zmm1,%0" : "=m" (p[1][i]));
+			asm volatile ("vmovntdq %%zmm2,%0" : "=m" (p[2][i]));
+			if (np > 3)
+				asm volatile ("vmovntdq %%zmm3,%0" : "=m" (p[3][i]));
+			if (np > 4)
+				asm volatile ("vmovntdq %%zmm4,%0" : "=m" (p[4][i]));
+			if (np > 5)
+				asm volatile ("vmovntdq %%zmm5,%0" : "=m" (p[5][i]));
+			if (np > 6)
+				asm volatile ("vmovntdq %%zmm6,%0" : "=m" (p[6][i]));
+			if (np > 7)
+				asm volatile ("vmovntdq %%zmm7,%0" : "=m" (p[7][i]));
+		} else {
+			asm volatile ("vmovdqa64 %%zmm0,%0" : "=m" (p[0][i]));
+			asm volatile ("vmovdqa64 %%zmm1,%0" : "=m" (p[1][i]));
+			asm volatile ("vmovdqa64 %%zmm2,%0" : "=m" (p[2][i]));
+			if (np > 3)
+				asm volatile ("vmovdqa64 %%zmm3,%0" : "=m" (p[3][i]));
+			if (np > 4)
+				asm volatile ("vmovdqa64 %%zmm4,%0" : "=m" (p[4][i]));
+			if (np > 5)
+				asm volatile ("vmovdqa64 %%zmm5,%0" : "=m" (p[5][i]));
+			if (np > 6)
+				asm volatile ("vmovdqa64 %%zmm6,%0" : "=m" (p[6][i]));
+			if (np > 7)
+				asm volatile ("vmovdqa64 %%zmm7,%0" : "=m" (p[7][i]));
+		}
+	}
+
+	raid_avx_end();
+}
+
+/*
+ * GEN7 (hepta parity with Cauchy matrix) GFNI implementation
+ */
+void raid_gen7_gfniext(int nd, size_t size, void **vv)
+{
+	raid_genX_gfniext(7, 1, nd, size, vv);
+}
+
+void raid_gen7_gfniext_temporal(int nd, size_t size, void **vv)
+{
+	raid_genX_gfniext(7, 0, nd, size, vv);
+}
+
+/*
+ * GEN8 (octa parity with Cauchy matrix) GFNI implementation
+ */
+void raid_gen8_gfniext(int nd, size_t size, void **vv)
+{
+	raid_genX_gfniext(8, 1, nd, size, vv);
+}
+
+void raid_gen8_gfniext_temporal(int nd, size_t size, void **vv)
+{
+	raid_genX_gfniext(8, 0, nd, size, vv);
+}
+#endif
+
+#if defined(CONFIG_X86_64) && defined(CONFIG_AVX512BW)
+/*
+ * GENX (generic parity with Cauchy matrix) AVX512BW implementation
+ *
+ * It computes from 3 to 8 parities, with @np expected to be a
+ * compile time constant. The compiler specializes the function for
+ * each parity level, removing all the checks on @np.
+ *
+ * It's used by CPUs with AVX512BW but without GFNI, doing the
+ * multiplications with two PSHUFB lookups as the AVX2 one, but
+ * on 64 bytes at time.
+ *
+ * Note that it uses 15 registers, meaning that x64 is required.
+ */
+static __always_inline void raid_genX_avx512bwext(int np, int nt, int nd, size_t size, void **vv)
+{
+	uint8_t **v = (uint8_t **)vv;
+	uint8_t *p[RAID_PARITY_MAX];
+	int d, l, j;
+	size_t i;
+
+	l = nd - 1;
+	for (j = 0; j < np; ++j)
+		p[j] = v[nd + j];
+
+	/* special case with only one data disk */
+	if (l == 0) {
+		for (j = 0; j < np; ++j)
+			memcpy(p[j], v[0], size);
+		return;
+	}
+
+	raid_avx_begin();
+
+	/* generic case with at least two data disks */
+	asm volatile ("vbroadcasti32x4 %0,%%zmm14" : : "m" (gfconst16.poly[0]));
+	asm volatile ("vbroadcasti32x4 %0,%%zmm15" : : "m" (gfconst16.low4[0]));
+
+	for (i = 0; i < size; i += 64) {
+		/* last disk without the by two multiplication */
+		asm volatile ("vmovdqa64 %0,%%zmm8" : : "m" (v[l][i]));
+
+		asm volatile ("vmovdqa64 %zmm8,%zmm0");
+		asm volatile ("vmovdqa64 %zmm8,%zmm1");
+
+		asm volatile ("vpsrlw  $4,%zmm8,%zmm9");
+		asm volatile ("vpandq  %zmm15,%zmm8,%zmm12");
+		asm volatile ("vpandq  %zmm15,%zmm9,%zmm9");
+
+		asm volatile ("vbroadcasti32x4 %0,%%zmm2" : : "m" (gfgenpshufb[l][0][0][0]));
+		asm volatile ("vbroadcasti32x4 %0,%%zmm11" : : "m" (gfgenpshufb[l][0][1][0]));
+		asm volatile ("vpshufb %zmm12,%zmm2,%zmm2");
+		asm volatile ("vpshufb %zmm9,%zmm11,%zmm11");
+		asm volatile ("vpxorq  %zmm11,%zmm2,%zmm2");
+
+		if (np > 3) {
+			asm volatile ("vbroadcasti32x4 %0,%%zmm3" : : "m" (gfgenpshufb[l][1][0][0]));
+			asm volatile ("vbroadcasti32x4 %0,%%zmm11" : : "m" (gfgenpshufb[l][1][1][0]));
+			asm volatile ("vpshufb %zmm12,%zmm3,%zmm3");
+			asm volatile ("vpshufb %zmm9,%zmm11,%zmm11");
+			asm volatile ("vpxorq  %zmm11,%zmm3,%zmm3");
+		}
+
+		if (np > 4) {
+			asm volatile ("vbroadcasti32x4 %0,%%zmm4" : : "m" (gfgenpshufb[l][2][0][0]));
+			asm volatile ("vbroadcasti32x4 %0,%%zmm11" : : "m" (gfgenpshufb[l][2][1][0]));
+			asm volatile ("vpshufb %zmm12,%zmm4,%zmm4");
+			asm volatile ("vpshufb %zmm9,%zmm11,%zmm11");
+			asm volatile ("vpxorq  %zmm11,%zmm4,%zmm4");
+		}
+
+		if (np > 5) {
+			asm volatile ("vbroadcasti32x4 %0,%%zmm5" : : "m" (gfgenpshufb[l][3][0][0]));
+			asm volatile ("vbroadcasti32x4 %0,%%zmm11" : : "m" (gfgenpshufb[l][3][1][0]));
+			asm volatile ("vpshufb %zmm12,%zmm5,%zmm5");
+			asm volatile ("vpshufb %zmm9,%zmm11,%zmm11");
+			asm volatile ("vpxorq  %zmm11,%zmm5,%zmm5");
+		}
+
+		if (np > 6) {
+			asm volatile ("vbroadcasti32x4 %0,%%zmm6" : : "m" (gfgenpshufb[l][4][0][0]));
+			asm volatile ("vbroadcasti32x4 %0,%%zmm11" : : "m" (gfgenpshufb[l][4][1][0]));
+			asm volatile ("vpshufb %zmm12,%zmm6,%zmm6");
+			asm volatile ("vpshufb %zmm9,%zmm11,%zmm11");
+			asm volatile ("vpxorq  %zmm11,%zmm6,%zmm6");
+		}
+
+		if (np > 7) {
+			asm volatile ("vbroadcasti32x4 %0,%%zmm7" : : "m" (gfgenpshufb[l][5][0][0]));
+			asm volatile ("vbroadcasti32x4 %0,%%zmm11" : : "m" (gfgenpshufb[l][5][1][0]));
+			asm volatile ("vpshufb %zmm12,%zmm7,%zmm7");
+			asm volatile ("vpshufb %zmm9,%zmm11,%zmm11");
+			asm volatile ("vpxorq  %zmm11,%zmm7,%zmm7");
+		}
+
+		/* intermediate disks */
+		for (d = l - 1; d > 0; --d) {
+			asm volatile ("vmovdqa64 %0,%%zmm8" : : "m" (v[d][i]));
+
+			asm volatile ("vpmovb2m %zmm1,%k1");
+			asm volatile ("vpaddb %zmm1,%zmm1,%zmm1");
+			asm volatile ("vmovdqu8 %zmm14,%zmm10{%k1}{z}");
+			asm volatile ("vpxorq %zmm8,%zmm0,%zmm0");
+			asm volatile ("vpternlogq $0x96,%zmm8,%zmm10,%zmm1");
+
+			asm volatile ("vpsrlw  $4,%zmm8,%zmm9");
+			asm volatile ("vpandq  %zmm15,%zmm8,%zmm12");
+			asm volatile ("vpandq  %zmm15,%zmm9,%zmm9");
+
+			asm volatile ("vbroadcasti32x4 %0,%%zmm10" : : "m" (gfgenpshufb[d][0][0][0]));
+			asm volatile ("vbroadcasti32x4 %0,%%zmm11" : : "m" (gfgenpshufb[d][0][1][0]));
+			asm volatile ("vpshufb %zmm12,%zmm10,%zmm10");
+			asm volatile ("vpshufb %zmm9,%zmm11,%zmm11");
+			asm volatile ("vpternlogq $0x96,%zmm11,%zmm10,%zmm2");
+
+			if (np > 3) {
+				asm volatile ("vbroadcasti32x4 %0,%%zmm10" : : "m" (gfgenpshufb[d][1][0][0]));
+				asm volatile ("vbroadcasti32x4 %0,%%zmm11" : : "m" (gfgenpshufb[d][1][1][0]));
+				asm volatile ("vpshufb %zmm12,%zmm10,%zmm10");
+				asm volatile ("vpshufb %zmm9,%zmm11,%zmm11");
+				asm volatile ("vpternlogq $0x96,%zmm11,%zmm10,%zmm3");
+			}
+
+			if (np > 4) {
+				asm volatile ("vbroadcasti32x4 %0,%%zmm10" : : "m" (gfgenpshufb[d][2][0][0]));
+				asm volatile ("vbroadcasti32x4 %0,%%zmm11" : : "m" (gfgenpshufb[d][2][1][0]));
+				asm volatile ("vpshufb %zmm12,%zmm10,%zmm10");
+				asm volatile ("vpshufb %zmm9,%zmm11,%zmm11");
+				asm volatile ("vpternlogq $0x96,%zmm11,%zmm10,%zmm4");
+			}
+
+			if (np > 5) {
+				asm volatile ("vbroadcasti32x4 %0,%%zmm10" : : "m" (gfgenpshufb[d][3][0][0]));
+				asm volatile ("vbroadcasti32x4 %0,%%zmm11" : : "m" (gfgenpshufb[d][3][1][0]));
+				asm volatile ("vpshufb %zmm12,%zmm10,%zmm10");
+				asm volatile ("vpshufb %zmm9,%zmm11,%zmm11");
+				asm volatile ("vpternlogq $0x96,%zmm11,%zmm10,%zmm5");
+			}
+
+			if (np > 6) {
+				asm volatile ("vbroadcasti32x4 %0,%%zmm10" : : "m" (gfgenpshufb[d][4][0][0]));
+				asm volatile ("vbroadcasti32x4 %0,%%zmm11" : : "m" (gfgenpshufb[d][4][1][0]));
+				asm volatile ("vpshufb %zmm12,%zmm10,%zmm10");
+				asm volatile ("vpshufb %zmm9,%zmm11,%zmm11");
+				asm volatile ("vpternlogq $0x96,%zmm11,%zmm10,%zmm6");
+			}
+
+			if (np > 7) {
+				asm volatile ("vbroadcasti32x4 %0,%%zmm10" : : "m" (gfgenpshufb[d][5][0][0]));
+				asm volatile ("vbroadcasti32x4 %0,%%zmm11" : : "m" (gfgenpshufb[d][5][1][0]));
+				asm volatile ("vpshufb %zmm12,%zmm10,%zmm10");
+				asm volatile ("vpshufb %zmm9,%zmm11,%zmm11");
+				asm volatile ("vpternlogq $0x96,%zmm11,%zmm10,%zmm7");
+			}
+		}
+
+		/* first disk with all coefficients at 1 */
+		asm volatile ("vmovdqa64 %0,%%zmm8" : : "m" (v[0][i]));
+
+		asm volatile ("vpmovb2m %zmm1,%k1");
+		asm volatile ("vpaddb %zmm1,%zmm1,%zmm1");
+		asm volatile ("vmovdqu8 %zmm14,%zmm10{%k1}{z}");
+		asm volatile ("vpxorq %zmm8,%zmm0,%zmm0");
+		asm volatile ("vpternlogq $0x96,%zmm8,%zmm10,%zmm1");
+		asm volatile ("vpxorq %zmm8,%zmm2,%zmm2");
+		if (np > 3)
+			asm volatile ("vpxorq %zmm8,%zmm3,%zmm3");
+		if (np > 4)
+			asm volatile ("vpxorq %zmm8,%zmm4,%zmm4");
+		if (np > 5)
+			asm volatile ("vpxorq %zmm8,%zmm5,%zmm5");
+		if (np > 6)
+			asm volatile ("vpxorq %zmm8,%zmm6,%zmm6");
+		if (np > 7)
+			asm volatile ("vpxorq %zmm8,%zmm7,%zmm7");
+
+		if (nt) {
+			asm volatile ("vmovntdq %%zmm0,%0" : "=m" (p[0][i]));
+			asm volatile ("vmovntdq %%zmm1,%0" : "=m" (p[1][i]));
+			asm volatile ("vmovntdq %%zmm2,%0" : "=m" (p[2][i]));
+			if (np > 3)
+				asm volatile ("vmovntdq %%zmm3,%0" : "=m" (p[3][i]));
+			if (np > 4)
+				asm volatile ("vmovntdq %%zmm4,%0" : "=m" (p[4][i]));
+			if (np > 5)
+				asm volatile ("vmovntdq %%zmm5,%0" : "=m" (p[5][i]));
+			if (np > 6)
+				asm volatile ("vmovntdq %%zmm6,%0" : "=m" (p[6][i]));
+			if (np > 7)
+				asm volatile ("vmovntdq %%zmm7,%0" : "=m" (p[7][i]));
+		} else {
+			asm volatile ("vmovdqa64 %%zmm0,%0" : "=m" (p[0][i]));
+			asm volatile ("vmovdqa64 %%zmm1,%0" : "=m" (p[1][i]));
+			asm volatile ("vmovdqa64 %%zmm2,%0" : "=m" (p[2][i]));
+			if (np > 3)
+				asm volatile ("vmovdqa64 %%zmm3,%0" : "=m" (p[3][i]));
+			if (np > 4)
+				asm volatile ("vmovdqa64 %%zmm4,%0" : "=m" (p[4][i]));
+			if (np > 5)
+				asm volatile ("vmovdqa64 %%zmm5,%0" : "=m" (p[5][i]));
+			if (np > 6)
+				asm volatile ("vmovdqa64 %%zmm6,%0" : "=m" (p[6][i]));
+			if (np > 7)
+				asm volatile ("vmovdqa64 %%zmm7,%0" : "=m" (p[7][i]));
+		}
+	}
+
+	raid_avx_end();
+}
+
+/*
+ * GEN3 (triple parity with Cauchy matrix) AVX512BW implementation
+ */
+void raid_gen3_avx512bwext(int nd, size_t size, void **vv)
+{
+	raid_genX_avx512bwext(3, 1, nd, size, vv);
+}
+
+void raid_gen3_avx512bwext_temporal(int nd, size_t size, void **vv)
+{
+	raid_genX_avx512bwext(3, 0, nd, size, vv);
+}
+
+/*
+ * GEN4 (quad parity with Cauchy matrix) AVX512BW implementation
+ */
+void raid_gen4_avx512bwext(int nd, size_t size, void **vv)
+{
+	raid_genX_avx512bwext(4, 1, nd, size, vv);
+}
+
+void raid_gen4_avx512bwext_temporal(int nd, size_t size, void **vv)
+{
+	raid_genX_avx512bwext(4, 0, nd, size, vv);
+}
+
+/*
+ * GEN5 (penta parity with Cauchy matrix) AVX512BW implementation
+ */
+void raid_gen5_avx512bwext(int nd, size_t size, void **vv)
+{
+	raid_genX_avx512bwext(5, 1, nd, size, vv);
+}
+
+void raid_gen5_avx512bwext_temporal(int nd, size_t size, void **vv)
+{
+	raid_genX_avx512bwext(5, 0, nd, size, vv);
+}
+
+/*
+ * GEN6 (hexa parity with Cauchy matrix) AVX512BW implementation
+ */
+void raid_gen6_avx512bwext(int nd, size_t size, void **vv)
+{
+	raid_genX_avx512bwext(6, 1, nd, size, vv);
+}
+
+void raid_gen6_avx512bwext_temporal(int nd, size_t size, void **vv)
+{
+	raid_genX_avx512bwext(6, 0, nd, size, vv);
+}
+
+/*
+ * GEN7 (hepta parity with Cauchy matrix) AVX512BW implementation
+ */
+void raid_gen7_avx512bwext(int nd, size_t size, void **vv)
+{
+	raid_genX_avx512bwext(7, 1, nd, size, vv);
+}
+
+void raid_gen7_avx512bwext_temporal(int nd, size_t size, void **vv)
+{
+	raid_genX_avx512bwext(7, 0, nd, size, vv);
+}
+
+/*
+ * GEN8 (octa parity with Cauchy matrix) AVX512BW implementation
+ */
+void raid_gen8_avx512bwext(int nd, size_t size, void **vv)
+{
+	raid_genX_avx512bwext(8, 1, nd, size, vv);
+}
+
+void raid_gen8_avx512bwext_temporal(int nd, size_t size, void **vv)
+{
+	raid_genX_avx512bwext(8, 0, nd, size, vv);
+}
+#endif
+
+#if defined(CONFIG_X86) && defined(CONFIG_SSSE3)
+/*
+ * RAID recovering for one disk SSSE3 implementation
+ */
+void raid_rec1_ssse3(int nr, int *id, int *ip, int nd, size_t size, void **vv)
+{
+	uint8_t **v = (uint8_t **)vv;
+	uint8_t *p;
+	uint8_t *pa;
+	uint8_t G;
+	uint8_t V;
+	size_t i;
+
+	(void)nr; /* unused, it's always 1 */
+
+	/* if it's RAID5 uses the faster function */
+	if (ip[0] == 0) {
+		raid_rec1of1(id, nd, size, vv);
+		return;
+	}
+
+	/* setup the coefficients matrix */
+	G = A(ip[0], id[0]);
+
+	/* invert it to solve the system of linear equations */
+	V = inv(G);
+
+	/* compute delta parity */
+	raid_delta_gen(1, id, ip, nd, size, vv);
+
+	p = v[nd + ip[0]];
+	pa = v[id[0]];
+
+	raid_sse_begin();
+
+	asm volatile ("movdqa %0,%%xmm7" : : "m" (gfconst16.low4[0]));
+	asm volatile ("movdqa %0,%%xmm4" : : "m" (gfmulpshufb[V][0][0]));
+	asm volatile ("movdqa %0,%%xmm5" : : "m" (gfmulpshufb[V][1][0]));
+
+	for (i = 0; i < size; i += 16) {
+		asm volatile ("movdqa %0,%%xmm0" : : "m" (p[i]));
+		asm volatile ("movdqa %0,%%xmm1" : : "m" (pa[i]));
+		asm volatile ("movdqa %xmm4,%xmm2");
+		asm volatile ("movdqa %xmm5,%xmm3");
+		asm volatile ("pxor   %xmm0,%xmm1");
+		asm volatile ("movdqa %xmm1,%xmm0");
+		asm volatile ("psrlw  $4,%xmm1");
+		asm volatile ("pand   %xmm7,%xmm0");
+		asm volatile ("pand   %xmm7,%xmm1");
+		asm volatile ("pshufb %xmm0,%xmm2");
+		asm volatile ("pshufb %xmm1,%xmm3");
+		asm volatile ("pxor   %xmm3,%xmm2");
+		asm volatile ("movdqa %%xmm2,%0" : "=m" (pa[i]));
+	}
+
+	raid_sse_end();
+}
+#endif
+
+#if defined(CONFIG_X86) && defined(CONFIG_SSSE3)
+/*
+ * RAID recovering for two disks SSSE3 implementation
+ */
+void raid_rec2_ssse3(int nr, int *id, int *ip, int nd, size_t size, void **vv)
+{
+	uint8_t **v = (uint8_t **)vv;
+	const int N = 2;
+	uint8_t *p[N];
+	uint8_t *pa[N];
+	const uint8_t *V;
+	size_t i;
+	int j;
+
+	(void)nr; /* unused, it's always 2 */
+
+	/* get the inverted coefficients matrix to solve the system of linear equations */
+	V = raid_rec_matrix(N, id, ip);
+
+	/* compute delta parity */
+	raid_delta_gen(N, id, ip, nd, size, vv);
+
+	for (j = 0; j < N; ++j) {
+		p[j] = v[nd + ip[j]];
+		pa[j] = v[id[j]];
+	}
+
+	raid_sse_begin();
+
+	asm volatile ("movdqa %0,%%xmm7" : : "m" (gfconst16.low4[0]));
+
+	for (i = 0; i < size; i += 16) {
+		asm volatile ("movdqa %0,%%xmm0" : : "m" (p[0][i]));
+		asm volatile ("movdqa %0,%%xmm2" : : "m" (pa[0][i]));
+		asm volatile ("movdqa %0,%%xmm1" : : "m" (p[1][i]));
+		asm volatile ("movdqa %0,%%xmm3" : : "m" (pa[1][i]));
+		asm volatile ("pxor   %xmm2,%xmm0");
+		asm volatile ("pxor   %xmm3,%xmm1");
+
+		asm volatile ("pxor %xmm6,%xmm6");
+
+		asm volatile ("movdqa %0,%%xmm2" : : "m" (gfmulpshufb[V[0]][0][0]));
+		asm volatile ("movdqa %0,%%xmm3" : : "m" (gfmulpshufb[V[0]][1][0]));
+		asm volatile ("movdqa %xmm0,%xmm4");
+		asm volatile ("movdqa %xmm0,%xmm5");
+		asm volatile ("psrlw  $4,%xmm5");
+		asm volatile ("pand   %xmm7,%xmm4");
+		asm volatile ("pand   %xmm7,%xmm5");
+		asm volatile ("pshufb %xmm4,%xmm2");
+		asm volatile ("pshufb %xmm5,%xmm3");
+		asm volatile ("pxor   %xmm2,%xmm6");
+		asm volatile ("pxor   %xmm3,%xmm6");
+
+		asm volatile ("movdqa %0,%%xmm2" : : "m" (gfmulpshufb[V[1]][0][0]));
+		asm volatile ("movdqa %0,%%xmm3" : : "m" (gfmulpshufb[V[1]][1][0]));
+		asm volatile ("movdqa %xmm1,%xmm4");
+		asm volatile ("movdqa %xmm1,%xmm5");
+		asm volatile ("psrlw  $4,%xmm5");
+		asm volatile ("pand   %xmm7,%xmm4");
+		asm volatile ("pand   %xmm7,%xmm5");
+		asm volatile ("pshufb %xmm4,%xmm2");
+		asm volatile ("pshufb %xmm5,%xmm3");
+		asm volatile ("pxor   %xmm2,%xmm6");
+		asm volatile ("pxor   %xmm3,%xmm6");
+
+		asm volatile ("movdqa %%xmm6,%0" : "=m" (pa[0][i]));
+
+		asm volatile ("pxor %xmm6,%xmm6");
+
+		asm volatile ("movdqa %0,%%xmm2" : : "m" (gfmulpshufb[V[2]][0][0]));
+		asm volatile ("movdqa %0,%%xmm3" : : "m" (gfmulpshufb[V[2]][1][0]));
+		asm volatile ("movdqa %xmm0,%xmm4");
+		asm volatile ("movdqa %xmm0,%xmm5");
+		asm volatile ("psrlw  $4,%xmm5");
+		asm volatile ("pand   %xmm7,%xmm4");
+		asm volatile ("pand   %xmm7,%xmm5");
+		asm volatile ("pshufb %xmm4,%xmm2");
+		asm volatile ("pshufb %xmm5,%xmm3");
+		asm volatile ("pxor   %xmm2,%xmm6");
+		asm volatile ("pxor   %xmm3,%xmm6");
+
+		asm volatile ("movdqa %0,%%xmm2" : : "m" (gfmulpshufb[V[3]][0][0]));
+		asm volatile ("movdqa %0,%%xmm3" : : "m" (gfmulpshufb[V[3]][1][0]));
+		asm volatile ("movdqa %xmm1,%xmm4");
 		asm volatile ("movdqa %xmm1,%xmm5");
 		asm volatile ("psrlw  $4,%xmm5");
 		asm volatile ("pand   %xmm7,%xmm4");
@@ -2155,20 +3750,14 @@ void raid_recX_ssse3(int nr, int *id, int *ip, int nd, size_t size, void **vv)
 	int N = nr;
 	uint8_t *p[RAID_PARITY_MAX];
 	uint8_t *pa[RAID_PARITY_MAX];
-	uint8_t G[RAID_PARITY_MAX * RAID_PARITY_MAX];
-	uint8_t V[RAID_PARITY_MAX * RAID_PARITY_MAX];
+	const uint8_t *V;
 	uint8_t buffer[RAID_PARITY_MAX*16+16];
 	uint8_t *pd = __align_ptr(buffer, 16);
 	size_t i;
 	int j, k;
 
-	/* setup the coefficients matrix */
-	for (j = 0; j < N; ++j)
-		for (k = 0; k < N; ++k)
-			G[j * N + k] = A(ip[j], id[k]);
-
-	/* invert it to solve the system of linear equations */
-	raid_invert(G, V, N);
+	/* get the inverted coefficients matrix to solve the system of linear equations */
+	V = raid_rec_matrix(N, id, ip);
 
 	/* compute delta parity */
 	raid_delta_gen(N, id, ip, nd, size, vv);
@@ -2287,20 +3876,14 @@ void raid_rec2_avx2(int nr, int *id, int *ip, int nd, size_t size, void **vv)
 	const int N = 2;
 	uint8_t *p[N];
 	uint8_t *pa[N];
-	uint8_t G[N * N];
-	uint8_t V[N * N];
+	const uint8_t *V;
 	size_t i;
-	int j, k;
+	int j;
 
 	(void)nr; /* unused, it's always 2 */
 
-	/* setup the coefficients matrix */
-	for (j = 0; j < N; ++j)
-		for (k = 0; k < N; ++k)
-			G[j * N + k] = A(ip[j], id[k]);
-
-	/* invert it to solve the system of linear equations */
-	raid_invert(G, V, N);
+	/* get the inverted coefficients matrix to solve the system of linear equations */
+	V = raid_rec_matrix(N, id, ip);
 
 	/* compute delta parity */
 	raid_delta_gen(N, id, ip, nd, size, vv);
@@ -2385,20 +3968,14 @@ void raid_recX_avx2(int nr, int *id, int *ip, int nd, size_t size, void **vv)
 	int N = nr;
 	uint8_t *p[RAID_PARITY_MAX];
 	uint8_t *pa[RAID_PARITY_MAX];
-	uint8_t G[RAID_PARITY_MAX * RAID_PARITY_MAX];
-	uint8_t V[RAID_PARITY_MAX * RAID_PARITY_MAX];
+	const uint8_t *V;
 	uint8_t buffer[RAID_PARITY_MAX*32+32];
 	uint8_t *pd = __align_ptr(buffer, 32);
 	size_t i;
 	int j, k;
 
-	/* setup the coefficients matrix */
-	for (j = 0; j < N; ++j)
-		for (k = 0; k < N; ++k)
-			G[j * N + k] = A(ip[j], id[k]);
-
-	/* invert it to solve the system of linear equations */
-	raid_invert(G, V, N);
+	/* get the inverted coefficients matrix to solve the system of linear equations */
+	V = raid_rec_matrix(N, id, ip);
 
 	/* compute delta parity */
 	raid_delta_gen(N, id, ip, nd, size, vv);
@@ -2450,3 +4027,356 @@ void raid_recX_avx2(int nr, int *id, int *ip, int nd, size_t size, void **vv)
 }
 #endif
 
+#if defined(CONFIG_X86) && defined(CONFIG_AVX512BW)
+/*
+ * RAID recovering for one disk AVX512BW implementation
+ */
+void raid_rec1_avx512bw(int nr, int *id, int *ip, int nd, size_t size, void **vv)
+{
+	uint8_t **v = (uint8_t **)vv;
+	uint8_t *p;
+	uint8_t *pa;
+	uint8_t G;
+	uint8_t V;
+	size_t i;
+
+	(void)nr; /* unused, it's always 1 */
+
+	/* if it's RAID5 uses the faster function */
+	if (ip[0] == 0) {
+		raid_rec1of1(id, nd, size, vv);
+		return;
+	}
+
+	/* setup the coefficients matrix */
+	G = A(ip[0], id[0]);
+
+	/* invert it to solve the system of linear equations */
+	V = inv(G);
+
+	/* compute delta parity */
+	raid_delta_gen(1, id, ip, nd, size, vv);
+
+	p = v[nd + ip[0]];
+	pa = v[id[0]];
+
+	raid_avx_begin();
+
+	asm volatile ("vbroadcasti32x4 %0,%%zmm7" : : "m" (gfconst16.low4[0]));
+	asm volatile ("vbroadcasti32x4 %0,%%zmm4" : : "m" (gfmulpshufb[V][0][0]));
+	asm volatile ("vbroadcasti32x4 %0,%%zmm5" : : "m" (gfmulpshufb[V][1][0]));
+
+	for (i = 0; i < size; i += 64) {
+		asm volatile ("vmovdqa64 %0,%%zmm0" : : "m" (p[i]));
+		asm volatile ("vpxorq  %0,%%zmm0,%%zmm0" : : "m" (pa[i]));
+		asm volatile ("vpsrlw  $4,%zmm0,%zmm1");
+		asm volatile ("vpandq  %zmm7,%zmm0,%zmm0");
+		asm volatile ("vpandq  %zmm7,%zmm1,%zmm1");
+		asm volatile ("vpshufb %zmm0,%zmm4,%zmm2");
+		asm volatile ("vpshufb %zmm1,%zmm5,%zmm3");
+		asm volatile ("vpxorq  %zmm3,%zmm2,%zmm2");
+		asm volatile ("vmovdqa64 %%zmm2,%0" : "=m" (pa[i]));
+	}
+
+	raid_avx_end();
+}
+#endif
+
+#if defined(CONFIG_X86) && defined(CONFIG_AVX512BW)
+/*
+ * RAID recovering AVX512BW implementation
+ */
+void raid_recX_avx512bw(int nr, int *id, int *ip, int nd, size_t size, void **vv)
+{
+	uint8_t **v = (uint8_t **)vv;
+	int N = nr;
+	uint8_t *p[RAID_PARITY_MAX];
+	uint8_t *pa[RAID_PARITY_MAX];
+	const uint8_t *V;
+	uint8_t buffer[RAID_PARITY_MAX*64+64];
+	uint8_t *pd = __align_ptr(buffer, 64);
+	size_t i;
+	int j, k;
+
+	/* get the inverted coefficients matrix to solve the system of linear equations */
+	V = raid_rec_matrix(N, id, ip);
+
+	/* compute delta parity */
+	raid_delta_gen(N, id, ip, nd, size, vv);
+
+	for (j = 0; j < N; ++j) {
+		p[j] = v[nd + ip[j]];
+		pa[j] = v[id[j]];
+	}
+
+	raid_avx_begin();
+
+	asm volatile ("vbroadcasti32x4 %0,%%zmm7" : : "m" (gfconst16.low4[0]));
+
+	for (i = 0; i < size; i += 64) {
+		/* delta */
+		for (j = 0; j < N; ++j) {
+			asm volatile ("vmovdqa64 %0,%%zmm0" : : "m" (p[j][i]));
+			asm volatile ("vpxorq  %0,%%zmm0,%%zmm0" : : "m" (pa[j][i]));
+			asm volatile ("vmovdqa64 %%zmm0,%0" : "=m" (pd[j*64]));
+		}
+
+		/* reconstruct */
+		for (j = 0; j < N; ++j) {
+			asm volatile ("vpxorq %zmm0,%zmm0,%zmm0");
+
+			for (k = 0; k < N; ++k) {
+				uint8_t m = V[j * N + k];
+
+				asm volatile ("vbroadcasti32x4 %0,%%zmm2" : : "m" (gfmulpshufb[m][0][0]));
+				asm volatile ("vbroadcasti32x4 %0,%%zmm3" : : "m" (gfmulpshufb[m][1][0]));
+				asm volatile ("vmovdqa64 %0,%%zmm4" : : "m" (pd[k*64]));
+				asm volatile ("vpsrlw  $4,%zmm4,%zmm5");
+				asm volatile ("vpandq  %zmm7,%zmm4,%zmm4");
+				asm volatile ("vpandq  %zmm7,%zmm5,%zmm5");
+				asm volatile ("vpshufb %zmm4,%zmm2,%zmm2");
+				asm volatile ("vpshufb %zmm5,%zmm3,%zmm3");
+				asm volatile ("vpternlogq $0x96,%zmm3,%zmm2,%zmm0");
+			}
+
+			asm volatile ("vmovdqa64 %%zmm0,%0" : "=m" (pa[j][i]));
+		}
+	}
+
+	raid_avx_end();
+}
+#endif
+
+#if defined(CONFIG_X86) && defined(CONFIG_GFNI)
+/*
+ * RAID recovering for one disk GFNI implementation
+ */
+void raid_rec1_gfni(int nr, int *id, int *ip, int nd, size_t size, void **vv)
+{
+	uint8_t **v = (uint8_t **)vv;
+	uint8_t *p;
+	uint8_t *pa;
+	uint8_t G;
+	uint8_t V;
+	size_t i;
+
+	(void)nr; /* unused, it's always 1 */
+
+	/* if it's RAID5 uses the faster function */
+	if (ip[0] == 0) {
+		raid_rec1of1(id, nd, size, vv);
+		return;
+	}
+
+	/* setup the coefficients matrix */
+	G = A(ip[0], id[0]);
+
+	/* invert it to solve the system of linear equations */
+	V = inv(G);
+
+	/* compute delta parity */
+	raid_delta_gen(1, id, ip, nd, size, vv);
+
+	p = v[nd + ip[0]];
+	pa = v[id[0]];
+
+	raid_avx_begin();
+
+	asm volatile ("vpbroadcastq %0,%%zmm7" : : "m" (gfmulaffine[V]));
+
+	for (i = 0; i < size; i += 64) {
+		asm volatile ("vmovdqa64 %0,%%zmm0" : : "m" (p[i]));
+		asm volatile ("vpxorq %0,%%zmm0,%%zmm0" : : "m" (pa[i]));
+		asm volatile ("vgf2p8affineqb $0,%zmm7,%zmm0,%zmm0");
+		asm volatile ("vmovdqa64 %%zmm0,%0" : "=m" (pa[i]));
+	}
+
+	raid_avx_end();
+}
+#endif
+
+#if defined(CONFIG_X86) && defined(CONFIG_GFNI)
+/*
+ * RAID recovering GFNI implementation
+ */
+void raid_recX_gfni(int nr, int *id, int *ip, int nd, size_t size, void **vv)
+{
+	uint8_t **v = (uint8_t **)vv;
+	int N = nr;
+	uint8_t *p[RAID_PARITY_MAX];
+	uint8_t *pa[RAID_PARITY_MAX];
+	const uint8_t *V;
+	uint8_t buffer[RAID_PARITY_MAX*64+64];
+	uint8_t *pd = __align_ptr(buffer, 64);
+	size_t i;
+	int j, k;
+
+	/* get the inverted coefficients matrix to solve the system of linear equations */
+	V = raid_rec_matrix(N, id, ip);
+
+	/* compute delta parity */
+	raid_delta_gen(N, id, ip, nd, size, vv);
+
+	for (j = 0; j < N; ++j) {
+		p[j] = v[nd + ip[j]];
+		pa[j] = v[id[j]];
+	}
+
+	raid_avx_begin();
+
+	for (i = 0; i < size; i += 64) {
+		/* delta */
+		for (j = 0; j < N; ++j) {
+			asm volatile ("vmovdqa64 %0,%%zmm0" : : "m" (p[j][i]));
+			asm volatile ("vpxorq %0,%%zmm0,%%zmm0" : : "m" (pa[j][i]));
+			asm volatile ("vmovdqa64 %%zmm0,%0" : "=m" (pd[j*64]));
+		}
+
+		/* reconstruct */
+		for (j = 0; j < N; ++j) {
+			asm volatile ("vpxorq %zmm0,%zmm0,%zmm0");
+
+			for (k = 0; k < N; ++k) {
+				uint8_t m = V[j * N + k];
+
+				asm volatile ("vmovdqa64 %0,%%zmm1" : : "m" (pd[k*64]));
+				asm volatile ("vgf2p8affineqb $0,%0%{1to8%},%%zmm1,%%zmm1" : : "m" (gfmulaffine[m]));
+				asm volatile ("vpxorq %zmm1,%zmm0,%zmm0");
+			}
+
+			asm volatile ("vmovdqa64 %%zmm0,%0" : "=m" (pa[j][i]));
+		}
+	}
+
+	raid_avx_end();
+}
+#endif
+
+
+#if defined(CONFIG_X86) && defined(CONFIG_SSSE3)
+/*
+ * Parity update SSSE3 implementation
+ */
+void raid_add_ssse3(int id, int np, size_t size, void **vv)
+{
+	uint8_t **v = (uint8_t **)vv;
+	const uint8_t *T[RAID_PARITY_MAX];
+	uint8_t *d;
+	size_t i;
+	int j;
+
+	d = v[0];
+
+	for (j = 1; j < np; ++j)
+		T[j] = gfmulpshufb[gfgen[j][id]][0];
+
+	raid_sse_begin();
+
+	asm volatile ("movdqa %0,%%xmm7" : : "m" (gfconst16.low4[0]));
+
+	for (i = 0; i < size; i += 16) {
+		asm volatile ("movdqa %0,%%xmm0" : : "m" (d[i]));
+		asm volatile ("movdqa %0,%%xmm2" : : "m" (v[1][i]));
+		asm volatile ("pxor   %xmm0,%xmm2");
+		asm volatile ("movdqa %%xmm2,%0" : "=m" (v[1][i]));
+
+		asm volatile ("movdqa %xmm0,%xmm1");
+		asm volatile ("psrlw  $4,%xmm1");
+		asm volatile ("pand   %xmm7,%xmm0");
+		asm volatile ("pand   %xmm7,%xmm1");
+
+		for (j = 1; j < np; ++j) {
+			asm volatile ("movdqa %0,%%xmm2" : : "m" (T[j][0]));
+			asm volatile ("movdqa %0,%%xmm3" : : "m" (T[j][16]));
+			asm volatile ("pshufb %xmm0,%xmm2");
+			asm volatile ("pshufb %xmm1,%xmm3");
+			asm volatile ("pxor   %xmm3,%xmm2");
+			asm volatile ("pxor   %0,%%xmm2" : : "m" (v[1 + j][i]));
+			asm volatile ("movdqa %%xmm2,%0" : "=m" (v[1 + j][i]));
+		}
+	}
+
+	raid_sse_end();
+}
+#endif
+
+#if defined(CONFIG_X86) && defined(CONFIG_AVX2)
+/*
+ * Parity update AVX2 implementation
+ */
+void raid_add_avx2(int id, int np, size_t size, void **vv)
+{
+	uint8_t **v = (uint8_t **)vv;
+	const uint8_t *T[RAID_PARITY_MAX];
+	uint8_t *d;
+	size_t i;
+	int j;
+
+	d = v[0];
+
+	for (j = 1; j < np; ++j)
+		T[j] = gfmulpshufb[gfgen[j][id]][0];
+
+	raid_avx_begin();
+
+	asm volatile ("vbroadcasti128 %0,%%ymm7" : : "m" (gfconst16.low4[0]));
+
+	for (i = 0; i < size; i += 32) {
+		asm volatile ("vmovdqa %0,%%ymm0" : : "m" (d[i]));
+		asm volatile ("vpxor   %0,%%ymm0,%%ymm2" : : "m" (v[1][i]));
+		asm volatile ("vmovdqa %%ymm2,%0" : "=m" (v[1][i]));
+
+		asm volatile ("vpsrlw  $4,%ymm0,%ymm1");
+		asm volatile ("vpand   %ymm7,%ymm0,%ymm0");
+		asm volatile ("vpand   %ymm7,%ymm1,%ymm1");
+
+		for (j = 1; j < np; ++j) {
+			asm volatile ("vbroadcasti128 %0,%%ymm2" : : "m" (T[j][0]));
+			asm volatile ("vbroadcasti128 %0,%%ymm3" : : "m" (T[j][16]));
+			asm volatile ("vpshufb %ymm0,%ymm2,%ymm2");
+			asm volatile ("vpshufb %ymm1,%ymm3,%ymm3");
+			asm volatile ("vpxor   %ymm3,%ymm2,%ymm2");
+			asm volatile ("vpxor   %0,%%ymm2,%%ymm2" : : "m" (v[1 + j][i]));
+			asm volatile ("vmovdqa %%ymm2,%0" : "=m" (v[1 + j][i]));
+		}
+	}
+
+	raid_avx_end();
+}
+#endif
+
+#if defined(CONFIG_X86) && defined(CONFIG_GFNI)
+/*
+ * Parity update GFNI implementation
+ */
+void raid_add_gfni(int id, int np, size_t size, void **vv)
+{
+	uint8_t **v = (uint8_t **)vv;
+	const uint64_t *T[RAID_PARITY_MAX];
+	uint8_t *d;
+	size_t i;
+	int j;
+
+	d = v[0];
+
+	for (j = 1; j < np; ++j)
+		T[j] = &gfmulaffine[gfgen[j][id]];
+
+	raid_avx_begin();
+
+	for (i = 0; i < size; i += 64) {
+		asm volatile ("vmovdqa64 %0,%%zmm0" : : "m" (d[i]));
+		asm volatile ("vpxorq %0,%%zmm0,%%zmm2" : : "m" (v[1][i]));
+		asm volatile ("vmovdqa64 %%zmm2,%0" : "=m" (v[1][i]));
+
+		for (j = 1; j < np; ++j) {
+			asm volatile ("vpbroadcastq %0,%%zmm1" : : "m" (*T[j]));
+			asm volatile ("vgf2p8affineqb $0,%zmm1,%zmm0,%zmm2");
+			asm volatile ("vpxorq %0,%%zmm2,%%zmm2" : : "m" (v[1 + j][i]));
+			asm volatile ("vmovdqa64 %%zmm2,%0" : "=m" (v[1 + j][i]));
+		}
+	}
+
+	raid_avx_end();
+}
+#endif
@@ -40,7 +40,7 @@ static const struct gfzconst16 {
 /*
  * GENz (triple parity with powers of 2^-1) SSE2 implementation
  */
-void raid_genz_sse2(int nd, size_t size, void **vv)
+static __always_inline void raid_genz_sse2_store(int nt, int nd, size_t size, void **vv)
 {
 	uint8_t **v = (uint8_t**)vv;
 	uint8_t *p;
@@ -85,13 +85,29 @@ void raid_genz_sse2(int nd, size_t size, void **vv)
 			asm volatile ("pxor %xmm4,%xmm1");
 			asm volatile ("pxor %xmm4,%xmm2");
 		}
-		asm volatile ("movntdq %%xmm0,%0" : "=m" (p[i]));
-		asm volatile ("movntdq %%xmm1,%0" : "=m" (q[i]));
-		asm volatile ("movntdq %%xmm2,%0" : "=m" (r[i]));
+		if (nt) {
+			asm volatile ("movntdq %%xmm0,%0" : "=m" (p[i]));
+			asm volatile ("movntdq %%xmm1,%0" : "=m" (q[i]));
+			asm volatile ("movntdq %%xmm2,%0" : "=m" (r[i]));
+		} else {
+			asm volatile ("movdqa %%xmm0,%0" : "=m" (p[i]));
+			asm volatile ("movdqa %%xmm1,%0" : "=m" (q[i]));
+			asm volatile ("movdqa %%xmm2,%0" : "=m" (r[i]));
+		}
 	}
 
 	raid_sse_end();
 }
+
+void raid_genz_sse2(int nd, size_t size, void **vv)
+{
+	raid_genz_sse2_store(1, nd, size, vv);
+}
+
+void raid_genz_sse2_temporal(int nd, size_t size, void **vv)
+{
+	raid_genz_sse2_store(0, nd, size, vv);
+}
 #endif
 
 #if defined(CONFIG_X86_64) && defined(CONFIG_SSE2)
@@ -100,7 +116,7 @@ void raid_genz_sse2(int nd, size_t size, void **vv)
  *
  * Note that it uses 16 registers, meaning that x64 is required.
  */
-void raid_genz_sse2ext(int nd, size_t size, void **vv)
+static __always_inline void raid_genz_sse2ext_store(int nt, int nd, size_t size, void **vv)
 {
 	uint8_t **v = (uint8_t**)vv;
 	uint8_t *p;
@@ -164,16 +180,35 @@ void raid_genz_sse2ext(int nd, size_t size, void **vv)
 			asm volatile ("pxor %xmm12,%xmm9");
 			asm volatile ("pxor %xmm12,%xmm10");
 		}
-		asm volatile ("movntdq %%xmm0,%0" : "=m" (p[i]));
-		asm volatile ("movntdq %%xmm8,%0" : "=m" (p[i + 16]));
-		asm volatile ("movntdq %%xmm1,%0" : "=m" (q[i]));
-		asm volatile ("movntdq %%xmm9,%0" : "=m" (q[i + 16]));
-		asm volatile ("movntdq %%xmm2,%0" : "=m" (r[i]));
-		asm volatile ("movntdq %%xmm10,%0" : "=m" (r[i + 16]));
+		if (nt) {
+			asm volatile ("movntdq %%xmm0,%0" : "=m" (p[i]));
+			asm volatile ("movntdq %%xmm8,%0" : "=m" (p[i + 16]));
+			asm volatile ("movntdq %%xmm1,%0" : "=m" (q[i]));
+			asm volatile ("movntdq %%xmm9,%0" : "=m" (q[i + 16]));
+			asm volatile ("movntdq %%xmm2,%0" : "=m" (r[i]));
+			asm volatile ("movntdq %%xmm10,%0" : "=m" (r[i + 16]));
+		} else {
+			asm volatile ("movdqa %%xmm0,%0" : "=m" (p[i]));
+			asm volatile ("movdqa %%xmm8,%0" : "=m" (p[i + 16]));
+			asm volatile ("movdqa %%xmm1,%0" : "=m" (q[i]));
+			asm volatile ("movdqa %%xmm9,%0" : "=m" (q[i + 16]));
+			asm volatile ("movdqa %%xmm2,%0" : "=m" (r[i]));
+			asm volatile ("movdqa %%xmm10,%0" : "=m" (r[i + 16]));
+		}
 	}
 
 	raid_sse_end();
 }
+
+void raid_genz_sse2ext(int nd, size_t size, void **vv)
+{
+	raid_genz_sse2ext_store(1, nd, size, vv);
+}
+
+void raid_genz_sse2ext_temporal(int nd, size_t size, void **vv)
+{
+	raid_genz_sse2ext_store(0, nd, size, vv);
+}
 #endif
 
 #if defined(CONFIG_X86_64) && defined(CONFIG_AVX2)
@@ -182,7 +217,7 @@ void raid_genz_sse2ext(int nd, size_t size, void **vv)
  *
  * Note that it uses 16 registers, meaning that x64 is required.
  */
-void raid_genz_avx2ext(int nd, size_t size, void **vv)
+static __always_inline void raid_genz_avx2ext_store(int nt, int nd, size_t size, void **vv)
 {
 	uint8_t **v = (uint8_t**)vv;
 	uint8_t *p;
@@ -241,15 +276,34 @@ void raid_genz_avx2ext(int nd, size_t size, void **vv)
 			asm volatile ("vpxor %ymm12,%ymm9,%ymm9");
 			asm volatile ("vpxor %ymm12,%ymm10,%ymm10");
 		}
-		asm volatile ("vmovntdq %%ymm0,%0" : "=m" (p[i]));
-		asm volatile ("vmovntdq %%ymm8,%0" : "=m" (p[i + 32]));
-		asm volatile ("vmovntdq %%ymm1,%0" : "=m" (q[i]));
-		asm volatile ("vmovntdq %%ymm9,%0" : "=m" (q[i + 32]));
-		asm volatile ("vmovntdq %%ymm2,%0" : "=m" (r[i]));
-		asm volatile ("vmovntdq %%ymm10,%0" : "=m" (r[i + 32]));
+		if (nt) {
+			asm volatile ("vmovntdq %%ymm0,%0" : "=m" (p[i]));
+			asm volatile ("vmovntdq %%ymm8,%0" : "=m" (p[i + 32]));
+			asm volatile ("vmovntdq %%ymm1,%0" : "=m" (q[i]));
+			asm volatile ("vmovntdq %%ymm9,%0" : "=m" (q[i + 32]));
+			asm volatile ("vmovntdq %%ymm2,%0" : "=m" (r[i]));
+			asm volatile ("vmovntdq %%ymm10,%0" : "=m" (r[i + 32]));
+		} else {
+			asm volatile ("vmovdqa %%ymm0,%0" : "=m" (p[i]));
+			asm volatile ("vmovdqa %%ymm8,%0" : "=m" (p[i + 32]));
+			asm volatile ("vmovdqa %%ymm1,%0" : "=m" (q[i]));
+			asm volatile ("vmovdqa %%ymm9,%0" : "=m" (q[i + 32]));
+			asm volatile ("vmovdqa %%ymm2,%0" : "=m" (r[i]));
+			asm volatile ("vmovdqa %%ymm10,%0" : "=m" (r[i + 32]));
+		}
 	}
 
 	raid_avx_end();
 }
+
+void raid_genz_avx2ext(int nd, size_t size, void **vv)
+{
+	raid_genz_avx2ext_store(1, nd, size, vv);
+}
+
+void raid_genz_avx2ext_temporal(int nd, size_t size, void **vv)
+{
+	raid_genz_avx2ext_store(0, nd, size, vv);
+}
 #endif
 